@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * ISR runtime profiler.
+ *
+ * The architecture interrupt wrappers dispatch through the software ISR
+ * table, so instead of hooking every wrapper this file interposes on the
+ * table itself: early during boot, while interrupts are still disabled,
+ * every connected entry is redirected to a trampoline whose argument
+ * points to a shadow entry holding the original handler and the
+ * per-entry statistics. The per-invocation cost is two lock free cycle
+ * counter reads and a handful of arithmetic.
+ *
+ * Interrupts connected at runtime with irq_connect_dynamic() overwrite
+ * the trampoline of their table entry and are simply not profiled.
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sw_isr_table.h>
+#include <zephyr/debug/isr_prof.h>
+#include <errno.h>
+#include <string.h>
+
+struct isr_prof_entry {
+	void (*isr)(const void *arg);
+	const void *arg;
+	struct isr_prof_stats stats;
+};
+
+static struct isr_prof_entry isr_prof_table[IRQ_TABLE_SIZE];
+
+static uint32_t alarm_threshold;
+static isr_prof_alarm_cb_t alarm_cb;
+
+static void isr_prof_trampoline(const void *param)
+{
+	struct isr_prof_entry *entry = (struct isr_prof_entry *)param;
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+
+	entry->isr(entry->arg);
+
+	cycles = k_cycle_get_32() - start;
+
+	entry->stats.count++;
+	entry->stats.total_cycles += cycles;
+	if (cycles > entry->stats.max_cycles) {
+		entry->stats.max_cycles = cycles;
+
+		if ((alarm_cb != NULL) && (alarm_threshold != 0U) &&
+		    (cycles > alarm_threshold)) {
+			alarm_cb((unsigned int)(entry - isr_prof_table),
+				 cycles);
+		}
+	}
+}
+
+int isr_prof_stats_get(unsigned int table_idx, struct isr_prof_stats *stats)
+{
+	if (table_idx >= IRQ_TABLE_SIZE) {
+		return -EINVAL;
+	}
+
+	*stats = isr_prof_table[table_idx].stats;
+
+	return 0;
+}
+
+void isr_prof_reset(void)
+{
+	for (int i = 0; i < IRQ_TABLE_SIZE; i++) {
+		memset(&isr_prof_table[i].stats, 0,
+		       sizeof(isr_prof_table[i].stats));
+	}
+}
+
+void isr_prof_alarm_set(uint32_t threshold_cycles, isr_prof_alarm_cb_t cb)
+{
+	alarm_cb = NULL;
+	alarm_threshold = threshold_cycles;
+	alarm_cb = cb;
+}
+
+static int isr_prof_init(void)
+{
+	/* Interrupts are still globally disabled at this point, the table
+	 * can be rewritten without racing against dispatch.
+	 */
+	for (int i = 0; i < IRQ_TABLE_SIZE; i++) {
+		struct _isr_table_entry *entry = &_sw_isr_table[i];
+
+		if ((entry->isr == z_irq_spurious) || (entry->isr == NULL)) {
+			continue;
+		}
+
+		isr_prof_table[i].isr = entry->isr;
+		isr_prof_table[i].arg = entry->arg;
+
+		entry->arg = &isr_prof_table[i];
+		entry->isr = isr_prof_trampoline;
+	}
+
+	return 0;
+}
+
+SYS_INIT(isr_prof_init, PRE_KERNEL_1, 0);
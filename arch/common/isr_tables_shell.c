@@ -8,6 +8,12 @@
 #include <zephyr/shell/shell.h>
 #include <zephyr/sw_isr_table.h>
 
+#ifdef CONFIG_ISR_PROFILING
+#include <string.h>
+
+#include <zephyr/debug/isr_prof.h>
+#endif /* CONFIG_ISR_PROFILING */
+
 static void dump_isr_table_entry(const struct shell *sh, int idx, struct _isr_table_entry *entry)
 {
 
@@ -50,6 +56,40 @@ static int cmd_shared_sw_isr_table(const struct shell *sh, size_t argc, char **a
 }
 #endif /* CONFIG_SHARED_INTERRUPTS */
 
+#ifdef CONFIG_ISR_PROFILING
+static int cmd_isr_table_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") == 0) {
+			isr_prof_reset();
+			return 0;
+		}
+
+		shell_error(sh, "Unknown subcommand \"%s\"", argv[1]);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "%4s %10s %14s %12s", "idx", "count", "total cyc",
+		    "max cyc");
+
+	for (unsigned int idx = 0; idx < IRQ_TABLE_SIZE; idx++) {
+		struct isr_prof_stats stats;
+
+		(void)isr_prof_stats_get(idx, &stats);
+
+		if (stats.count == 0U) {
+			continue;
+		}
+
+		shell_print(sh, "%4u %10u %14llu %12u", idx, stats.count,
+			    (unsigned long long)stats.total_cycles,
+			    stats.max_cycles);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ISR_PROFILING */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(isr_table_cmds,
 			       SHELL_CMD_ARG(sw_isr_table, NULL,
 					     "Dump _sw_isr_table.\n"
@@ -61,6 +101,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(isr_table_cmds,
 					     "Usage: isr_table shared_sw_isr_table",
 					     cmd_shared_sw_isr_table, 1, 0),
 #endif /* CONFIG_SHARED_INTERRUPTS */
+#ifdef CONFIG_ISR_PROFILING
+			       SHELL_CMD_ARG(stats, NULL,
+					     "Dump or reset per-ISR runtime statistics.\n"
+					     "Usage: isr_table stats [reset]",
+					     cmd_isr_table_stats, 1, 1),
+#endif /* CONFIG_ISR_PROFILING */
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_ARG_REGISTER(isr_table, &isr_table_cmds, "ISR tables shell command",
@@ -16,26 +16,142 @@
 BUILD_ASSERT(CONFIG_SHARED_IRQ_MAX_NUM_CLIENTS >= 2,
 	     "maximum number of clients should be at least 2");
 
+#if defined(CONFIG_DYNAMIC_INTERRUPTS) || defined(CONFIG_SHARED_INTERRUPTS_PRECHECK)
+static struct k_spinlock lock;
+#endif
+
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+static void swap_clients(struct z_shared_isr_table_entry *shared_entry,
+			 size_t a, size_t b);
+
+/* Move the client that served the interrupt one position towards the
+ * front of the client list, so that the hottest source converges to the
+ * first probe while a single burst cannot reorder the whole list.
+ */
+static void promote_client(struct z_shared_isr_table_entry *entry, size_t idx,
+			   const struct _isr_table_entry *served)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* The list may have been modified between the unlocked dispatch
+	 * and here, only promote if the served client is still at idx.
+	 */
+	if ((idx > 0) && (idx < entry->client_num) &&
+	    (entry->clients[idx].isr == served->isr) &&
+	    (entry->clients[idx].arg == served->arg)) {
+		swap_clients(entry, idx, idx - 1);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_SHARED_INTERRUPTS_PRECHECK */
+
 void z_shared_isr(const void *data)
 {
 	size_t i;
 	const struct z_shared_isr_table_entry *entry;
 	const struct _isr_table_entry *client;
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	struct _isr_table_entry served = { NULL, NULL };
+	size_t served_idx = 0;
+#endif
 
 	entry = data;
 
 	for (i = 0; i < entry->client_num; i++) {
 		client = &entry->clients[i];
 
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+		if (entry->precheck[i] != NULL) {
+			if (!entry->precheck[i](client->arg)) {
+				continue;
+			}
+
+			if (served.isr == NULL) {
+				served_idx = i;
+				served = *client;
+			}
+		}
+#endif
+
 		if (client->isr) {
 			client->isr(client->arg);
 		}
 	}
+
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	if ((served.isr != NULL) && (served_idx > 0)) {
+		promote_client((struct z_shared_isr_table_entry *)entry,
+			       served_idx, &served);
+	}
+#endif
 }
 
-#ifdef CONFIG_DYNAMIC_INTERRUPTS
+#if defined(CONFIG_DYNAMIC_INTERRUPTS) || defined(CONFIG_SHARED_INTERRUPTS_PRECHECK)
 
-static struct k_spinlock lock;
+static void swap_clients(struct z_shared_isr_table_entry *shared_entry,
+			 size_t a, size_t b)
+{
+	struct _isr_table_entry tmp = shared_entry->clients[a];
+
+	shared_entry->clients[a] = shared_entry->clients[b];
+	shared_entry->clients[b] = tmp;
+
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	bool (*tmp_precheck)(const void *) = shared_entry->precheck[a];
+
+	shared_entry->precheck[a] = shared_entry->precheck[b];
+	shared_entry->precheck[b] = tmp_precheck;
+#endif
+}
+
+#endif /* CONFIG_DYNAMIC_INTERRUPTS || CONFIG_SHARED_INTERRUPTS_PRECHECK */
+
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+
+int z_shared_irq_set_precheck(unsigned int irq, void (*routine)(const void *),
+			      const void *parameter,
+			      bool (*precheck)(const void *arg))
+{
+	struct z_shared_isr_table_entry *shared_entry;
+	unsigned int table_idx;
+	k_spinlock_key_t key;
+	size_t i;
+	int ret = -ENOENT;
+
+	table_idx = z_get_sw_isr_table_idx(irq);
+
+	/* check for out of bounds table index */
+	if (table_idx >= IRQ_TABLE_SIZE) {
+		return -EINVAL;
+	}
+
+	shared_entry = &z_shared_sw_isr_table[table_idx];
+
+	key = k_spin_lock(&lock);
+
+	if (!shared_entry->client_num) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	for (i = 0; i < shared_entry->client_num; i++) {
+		if ((shared_entry->clients[i].isr == routine) &&
+		    (shared_entry->clients[i].arg == parameter)) {
+			shared_entry->precheck[i] = precheck;
+			ret = 0;
+			break;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+#endif /* CONFIG_SHARED_INTERRUPTS_PRECHECK */
+
+#ifdef CONFIG_DYNAMIC_INTERRUPTS
 
 void z_isr_install(unsigned int irq, void (*routine)(const void *),
 		   const void *param)
@@ -81,6 +197,9 @@ void z_isr_install(unsigned int irq, void (*routine)(const void *),
 		 */
 		shared_entry->clients[shared_entry->client_num].isr = entry->isr;
 		shared_entry->clients[shared_entry->client_num].arg = entry->arg;
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+		shared_entry->precheck[shared_entry->client_num] = NULL;
+#endif
 
 		shared_entry->client_num++;
 
@@ -98,26 +217,14 @@ void z_isr_install(unsigned int irq, void (*routine)(const void *),
 
 	shared_entry->clients[shared_entry->client_num].isr = routine;
 	shared_entry->clients[shared_entry->client_num].arg = param;
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	shared_entry->precheck[shared_entry->client_num] = NULL;
+#endif
 	shared_entry->client_num++;
 
 	k_spin_unlock(&lock, key);
 }
 
-static void swap_client_data(struct _isr_table_entry *a,
-			     struct _isr_table_entry *b)
-{
-	struct _isr_table_entry tmp;
-
-	tmp.arg = a->arg;
-	tmp.isr = a->isr;
-
-	a->arg = b->arg;
-	a->isr = b->isr;
-
-	b->arg = tmp.arg;
-	b->isr = tmp.isr;
-}
-
 static void shared_irq_remove_client(struct z_shared_isr_table_entry *shared_entry,
 				     int client_idx, unsigned int table_idx)
 {
@@ -125,11 +232,13 @@ static void shared_irq_remove_client(struct z_shared_isr_table_entry *shared_ent
 
 	shared_entry->clients[client_idx].isr = NULL;
 	shared_entry->clients[client_idx].arg = NULL;
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	shared_entry->precheck[client_idx] = NULL;
+#endif
 
 	/* push back the removed client to the end of the client list */
 	for (i = client_idx; i <= (int)shared_entry->client_num - 2; i++) {
-		swap_client_data(&shared_entry->clients[i],
-				 &shared_entry->clients[i + 1]);
+		swap_clients(shared_entry, i, i + 1);
 	}
 
 	shared_entry->client_num--;
@@ -141,6 +250,9 @@ static void shared_irq_remove_client(struct z_shared_isr_table_entry *shared_ent
 
 		shared_entry->clients[0].isr = NULL;
 		shared_entry->clients[0].arg = NULL;
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+		shared_entry->precheck[0] = NULL;
+#endif
 
 		shared_entry->client_num--;
 	}
@@ -30,6 +30,10 @@ LOG_MODULE_REGISTER(bt_driver);
 
 #include "../util.h"
 
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+#include <zephyr/sys/ring_buffer.h>
+#endif
+
 #define DT_DRV_COMPAT zephyr_bt_hci_uart
 
 struct h4_data {
@@ -52,12 +56,26 @@ struct h4_data {
 			struct bt_hci_iso_hdr iso;
 			uint8_t hdr[4];
 		};
+
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+		struct ring_buf rb;
+		uint8_t         rb_mem[CONFIG_BT_H4_ASYNC_UART_RX_RING_SIZE];
+		uint8_t         dma[2][CONFIG_BT_H4_ASYNC_UART_RX_BUF_SIZE];
+		uint8_t         dma_next;
+		struct k_sem    ready;
+		uint32_t        dropped;
+#endif
 	} rx;
 
 	struct {
 		uint8_t         type;
 		struct net_buf *buf;
 		struct k_fifo   fifo;
+
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+		uint8_t         dma[CONFIG_BT_H4_ASYNC_UART_TX_BUF_SIZE];
+		atomic_t        busy;
+#endif
 	} tx;
 
 	bt_hci_recv_t recv;
@@ -70,13 +88,28 @@ struct h4_config {
 	struct k_thread *rx_thread;
 };
 
-static inline void h4_get_type(const struct device *dev)
+/* Pull received bytes from the transport: straight out of the UART FIFO in
+ * interrupt-driven mode, from the DMA chunk ring buffer in asynchronous mode.
+ */
+static int h4_read(const struct device *dev, uint8_t *dst, size_t req)
 {
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+	struct h4_data *h4 = dev->data;
+
+	return ring_buf_get(&h4->rx.rb, dst, req);
+#else
 	const struct h4_config *cfg = dev->config;
+
+	return uart_fifo_read(cfg->uart, dst, req);
+#endif
+}
+
+static inline void h4_get_type(const struct device *dev)
+{
 	struct h4_data *h4 = dev->data;
 
 	/* Get packet type */
-	if (uart_fifo_read(cfg->uart, &h4->rx.type, 1) != 1) {
+	if (h4_read(dev, &h4->rx.type, 1) != 1) {
 		LOG_WRN("Unable to read H:4 packet type");
 		h4->rx.type = BT_HCI_H4_NONE;
 		return;
@@ -106,12 +139,11 @@ static inline void h4_get_type(const struct device *dev)
 
 static void h4_read_hdr(const struct device *dev)
 {
-	const struct h4_config *cfg = dev->config;
 	struct h4_data *h4 = dev->data;
 	int bytes_read = h4->rx.hdr_len - h4->rx.remaining;
 	int ret;
 
-	ret = uart_fifo_read(cfg->uart, h4->rx.hdr + bytes_read, h4->rx.remaining);
+	ret = h4_read(dev, h4->rx.hdr + bytes_read, h4->rx.remaining);
 	if (unlikely(ret < 0)) {
 		LOG_ERR("Unable to read from UART (ret %d)", ret);
 	} else {
@@ -218,6 +250,7 @@ static struct net_buf *get_rx(struct h4_data *h4, k_timeout_t timeout)
 	return NULL;
 }
 
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 static void rx_thread(void *p1, void *p2, void *p3)
 {
 	const struct device *dev = p1;
@@ -270,13 +303,14 @@ static void rx_thread(void *p1, void *p2, void *p3)
 		} while (buf);
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC_UART */
 
-static size_t h4_discard(const struct device *uart, size_t len)
+static size_t h4_discard(const struct device *dev, size_t len)
 {
 	uint8_t buf[33];
 	int err;
 
-	err = uart_fifo_read(uart, buf, MIN(len, sizeof(buf)));
+	err = h4_read(dev, buf, MIN(len, sizeof(buf)));
 	if (unlikely(err < 0)) {
 		LOG_ERR("Unable to read from UART (err %d)", err);
 		return 0;
@@ -305,7 +339,9 @@ static inline void read_payload(const struct device *dev)
 			}
 
 			LOG_WRN("Failed to allocate, deferring to rx_thread");
-			uart_irq_rx_disable(cfg->uart);
+			if (!IS_ENABLED(CONFIG_BT_H4_ASYNC_UART)) {
+				uart_irq_rx_disable(cfg->uart);
+			}
 			return;
 		}
 
@@ -323,7 +359,7 @@ static inline void read_payload(const struct device *dev)
 		copy_hdr(h4);
 	}
 
-	read = uart_fifo_read(cfg->uart, net_buf_tail(h4->rx.buf), h4->rx.remaining);
+	read = h4_read(dev, net_buf_tail(h4->rx.buf), h4->rx.remaining);
 	if (unlikely(read < 0)) {
 		LOG_ERR("Failed to read UART (err %d)", read);
 		return;
@@ -391,6 +427,7 @@ static inline void read_header(const struct device *dev)
 	}
 }
 
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 static inline void process_tx(const struct device *dev)
 {
 	const struct h4_config *cfg = dev->config;
@@ -452,10 +489,10 @@ done:
 		uart_irq_tx_disable(cfg->uart);
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC_UART */
 
 static inline void process_rx(const struct device *dev)
 {
-	const struct h4_config *cfg = dev->config;
 	struct h4_data *h4 = dev->data;
 
 	LOG_DBG("remaining %u discard %u have_hdr %u rx.buf %p len %u",
@@ -463,7 +500,7 @@ static inline void process_rx(const struct device *dev)
 		h4->rx.buf ? h4->rx.buf->len : 0);
 
 	if (h4->rx.discard) {
-		h4->rx.discard -= h4_discard(cfg->uart, h4->rx.discard);
+		h4->rx.discard -= h4_discard(dev, h4->rx.discard);
 		return;
 	}
 
@@ -474,6 +511,7 @@ static inline void process_rx(const struct device *dev)
 	}
 }
 
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 static void bt_uart_isr(const struct device *uart, void *user_data)
 {
 	struct device *dev = user_data;
@@ -488,16 +526,216 @@ static void bt_uart_isr(const struct device *uart, void *user_data)
 		}
 	}
 }
+#endif /* !CONFIG_BT_H4_ASYNC_UART */
 
-static int h4_send(const struct device *dev, struct net_buf *buf)
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	struct h4_data *h4 = dev->data;
+	struct net_buf *buf;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	LOG_DBG("started");
+
+	while (1) {
+		LOG_DBG("rx.buf %p", h4->rx.buf);
+
+		/* We can only do the allocation if we know the initial
+		 * header, since Command Complete/Status events must use the
+		 * original command buffer (if available). Unlike the
+		 * interrupt-driven mode we are not inside an ISR here, so we
+		 * can afford to block; DMA keeps filling the ring buffer in
+		 * the meantime.
+		 */
+		if (h4->rx.have_hdr && !h4->rx.buf) {
+			h4->rx.buf = get_rx(h4, K_FOREVER);
+			LOG_DBG("Got rx.buf %p", h4->rx.buf);
+			if (h4->rx.remaining > net_buf_tailroom(h4->rx.buf)) {
+				LOG_ERR("Not enough space in buffer");
+				h4->rx.discard = h4->rx.remaining;
+				reset_rx(h4);
+			} else {
+				copy_hdr(h4);
+			}
+		}
+
+		if ((h4->rx.have_hdr && !h4->rx.remaining) ||
+		    !ring_buf_is_empty(&h4->rx.rb)) {
+			process_rx(dev);
+		} else {
+			k_sem_take(&h4->rx.ready, K_FOREVER);
+			continue;
+		}
+
+		buf = k_fifo_get(&h4->rx.fifo, K_NO_WAIT);
+		while (buf) {
+			LOG_DBG("Calling bt_recv(%p)", buf);
+			h4->recv(dev, buf);
+			buf = k_fifo_get(&h4->rx.fifo, K_NO_WAIT);
+		}
+	}
+}
+
+/* Coalesce as many queued packets as will fit into the TX staging buffer.
+ * Must only be called by the current transfer owner (tx.busy held).
+ */
+static size_t tx_async_fill(const struct device *dev)
+{
+	struct h4_data *h4 = dev->data;
+	size_t len = 0U;
+
+	while (len < sizeof(h4->tx.dma)) {
+		size_t chunk;
+
+		if (!h4->tx.buf) {
+			h4->tx.buf = k_fifo_get(&h4->tx.fifo, K_NO_WAIT);
+			if (!h4->tx.buf) {
+				break;
+			}
+			h4->tx.type = BT_HCI_H4_NONE;
+		}
+
+		if (h4->tx.type == BT_HCI_H4_NONE) {
+			switch (bt_buf_get_type(h4->tx.buf)) {
+			case BT_BUF_ACL_OUT:
+				h4->tx.type = BT_HCI_H4_ACL;
+				break;
+			case BT_BUF_CMD:
+				h4->tx.type = BT_HCI_H4_CMD;
+				break;
+			case BT_BUF_ISO_OUT:
+				if (IS_ENABLED(CONFIG_BT_ISO)) {
+					h4->tx.type = BT_HCI_H4_ISO;
+					break;
+				}
+				__fallthrough;
+			default:
+				LOG_ERR("Unknown buffer type");
+				net_buf_unref(h4->tx.buf);
+				h4->tx.buf = NULL;
+				continue;
+			}
+
+			h4->tx.dma[len++] = h4->tx.type;
+		}
+
+		chunk = MIN(h4->tx.buf->len, sizeof(h4->tx.dma) - len);
+		memcpy(&h4->tx.dma[len], h4->tx.buf->data, chunk);
+		net_buf_pull(h4->tx.buf, chunk);
+		len += chunk;
+
+		if (!h4->tx.buf->len) {
+			h4->tx.type = BT_HCI_H4_NONE;
+			net_buf_unref(h4->tx.buf);
+			h4->tx.buf = NULL;
+		}
+	}
+
+	return len;
+}
+
+static void tx_async_process(const struct device *dev)
 {
 	const struct h4_config *cfg = dev->config;
 	struct h4_data *h4 = dev->data;
+	size_t len;
+	int err;
+
+	do {
+		len = tx_async_fill(dev);
+		if (len > 0U) {
+			err = uart_tx(cfg->uart, h4->tx.dma, len, SYS_FOREVER_US);
+			if (unlikely(err)) {
+				LOG_ERR("Unable to start TX (err %d)", err);
+				atomic_clear(&h4->tx.busy);
+			}
+			return;
+		}
+
+		atomic_clear(&h4->tx.busy);
+
+		/* A sender may have queued a packet after the FIFO was found
+		 * empty but before the busy flag was released; retry if we
+		 * can re-claim the transfer.
+		 */
+	} while (!k_fifo_is_empty(&h4->tx.fifo) &&
+		 atomic_cas(&h4->tx.busy, 0, 1));
+}
+
+static void h4_async_cb(const struct device *uart, struct uart_event *evt,
+			void *user_data)
+{
+	const struct device *dev = user_data;
+	struct h4_data *h4 = dev->data;
+	uint32_t written;
+	int err;
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		written = ring_buf_put(&h4->rx.rb,
+				       evt->data.rx.buf + evt->data.rx.offset,
+				       evt->data.rx.len);
+		if (unlikely(written < evt->data.rx.len)) {
+			h4->rx.dropped += evt->data.rx.len - written;
+			LOG_ERR("RX ring full, dropped %u bytes (total %u)",
+				evt->data.rx.len - written, h4->rx.dropped);
+		}
+		k_sem_give(&h4->rx.ready);
+		break;
+	case UART_RX_BUF_REQUEST:
+		err = uart_rx_buf_rsp(uart, h4->rx.dma[h4->rx.dma_next],
+				      sizeof(h4->rx.dma[0]));
+		if (err) {
+			LOG_ERR("Unable to provide RX buffer (err %d)", err);
+		} else {
+			h4->rx.dma_next ^= 1;
+		}
+		break;
+	case UART_RX_DISABLED:
+		/* All DMA buffers have been released; restart reception */
+		err = uart_rx_enable(uart, h4->rx.dma[0], sizeof(h4->rx.dma[0]),
+				     CONFIG_BT_H4_ASYNC_UART_RX_IDLE_TIMEOUT);
+		if (err) {
+			LOG_ERR("Unable to re-enable RX (err %d)", err);
+		} else {
+			h4->rx.dma_next = 1U;
+		}
+		break;
+	case UART_RX_STOPPED:
+		LOG_ERR("RX stopped (reason %d)", evt->data.rx_stop.reason);
+		break;
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		tx_async_process(dev);
+		break;
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_BT_H4_ASYNC_UART */
+
+static int h4_send(const struct device *dev, struct net_buf *buf)
+{
+	struct h4_data *h4 = dev->data;
 
 	LOG_DBG("buf %p type %u len %u", buf, bt_buf_get_type(buf), buf->len);
 
 	k_fifo_put(&h4->tx.fifo, buf);
-	uart_irq_tx_enable(cfg->uart);
+
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+	if (atomic_cas(&h4->tx.busy, 0, 1)) {
+		tx_async_process(dev);
+	}
+#else
+	{
+		const struct h4_config *cfg = dev->config;
+
+		uart_irq_tx_enable(cfg->uart);
+	}
+#endif
 
 	return 0;
 }
@@ -510,7 +748,12 @@ static int h4_send(const struct device *dev, struct net_buf *buf)
   */
 int __weak bt_hci_transport_setup(const struct device *uart)
 {
-	h4_discard(uart, 32);
+	uint8_t dummy[32];
+
+	/* The driver data path is not active yet, so drain any stale bytes
+	 * straight from the UART FIFO.
+	 */
+	(void)uart_fifo_read(uart, dummy, sizeof(dummy));
 	return 0;
 }
 
@@ -523,8 +766,10 @@ static int h4_open(const struct device *dev, bt_hci_recv_t recv)
 
 	LOG_DBG("");
 
+#if !defined(CONFIG_BT_H4_ASYNC_UART)
 	uart_irq_rx_disable(cfg->uart);
 	uart_irq_tx_disable(cfg->uart);
+#endif
 
 	ret = bt_hci_transport_setup(cfg->uart);
 	if (ret < 0) {
@@ -533,7 +778,24 @@ static int h4_open(const struct device *dev, bt_hci_recv_t recv)
 
 	h4->recv = recv;
 
+#if defined(CONFIG_BT_H4_ASYNC_UART)
+	ring_buf_init(&h4->rx.rb, sizeof(h4->rx.rb_mem), h4->rx.rb_mem);
+	k_sem_init(&h4->rx.ready, 0, 1);
+
+	ret = uart_callback_set(cfg->uart, h4_async_cb, (void *)dev);
+	if (ret < 0) {
+		return -EIO;
+	}
+
+	ret = uart_rx_enable(cfg->uart, h4->rx.dma[0], sizeof(h4->rx.dma[0]),
+			     CONFIG_BT_H4_ASYNC_UART_RX_IDLE_TIMEOUT);
+	if (ret < 0) {
+		return -EIO;
+	}
+	h4->rx.dma_next = 1U;
+#else
 	uart_irq_callback_user_data_set(cfg->uart, bt_uart_isr, (void *)dev);
+#endif
 
 	tid = k_thread_create(cfg->rx_thread, cfg->rx_thread_stack,
 			      cfg->rx_thread_stack_size,
@@ -66,6 +66,20 @@ struct display_stm32_ltdc_data {
 	const uint8_t *pend_buf;
 	const uint8_t *front_buf;
 	struct k_sem sem;
+	display_write_callback_t write_cb;
+	void *write_cb_user_data;
+#if CONFIG_STM32_LTDC_FB_NUM == 2
+	/* Region of each internal frame buffer that is out of date with
+	 * respect to the most recently written content. w == 0 means the
+	 * buffer is up to date.
+	 */
+	struct {
+		uint16_t x;
+		uint16_t y;
+		uint16_t w;
+		uint16_t h;
+	} stale[2];
+#endif
 };
 
 struct display_stm32_ltdc_config {
@@ -93,6 +107,13 @@ static void stm32_ltdc_global_isr(const struct device *dev)
 			__HAL_LTDC_RELOAD_CONFIG(&data->hltdc);
 
 			k_sem_give(&data->sem);
+
+			if (data->write_cb != NULL) {
+				display_write_callback_t cb = data->write_cb;
+
+				data->write_cb = NULL;
+				cb(dev, 0, data->write_cb_user_data);
+			}
 		}
 
 		__HAL_LTDC_CLEAR_FLAG(&data->hltdc, LTDC_FLAG_LI);
@@ -160,10 +181,55 @@ static void stm32_ltdc_get_capabilities(const struct device *dev,
 	capabilities->current_orientation = DISPLAY_ORIENTATION_NORMAL;
 }
 
-static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
+#if CONFIG_STM32_LTDC_FB_NUM == 2
+/* Copy a rectangle between the two internal frame buffers */
+static void stm32_ltdc_copy_rect(const struct device *dev, uint8_t *dst_fb,
+				 const uint8_t *src_fb, uint16_t x, uint16_t y,
+				 uint16_t w, uint16_t h)
+{
+	const struct display_stm32_ltdc_config *config = dev->config;
+	struct display_stm32_ltdc_data *data = dev->data;
+	uint32_t offset = (y * config->width + x) * data->current_pixel_size;
+	uint32_t line_len = w * data->current_pixel_size;
+	uint32_t stride = config->width * data->current_pixel_size;
+
+	for (uint16_t row = 0; row < h; row++) {
+		(void) memcpy(&dst_fb[offset], &src_fb[offset], line_len);
+		sys_cache_data_flush_range(&dst_fb[offset], line_len);
+		offset += stride;
+	}
+}
+
+/* Grow a stale region to cover the given rectangle */
+static void stm32_ltdc_stale_add(struct display_stm32_ltdc_data *data,
+				 int idx, uint16_t x, uint16_t y,
+				 uint16_t w, uint16_t h)
+{
+	if (data->stale[idx].w == 0) {
+		data->stale[idx].x = x;
+		data->stale[idx].y = y;
+		data->stale[idx].w = w;
+		data->stale[idx].h = h;
+	} else {
+		uint16_t x1 = MAX(data->stale[idx].x + data->stale[idx].w, x + w);
+		uint16_t y1 = MAX(data->stale[idx].y + data->stale[idx].h, y + h);
+
+		data->stale[idx].x = MIN(data->stale[idx].x, x);
+		data->stale[idx].y = MIN(data->stale[idx].y, y);
+		data->stale[idx].w = x1 - data->stale[idx].x;
+		data->stale[idx].h = y1 - data->stale[idx].y;
+	}
+}
+#endif /* CONFIG_STM32_LTDC_FB_NUM == 2 */
+
+/* Copies the rectangle into a displayable buffer and returns it through
+ * pend_buf, without initiating the buffer swap.
+ */
+static int stm32_ltdc_write_prepare(const struct device *dev, const uint16_t x,
 				const uint16_t y,
 				const struct display_buffer_descriptor *desc,
-				const void *buf)
+				const void *buf,
+				const uint8_t **pend_buf_out)
 {
 	const struct display_stm32_ltdc_config *config = dev->config;
 	struct display_stm32_ltdc_data *data = dev->data;
@@ -178,6 +244,12 @@ static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
 	    (desc->pitch == desc->width)) {
 		/* Use buf as ltdc frame buffer directly if it length same as ltdc frame buffer. */
 		pend_buf = buf;
+
+#if CONFIG_STM32_LTDC_FB_NUM == 2
+		/* The internal buffers miss everything the external one shows */
+		stm32_ltdc_stale_add(data, 0, 0, 0, config->width, config->height);
+		stm32_ltdc_stale_add(data, 1, 0, 0, config->width, config->height);
+#endif
 	} else {
 		if (CONFIG_STM32_LTDC_FB_NUM == 0)  {
 			LOG_ERR("Partial write requires internal frame buffer");
@@ -186,13 +258,37 @@ static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
 
 		dst = data->frame_buffer;
 
-		if (CONFIG_STM32_LTDC_FB_NUM == 2) {
-			if (data->front_buf == data->frame_buffer) {
-				dst = data->frame_buffer + data->frame_buffer_len;
-			}
+#if CONFIG_STM32_LTDC_FB_NUM == 2
+		int idx = 0;
+
+		if (data->front_buf == data->frame_buffer) {
+			dst = data->frame_buffer + data->frame_buffer_len;
+			idx = 1;
+		}
 
+		/* Bring the back buffer up to date by copying only the region
+		 * it is missing instead of the whole front buffer.
+		 */
+		if (data->front_buf == data->frame_buffer ||
+		    data->front_buf == data->frame_buffer + data->frame_buffer_len) {
+			if (data->stale[idx].w != 0) {
+				stm32_ltdc_copy_rect(dev, dst, data->front_buf,
+						     data->stale[idx].x,
+						     data->stale[idx].y,
+						     data->stale[idx].w,
+						     data->stale[idx].h);
+			}
+		} else {
+			/* Front buffer is an external one, full copy needed */
 			memcpy(dst, data->front_buf, data->frame_buffer_len);
+			sys_cache_data_flush_range(dst, data->frame_buffer_len);
 		}
+		data->stale[idx].w = 0;
+
+		/* The other buffer now misses this write */
+		stm32_ltdc_stale_add(data, idx == 0 ? 1 : 0, x, y,
+				     desc->width, desc->height);
+#endif
 
 		pend_buf = dst;
 
@@ -211,6 +307,25 @@ static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
 
 	}
 
+	*pend_buf_out = pend_buf;
+
+	return 0;
+}
+
+static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
+				const uint16_t y,
+				const struct display_buffer_descriptor *desc,
+				const void *buf)
+{
+	struct display_stm32_ltdc_data *data = dev->data;
+	const uint8_t *pend_buf;
+	int err;
+
+	err = stm32_ltdc_write_prepare(dev, x, y, desc, buf, &pend_buf);
+	if (err != 0) {
+		return err;
+	}
+
 	if (data->front_buf == pend_buf) {
 		return 0;
 	}
@@ -224,6 +339,43 @@ static int stm32_ltdc_write(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
+static int stm32_ltdc_write_async(const struct device *dev, const uint16_t x,
+				const uint16_t y,
+				const struct display_buffer_descriptor *desc,
+				const void *buf,
+				display_write_callback_t callback,
+				void *user_data)
+{
+	struct display_stm32_ltdc_data *data = dev->data;
+	const uint8_t *pend_buf;
+	int err;
+
+	if (data->write_cb != NULL || data->front_buf != data->pend_buf) {
+		return -EBUSY;
+	}
+
+	err = stm32_ltdc_write_prepare(dev, x, y, desc, buf, &pend_buf);
+	if (err != 0) {
+		return err;
+	}
+
+	if (data->front_buf == pend_buf) {
+		callback(dev, 0, user_data);
+		return 0;
+	}
+
+	/* Publish the callback before arming the buffer swap; the line
+	 * interrupt completes the write on the next sync point.
+	 */
+	data->write_cb_user_data = user_data;
+	data->write_cb = callback;
+	barrier_dmem_fence_full();
+
+	data->pend_buf = pend_buf;
+
+	return 0;
+}
+
 static int stm32_ltdc_read(const struct device *dev, const uint16_t x,
 				const uint16_t y,
 				const struct display_buffer_descriptor *desc,
@@ -461,6 +613,7 @@ static int stm32_ltdc_pm_action(const struct device *dev,
 
 static const struct display_driver_api stm32_ltdc_display_api = {
 	.write = stm32_ltdc_write,
+	.write_async = stm32_ltdc_write_async,
 	.read = stm32_ltdc_read,
 	.get_capabilities = stm32_ltdc_get_capabilities,
 	.set_pixel_format = stm32_ltdc_set_pixel_format,
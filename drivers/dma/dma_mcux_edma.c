@@ -100,6 +100,12 @@ struct dma_mcux_channel_transfer_edma_settings {
 	volatile int8_t write_idx;
 	/* How many TCDs in TCD pool is emtpy(can be used to write transfer parameters) */
 	volatile uint8_t empty_tcds;
+	/* Configured transfer, kept to rearm the HW TCD on repeated start.
+	 * Only tracked in single TCD (no scatter/gather) mode.
+	 */
+	uint32_t src_addr;
+	uint32_t dest_addr;
+	uint32_t major_loops;
 };
 
 
@@ -360,6 +366,7 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	data->transfer_settings.dest_data_size = config->dest_data_size;
 	data->transfer_settings.source_burst_length = config->source_burst_length;
 	data->transfer_settings.dest_burst_length = config->dest_burst_length;
+	data->transfer_settings.major_loops = 0;
 	data->transfer_settings.direction = config->channel_direction;
 	data->transfer_settings.transfer_type = transfer_type;
 	data->transfer_settings.valid = true;
@@ -508,6 +515,11 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 		if (submit_status != kStatus_Success) {
 			LOG_ERR("Error submitting EDMA Transfer: 0x%x", submit_status);
 			ret = -EFAULT;
+		} else if (config->source_burst_length != 0) {
+			data->transfer_settings.src_addr = block_config->source_address;
+			data->transfer_settings.dest_addr = block_config->dest_address;
+			data->transfer_settings.major_loops =
+				block_config->block_size / config->source_burst_length;
 		}
 
 		LOG_DBG("DMA TCD CSR 0x%x", EDMA_HW_TCD_CSR(dev, hw_channel));
@@ -537,12 +549,29 @@ static int dma_mcux_edma_configure(const struct device *dev, uint32_t channel,
 	return ret;
 }
 
+static void dma_mcux_edma_update_hw_tcd(const struct device *dev, uint32_t channel, uint32_t src,
+					uint32_t dst, size_t size);
+
 static int dma_mcux_edma_start(const struct device *dev, uint32_t channel)
 {
 	struct call_back *data = DEV_CHANNEL_DATA(dev, channel);
 
 	LOG_DBG("START TRANSFER");
 
+	/* Rearm a completed single-TCD transfer so the channel restarts
+	 * without rebuilding the TCD. On completion the engine has advanced
+	 * SADDR/DADDR past the buffers and disabled the request, so reset
+	 * the addresses and major loop count from the kept configuration.
+	 */
+	if (data->transfer_settings.valid && !data->transfer_settings.cyclic &&
+	    !data->busy && data->edma_handle.tcdPool == NULL &&
+	    data->transfer_settings.major_loops != 0U) {
+		dma_mcux_edma_update_hw_tcd(dev, channel,
+					    data->transfer_settings.src_addr,
+					    data->transfer_settings.dest_addr,
+					    data->transfer_settings.major_loops);
+	}
+
 #if defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT
 	uint8_t dmamux_idx = DEV_DMAMUX_IDX(dev, channel);
 	uint8_t dmamux_channel = DEV_DMAMUX_CHANNEL(dev, channel);
@@ -738,6 +767,11 @@ static int dma_mcux_edma_reload(const struct device *dev, uint32_t channel,
 		if (submit_status != kStatus_Success) {
 			LOG_ERR("Error submitting EDMA Transfer: 0x%x", submit_status);
 			ret = -EFAULT;
+		} else if (data->transfer_settings.source_burst_length != 0) {
+			data->transfer_settings.src_addr = src;
+			data->transfer_settings.dest_addr = dst;
+			data->transfer_settings.major_loops =
+				size / data->transfer_settings.source_burst_length;
 		}
 	}
 
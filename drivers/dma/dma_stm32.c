@@ -490,6 +490,10 @@ DMA_STM32_EXPORT_API int dma_stm32_configure(const struct device *dev,
 	/* With dma V2 and dmamux,the request ID is stored in the dma_slot */
 	DMA_InitStruct.PeriphRequest = config->dma_slot;
 #endif
+	stream->src_addr = config->head_block->source_address;
+	stream->dst_addr = config->head_block->dest_address;
+	stream->nb_data = DMA_InitStruct.NbData;
+
 	LL_DMA_Init(dma, dma_stm32_id_to_stream(id), &DMA_InitStruct);
 
 	LL_DMA_EnableIT_TC(dma, dma_stm32_id_to_stream(id));
@@ -554,6 +558,11 @@ DMA_STM32_EXPORT_API int dma_stm32_reload(const struct device *dev, uint32_t id,
 				     size / stream->dst_size);
 	}
 
+	/* Keep the reloaded transfer for rearming on repeated start */
+	stream->src_addr = src;
+	stream->dst_addr = dst;
+	stream->nb_data = LL_DMA_GetDataLength(dma, dma_stm32_id_to_stream(id));
+
 	/* When reloading the dma, the stream is busy again before enabling */
 	stream->busy = true;
 
@@ -581,8 +590,37 @@ DMA_STM32_EXPORT_API int dma_stm32_start(const struct device *dev, uint32_t id)
 		return 0;
 	}
 
-	/* When starting the dma, the stream is busy before enabling */
 	stream = &config->streams[id];
+
+	/* Rearm a completed transfer so a configured stream restarts without
+	 * rebuilding its configuration. On completion NDTR has counted down
+	 * to zero, except in circular mode where it auto-reloads.
+	 */
+	if (!stream->hal_override && !stream->cyclic && stream->nb_data != 0 &&
+	    LL_DMA_GetDataLength(dma, dma_stm32_id_to_stream(id)) == 0) {
+		switch (stream->direction) {
+		case MEMORY_TO_PERIPHERAL:
+			LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id),
+						stream->src_addr);
+			LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id),
+						stream->dst_addr);
+			break;
+		case MEMORY_TO_MEMORY:
+		case PERIPHERAL_TO_MEMORY:
+			LL_DMA_SetPeriphAddress(dma, dma_stm32_id_to_stream(id),
+						stream->src_addr);
+			LL_DMA_SetMemoryAddress(dma, dma_stm32_id_to_stream(id),
+						stream->dst_addr);
+			break;
+		default:
+			return -EINVAL;
+		}
+
+		LL_DMA_SetDataLength(dma, dma_stm32_id_to_stream(id),
+				     stream->nb_data);
+	}
+
+	/* When starting the dma, the stream is busy before enabling */
 	stream->busy = true;
 
 	dma_stm32_clear_stream_irq(dev, id);
@@ -28,6 +28,12 @@ struct dma_stm32_stream {
 	void *user_data; /* holds the client data */
 	dma_callback_t dma_callback;
 	bool cyclic;
+	/* Configured transfer, kept to rearm the stream on repeated start
+	 * without rebuilding the configuration.
+	 */
+	uint32_t src_addr;
+	uint32_t dst_addr;
+	uint32_t nb_data;
 };
 
 struct dma_stm32_data {
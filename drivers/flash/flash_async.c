@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/flash/flash_async.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(flash_async, CONFIG_FLASH_LOG_LEVEL);
+
+static K_THREAD_STACK_DEFINE(flash_async_stack, CONFIG_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q flash_async_q;
+
+static void flash_async_work_handler(struct k_work *work)
+{
+	struct flash_async_request *req = CONTAINER_OF(work, struct flash_async_request, work);
+	int rc;
+
+	switch (req->op) {
+	case FLASH_ASYNC_OP_READ:
+		rc = flash_read(req->dev, req->offset, req->read_buf, req->len);
+		break;
+	case FLASH_ASYNC_OP_WRITE:
+		rc = flash_write(req->dev, req->offset, req->write_buf, req->len);
+		break;
+	case FLASH_ASYNC_OP_ERASE:
+		rc = flash_erase(req->dev, req->offset, req->len);
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	req->result = rc;
+	k_sem_give(&req->done);
+
+	if (req->callback != NULL) {
+		req->callback(req->dev, rc, req->user_data);
+	}
+}
+
+static int flash_async_submit(const struct device *dev, struct flash_async_request *req,
+			      flash_async_callback_t callback, void *user_data)
+{
+	if (k_work_busy_get(&req->work) != 0) {
+		return -EBUSY;
+	}
+
+	req->dev = dev;
+	req->callback = callback;
+	req->user_data = user_data;
+	req->result = 0;
+	k_sem_init(&req->done, 0, 1);
+	k_work_init(&req->work, flash_async_work_handler);
+
+	return k_work_submit_to_queue(&flash_async_q, &req->work) >= 0 ? 0 : -EBUSY;
+}
+
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_request *req, flash_async_callback_t callback,
+		     void *user_data)
+{
+	req->op = FLASH_ASYNC_OP_READ;
+	req->offset = offset;
+	req->read_buf = data;
+	req->len = len;
+
+	return flash_async_submit(dev, req, callback, user_data);
+}
+
+int flash_write_async(const struct device *dev, off_t offset, const void *data,
+		      size_t len, struct flash_async_request *req,
+		      flash_async_callback_t callback, void *user_data)
+{
+	req->op = FLASH_ASYNC_OP_WRITE;
+	req->offset = offset;
+	req->write_buf = data;
+	req->len = len;
+
+	return flash_async_submit(dev, req, callback, user_data);
+}
+
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_request *req, flash_async_callback_t callback,
+		      void *user_data)
+{
+	req->op = FLASH_ASYNC_OP_ERASE;
+	req->offset = offset;
+	req->len = size;
+
+	return flash_async_submit(dev, req, callback, user_data);
+}
+
+int flash_async_wait(struct flash_async_request *req, k_timeout_t timeout)
+{
+	if (k_sem_take(&req->done, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	/* Keep the completion latched so repeated waits return the result */
+	k_sem_give(&req->done);
+
+	return req->result;
+}
+
+static int flash_async_init(void)
+{
+	k_work_queue_init(&flash_async_q);
+	k_work_queue_start(&flash_async_q, flash_async_stack,
+			   K_THREAD_STACK_SIZEOF(flash_async_stack),
+			   CONFIG_FLASH_ASYNC_THREAD_PRIORITY, NULL);
+	k_thread_name_set(&flash_async_q.thread, "flash_async");
+
+	return 0;
+}
+
+SYS_INIT(flash_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
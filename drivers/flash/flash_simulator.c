@@ -288,10 +288,17 @@ static int flash_sim_write(const struct device *dev, const off_t offset,
 	FLASH_SIM_STATS_INCN(flash_sim_stats, bytes_written, len);
 
 #ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
-	/* wait before returning */
-	k_busy_wait(CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US);
-	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_write_time_us,
-		   CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US);
+	{
+		uint32_t wait_us = CONFIG_FLASH_SIMULATOR_MIN_WRITE_TIME_US;
+
+		if (IS_ENABLED(CONFIG_FLASH_SIMULATOR_TIME_PER_UNIT)) {
+			wait_us *= len / FLASH_SIMULATOR_PROG_UNIT;
+		}
+
+		/* wait before returning */
+		k_busy_wait(wait_us);
+		FLASH_SIM_STATS_INCN(flash_sim_stats, flash_write_time_us, wait_us);
+	}
 #endif
 
 	return 0;
@@ -340,10 +347,17 @@ static int flash_sim_erase(const struct device *dev, const off_t offset,
 	}
 
 #ifdef CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING
-	/* wait before returning */
-	k_busy_wait(CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US);
-	FLASH_SIM_STATS_INCN(flash_sim_stats, flash_erase_time_us,
-		   CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US);
+	{
+		uint32_t wait_us = CONFIG_FLASH_SIMULATOR_MIN_ERASE_TIME_US;
+
+		if (IS_ENABLED(CONFIG_FLASH_SIMULATOR_TIME_PER_UNIT)) {
+			wait_us *= len / FLASH_SIMULATOR_ERASE_UNIT;
+		}
+
+		/* wait before returning */
+		k_busy_wait(wait_us);
+		FLASH_SIM_STATS_INCN(flash_sim_stats, flash_erase_time_us, wait_us);
+	}
 #endif
 
 	return 0;
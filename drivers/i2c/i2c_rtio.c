@@ -58,11 +58,56 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 	mpsc_init(&ctx->io_q);
 	ctx->txn_curr = NULL;
 	ctx->txn_head = NULL;
+	ctx->txn_next = NULL;
 	ctx->dt_spec.bus = dev;
 	ctx->iodev.data = &ctx->dt_spec;
 	ctx->iodev.api = &i2c_iodev_api;
 }
 
+/**
+ * @private
+ * @brief Check that a submission is a plain data transfer
+ *
+ * Configure and recover requests also travel through the work queue and
+ * must never be chained with bus transfers.
+ */
+static bool i2c_rtio_op_is_xfer(const struct rtio_sqe *sqe)
+{
+	return sqe->op == RTIO_OP_RX || sqe->op == RTIO_OP_TX || sqe->op == RTIO_OP_TINY_TX;
+}
+
+/**
+ * @private
+ * @brief Merge two queued transactions targeting the same device
+ *
+ * Suppresses the STOP condition ending @p txn and marks the first
+ * submission of @p next with a repeated START, so both execute as one
+ * combined bus transaction. @p next is guaranteed to be started right
+ * after @p txn as it is already popped from the work queue.
+ */
+static void i2c_rtio_txn_merge(struct rtio_iodev_sqe *txn, struct rtio_iodev_sqe *next)
+{
+	const struct i2c_dt_spec *spec = txn->sqe.iodev->data;
+	const struct i2c_dt_spec *next_spec = next->sqe.iodev->data;
+	struct rtio_iodev_sqe *last = txn;
+
+	if (!i2c_rtio_op_is_xfer(&txn->sqe) || !i2c_rtio_op_is_xfer(&next->sqe)) {
+		return;
+	}
+
+	if (spec->addr != next_spec->addr ||
+	    (((txn->sqe.iodev_flags ^ next->sqe.iodev_flags) & RTIO_IODEV_I2C_10_BITS) != 0)) {
+		return;
+	}
+
+	while (rtio_txn_next(last) != NULL) {
+		last = rtio_txn_next(last);
+	}
+
+	last->sqe.iodev_flags &= ~RTIO_IODEV_I2C_STOP;
+	next->sqe.iodev_flags |= RTIO_IODEV_I2C_RESTART;
+}
+
 /**
  * @private
  * @brief Setup the next transaction (could be a single op) if needed
@@ -73,6 +118,7 @@ void i2c_rtio_init(struct i2c_rtio *ctx, const struct device *dev)
 static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 {
 	k_spinlock_key_t key = k_spin_lock(&ctx->slock);
+	struct rtio_iodev_sqe *head;
 
 	/* Already working on something, bail early */
 	if (!completion && ctx->txn_head != NULL) {
@@ -80,18 +126,35 @@ static bool i2c_rtio_next(struct i2c_rtio *ctx, bool completion)
 		return false;
 	}
 
-	struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+	if (ctx->txn_next != NULL) {
+		/* Popped ahead of time for same-target merging */
+		head = ctx->txn_next;
+		ctx->txn_next = NULL;
+	} else {
+		struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+
+		/* Nothing left to do */
+		if (next == NULL) {
+			ctx->txn_head = NULL;
+			ctx->txn_curr = NULL;
+			k_spin_unlock(&ctx->slock, key);
+			return false;
+		}
 
-	/* Nothing left to do */
-	if (next == NULL) {
-		ctx->txn_head = NULL;
-		ctx->txn_curr = NULL;
-		k_spin_unlock(&ctx->slock, key);
-		return false;
+		head = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
 	}
 
-	ctx->txn_head = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
-	ctx->txn_curr = ctx->txn_head;
+	ctx->txn_head = head;
+	ctx->txn_curr = head;
+
+	if (IS_ENABLED(CONFIG_I2C_RTIO_SAME_TARGET_MERGE)) {
+		struct mpsc_node *next = mpsc_pop(&ctx->io_q);
+
+		if (next != NULL) {
+			ctx->txn_next = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
+			i2c_rtio_txn_merge(ctx->txn_head, ctx->txn_next);
+		}
+	}
 
 	k_spin_unlock(&ctx->slock, key);
 
@@ -11,6 +11,8 @@
  * NOTE: This driver implements the GICv1 and GICv2 interfaces.
  */
 
+#include <errno.h>
+
 #include <zephyr/device.h>
 #include <zephyr/arch/cpu.h>
 #include <zephyr/devicetree.h>
@@ -125,6 +127,18 @@ void arm_gic_irq_set_priority(
 	}
 }
 
+int arm_gic_irq_set_affinity(unsigned int irq, unsigned int target_cpu)
+{
+	if ((irq < GIC_SPI_INT_BASE) || (target_cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	/* ITARGETSRn provides one target byte per interrupt */
+	sys_write8(BIT(cpu_mpid_list[target_cpu]), GICD_ITARGETSRn + irq);
+
+	return 0;
+}
+
 unsigned int arm_gic_get_active(void)
 {
 	unsigned int irq;
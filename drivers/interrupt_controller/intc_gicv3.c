@@ -201,6 +201,32 @@ void arm_gic_irq_disable(unsigned int intid)
 	gic_wait_rwp(intid);
 }
 
+int arm_gic_irq_set_affinity(unsigned int intid, unsigned int target_cpu)
+{
+#if defined(CONFIG_ARMV8_A_NS) || defined(CONFIG_GIC_SINGLE_SECURITY_STATE)
+	static const uint64_t cpu_mpid_list[] = {
+		DT_FOREACH_CHILD_STATUS_OKAY_SEP(DT_PATH(cpus), DT_REG_ADDR, (,))
+	};
+
+	BUILD_ASSERT(ARRAY_SIZE(cpu_mpid_list) >= CONFIG_MP_MAX_NUM_CPUS,
+		     "The count of CPU Cores nodes in dts is less than CONFIG_MP_MAX_NUM_CPUS\n");
+
+	if (!GIC_IS_SPI(intid) || (target_cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	arm_gic_write_irouter(MPIDR_TO_CORE(cpu_mpid_list[target_cpu]), intid);
+
+	return 0;
+#else
+	ARG_UNUSED(intid);
+	ARG_UNUSED(target_cpu);
+
+	/* Without affinity routing SPI targeting is not programmable here */
+	return -ENOTSUP;
+#endif
+}
+
 bool arm_gic_irq_is_enabled(unsigned int intid)
 {
 #ifdef CONFIG_GIC_V3_ITS
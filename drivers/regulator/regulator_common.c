@@ -141,6 +141,71 @@ int regulator_enable(const struct device *dev)
 	return ret;
 }
 
+int regulator_enable_batch(const struct device **devs, size_t count)
+{
+	int64_t settle_end = k_uptime_ticks();
+	size_t enabled;
+	int ret = 0;
+
+	for (enabled = 0U; enabled < count; enabled++) {
+		const struct device *dev = devs[enabled];
+		const struct regulator_driver_api *api = dev->api;
+		const struct regulator_common_config *config = dev->config;
+		struct regulator_common_data *data = dev->data;
+
+		/* enable not supported or regulator must stay always on */
+		if ((api->enable == NULL) ||
+		    ((config->flags & REGULATOR_ALWAYS_ON) != 0U)) {
+			continue;
+		}
+
+#ifdef CONFIG_REGULATOR_THREAD_SAFE_REFCNT
+		(void)k_mutex_lock(&data->lock, K_FOREVER);
+#endif
+
+		data->refcnt++;
+
+		if (data->refcnt == 1) {
+			ret = api->enable(dev);
+			if (ret < 0) {
+				data->refcnt--;
+			} else {
+				/* Settle concurrently with the remaining
+				 * enables; the collective wait below covers
+				 * the latest deadline.
+				 */
+				settle_end = MAX(settle_end,
+						 k_uptime_ticks() +
+						 k_us_to_ticks_ceil64(
+							config->off_on_delay_us));
+			}
+		}
+
+#ifdef CONFIG_REGULATOR_THREAD_SAFE_REFCNT
+		k_mutex_unlock(&data->lock);
+#endif
+
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (ret < 0) {
+		while (enabled > 0U) {
+			enabled--;
+			(void)regulator_disable(devs[enabled]);
+		}
+
+		return ret;
+	}
+
+	if (settle_end > k_uptime_ticks()) {
+		k_sleep(K_TIMEOUT_ABS_TICKS(settle_end));
+	}
+
+	return 0;
+}
+
 bool regulator_is_enabled(const struct device *dev)
 {
 	const struct regulator_common_config *config = dev->config;
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/drivers/serial/uart_async_ring.h>
+
+static void ring_restart(struct uart_async_ring *ring)
+{
+	uint8_t *buf;
+
+	/* Reception already stopped, no races with the driver here. */
+	buf = uart_async_rx_buf_req(&ring->rx);
+	if (buf == NULL) {
+		/* Ring full of unconsumed data, restarted from consume. */
+		ring->stalled = true;
+		ring->stop_reason = 0;
+		ring->callback(ring->dev, UART_ASYNC_RING_EVT_STOPPED, ring->user_data);
+		return;
+	}
+
+	(void)uart_rx_enable(ring->dev, buf, uart_async_rx_get_buf_len(&ring->rx),
+			     ring->timeout);
+}
+
+static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct uart_async_ring *ring = user_data;
+	uint8_t *buf;
+
+	switch (evt->type) {
+	case UART_RX_BUF_REQUEST:
+		buf = uart_async_rx_buf_req(&ring->rx);
+		if (buf != NULL) {
+			(void)uart_rx_buf_rsp(dev, buf, uart_async_rx_get_buf_len(&ring->rx));
+		}
+		break;
+	case UART_RX_RDY:
+		uart_async_rx_on_rdy(&ring->rx, evt->data.rx.buf, evt->data.rx.len);
+		if (evt->data.rx.offset + evt->data.rx.len <
+		    uart_async_rx_get_buf_len(&ring->rx)) {
+			/* Flushed by the receiver timeout before the chunk
+			 * filled up: the line went idle.
+			 */
+			ring->callback(dev, UART_ASYNC_RING_EVT_IDLE, ring->user_data);
+		} else if ((size_t)atomic_get(&ring->rx.pending_bytes) >= ring->watermark) {
+			ring->callback(dev, UART_ASYNC_RING_EVT_DATA, ring->user_data);
+		}
+		break;
+	case UART_RX_BUF_RELEASED:
+		uart_async_rx_on_buf_rel(&ring->rx, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_STOPPED:
+		ring->stop_reason = (uint8_t)evt->data.rx_stop.reason;
+		ring->callback(dev, UART_ASYNC_RING_EVT_STOPPED, ring->user_data);
+		break;
+	case UART_RX_DISABLED:
+		if (ring->enabled) {
+			/* Continuous mode: bring reception back up after a
+			 * missing buffer or a line error.
+			 */
+			ring_restart(ring);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+int uart_async_ring_enable(const struct device *dev, struct uart_async_ring *ring,
+			   const struct uart_async_rx_config *config, int32_t timeout,
+			   size_t watermark, uart_async_ring_callback_t callback,
+			   void *user_data)
+{
+	uint8_t *buf;
+	int err;
+
+	if (callback == NULL) {
+		return -EINVAL;
+	}
+
+	memset(ring, 0, sizeof(*ring));
+	ring->dev = dev;
+	ring->callback = callback;
+	ring->user_data = user_data;
+	ring->timeout = timeout;
+	ring->watermark = watermark;
+
+	err = uart_async_rx_init(&ring->rx, config);
+	if (err < 0) {
+		return err;
+	}
+
+	err = uart_callback_set(dev, uart_callback, ring);
+	if (err < 0) {
+		return err;
+	}
+
+	ring->enabled = true;
+	buf = uart_async_rx_buf_req(&ring->rx);
+	__ASSERT_NO_MSG(buf != NULL);
+
+	err = uart_rx_enable(dev, buf, uart_async_rx_get_buf_len(&ring->rx), timeout);
+	if (err < 0) {
+		ring->enabled = false;
+	}
+
+	return err;
+}
+
+int uart_async_ring_disable(struct uart_async_ring *ring)
+{
+	int err;
+
+	ring->enabled = false;
+	err = uart_rx_disable(ring->dev);
+	if (err == -EFAULT && ring->stalled) {
+		/* Reception already stopped on a full ring. */
+		err = 0;
+	}
+
+	return err;
+}
+
+size_t uart_async_ring_claim(struct uart_async_ring *ring, uint8_t **data, size_t length)
+{
+	return uart_async_rx_data_claim(&ring->rx, data, length);
+}
+
+void uart_async_ring_consume(struct uart_async_ring *ring, size_t length)
+{
+	bool buf_available;
+	k_spinlock_key_t key;
+
+	buf_available = uart_async_rx_data_consume(&ring->rx, length);
+	if (!buf_available) {
+		return;
+	}
+
+	key = k_spin_lock(&ring->lock);
+
+	if (ring->stalled && ring->enabled) {
+		ring->stalled = false;
+		ring_restart(ring);
+	}
+
+	k_spin_unlock(&ring->lock, key);
+}
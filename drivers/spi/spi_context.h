@@ -117,7 +117,15 @@ static inline void spi_context_release(struct spi_context *ctx, int status)
 #endif /* CONFIG_SPI_SLAVE */
 
 #ifdef CONFIG_SPI_ASYNC
-	if (!ctx->asynchronous || (status < 0)) {
+	if (!ctx->asynchronous) {
+		/* Synchronous transfers retain the lock with SPI_LOCK_ON,
+		 * like in the non-async case below.
+		 */
+		if (!(ctx->config->operation & SPI_LOCK_ON)) {
+			ctx->owner = NULL;
+			k_sem_give(&ctx->lock);
+		}
+	} else if (status < 0) {
 		ctx->owner = NULL;
 		k_sem_give(&ctx->lock);
 	}
@@ -18,82 +18,103 @@ const struct rtio_iodev_api spi_iodev_api = {
 	.submit = spi_iodev_submit,
 };
 
-static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+int spi_rtio_txn_flatten(struct rtio_iodev_sqe *txn_head,
+			 struct spi_buf *tx_bufs,
+			 struct spi_buf *rx_bufs,
+			 size_t max_bufs)
 {
-	struct spi_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
-	const struct device *dev = dt_spec->bus;
-	int err = 0;
-
-	LOG_DBG("Sync RTIO work item for: %p", (void *)dev);
-
-	/** Take care of Multi-submissions transactions in the same context.
-	 * This guarantees that linked items will be consumed in the expected
-	 * order, regardless pending items in the workqueue.
-	 */
-	struct rtio_iodev_sqe *txn_head = iodev_sqe;
-	struct rtio_iodev_sqe *txn_curr = iodev_sqe;
+	struct rtio_iodev_sqe *txn_curr = txn_head;
+	size_t n = 0;
 
 	do {
-		struct rtio_sqe *sqe = &txn_curr->sqe;
-		struct spi_buf tx_buf = {0};
-		struct spi_buf_set tx_buf_set = {
-			.buffers = &tx_buf,
-		};
+		const struct rtio_sqe *sqe = &txn_curr->sqe;
 
-		struct spi_buf rx_buf = {0};
-		struct spi_buf_set rx_buf_set = {
-			.buffers = &rx_buf,
-		};
+		if (n >= max_bufs) {
+			return -ENOMEM;
+		}
 
-		LOG_DBG("Preparing transfer: %p", txn_curr);
+		tx_bufs[n].buf = NULL;
+		rx_bufs[n].buf = NULL;
 
 		switch (sqe->op) {
 		case RTIO_OP_RX:
-			rx_buf.buf = sqe->rx.buf;
-			rx_buf.len = sqe->rx.buf_len;
-			rx_buf_set.count = 1;
+			rx_bufs[n].buf = sqe->rx.buf;
+			tx_bufs[n].len = sqe->rx.buf_len;
+			rx_bufs[n].len = sqe->rx.buf_len;
 			break;
 		case RTIO_OP_TX:
-			tx_buf.buf = (uint8_t *)sqe->tx.buf;
-			tx_buf.len = sqe->tx.buf_len;
-			tx_buf_set.count = 1;
+			tx_bufs[n].buf = (uint8_t *)sqe->tx.buf;
+			tx_bufs[n].len = sqe->tx.buf_len;
+			rx_bufs[n].len = sqe->tx.buf_len;
 			break;
 		case RTIO_OP_TINY_TX:
-			tx_buf.buf = (uint8_t *)sqe->tiny_tx.buf;
-			tx_buf.len = sqe->tiny_tx.buf_len;
-			tx_buf_set.count = 1;
+			tx_bufs[n].buf = (uint8_t *)sqe->tiny_tx.buf;
+			tx_bufs[n].len = sqe->tiny_tx.buf_len;
+			rx_bufs[n].len = sqe->tiny_tx.buf_len;
 			break;
 		case RTIO_OP_TXRX:
-			rx_buf.buf = sqe->txrx.rx_buf;
-			rx_buf.len = sqe->txrx.buf_len;
-			tx_buf.buf = (uint8_t *)sqe->txrx.tx_buf;
-			tx_buf.len = sqe->txrx.buf_len;
-			rx_buf_set.count = 1;
-			tx_buf_set.count = 1;
+			tx_bufs[n].buf = (uint8_t *)sqe->txrx.tx_buf;
+			rx_bufs[n].buf = sqe->txrx.rx_buf;
+			tx_bufs[n].len = sqe->txrx.buf_len;
+			rx_bufs[n].len = sqe->txrx.buf_len;
 			break;
 		default:
 			LOG_ERR("Invalid op code %d for submission %p\n", sqe->op, (void *)sqe);
-			err = -EIO;
-			break;
+			return -EIO;
 		}
 
-		if (!err) {
-			struct spi_buf_set *tx_buf_ptr = tx_buf_set.count > 0 ? &tx_buf_set : NULL;
-			struct spi_buf_set *rx_buf_ptr = rx_buf_set.count > 0 ? &rx_buf_set : NULL;
+		n++;
 
-			err = spi_transceive_dt(dt_spec, tx_buf_ptr, rx_buf_ptr);
+		/* NULL if this submission is not a transaction */
+		txn_curr = rtio_txn_next(txn_curr);
+	} while (txn_curr != NULL);
 
-			/* NULL if this submission is not a transaction */
-			txn_curr = rtio_txn_next(txn_curr);
+	return n;
+}
+
+static void spi_rtio_iodev_default_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
+	const struct device *dev = dt_spec->bus;
+	struct spi_buf tx_bufs[CONFIG_SPI_RTIO_FALLBACK_BUFS];
+	struct spi_buf rx_bufs[CONFIG_SPI_RTIO_FALLBACK_BUFS];
+	int ret;
+
+	LOG_DBG("Sync RTIO work item for: %p", (void *)dev);
+
+	/** Flatten the whole transaction into a single transceive call so the
+	 * bus driver sees one transfer: chip select stays asserted across the
+	 * chained operations and drivers with DMA support can execute the
+	 * complete buffer chain without CPU intervention in between.
+	 */
+	ret = spi_rtio_txn_flatten(iodev_sqe, tx_bufs, rx_bufs, ARRAY_SIZE(tx_bufs));
+	if (ret < 0) {
+		if (ret == -ENOMEM) {
+			LOG_ERR("At most CONFIG_SPI_RTIO_FALLBACK_BUFS"
+				" submissions in a transaction are"
+				" supported in the default handler");
 		}
-	} while (err >= 0 && txn_curr != NULL);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
 
-	if (err < 0) {
-		LOG_ERR("Transfer failed: %d", err);
-		rtio_iodev_sqe_err(txn_head, err);
+	const struct spi_buf_set tx_buf_set = {
+		.buffers = tx_bufs,
+		.count = ret,
+	};
+	const struct spi_buf_set rx_buf_set = {
+		.buffers = rx_bufs,
+		.count = ret,
+	};
+
+	ret = spi_transceive_dt(dt_spec, &tx_buf_set, &rx_buf_set);
+
+	if (ret < 0) {
+		LOG_ERR("Transfer failed: %d", ret);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
 	} else {
-		LOG_DBG("Transfer OK: %d", err);
-		rtio_iodev_sqe_ok(txn_head, err);
+		LOG_DBG("Transfer OK: %d", ret);
+		rtio_iodev_sqe_ok(iodev_sqe, ret);
 	}
 }
 
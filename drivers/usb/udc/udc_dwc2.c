@@ -106,6 +106,10 @@ struct udc_dwc2_data {
 	struct k_event xfer_new;
 	/* Finished transactions (IN on bits 0-15, OUT on bits 16-31) */
 	struct k_event xfer_finished;
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+	/* Buffers completed in interrupt context awaiting event delivery */
+	struct k_fifo fin;
+#endif
 	struct dwc2_reg_backup backup;
 	uint32_t ghwcfg1;
 	uint32_t txf_set;
@@ -806,6 +810,22 @@ static int dwc2_handle_evt_din(const struct device *dev,
 {
 	struct net_buf *buf;
 
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+	if (cfg->addr != USB_CONTROL_EP_IN && !dwc2_ep_is_iso(cfg)) {
+		/* Completed buffers were popped in interrupt context. If the
+		 * endpoint is still busy, the head buffer was only partially
+		 * written to the TX FIFO, retry. Otherwise the next transfer
+		 * is started by dwc2_handle_xfer_next().
+		 */
+		buf = udc_buf_peek(dev, cfg->addr);
+		if (buf != NULL && udc_ep_is_busy(dev, cfg->addr)) {
+			return dwc2_tx_fifo_write(dev, cfg, buf);
+		}
+
+		return 0;
+	}
+#endif
+
 	buf = udc_buf_peek(dev, cfg->addr);
 	if (buf == NULL) {
 		LOG_ERR("No buffer for ep 0x%02x", cfg->addr);
@@ -2093,6 +2113,9 @@ static int dwc2_driver_preinit(const struct device *dev)
 	k_event_init(&priv->drv_evt);
 	k_event_init(&priv->xfer_new);
 	k_event_init(&priv->xfer_finished);
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+	k_fifo_init(&priv->fin);
+#endif
 
 	data->caps.rwup = true;
 	data->caps.addr_before_status = true;
@@ -2349,6 +2372,30 @@ static inline void dwc2_handle_in_xfercompl(const struct device *dev,
 		return;
 	}
 
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+	if (ep_idx != 0U && !dwc2_ep_is_iso(ep_cfg) &&
+	    buf->len == 0U && !udc_ep_buf_has_zlp(buf)) {
+		/* Hand the finished buffer over to the thread for event
+		 * delivery and start the next queued buffer back-to-back,
+		 * without a round-trip through the driver thread.
+		 */
+		buf = udc_buf_get(dev, ep_cfg->addr);
+		k_fifo_put(&priv->fin, buf);
+
+		buf = udc_buf_peek(dev, ep_cfg->addr);
+		if (buf == NULL || dwc2_tx_fifo_write(dev, ep_cfg, buf) != 0) {
+			/* Nothing to chain, or no space in the TX FIFO yet;
+			 * leave the next buffer to dwc2_handle_xfer_next().
+			 */
+			udc_ep_set_busy(dev, ep_cfg->addr, false);
+			k_event_post(&priv->xfer_finished, BIT(ep_idx));
+		}
+
+		k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
+		return;
+	}
+#endif
+
 	k_event_post(&priv->xfer_finished, BIT(ep_idx));
 	k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
 }
@@ -2455,6 +2502,22 @@ static inline void dwc2_handle_out_xfercompl(const struct device *dev,
 	    net_buf_tailroom(buf)) {
 		dwc2_prep_rx(dev, buf, ep_cfg);
 	} else {
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+		if (ep_idx != 0U && !is_iso) {
+			buf = udc_buf_get(dev, ep_cfg->addr);
+			k_fifo_put(&priv->fin, buf);
+
+			buf = udc_buf_peek(dev, ep_cfg->addr);
+			if (buf != NULL) {
+				dwc2_prep_rx(dev, buf, ep_cfg);
+			} else {
+				udc_ep_set_busy(dev, ep_cfg->addr, false);
+			}
+
+			k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
+			return;
+		}
+#endif
 		k_event_post(&priv->xfer_finished, BIT(16 + ep_idx));
 		k_event_post(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
 	}
@@ -2860,6 +2923,17 @@ static ALWAYS_INLINE void dwc2_thread_handler(void *const arg)
 	if (evt & BIT(DWC2_DRV_EVT_EP_FINISHED)) {
 		k_event_clear(&priv->drv_evt, BIT(DWC2_DRV_EVT_EP_FINISHED));
 
+#ifdef CONFIG_UDC_DWC2_EP_CHAINING
+		/* Deliver events for buffers completed in interrupt context */
+		struct net_buf *fin_buf;
+
+		while ((fin_buf = k_fifo_get(&priv->fin, K_NO_WAIT)) != NULL) {
+			if (udc_submit_ep_event(dev, fin_buf, 0)) {
+				LOG_ERR("Failed to submit endpoint event");
+			}
+		}
+#endif
+
 		if (!priv->hibernated) {
 			eps = k_event_test(&priv->xfer_finished, UINT32_MAX);
 			k_event_clear(&priv->xfer_finished, eps);
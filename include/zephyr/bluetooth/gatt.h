@@ -1305,6 +1305,27 @@ int bt_gatt_notify_multiple(struct bt_conn *conn,
 			    uint16_t num_params,
 			    struct bt_gatt_notify_params params[]);
 
+/** @brief Flush batched notifications to a client.
+ *
+ *  When @kconfig{CONFIG_BT_GATT_NOTIFY_MULTIPLE_FLUSH_MS} is non-zero,
+ *  consecutive bt_gatt_notify_cb() calls are batched into a single
+ *  ATT_MULTIPLE_HANDLE_VALUE_NTF PDU that is sent when the batching
+ *  window expires. This function sends the pending PDU immediately,
+ *  letting an application that notifies a burst of characteristics
+ *  close the batch at the end of the burst instead of waiting out the
+ *  window.
+ *
+ *  It is not an error to call this function when no notifications are
+ *  pending.
+ *
+ *  @param conn Target client.
+ *
+ *  @retval 0 Success, or nothing was pending.
+ *  @retval -EINVAL @p conn was NULL.
+ *  @return Negative error code from sending the pending PDU otherwise.
+ */
+int bt_gatt_notify_mult_flush(struct bt_conn *conn);
+
 /** @brief Notify attribute value change.
  *
  *  Send notification of attribute value change, if connection is NULL notify
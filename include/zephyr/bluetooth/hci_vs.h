@@ -213,6 +213,35 @@ struct bt_hci_cp_vs_set_min_num_used_chans {
 	uint8_t  min_used_chans;
 } __packed;
 
+#define BT_HCI_OP_VS_READ_SCHED_STATS          BT_OP(BT_OGF_VS, 0x0013)
+
+#define BT_HCI_VS_SCHED_STATS_LAZY_BUCKETS 4
+#define BT_HCI_VS_SCHED_STATS_ROLE_CONN    0
+#define BT_HCI_VS_SCHED_STATS_ROLE_ADV     1
+#define BT_HCI_VS_SCHED_STATS_ROLE_SCAN    2
+#define BT_HCI_VS_SCHED_STATS_ROLE_SYNC    3
+#define BT_HCI_VS_SCHED_STATS_ROLE_ISO     4
+#define BT_HCI_VS_SCHED_STATS_ROLE_OTHER   5
+#define BT_HCI_VS_SCHED_STATS_ROLE_COUNT   6
+
+struct bt_hci_cp_vs_read_sched_stats {
+	uint8_t  clear;
+} __packed;
+
+struct bt_hci_rp_vs_read_sched_stats {
+	uint8_t  status;
+	uint32_t prepare_count;
+	uint32_t resume_count;
+	uint32_t prepare_queued;
+	uint32_t preempt_stop_fail;
+	/* Skipped ticker expirations at prepare: 0, 1, 2 and 3-or-more */
+	uint32_t prepare_lazy[BT_HCI_VS_SCHED_STATS_LAZY_BUCKETS];
+	uint16_t prepare_lazy_max;
+	uint32_t done_count[BT_HCI_VS_SCHED_STATS_ROLE_COUNT];
+	uint32_t done_aborted;
+	uint32_t done_late;
+} __packed;
+
 /* Events */
 
 struct bt_hci_evt_vs {
@@ -0,0 +1,137 @@
+/** @file
+ *  @brief Bluetooth ISO receive jitter buffer
+ */
+
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_BLUETOOTH_ISO_JBUF_H_
+#define ZEPHYR_INCLUDE_BLUETOOTH_ISO_JBUF_H_
+
+/**
+ * @brief ISO receive jitter buffer
+ * @defgroup bt_iso_jbuf ISO receive jitter buffer
+ * @ingroup bluetooth
+ * @{
+ *
+ * The ISO jitter buffer stages SDUs delivered by the @ref bt_iso_chan_ops
+ * recv callback and re-orders them by packet sequence number, so that a
+ * renderer can read frames in order with bounded latency instead of
+ * consuming them in callback context. SDUs arriving behind the read
+ * cursor are dropped as late, and the buffer tracks overrun and underrun
+ * counts for tuning the staging depth against the SDU interval.
+ */
+
+#include <stdint.h>
+
+#include <zephyr/bluetooth/iso.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief ISO jitter buffer statistics. */
+struct bt_iso_jbuf_stats {
+	/** SDUs accepted into the buffer */
+	uint32_t queued;
+	/** SDUs handed to the reader */
+	uint32_t delivered;
+	/** SDUs dropped because they arrived behind the read cursor */
+	uint32_t dropped_late;
+	/** SDUs dropped because the buffer was full (oldest evicted) */
+	uint32_t overruns;
+	/** Reads that found the buffer empty within their timeout */
+	uint32_t underruns;
+};
+
+/** @brief ISO jitter buffer.
+ *
+ * All fields are internal; initialize with bt_iso_jbuf_init().
+ */
+struct bt_iso_jbuf {
+	struct {
+		struct net_buf *buf;
+		struct bt_iso_recv_info info;
+	} slots[CONFIG_BT_ISO_JITTER_BUF_DEPTH];
+	struct bt_iso_jbuf_stats stats;
+	struct k_sem ready;
+	struct k_spinlock lock;
+	uint16_t next_seq;
+	uint8_t depth;
+	uint8_t count;
+	bool started;
+};
+
+/** @brief Initialize an ISO jitter buffer.
+ *
+ *  @param jbuf  Jitter buffer to initialize.
+ *  @param depth Staging capacity in SDUs. The buffer holds at most this
+ *               many SDUs; a put on a full buffer evicts the oldest one.
+ *               Must be in [1, @kconfig{CONFIG_BT_ISO_JITTER_BUF_DEPTH}].
+ *
+ *  @retval 0 Success.
+ *  @retval -EINVAL Invalid depth.
+ */
+int bt_iso_jbuf_init(struct bt_iso_jbuf *jbuf, uint8_t depth);
+
+/** @brief Stage a received SDU.
+ *
+ *  Call from the @ref bt_iso_chan_ops recv callback. On success the
+ *  buffer is referenced by the jitter buffer; the caller does not need
+ *  to keep its own reference.
+ *
+ *  @param jbuf Jitter buffer.
+ *  @param buf  SDU buffer as delivered to the recv callback.
+ *  @param info Packet metadata as delivered to the recv callback.
+ *
+ *  @retval 0 SDU staged.
+ *  @retval -EALREADY SDU dropped: behind the read cursor or duplicate.
+ */
+int bt_iso_jbuf_put(struct bt_iso_jbuf *jbuf, struct net_buf *buf,
+		    const struct bt_iso_recv_info *info);
+
+/** @brief Read the next in-order SDU.
+ *
+ *  Blocks up to @p timeout until an SDU is staged. The returned buffer
+ *  is owned by the caller, who must unreference it when done.
+ *
+ *  @param jbuf    Jitter buffer.
+ *  @param timeout How long to wait for an SDU.
+ *  @param info    Packet metadata output; may be NULL.
+ *
+ *  @return The SDU with the lowest pending sequence number, or NULL on
+ *          timeout (counted as an underrun).
+ */
+struct net_buf *bt_iso_jbuf_get(struct bt_iso_jbuf *jbuf, k_timeout_t timeout,
+				struct bt_iso_recv_info *info);
+
+/** @brief Drop all staged SDUs and reset the read cursor.
+ *
+ *  Statistics are preserved.
+ *
+ *  @param jbuf Jitter buffer.
+ */
+void bt_iso_jbuf_flush(struct bt_iso_jbuf *jbuf);
+
+/** @brief Get a snapshot of the buffer statistics.
+ *
+ *  @param jbuf  Jitter buffer.
+ *  @param stats Statistics output.
+ */
+void bt_iso_jbuf_stats_get(struct bt_iso_jbuf *jbuf,
+			   struct bt_iso_jbuf_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_BLUETOOTH_ISO_JBUF_H_ */
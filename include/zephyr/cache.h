@@ -542,6 +542,93 @@ static ALWAYS_INLINE void *sys_cache_uncached_ptr_get(void __sparse_cache *ptr)
 #endif
 }
 
+/**
+ * @brief Dirty-range tracker for a DMA buffer.
+ *
+ * Collects the extent touched by the CPU between cache maintenance
+ * points so that one flush covers it, instead of conservatively
+ * flushing the whole buffer (or flushing piecewise) before each DMA
+ * operation. Trackers are caller-owned, one per buffer, and are not
+ * thread safe; serialize access like the buffer itself.
+ */
+struct sys_cache_track {
+	/** Lowest dirty address, aligned down to a cache line */
+	uintptr_t start;
+	/** One past the highest dirty address, aligned up to a cache line */
+	uintptr_t end;
+	/** Region is coherent or write-through: flushes are skipped */
+	bool coherent;
+};
+
+/**
+ * @brief Initialize a dirty-range tracker.
+ *
+ * @param track Tracker to initialize.
+ * @param coherent True when the tracked buffer lives in coherent or
+ * write-through memory, making write-back flushes unnecessary;
+ * sys_cache_track_flush() then only resets the tracked range.
+ */
+static ALWAYS_INLINE void sys_cache_track_init(struct sys_cache_track *track,
+					       bool coherent)
+{
+	track->start = UINTPTR_MAX;
+	track->end = 0;
+	track->coherent = coherent;
+}
+
+/**
+ * @brief Record a CPU write into the tracked buffer.
+ *
+ * Extends the pending dirty range to cover @p addr / @p size, aligned
+ * outward to whole cache lines. Overlapping and adjacent marks coalesce
+ * into one range for free.
+ *
+ * @param track Tracker of the buffer being written.
+ * @param addr Start of the written region.
+ * @param size Size of the written region.
+ */
+static ALWAYS_INLINE void sys_cache_track_dirty(struct sys_cache_track *track,
+						void *addr, size_t size)
+{
+	size_t line = sys_cache_data_line_size_get();
+	uintptr_t start = (uintptr_t)addr;
+	uintptr_t end = start + size;
+
+	if (line > 0) {
+		start = ROUND_DOWN(start, line);
+		end = ROUND_UP(end, line);
+	}
+
+	track->start = MIN(track->start, start);
+	track->end = MAX(track->end, end);
+}
+
+/**
+ * @brief Flush the coalesced dirty range and reset the tracker.
+ *
+ * Issues at most one sys_cache_data_flush_range() covering everything
+ * recorded since the last flush. Nothing is flushed when no writes were
+ * recorded or when the tracker was initialized as coherent.
+ *
+ * @param track Tracker of the buffer handed to the device.
+ *
+ * @retval 0 If succeeded or nothing needed flushing.
+ * @retval -errno Negative errno code from the flush operation.
+ */
+static ALWAYS_INLINE int sys_cache_track_flush(struct sys_cache_track *track)
+{
+	int ret = 0;
+
+	if (!track->coherent && (track->start < track->end)) {
+		ret = sys_cache_data_flush_range((void *)track->start,
+						 track->end - track->start);
+	}
+
+	track->start = UINTPTR_MAX;
+	track->end = 0;
+
+	return ret;
+}
 
 #ifdef CONFIG_LIBMETAL
 static ALWAYS_INLINE void sys_cache_flush(void *addr, size_t size)
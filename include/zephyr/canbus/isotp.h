@@ -301,6 +301,30 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
  */
 int isotp_recv_net(struct isotp_recv_ctx *rctx, struct net_buf **buffer, k_timeout_t timeout);
 
+#if defined(CONFIG_ISOTP_RX_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Reception statistics of a receiving context
+ */
+struct isotp_rx_stats {
+	/** Payload bytes received */
+	uint32_t rx_bytes;
+	/** Completed messages received */
+	uint32_t rx_msgs;
+	/** FC WAIT frames sent due to buffer shortage */
+	uint32_t fc_wait_frames;
+};
+
+/**
+ * @brief Get the reception statistics of a context
+ *
+ * The counters accumulate since isotp_bind.
+ *
+ * @param rctx  Context that is already bound.
+ * @param stats Pointer where the statistics are copied to.
+ */
+void isotp_rx_stats_get(const struct isotp_recv_ctx *rctx, struct isotp_rx_stats *stats);
+#endif
+
 /**
  * @brief Send data
  *
@@ -464,6 +488,15 @@ struct isotp_recv_ctx {
 	struct isotp_msg_id rx_addr;
 	struct isotp_msg_id tx_addr;
 	struct isotp_fc_opts opts;
+#ifdef CONFIG_ISOTP_RX_FC_AUTOTUNE
+	/* flow control parameters given at bind time (tuning bounds) */
+	struct isotp_fc_opts opts_cfg;
+	/* consecutive blocks whose buffers were allocated without waiting */
+	uint8_t alloc_streak;
+#endif
+#ifdef CONFIG_ISOTP_RX_STATS
+	struct isotp_rx_stats stats;
+#endif
 	uint8_t state;
 	uint8_t bs;
 	uint8_t wft;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_ISR_PROF_H_
+#define ZEPHYR_INCLUDE_DEBUG_ISR_PROF_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief ISR runtime profiler
+ * @defgroup isr_prof ISR runtime profiler
+ * @ingroup os_services
+ * @{
+ */
+
+/** Runtime statistics of one software ISR table entry */
+struct isr_prof_stats {
+	/** Number of times the ISR ran */
+	uint32_t count;
+	/** Total time spent in the ISR, in cycles */
+	uint64_t total_cycles;
+	/** Longest single run of the ISR, in cycles. While this ISR runs,
+	 * interrupts of the same or lower priority are locked out, so this
+	 * is also the maximum lockout interval the ISR inflicts on them.
+	 */
+	uint32_t max_cycles;
+};
+
+/**
+ * @typedef isr_prof_alarm_cb_t
+ * @brief High watermark alarm callback
+ *
+ * Invoked from interrupt context, directly after the offending ISR
+ * returned. Keep it short.
+ *
+ * @param table_idx Index of the ISR in the software ISR table
+ * @param cycles Runtime of the offending ISR invocation, in cycles
+ */
+typedef void (*isr_prof_alarm_cb_t)(unsigned int table_idx, uint32_t cycles);
+
+/**
+ * @brief Get the statistics of one software ISR table entry
+ *
+ * @param table_idx Index of the ISR in the software ISR table, i.e. the
+ *                  IRQ number minus CONFIG_GEN_IRQ_START_VECTOR
+ * @param stats Output buffer for the statistics
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if @a table_idx is out of range
+ */
+int isr_prof_stats_get(unsigned int table_idx, struct isr_prof_stats *stats);
+
+/**
+ * @brief Reset the collected ISR statistics
+ */
+void isr_prof_reset(void);
+
+/**
+ * @brief Install a high watermark alarm
+ *
+ * The callback fires from interrupt context whenever an ISR invocation
+ * both exceeds @a threshold_cycles and sets a new maximum for its table
+ * entry, so a stuck long-running handler produces one alarm per new
+ * high watermark rather than one per invocation.
+ *
+ * @param threshold_cycles Runtime threshold in cycles, 0 disables the alarm
+ * @param cb Callback to invoke, may be NULL to disable the alarm
+ */
+void isr_prof_alarm_set(uint32_t threshold_cycles, isr_prof_alarm_cb_t cb);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_ISR_PROF_H_ */
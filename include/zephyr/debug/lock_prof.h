@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DEBUG_LOCK_PROF_H_
+#define ZEPHYR_INCLUDE_DEBUG_LOCK_PROF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Lock contention profiler
+ * @defgroup lock_prof Lock contention profiler
+ * @ingroup os_services
+ * @{
+ */
+
+/** Kind of lock a profiled call site acquires */
+enum lock_prof_kind {
+	/** k_spinlock call site */
+	LOCK_PROF_KIND_SPINLOCK,
+	/** k_mutex call site */
+	LOCK_PROF_KIND_MUTEX,
+};
+
+/** Statistics collected for one lock call site */
+struct lock_prof_stats {
+	/** Call site identifier: a "file:line" string for spinlocks, the
+	 * caller return address for mutexes.
+	 */
+	const void *site;
+	/** Kind of the lock acquired at this call site */
+	enum lock_prof_kind kind;
+	/** Number of acquisitions */
+	uint32_t count;
+	/** Total cycles spent spinning on a contended spinlock or waiting
+	 * for a contended mutex.
+	 */
+	uint64_t contended_cycles;
+	/** Longest time the lock was held, in cycles */
+	uint32_t max_hold_cycles;
+};
+
+/**
+ * @typedef lock_prof_cb_t
+ * @brief Callback used by lock_prof_foreach()
+ *
+ * @param stats Snapshot of one call site entry
+ * @param user_data User data given to lock_prof_foreach()
+ */
+typedef void (*lock_prof_cb_t)(const struct lock_prof_stats *stats,
+			       void *user_data);
+
+/**
+ * @brief Iterate over all profiled lock call sites
+ *
+ * @param cb Callback invoked for every call site with recorded data
+ * @param user_data User data passed to the callback
+ */
+void lock_prof_foreach(lock_prof_cb_t cb, void *user_data);
+
+/**
+ * @brief Reset all collected lock statistics
+ */
+void lock_prof_reset(void);
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Called by the lock implementations when a profiled lock is released */
+void z_lock_prof_update(const void *site, uint8_t kind,
+			uint32_t contended_cycles, uint32_t hold_cycles);
+
+/** @endcond */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DEBUG_LOCK_PROF_H_ */
@@ -391,6 +391,13 @@ struct device_state {
 	 * invoked.
 	 */
 	bool initialized : 1;
+
+#if defined(CONFIG_DEVICE_INIT_PARALLEL) || defined(__DOXYGEN__)
+	/** Indicates the device init entry has been claimed by a
+	 * parallel init worker (it may still be running).
+	 */
+	bool init_claimed : 1;
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
 };
 
 struct pm_device_base;
@@ -755,6 +762,11 @@ size_t z_device_get_all_static(const struct device **devices);
  * does not include the readiness checks of device_get_binding(). At minimum
  * this means that the device has been successfully initialized.
  *
+ * When @kconfig{CONFIG_DEVICE_DEFERRED_INIT_LAZY} is enabled, calling this
+ * on an uninitialized ``zephyr,deferred-init`` device from thread context
+ * triggers its (one-time) initialization, and the result reflects the
+ * outcome.
+ *
  * @param dev pointer to the device in question.
  *
  * @retval true If the device is ready for use.
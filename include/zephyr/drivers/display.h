@@ -155,6 +155,31 @@ typedef int (*display_write_api)(const struct device *dev, const uint16_t x,
 				 const struct display_buffer_descriptor *desc,
 				 const void *buf);
 
+/**
+ * @typedef display_write_callback_t
+ * @brief Callback used to signal completion of an asynchronous write
+ *
+ * @param dev Pointer to device structure
+ * @param result 0 on success else negative errno code
+ * @param user_data Pointer passed to display_write_async()
+ *
+ * @note May be invoked from interrupt context.
+ */
+typedef void (*display_write_callback_t)(const struct device *dev, int result,
+					 void *user_data);
+
+/**
+ * @typedef display_write_async_api
+ * @brief Callback API for writing data to the display asynchronously
+ * See display_write_async() for argument description
+ */
+typedef int (*display_write_async_api)(const struct device *dev, const uint16_t x,
+				       const uint16_t y,
+				       const struct display_buffer_descriptor *desc,
+				       const void *buf,
+				       display_write_callback_t callback,
+				       void *user_data);
+
 /**
  * @typedef display_read_api
  * @brief Callback API for reading data from the display
@@ -223,6 +248,7 @@ __subsystem struct display_driver_api {
 	display_blanking_on_api blanking_on;
 	display_blanking_off_api blanking_off;
 	display_write_api write;
+	display_write_async_api write_async;
 	display_read_api read;
 	display_get_framebuffer_api get_framebuffer;
 	display_set_brightness_api set_brightness;
@@ -254,6 +280,46 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write data to display asynchronously
+ *
+ * Starts the transfer and returns without waiting for it to finish; the
+ * callback is invoked, possibly from interrupt context, once the data has
+ * been flushed to the display. The buffer must remain valid and unmodified
+ * until then. This allows rendering of the next frame to overlap the
+ * transfer of the previous one. Only one asynchronous write may be in
+ * flight per device.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Pointer to a structure describing the buffer layout
+ * @param buf Pointer to buffer array
+ * @param callback Function called when the write completes
+ * @param user_data Pointer passed to the completion callback
+ *
+ * @retval 0 on success else negative errno code.
+ * @retval -EBUSY if a previous asynchronous write is still in flight.
+ * @retval -ENOSYS if not implemented, the caller should fall back to
+ *         display_write().
+ */
+static inline int display_write_async(const struct device *dev, const uint16_t x,
+				      const uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf,
+				      display_write_callback_t callback,
+				      void *user_data)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+
+	if (api->write_async == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->write_async(dev, x, y, desc, buf, callback, user_data);
+}
+
 /**
  * @brief Read data from display
  *
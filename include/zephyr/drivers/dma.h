@@ -428,6 +428,14 @@ static inline int dma_reload(const struct device *dev, uint32_t channel,
  * Start is allowed on channels that have already been started and must report
  * success.
  *
+ * Drivers should retain the configured transfer list so that a channel whose
+ * transfer has completed can be started again without calling dma_config()
+ * first, allowing a descriptor chain built once to be submitted many times
+ * without rebuilding it. For endlessly repeating buffers, a cyclic transfer
+ * list (see the cyclic flag in @ref dma_config) keeps the channel running
+ * with no resubmission at all; its progress is observable through
+ * dma_get_status().
+ *
  * @funcprops \isr_ok
  *
  * @param dev     Pointer to the device structure for the driver instance.
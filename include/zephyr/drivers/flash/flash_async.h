@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Asynchronous flash operations with completion notification.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_ASYNC_H_
+#define ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_ASYNC_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous flash operation completion callback.
+ *
+ * Called from the flash async work queue thread after the operation
+ * finished.
+ *
+ * @param dev Flash device the operation ran on.
+ * @param result Operation result, 0 on success, negative errno on failure.
+ * @param user_data User data passed on submission.
+ */
+typedef void (*flash_async_callback_t)(const struct device *dev, int result,
+				       void *user_data);
+
+/** @cond INTERNAL_HIDDEN */
+enum flash_async_op {
+	FLASH_ASYNC_OP_READ,
+	FLASH_ASYNC_OP_WRITE,
+	FLASH_ASYNC_OP_ERASE,
+};
+/** @endcond */
+
+/**
+ * @brief Asynchronous flash request.
+ *
+ * Must remain valid (and its buffers untouched) from submission until
+ * completion. All members are internal.
+ */
+struct flash_async_request {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_work work;
+	struct k_sem done;
+	const struct device *dev;
+	enum flash_async_op op;
+	off_t offset;
+	union {
+		void *read_buf;
+		const void *write_buf;
+	};
+	size_t len;
+	flash_async_callback_t callback;
+	void *user_data;
+	int result;
+	/** @endcond */
+};
+
+/**
+ * @brief Read from flash asynchronously.
+ *
+ * The operation is queued to the flash async work queue and the call
+ * returns immediately. Completion is reported through the optional
+ * @p callback and can be awaited with @ref flash_async_wait.
+ *
+ * @param dev Flash device.
+ * @param offset Offset to read from, see flash_read().
+ * @param data Destination buffer, must stay valid until completion.
+ * @param len Number of bytes to read.
+ * @param req Request tracking object, must stay valid until completion.
+ * @param callback Completion callback, may be NULL.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 on successful submission.
+ * @retval -EBUSY when @p req is still tracking an earlier operation.
+ */
+int flash_read_async(const struct device *dev, off_t offset, void *data, size_t len,
+		     struct flash_async_request *req, flash_async_callback_t callback,
+		     void *user_data);
+
+/**
+ * @brief Write to flash asynchronously.
+ *
+ * See @ref flash_read_async for the submission and completion semantics
+ * and flash_write() for the operation requirements.
+ *
+ * @param dev Flash device.
+ * @param offset Offset to write to.
+ * @param data Data to write, must stay valid until completion.
+ * @param len Number of bytes to write.
+ * @param req Request tracking object, must stay valid until completion.
+ * @param callback Completion callback, may be NULL.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 on successful submission.
+ * @retval -EBUSY when @p req is still tracking an earlier operation.
+ */
+int flash_write_async(const struct device *dev, off_t offset, const void *data,
+		      size_t len, struct flash_async_request *req,
+		      flash_async_callback_t callback, void *user_data);
+
+/**
+ * @brief Erase flash asynchronously.
+ *
+ * See @ref flash_read_async for the submission and completion semantics
+ * and flash_erase() for the operation requirements. Intended to overlap
+ * long erase latencies with useful work in the submitting thread.
+ *
+ * @param dev Flash device.
+ * @param offset Offset of the area to erase, page aligned.
+ * @param size Size of the area to erase, page aligned.
+ * @param req Request tracking object, must stay valid until completion.
+ * @param callback Completion callback, may be NULL.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 on successful submission.
+ * @retval -EBUSY when @p req is still tracking an earlier operation.
+ */
+int flash_erase_async(const struct device *dev, off_t offset, size_t size,
+		      struct flash_async_request *req, flash_async_callback_t callback,
+		      void *user_data);
+
+/**
+ * @brief Wait for an asynchronous flash operation to complete.
+ *
+ * @param req Submitted request.
+ * @param timeout Maximum time to wait, or K_NO_WAIT to poll.
+ *
+ * @retval result The operation result, 0 on success, negative errno on
+ *	   failure.
+ * @retval -EAGAIN when the operation did not complete within @p timeout.
+ */
+int flash_async_wait(struct flash_async_request *req, k_timeout_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_FLASH_FLASH_ASYNC_H_ */
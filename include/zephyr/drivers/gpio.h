@@ -1683,6 +1683,197 @@ static inline int gpio_pin_toggle_dt(const struct gpio_dt_spec *spec)
 	return gpio_pin_toggle(spec->port, spec->pin);
 }
 
+/**
+ * @brief Validated group of GPIO pins, possibly spanning several ports.
+ *
+ * Initialize with gpio_pin_group_init(). Group operations address pins by
+ * their index in the spec array: bit @em i of a group mask or value refers
+ * to the pin described by the i-th @ref gpio_dt_spec. Pins sharing a port
+ * are written with a single port operation.
+ */
+struct gpio_pin_group {
+	/** Pins in the group, in group bit order */
+	const struct gpio_dt_spec *specs;
+	/** Number of pins in the group */
+	size_t count;
+};
+
+/**
+ * @brief Initialize a group of GPIO pins.
+ *
+ * Validates that all pin controllers are ready so that the group operations
+ * can skip per-pin checks.
+ *
+ * The spec array is referenced, not copied, and must remain valid for the
+ * lifetime of the group. The pins themselves must be configured separately,
+ * e.g. with gpio_pin_configure_dt().
+ *
+ * @param group Group to initialize.
+ * @param specs Array of pin specifications, one per group bit.
+ * @param count Number of pins, at most 32.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If @p count does not fit a group mask.
+ * @retval -ENODEV If a pin controller is not ready.
+ */
+static inline int gpio_pin_group_init(struct gpio_pin_group *group,
+				      const struct gpio_dt_spec *specs,
+				      size_t count)
+{
+	if (count > 32U) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (!gpio_is_ready_dt(&specs[i])) {
+			return -ENODEV;
+		}
+	}
+
+	group->specs = specs;
+	group->count = count;
+
+	return 0;
+}
+
+/**
+ * @brief Set logical levels of selected pins in a group.
+ *
+ * Pins selected by @p mask are set to the corresponding bits of @p value;
+ * bit @em i refers to the i-th pin of the group. Levels are logical, i.e.
+ * pins configured as GPIO_ACTIVE_LOW are inverted. All selected pins on the
+ * same port are written with one gpio_port_set_masked_raw() call; pins on
+ * different ports are written port by port, in group order.
+ *
+ * @param group Pin group.
+ * @param mask Group bit mask selecting the pins to write.
+ * @param value Group bit values to set the selected pins to.
+ *
+ * @retval 0 If successful.
+ * @retval -errno Negative errno code from the first failing port write.
+ */
+static inline int gpio_pin_group_set_masked(const struct gpio_pin_group *group,
+					    uint32_t mask, uint32_t value)
+{
+	for (size_t i = 0; i < group->count; i++) {
+		const struct device *port = group->specs[i].port;
+		gpio_port_pins_t port_mask = 0;
+		gpio_port_value_t port_value = 0;
+		bool done = false;
+		int ret;
+
+		/* Each port is handled once, where it first occurs */
+		for (size_t j = 0; j < i; j++) {
+			if (group->specs[j].port == port) {
+				done = true;
+				break;
+			}
+		}
+
+		if (done) {
+			continue;
+		}
+
+		for (size_t j = i; j < group->count; j++) {
+			const struct gpio_dt_spec *spec = &group->specs[j];
+			bool level = (value & BIT(j)) != 0U;
+
+			if ((spec->port != port) || ((mask & BIT(j)) == 0U)) {
+				continue;
+			}
+
+			if ((spec->dt_flags & GPIO_ACTIVE_LOW) != 0U) {
+				level = !level;
+			}
+
+			port_mask |= (gpio_port_pins_t)BIT(spec->pin);
+			if (level) {
+				port_value |= (gpio_port_value_t)BIT(spec->pin);
+			}
+		}
+
+		if (port_mask == 0U) {
+			continue;
+		}
+
+		ret = gpio_port_set_masked_raw(port, port_mask, port_value);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Set logical levels of all pins in a group.
+ *
+ * @param group Pin group.
+ * @param value Group bit values to set the pins to.
+ *
+ * @retval 0 If successful.
+ * @retval -errno Negative errno code from the first failing port write.
+ */
+static inline int gpio_pin_group_set(const struct gpio_pin_group *group,
+				     uint32_t value)
+{
+	return gpio_pin_group_set_masked(group, UINT32_MAX, value);
+}
+
+/**
+ * @brief Toggle selected pins in a group.
+ *
+ * Pins selected by @p mask are toggled, one gpio_port_toggle_bits() call
+ * per port covered by the selection.
+ *
+ * @param group Pin group.
+ * @param mask Group bit mask selecting the pins to toggle.
+ *
+ * @retval 0 If successful.
+ * @retval -errno Negative errno code from the first failing port write.
+ */
+static inline int gpio_pin_group_toggle(const struct gpio_pin_group *group,
+					uint32_t mask)
+{
+	for (size_t i = 0; i < group->count; i++) {
+		const struct device *port = group->specs[i].port;
+		gpio_port_pins_t port_pins = 0;
+		bool done = false;
+		int ret;
+
+		/* Each port is handled once, where it first occurs */
+		for (size_t j = 0; j < i; j++) {
+			if (group->specs[j].port == port) {
+				done = true;
+				break;
+			}
+		}
+
+		if (done) {
+			continue;
+		}
+
+		for (size_t j = i; j < group->count; j++) {
+			const struct gpio_dt_spec *spec = &group->specs[j];
+
+			if ((spec->port == port) && ((mask & BIT(j)) != 0U)) {
+				port_pins |= (gpio_port_pins_t)BIT(spec->pin);
+			}
+		}
+
+		if (port_pins == 0U) {
+			continue;
+		}
+
+		ret = gpio_port_toggle_bits(port, port_pins);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 /**
  * @brief Helper to initialize a struct gpio_callback properly
  * @param callback A valid Application's callback structure pointer.
@@ -26,6 +26,7 @@ struct i2c_rtio {
 	struct rtio_iodev iodev;
 	struct rtio_iodev_sqe *txn_head;
 	struct rtio_iodev_sqe *txn_curr;
+	struct rtio_iodev_sqe *txn_next;
 	struct i2c_dt_spec dt_spec;
 };
 
@@ -326,6 +326,27 @@ void arm_gic_irq_clear_pending(unsigned int irq);
 void arm_gic_irq_set_priority(
 	unsigned int irq, unsigned int prio, unsigned int flags);
 
+/**
+ * @brief Route a shared peripheral interrupt to a specific CPU
+ *
+ * Changes at runtime which CPU services the given SPI, e.g. to spread
+ * the completion interrupts of multi-queue devices across cores. Only
+ * shared peripheral interrupts can be re-routed; SGIs and PPIs are
+ * banked per CPU.
+ *
+ * @note arm_gic_irq_enable() routes an SPI to the CPU enabling it, so
+ * call this after the interrupt has been enabled.
+ *
+ * @param irq interrupt ID
+ * @param target_cpu CPU index, as used by arch_curr_cpu()
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If @p irq is not an SPI or @p target_cpu is not a
+ * valid CPU.
+ * @retval -ENOTSUP If the GIC configuration does not allow re-routing.
+ */
+int arm_gic_irq_set_affinity(unsigned int irq, unsigned int target_cpu);
+
 /**
  * @brief Get active interrupt ID
  *
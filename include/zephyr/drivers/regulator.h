@@ -419,6 +419,32 @@ static inline int regulator_parent_ship_mode(const struct device *dev)
  */
 int regulator_enable(const struct device *dev);
 
+/**
+ * @brief Enable a set of independent regulators, overlapping settle times.
+ *
+ * Equivalent to calling regulator_enable() on each entry of @p devs, except
+ * that all regulators are switched on first and their `off-on-delay-us`
+ * settle times elapse concurrently: the call sleeps until the last issued
+ * enable has settled, so the total wait is the maximum of the individual
+ * delays instead of their sum. Use one call per group of regulators with no
+ * ordering requirement between them; sequence dependent groups with
+ * consecutive calls.
+ *
+ * If enabling any regulator fails, the regulators already enabled by this
+ * call are released again and the error is returned.
+ *
+ * @note The settle wait runs outside the per-regulator locks, so the listed
+ * regulators must not be operated on from other threads until the call
+ * returns.
+ *
+ * @param devs Array of regulator device instances.
+ * @param count Number of entries in @p devs.
+ *
+ * @retval 0 If all regulators have been successfully enabled.
+ * @retval -errno Negative errno in case of failure.
+ */
+int regulator_enable_batch(const struct device **devs, size_t count);
+
 /**
  * @brief Check if a regulator is enabled.
  *
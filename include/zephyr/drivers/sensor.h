@@ -423,6 +423,30 @@ typedef int (*sensor_channel_get_t)(const struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
 
+/**
+ * @brief One timestamped sample as returned by sensor_fetch_samples()
+ */
+struct sensor_bulk_sample {
+	/** Uptime, in nanoseconds, at which the sample was read out */
+	uint64_t timestamp_ns;
+
+	/** Sample value; X, Y and Z in that order for 3-axis channels,
+	 * only values[0] is used for scalar channels.
+	 */
+	struct sensor_value values[3];
+};
+
+/**
+ * @typedef sensor_fetch_samples_t
+ * @brief Callback API for fetching a batch of samples from a sensor
+ *
+ * See sensor_fetch_samples() for argument description
+ */
+typedef int (*sensor_fetch_samples_t)(const struct device *dev,
+				      enum sensor_channel chan,
+				      struct sensor_bulk_sample *samples,
+				      size_t max_samples);
+
 /**
  * @brief Sensor Channel Specification
  *
@@ -706,6 +730,7 @@ __subsystem struct sensor_driver_api {
 	sensor_channel_get_t channel_get;
 	sensor_get_decoder_t get_decoder;
 	sensor_submit_t submit;
+	sensor_fetch_samples_t fetch_samples;
 };
 
 /**
@@ -904,6 +929,61 @@ static inline int z_impl_sensor_channel_get(const struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+/**
+ * @brief Fetch a batch of timestamped samples from a sensor
+ *
+ * Read up to @p max_samples samples of the given channel into the caller
+ * provided buffer. Drivers for sensors with a hardware FIFO drain as many
+ * buffered samples as fit in one call, typically in a single bus
+ * transaction, instead of one register read-out per sample. When the
+ * driver does not implement batch fetching, a single sample is read
+ * through @ref sensor_sample_fetch_chan and @ref sensor_channel_get and
+ * timestamped on the host, so applications can use this call uniformly.
+ *
+ * The function blocks until the read-out is complete. Like
+ * @ref sensor_sample_fetch it must not be called from an ISR when the
+ * device sits on I2C or SPI.
+ *
+ * @param dev Pointer to the sensor device
+ * @param chan The channel to read
+ * @param samples Buffer receiving the samples, oldest first
+ * @param max_samples Capacity of @p samples in samples
+ *
+ * @return Number of samples stored in @p samples on success (zero when
+ * the FIFO is empty), negative errno code if failure.
+ */
+static inline int sensor_fetch_samples(const struct device *dev,
+				       enum sensor_channel chan,
+				       struct sensor_bulk_sample *samples,
+				       size_t max_samples)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+	int rc;
+
+	if (max_samples == 0) {
+		return 0;
+	}
+
+	if (api->fetch_samples != NULL) {
+		return api->fetch_samples(dev, chan, samples, max_samples);
+	}
+
+	rc = sensor_sample_fetch_chan(dev, chan);
+	if (rc < 0) {
+		return rc;
+	}
+
+	samples[0].timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+
+	rc = sensor_channel_get(dev, chan, samples[0].values);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return 1;
+}
+
 #if defined(CONFIG_SENSOR_ASYNC_API) || defined(__DOXYGEN__)
 
 /*
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Self-servicing ring reception on top of the UART Asynchronous API.
+ */
+
+#ifndef ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_RING_H_
+#define ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_RING_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/serial/uart_async_rx.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Ring reception event types. */
+enum uart_async_ring_event_type {
+	/**
+	 * At least the configured watermark amount of bytes is pending in
+	 * the ring.
+	 */
+	UART_ASYNC_RING_EVT_DATA,
+	/**
+	 * The line went idle (receiver timeout) with data pending in the
+	 * ring. Reported by drivers which map their hardware idle detection
+	 * to the receiver timeout, e.g. IDLE line interrupt or frame timeout.
+	 */
+	UART_ASYNC_RING_EVT_IDLE,
+	/**
+	 * Reception stopped, either due to a line error (see
+	 * uart_async_ring_stop_reason()) or because the ring is full of
+	 * unconsumed data. Reception restarts automatically, in the latter
+	 * case once enough data is consumed.
+	 */
+	UART_ASYNC_RING_EVT_STOPPED,
+};
+
+/** @brief Ring reception event callback.
+ *
+ * Called from the UART driver callback context, which is typically
+ * interrupt context. No data is passed with the event, pending data is
+ * accessed in zero-copy manner with @ref uart_async_ring_claim.
+ *
+ * @param dev UART device.
+ * @param type Event type.
+ * @param user_data User data passed to @ref uart_async_ring_enable.
+ */
+typedef void (*uart_async_ring_callback_t)(const struct device *dev,
+					   enum uart_async_ring_event_type type,
+					   void *user_data);
+
+/** @brief Ring reception instance. */
+struct uart_async_ring {
+	/** Reception buffer accounting. */
+	struct uart_async_rx rx;
+
+	/** UART device. */
+	const struct device *dev;
+
+	/** User callback. */
+	uart_async_ring_callback_t callback;
+
+	/** User data passed to the callback. */
+	void *user_data;
+
+	/** Lock protecting reception restart decisions. */
+	struct k_spinlock lock;
+
+	/** Receiver inactivity timeout in microseconds. */
+	int32_t timeout;
+
+	/** Watermark for @ref UART_ASYNC_RING_EVT_DATA in bytes. */
+	size_t watermark;
+
+	/** Last reception stop reason (enum uart_rx_stop_reason). */
+	uint8_t stop_reason;
+
+	/** Set when reception halted because the ring was full. */
+	bool stalled;
+
+	/** Set between enable and disable calls. */
+	bool enabled;
+};
+
+/** @brief Enable continuous ring reception.
+ *
+ * The module registers its own UART callback and services all buffer
+ * rotation events internally, so no application thread is needed to keep
+ * reception running. The user is notified through @p callback when the
+ * pending amount of data reaches @p watermark or when the line goes idle,
+ * and consumes data in place with @ref uart_async_ring_claim and
+ * @ref uart_async_ring_consume.
+ *
+ * @param dev UART device implementing the asynchronous API.
+ * @param ring Ring instance.
+ * @param config Reception buffer configuration. Must be persistent. The
+ *		 buffer is split into @p config->buf_cnt chunks which are
+ *		 rotated through the driver.
+ * @param timeout Receiver inactivity timeout in microseconds, forwarded to
+ *		  @ref uart_rx_enable. @ref SYS_FOREVER_US disables idle
+ *		  events.
+ * @param watermark Pending byte count that triggers
+ *		    @ref UART_ASYNC_RING_EVT_DATA.
+ * @param callback Event callback.
+ * @param user_data User data passed to the callback.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL on invalid configuration.
+ * @retval -errno on driver failure.
+ */
+int uart_async_ring_enable(const struct device *dev, struct uart_async_ring *ring,
+			   const struct uart_async_rx_config *config, int32_t timeout,
+			   size_t watermark, uart_async_ring_callback_t callback,
+			   void *user_data);
+
+/** @brief Disable ring reception.
+ *
+ * Pending data can still be consumed after disabling.
+ *
+ * @param ring Ring instance.
+ *
+ * @retval 0 on success.
+ * @retval -errno on driver failure.
+ */
+int uart_async_ring_disable(struct uart_async_ring *ring);
+
+/** @brief Claim pending data for in-place processing.
+ *
+ * @param ring Ring instance.
+ * @param data Location where the address of the data is written.
+ * @param length Amount of requested data.
+ *
+ * @return Amount of valid data at @p data, 0 when the ring is empty.
+ */
+size_t uart_async_ring_claim(struct uart_async_ring *ring, uint8_t **data, size_t length);
+
+/** @brief Consume claimed data.
+ *
+ * Pairs with @ref uart_async_ring_claim. Consuming data frees ring space
+ * and restarts reception if it stalled on a full ring.
+ *
+ * @param ring Ring instance.
+ * @param length Amount of data to consume. Must not exceed the amount
+ *		 claimed.
+ */
+void uart_async_ring_consume(struct uart_async_ring *ring, size_t length);
+
+/** @brief Get the reason of the last @ref UART_ASYNC_RING_EVT_STOPPED event.
+ *
+ * @param ring Ring instance.
+ *
+ * @return One of enum uart_rx_stop_reason, or 0 when reception stopped
+ *	   because the ring was full.
+ */
+static inline int uart_async_ring_stop_reason(struct uart_async_ring *ring)
+{
+	return ring->stop_reason;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_SERIAL_UART_ASYNC_RING_H_ */
@@ -475,6 +475,20 @@ struct spi_buf_set {
 	size_t count;
 };
 
+/**
+ * @brief One transfer of a batch submitted with spi_transceive_batch()
+ *
+ * Each transfer is a complete transaction: chip select is asserted for its
+ * duration and released between transfers, unless the configuration holds it
+ * with @ref SPI_HOLD_ON_CS.
+ */
+struct spi_transfer {
+	/** Buffer array where data to be sent originates from, or NULL */
+	const struct spi_buf_set *tx_bufs;
+	/** Buffer array where data to be read will be written to, or NULL */
+	const struct spi_buf_set *rx_bufs;
+};
+
 #if defined(CONFIG_SPI_STATS)
 STATS_SECT_START(spi)
 STATS_SECT_ENTRY32(rx_bytes)
@@ -1135,6 +1149,76 @@ static inline int spi_release_dt(const struct spi_dt_spec *spec)
 	return spi_release(spec->bus, &spec->config);
 }
 
+/**
+ * @brief Execute a list of transfers back-to-back under one configuration.
+ *
+ * All transfers are issued through the single @p config pointer, hence
+ * drivers which detect configuration changes by pointer-comparison
+ * validate and apply the configuration on the first transfer only and
+ * skip peripheral reprogramming for the rest of the list.
+ *
+ * When @p config has @ref SPI_LOCK_ON set, the bus lock is acquired on
+ * the first transfer and held across the whole list, so no other bus
+ * user can interleave. As usual for @ref SPI_LOCK_ON, the lock remains
+ * held after the batch completes and must be released with
+ * spi_release().
+ *
+ * Execution stops at the first failing transfer.
+ *
+ * @note This function is synchronous.
+ *
+ * @note This function is a helper function calling spi_transceive.
+ *
+ * @param dev Pointer to the device structure for the driver instance
+ * @param config Pointer to a valid spi_config structure instance.
+ *        Pointer-comparison may be used to detect changes from
+ *        previous operations.
+ * @param transfers Array of transfers to execute in order.
+ * @param count Number of transfers in the array.
+ *
+ * @retval frames Positive number of frames received by the last transfer
+ *         in slave mode.
+ * @retval 0 If successful in master mode.
+ * @retval -errno Negative errno code on the first failed transfer.
+ */
+static inline int spi_transceive_batch(const struct device *dev,
+				       const struct spi_config *config,
+				       const struct spi_transfer *transfers,
+				       size_t count)
+{
+	int ret = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		ret = spi_transceive(dev, config, transfers[i].tx_bufs,
+				     transfers[i].rx_bufs);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Execute a list of transfers on a SPI bus specified in @p spi_dt_spec.
+ *
+ * This is equivalent to:
+ *
+ *     spi_transceive_batch(spec->bus, &spec->config, transfers, count);
+ *
+ * @param spec SPI specification from devicetree
+ * @param transfers Array of transfers to execute in order.
+ * @param count Number of transfers in the array.
+ *
+ * @return a value from spi_transceive_batch().
+ */
+static inline int spi_transceive_batch_dt(const struct spi_dt_spec *spec,
+					  const struct spi_transfer *transfers,
+					  size_t count)
+{
+	return spi_transceive_batch(spec->bus, &spec->config, transfers, count);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,30 @@ int spi_rtio_copy(struct rtio *r,
 		  const struct spi_buf_set *rx_bufs,
 		  struct rtio_sqe **last_sqe);
 
+/**
+ * @brief Flatten an RTIO transaction into SPI transfer buffers
+ *
+ * Walks a full submission transaction (e.g. command write followed by burst
+ * reads) and converts each operation into a pair of equal length tx/rx
+ * spi_buf entries, using NULL buffers for the unused direction. The result
+ * describes the complete transaction as a single transfer, letting drivers
+ * with DMA support program one descriptor chain covering the whole
+ * transaction and signal a single completion with @ref spi_rtio_complete.
+ *
+ * @param[in] txn_head First submission of the transaction
+ * @param[out] tx_bufs Array of transmit buffers to fill
+ * @param[out] rx_bufs Array of receive buffers to fill
+ * @param[in] max_bufs Capacity of @p tx_bufs and @p rx_bufs
+ *
+ * @retval Number of filled buffer pairs
+ * @retval -ENOMEM transaction does not fit in @p max_bufs entries
+ * @retval -EIO unsupported operation in the transaction
+ */
+int spi_rtio_txn_flatten(struct rtio_iodev_sqe *txn_head,
+			 struct spi_buf *tx_bufs,
+			 struct spi_buf *rx_bufs,
+			 size_t max_bufs);
+
 /**
  * @brief Initialize a SPI RTIO context
  *
@@ -191,6 +191,38 @@ int fcb_append(struct fcb *fcbp, uint16_t len, struct fcb_entry *loc);
  */
 int fcb_append_finish(struct fcb *fcbp, struct fcb_entry *append_loc);
 
+/**
+ * @brief Descriptor of one element for @ref fcb_append_bulk.
+ */
+struct fcb_bulk_entry {
+	const void *fbe_data; /**< Element payload */
+	uint16_t fbe_len; /**< Payload length in bytes */
+};
+
+/**
+ * Append several entries to the circular buffer in one pass.
+ *
+ * Unlike repeated fcb_append()/fcb_append_finish() pairs, the entries are
+ * packed - length headers, payloads and endmarkers - into an internal
+ * buffer and written out with as few flash operations as possible, and the
+ * endmarker CRCs are computed from the supplied payloads instead of being
+ * read back from flash. Entries are stored exactly as fcb_append() would
+ * store them and the batch may span a sector boundary.
+ *
+ * The batch is not atomic: each entry becomes valid once its endmarker
+ * reaches the flash, so after a power cut a prefix of the batch may be
+ * present.
+ *
+ * @param[in] fcbp    FCB instance structure.
+ * @param[in] entries Array of entry descriptors to append.
+ * @param[in] cnt     Number of entries in the array.
+ *
+ * @return 0 on success, negative errno code on failure. On failure the
+ *         partially written batch region is skipped over; entries whose
+ *         endmarker was written before the error remain readable.
+ */
+int fcb_append_bulk(struct fcb *fcbp, const struct fcb_bulk_entry *entries, int cnt);
+
 /**
  * FCB Walk callback function type.
  *
@@ -225,6 +257,52 @@ typedef int (*fcb_walk_cb)(struct fcb_entry_ctx *loc_ctx, void *arg);
  */
 int fcb_walk(struct fcb *fcbp, struct flash_sector *sector, fcb_walk_cb cb, void *cb_arg);
 
+/**
+ * FCB buffered walk callback function type.
+ *
+ * Like @ref fcb_walk_cb, but the entry payload is normally handed over
+ * directly as @p data, read from the walk buffer, so the callback does not
+ * need to issue a flash read of its own. The pointer is only valid for the
+ * duration of the call. When the entry was too large for the walk buffer,
+ * @p data is NULL and the payload must be read with flash_area_read()
+ * using loc_ctx fields as arguments.
+ *
+ * @param[in] loc_ctx entry location information (full context)
+ * @param[in] data entry payload of loc_ctx->loc.fe_data_len bytes, or NULL
+ * @param[in,out] arg callback context, transferred from
+ *                @ref fcb_walk_buffered.
+ *
+ * @return 0 continue walking, non-zero stop walking.
+ */
+typedef int (*fcb_buffered_walk_cb)(struct fcb_entry_ctx *loc_ctx, const void *data, void *arg);
+
+/**
+ * Walk over FCB entries using a caller-supplied read buffer.
+ *
+ * Behaves like @ref fcb_walk, but fills @p buf with large sequential flash
+ * reads and parses, CRC-checks and delivers the entries from it, so walking
+ * a sector costs roughly one flash read per buffer fill instead of several
+ * small reads per entry. Entries appended while the walk is in progress may
+ * not be reported.
+ *
+ * @param[in] fcbp       FCB instance structure.
+ * @param[in] sector     fcb sector to be walked. If null, traverse entire
+ *                       storage.
+ * @param[in] buf        read buffer used for the walk.
+ * @param[in] buf_size   size of @p buf in bytes; a sector-sized buffer
+ *                       gives the fewest flash reads.
+ * @param[in] cb         pointer to the function which gets called for every
+ *                       entry. If cb wants to stop the walk, it should return
+ *                       non-zero value.
+ * @param[in,out] cb_arg callback context, transferred to the callback
+ *                       implementation.
+ *
+ * @return 0 on success, negative on failure (or transferred form callback
+ *         return-value), positive transferred form callback return-value
+ */
+int fcb_walk_buffered(struct fcb *fcbp, struct flash_sector *sector, void *buf, size_t buf_size,
+		      fcb_buffered_walk_cb cb, void *cb_arg);
+
 /**
  * Get next fcb entry location.
  *
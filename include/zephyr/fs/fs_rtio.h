@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous file operations over RTIO
+ * @defgroup fs_rtio Asynchronous file operations over RTIO
+ * @ingroup file_system_storage
+ * @{
+ *
+ * An RTIO IO device wrapping an open file. Read (@ref RTIO_OP_RX) and
+ * write (@ref RTIO_OP_TX, @ref RTIO_OP_TINY_TX) submissions are executed
+ * with fs_read()/fs_write() at the file's current offset from the RTIO
+ * work-queue, so the submitting thread does not block on storage latency
+ * and may queue several operations back to back.
+ *
+ * Operations submitted in one rtio_submit() batch may execute in any
+ * order unless they are linked with @ref RTIO_SQE_CHAINED or
+ * @ref RTIO_SQE_TRANSACTION; chain submissions that depend on the
+ * file offset advancing in order.
+ */
+
+/** @brief RTIO IO device wrapping an open file */
+struct fs_rtio_iodev {
+	/** RTIO IO device, to be passed to rtio_sqe_prep_read() and alike */
+	struct rtio_iodev iodev;
+	/** File the submissions operate on, must stay open while in use */
+	struct fs_file_t *zfp;
+};
+
+/**
+ * @brief Initialize an RTIO IO device operating on an open file.
+ *
+ * The file must have been opened with fs_open() before any submission is
+ * made and must not be closed while submissions are in flight.
+ *
+ * @param fs_iodev IO device to initialize.
+ * @param zfp File the IO device operates on.
+ */
+void fs_rtio_iodev_init(struct fs_rtio_iodev *fs_iodev, struct fs_file_t *zfp);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
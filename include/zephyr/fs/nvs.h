@@ -61,6 +61,12 @@ struct nvs_fs {
 	const struct flash_parameters *flash_parameters;
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+	/** IDs owning the lookup cache entries */
+	uint16_t lookup_cache_id[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	/** True when the lookup cache no longer covers every stored ID */
+	bool lookup_cache_degraded;
+#endif
 #endif
 };
 
@@ -60,9 +60,21 @@ struct zms_fs {
 	const struct flash_parameters *flash_parameters;
 	/** Size of an Allocation Table Entry */
 	size_t ate_size;
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/** Work item running proactive garbage collection */
+	struct k_work gc_work;
+#endif
 #if CONFIG_ZMS_LOOKUP_CACHE
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+	/** ID owning each lookup cache slot, makes cache hits definitive */
+	uint32_t lookup_cache_id[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_STATS
+	/** Number of lookups served from the cache */
+	uint32_t lookup_cache_hits;
+	/** Number of lookups that fell back to a linear ATE search */
+	uint32_t lookup_cache_misses;
+#endif
 #endif
 };
 
@@ -200,6 +212,22 @@ size_t zms_active_sector_free_space(struct zms_fs *fs);
  */
 int zms_sector_use_next(struct zms_fs *fs);
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_STATS
+/**
+ * @brief Get the lookup cache hit/miss counters and reset them.
+ *
+ * A high miss ratio indicates that `CONFIG_ZMS_LOOKUP_CACHE_SIZE` is too
+ * small for the ID working set and reads are paying for linear ATE searches.
+ *
+ * @param fs Pointer to the file system.
+ * @param hits Pointer for receiving the number of lookups served from the cache.
+ * @param misses Pointer for receiving the number of lookups that missed the cache.
+ *
+ * @return 0 on success. On error, returns negative value of error codes defined in `errno.h`.
+ */
+int zms_lookup_cache_stats_get(struct zms_fs *fs, uint32_t *hits, uint32_t *misses);
+#endif
+
 /**
  * @}
  */
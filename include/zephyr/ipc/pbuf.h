@@ -223,6 +223,33 @@ int pbuf_write(struct pbuf *pb, const char *buf, uint16_t len);
  */
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len);
 
+/**
+ * @brief Get a snapshot of the write index.
+ *
+ * The returned value may be passed to pbuf_is_rd_pending() to check whether
+ * the reader has already consumed all the data written before the snapshot
+ * was taken. May only be called by the writer.
+ *
+ * @param pb	A buffer to take the snapshot from.
+ * @retval uint32_t	Current value of the write index.
+ */
+uint32_t pbuf_wr_idx_get(const struct pbuf *pb);
+
+/**
+ * @brief Check if the reader is behind a given write index snapshot.
+ *
+ * The function reads back the read index from the shared memory and compares
+ * it with a write index snapshot taken with pbuf_wr_idx_get(). May only be
+ * called by the writer.
+ *
+ * @param pb	A buffer to be checked.
+ * @param wr_idx	Write index snapshot taken before the write in question.
+ * @retval true		The reader has not yet consumed all the data written
+ *			before the snapshot was taken.
+ * @retval false	Everything written before the snapshot was consumed.
+ */
+bool pbuf_is_rd_pending(struct pbuf *pb, uint32_t wr_idx);
+
 /**
  * @}
  */
@@ -1133,6 +1133,33 @@ void k_sched_time_slice_set(int32_t slice, int prio);
 void k_thread_time_slice_set(struct k_thread *th, int32_t slice_ticks,
 			     k_thread_timeslice_fn_t expired, void *data);
 
+#ifdef CONFIG_IPI_METRICS
+/** @brief Scheduler IPI delivery metrics.
+ *
+ * Counters accumulated since boot; see k_ipi_metrics_get().
+ */
+struct k_ipi_metrics {
+	/** Scheduling events that flagged at least one CPU for an IPI */
+	uint64_t flag_events;
+	/** Total CPU targets accumulated across all flag events */
+	uint64_t cpu_targets;
+	/** Directed IPIs actually raised after coalescing */
+	uint64_t directed_ipis;
+	/** Broadcast IPIs actually raised after coalescing */
+	uint64_t broadcast_ipis;
+};
+
+/** @brief Retrieve scheduler IPI delivery metrics.
+ *
+ * Comparing @a cpu_targets (or @a flag_events) against the number of
+ * IPIs actually raised shows how much coalescing and directed delivery
+ * are saving.
+ *
+ * @param metrics Location to store the counters.
+ */
+void k_ipi_metrics_get(struct k_ipi_metrics *metrics);
+#endif /* CONFIG_IPI_METRICS */
+
 /** @} */
 
 /**
@@ -1932,6 +1959,13 @@ struct k_queue {
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	/** Lock-free staging stack for k_queue_append_mpsc() */
+	atomic_ptr_t stage;
+	/** Number of threads advertised as pending on the queue */
+	atomic_t sleepers;
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	Z_DECL_POLL_EVENT
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_queue)
@@ -1997,6 +2031,29 @@ __syscall void k_queue_cancel_wait(struct k_queue *queue);
  */
 void k_queue_append(struct k_queue *queue, void *data);
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+/**
+ * @brief Append an element to a queue without taking the queue lock.
+ *
+ * This routine appends a data item to @a queue by pushing it onto a
+ * lock-free staging stack; the queue spinlock is only taken when a
+ * pending consumer must be woken.  Staged items are folded into the
+ * queue, in FIFO order, when a consumer next calls k_queue_get(); they
+ * are not visible to k_queue_peek_head()/k_queue_is_empty() and do not
+ * trigger k_poll() events until then, so consumers must use
+ * k_queue_get() rather than polling.
+ *
+ * The data item requirements match k_queue_append().  Only available
+ * from supervisor mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Address of the data item.
+ */
+void k_queue_append_mpsc(struct k_queue *queue, void *data);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 /**
  * @brief Append an element to a queue.
  *
@@ -2284,6 +2341,46 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+/**
+ * @brief Wake up to @a count threads pending on a futex
+ *
+ * Wake up to @a count of the highest priority threads pending on the
+ * supplied futex. Unlike k_futex_wake(), this allows waking a bounded
+ * batch of waiters, e.g. to hand off work to a fixed number of threads
+ * without a thundering herd.
+ *
+ * @param futex Futex to wake up pending threads.
+ * @param count Maximum number of threads to wake.
+ * @retval -EACCES Caller does not have access to the futex address.
+ * @retval -EINVAL Futex parameter address not recognized by the kernel.
+ * @retval Number of threads that were woken up.
+ */
+__syscall int k_futex_wake_n(struct k_futex *futex, uint32_t count);
+
+/**
+ * @brief Wake some waiters and requeue the rest onto another futex
+ *
+ * Wake up to @a wake_count of the highest priority threads pending on the
+ * supplied futex, then move all remaining waiters to pend on @a target
+ * without waking them. A moved waiter's timeout (if any) stays armed and
+ * is measured against its original k_futex_wait() call.
+ *
+ * This is the building block for condition variable broadcast: waking one
+ * waiter and requeueing the others onto the mutex's futex avoids waking
+ * every waiter only to have all but one immediately block again.
+ *
+ * @param futex Futex to wake and requeue pending threads from.
+ * @param wake_count Maximum number of threads to wake.
+ * @param target Futex the remaining waiters are moved to; must differ from
+ *               @a futex.
+ * @retval -EACCES Caller does not have access to a futex address.
+ * @retval -EINVAL A futex parameter address not recognized by the kernel,
+ *                 or @a target is the same futex as @a futex.
+ * @retval Number of threads that were woken up.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, uint32_t wake_count,
+			      struct k_futex *target);
+
 /** @} */
 #endif
 
@@ -2303,6 +2400,13 @@ struct k_event {
 	uint32_t          events;
 	struct k_spinlock lock;
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/** Bitwise OR of the events every current waiter is waiting for */
+	uint32_t          waiters_mask;
+	/** Number of current waiters interested in each event bit */
+	uint16_t          waiters_per_bit[32];
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -2975,7 +3079,12 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 struct k_work;
 struct k_work_q;
 struct k_work_queue_config;
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+extern struct k_work_q k_sys_work_qs[CONFIG_MP_MAX_NUM_CPUS];
+#define k_sys_work_q k_sys_work_qs[0]
+#else
 extern struct k_work_q k_sys_work_q;
+#endif
 
 /**
  * INTERNAL_HIDDEN @endcond
@@ -3003,6 +3112,18 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/** Spin while the owner runs on another CPU before pending */
+	bool adaptive_spin;
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
+#ifdef CONFIG_LOCK_PROFILING
+	/** Contention profiler bookkeeping, see kernel/lock_prof.c */
+	const void *prof_site;
+	uint32_t prof_wait;
+	uint32_t prof_acquired;
+#endif /* CONFIG_LOCK_PROFILING */
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -3052,6 +3173,22 @@ struct k_mutex {
  */
 __syscall int k_mutex_init(struct k_mutex *mutex);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/**
+ * @brief Enable or disable adaptive spinning on a mutex.
+ *
+ * When enabled, a contended k_mutex_lock() spins for a bounded number
+ * of iterations while the owner is running on another CPU, instead of
+ * pending immediately.  This avoids a pair of context switches when
+ * critical sections are short.  New mutexes default to disabled.
+ *
+ * Only available from supervisor mode.
+ *
+ * @param mutex Address of the mutex.
+ * @param enable True to spin before blocking, false to always pend.
+ */
+void k_mutex_spin_set(struct k_mutex *mutex, bool enable);
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
 
 /**
  * @brief Lock a mutex.
@@ -3248,6 +3385,23 @@ struct k_sem {
 __syscall int k_sem_init(struct k_sem *sem, unsigned int initial_count,
 			  unsigned int limit);
 
+#ifdef CONFIG_WAITQ_PER_OBJECT
+/**
+ * @brief Switch a semaphore's wait queue to the scalable backend.
+ *
+ * This routine opts @a sem into the balanced tree wait queue backend,
+ * giving O(log N) pend/unpend cost when many threads block on it.
+ * Call it after k_sem_init() (or on a statically defined semaphore)
+ * and before any thread pends on the semaphore; the wait queue must
+ * be empty.
+ *
+ * Only available from supervisor mode.
+ *
+ * @param sem Address of the semaphore.
+ */
+void k_sem_waitq_scalable_set(struct k_sem *sem);
+#endif /* CONFIG_WAITQ_PER_OBJECT */
+
 /**
  * @brief Take a semaphore.
  *
@@ -3435,6 +3589,23 @@ int k_work_submit_to_queue(struct k_work_q *queue,
  */
 int k_work_submit(struct k_work *work);
 
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+/** @brief Submit a work item to the system queue of a specific CPU.
+ *
+ * Use this for work with CPU affinity, e.g. a driver bottom half that
+ * should run on the CPU that services the device's interrupt.  Plain
+ * k_work_submit() queues to the system queue of the submitting CPU.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param work pointer to the work item.
+ * @param cpu CPU index, 0 to (arch_num_cpus() - 1).
+ *
+ * @return as with k_work_submit_to_queue().
+ */
+int k_work_submit_to_cpu(struct k_work *work, int cpu);
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+
 /** @brief Wait for last-submitted instance to complete.
  *
  * Resubmissions may occur while waiting, including chained submissions (from
@@ -4103,6 +4274,14 @@ struct k_work_queue_config {
 	 * essential thread.
 	 */
 	bool essential;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	/** CPUs the work queue thread may run on, as a bit mask.
+	 *
+	 * Leave zero (the default) to let the thread run on any CPU.
+	 */
+	uint32_t cpu_mask;
+#endif
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -4520,6 +4699,15 @@ struct k_msgq {
 	/** Number of used messages */
 	uint32_t used_msgs;
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/** Per-slot states for the reserve/commit (zero-copy) API */
+	uint8_t *slot_states;
+	/** Slots reserved for write but not yet committed */
+	uint32_t reserved_msgs;
+	/** Slots claimed for read but not yet finished */
+	uint32_t claimed_msgs;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 	Z_DECL_POLL_EVENT
 
 	/** Message queue */
@@ -4689,6 +4877,103 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/**
+ * @brief Initialize a message queue for zero-copy operation.
+ *
+ * This routine initializes a message queue object for use with the
+ * reserve/commit and claim/finish API, which passes ring slot pointers
+ * instead of copying message contents.  In addition to the ring buffer
+ * it needs one state byte per message, supplied via @a slot_states.
+ *
+ * A queue initialized this way must be accessed only through
+ * k_msgq_put_reserve()/k_msgq_put_commit() and
+ * k_msgq_get_claim()/k_msgq_get_finish(); do not mix in the copying
+ * put/get API.
+ *
+ * The zero-copy API is only available from supervisor mode.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued.
+ * @param slot_states Array of @a max_msgs bytes of slot state storage.
+ */
+void k_msgq_zero_copy_init(struct k_msgq *msgq, char *buffer,
+			   size_t msg_size, uint32_t max_msgs,
+			   uint8_t *slot_states);
+
+/**
+ * @brief Reserve a message slot for in-place filling.
+ *
+ * This routine reserves the next free slot in the ring and returns its
+ * address through @a slot.  The caller fills the slot (memcpy, DMA,
+ * in-place construction) and then publishes it with
+ * k_msgq_put_commit().  Multiple producers may hold reservations
+ * concurrently; messages become visible to consumers in reservation
+ * order.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Filled in with the address of the reserved slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_put_reserve(struct k_msgq *msgq, void **slot,
+		       k_timeout_t timeout);
+
+/**
+ * @brief Publish a previously reserved message slot.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_put_reserve().
+ */
+void k_msgq_put_commit(struct k_msgq *msgq, void *slot);
+
+/**
+ * @brief Claim the oldest message for in-place reading.
+ *
+ * This routine removes the oldest committed message from the queue and
+ * returns its slot address through @a slot without copying it.  The
+ * slot remains valid (and is not reused by producers) until released
+ * with k_msgq_get_finish().
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Filled in with the address of the claimed message.
+ * @param timeout Waiting period for a message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot,
+		     k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message slot back to the ring.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_get_claim().
+ */
+void k_msgq_get_finish(struct k_msgq *msgq, void *slot);
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4809,6 +5094,22 @@ struct k_mbox_msg {
 	struct k_sem *_async_sem;
 #endif
 };
+
+/**
+ * @typedef k_mbox_async_cb_t
+ * @brief Mailbox asynchronous transfer completion callback
+ *
+ * Invoked when an asynchronous mailbox transfer completes, i.e. when the
+ * message has been both received and completely processed. The callback
+ * runs in the context of whichever thread completed the exchange and must
+ * not block.
+ *
+ * @param msg Address of the completed message descriptor. Only valid for
+ *            the duration of the callback.
+ * @param user_data Opaque pointer supplied when the transfer was started.
+ */
+typedef void (*k_mbox_async_cb_t)(struct k_mbox_msg *msg, void *user_data);
+
 /**
  * @brief Mailbox Structure
  *
@@ -4900,6 +5201,55 @@ int k_mbox_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 			     struct k_sem *sem);
 
+/**
+ * @brief Send a mailbox message asynchronously with a completion callback.
+ *
+ * This routine sends a message to @a mbox without waiting for a receiver
+ * to process it. The message data may be in a buffer or non-existent
+ * (i.e. an empty message). Optionally, @a cb will be invoked when the
+ * message has been both received and completely processed by the receiver;
+ * the message data buffer must remain valid until then.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note A free asynchronous message descriptor must be available when this
+ * routine is called from an ISR (see @kconfig{CONFIG_NUM_MBOX_ASYNC_MSGS}),
+ * as an ISR cannot wait for one to be released.
+ *
+ * @param mbox Address of the mailbox.
+ * @param tx_msg Address of the transmit message descriptor.
+ * @param cb Completion callback, or NULL if none is needed.
+ * @param user_data Opaque pointer passed to the completion callback.
+ */
+void k_mbox_async_put_cb(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+			 k_mbox_async_cb_t cb, void *user_data);
+
+/**
+ * @brief Receive a mailbox message asynchronously.
+ *
+ * This routine retrieves a message from @a mbox without requiring the
+ * caller to wait for one. If a compatible message is already available,
+ * the exchange completes immediately; otherwise the receive request is
+ * queued and served by a future send. In both cases the message data is
+ * copied into @a buffer (which must remain valid until completion) and
+ * @a cb is then invoked.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note A free asynchronous message descriptor must be available when this
+ * routine is called from an ISR (see @kconfig{CONFIG_NUM_MBOX_ASYNC_MSGS}),
+ * as an ISR cannot wait for one to be released.
+ *
+ * @param mbox Address of the mailbox.
+ * @param rx_msg Address of the receive message descriptor.
+ * @param buffer Address of the buffer to receive data, or NULL to discard
+ *               the data.
+ * @param cb Completion callback, or NULL if none is needed.
+ * @param user_data Opaque pointer passed to the completion callback.
+ */
+void k_mbox_async_get(struct k_mbox *mbox, struct k_mbox_msg *rx_msg,
+		      void *buffer, k_mbox_async_cb_t cb, void *user_data);
+
 /**
  * @brief Receive a mailbox message.
  *
@@ -4959,6 +5309,11 @@ struct k_pipe {
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_PIPE_CLAIM
+	size_t write_claim_len;	/**< Size of outstanding write claim */
+	size_t read_claim_len;	/**< Size of outstanding read claim */
+#endif /* CONFIG_PIPE_CLAIM */
+
 	uint8_t	       flags;		/**< Flags */
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_pipe)
@@ -4972,6 +5327,8 @@ struct k_pipe {
  * @cond INTERNAL_HIDDEN
  */
 #define K_PIPE_FLAG_ALLOC	BIT(0)	/** Buffer was allocated */
+#define K_PIPE_FLAG_WRITE_CLAIM	BIT(1)	/** Write claim outstanding */
+#define K_PIPE_FLAG_READ_CLAIM	BIT(2)	/** Read claim outstanding */
 
 #define Z_PIPE_INITIALIZER(obj, pipe_buffer, pipe_buffer_size)     \
 	{                                                           \
@@ -5120,6 +5477,83 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+#ifdef CONFIG_PIPE_CLAIM
+/**
+ * @brief Claim a contiguous region of the pipe buffer for writing.
+ *
+ * This routine exposes the largest contiguous run of free ring buffer
+ * space through @a data / @a size so it can be filled in place, e.g. by
+ * a DMA engine, instead of being copied through k_pipe_put().  The
+ * claim must be completed with k_pipe_write_finish() before another
+ * write claim can be made.  While a write claim is outstanding, no
+ * other writer (claiming or copying) may operate on the pipe.
+ *
+ * The claim API never blocks and is only available from supervisor
+ * mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Filled in with the address of the claimed region.
+ * @param size Filled in with the size of the claimed region.
+ *
+ * @retval 0 Region claimed.
+ * @retval -EINVAL Pipe is unbuffered.
+ * @retval -EBUSY A write claim is already outstanding.
+ * @retval -EAGAIN No contiguous free space available.
+ */
+int k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t *size);
+
+/**
+ * @brief Complete a write claim, publishing the written bytes.
+ *
+ * Pended readers are satisfied directly from the published data.
+ *
+ * @param pipe Address of the pipe.
+ * @param bytes_written Number of bytes actually written; may be less
+ *                      than the claimed size (0 cancels the claim).
+ *
+ * @retval 0 Claim completed.
+ * @retval -EINVAL No claim outstanding, or more bytes than claimed.
+ */
+int k_pipe_write_finish(struct k_pipe *pipe, size_t bytes_written);
+
+/**
+ * @brief Claim a contiguous region of the pipe buffer for reading.
+ *
+ * This routine exposes the largest contiguous run of unread data
+ * through @a data / @a size so it can be consumed in place.  The claim
+ * must be completed with k_pipe_read_finish() before another read
+ * claim can be made.  While a read claim is outstanding, no other
+ * reader (claiming or copying) may operate on the pipe.
+ *
+ * The claim API never blocks and is only available from supervisor
+ * mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Filled in with the address of the claimed data.
+ * @param size Filled in with the number of claimed bytes.
+ *
+ * @retval 0 Data claimed.
+ * @retval -EINVAL Pipe is unbuffered.
+ * @retval -EBUSY A read claim is already outstanding.
+ * @retval -EAGAIN No data available.
+ */
+int k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t *size);
+
+/**
+ * @brief Complete a read claim, releasing the consumed bytes.
+ *
+ * The freed space is refilled from any pended writers.
+ *
+ * @param pipe Address of the pipe.
+ * @param bytes_read Number of bytes actually consumed; may be less
+ *                   than the claimed size (0 cancels the claim).
+ *
+ * @retval 0 Claim completed.
+ * @retval -EINVAL No claim outstanding, or more bytes than claimed.
+ */
+int k_pipe_read_finish(struct k_pipe *pipe, size_t bytes_read);
+#endif /* CONFIG_PIPE_CLAIM */
+
 /**
  * @brief Flush the pipe of write data
  *
@@ -5166,6 +5600,11 @@ struct k_mem_slab {
 	char *buffer;
 	char *free_list;
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_t free_head;
+	atomic_t num_used;
+	atomic_t waiters;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5394,10 +5833,23 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+/* Per-CPU cache of equal-sized heap blocks, see CONFIG_KHEAP_MAGAZINE */
+struct k_heap_magazine {
+	struct k_spinlock lock;
+	void *slots[CONFIG_KHEAP_MAGAZINE_DEPTH];
+	uint8_t count;
+};
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KHEAP_MAGAZINE
+	struct k_heap_magazine magazine[CONFIG_MP_MAX_NUM_CPUS];
+	size_t magazine_usable;
+#endif
 };
 
 /**
@@ -5917,6 +6369,68 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+#ifdef CONFIG_POLL_SET
+/**
+ * @brief Persistent poll set.
+ *
+ * Keeps poll event registrations armed across wait calls so that
+ * steady-state polling of a fixed event set only touches events that
+ * actually triggered, instead of re-registering the whole array on
+ * every call as k_poll() does.
+ */
+struct k_poll_set {
+	/** Array of events being polled */
+	struct k_poll_event *events;
+	/** Number of events in the array */
+	int num_events;
+	/** Poller of the thread the set is bound to, or NULL */
+	struct z_poller *poller;
+};
+
+/**
+ * @brief Initialize a persistent poll set.
+ *
+ * The event array must have been prepared with k_poll_event_init() and
+ * must outlive the poll set.  A poll set may only be waited on by one
+ * thread, and is only available from supervisor mode.
+ *
+ * @param pset Address of the poll set.
+ * @param events An array of events to be polled for.
+ * @param num_events The number of events in the array.
+ */
+void k_poll_set_init(struct k_poll_set *pset, struct k_poll_event *events,
+		     int num_events);
+
+/**
+ * @brief Wait on a persistent poll set.
+ *
+ * Like k_poll(), but event registrations survive the call: events that
+ * did not trigger stay armed and are not re-registered on the next
+ * wait.  On return the caller scans the event array for states other
+ * than K_POLL_STATE_NOT_READY, handles them, and resets those states
+ * to K_POLL_STATE_NOT_READY before waiting again.
+ *
+ * @param pset Address of the poll set.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 One or more events are ready.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINTR Polling was interrupted (see k_poll()).
+ */
+int k_poll_set_wait(struct k_poll_set *pset, k_timeout_t timeout);
+
+/**
+ * @brief Disarm a persistent poll set.
+ *
+ * Clears all outstanding event registrations.  Call before freeing or
+ * reusing the event array, or to hand the set to another thread.
+ *
+ * @param pset Address of the poll set.
+ */
+void k_poll_set_disarm(struct k_poll_set *pset);
+#endif /* CONFIG_POLL_SET */
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -6242,6 +6756,21 @@ void k_sys_runtime_stats_enable(void);
  */
 void k_sys_runtime_stats_disable(void);
 
+#ifdef CONFIG_SCHED_CYCLE_STATS
+/**
+ * @brief Get context switch cycle statistics for a CPU
+ *
+ * This routine copies out the per-CPU context switch timing data
+ * gathered by CONFIG_SCHED_CYCLE_STATS: switch count, total and
+ * longest switch duration, and a log2 histogram of switch durations.
+ *
+ * @param cpu The cpu number
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if invalid cpu or null stats pointer, otherwise 0
+ */
+int k_sched_stats_get(int cpu, struct k_sched_cycle_stats *stats);
+#endif /* CONFIG_SCHED_CYCLE_STATS */
+
 #ifdef __cplusplus
 }
 #endif
@@ -192,6 +192,39 @@ static inline void *k_mem_map(size_t size, uint32_t flags)
 	return k_mem_map_phys_guard((uintptr_t)NULL, size, flags, true);
 }
 
+#ifdef CONFIG_KERNEL_CONTIG_MAP
+/**
+ * Map physically contiguous anonymous memory into Zephyr's address space
+ *
+ * This behaves like k_mem_map(), except that the mapping is backed by a
+ * single physically contiguous run of page frames, and both the virtual
+ * and physical base addresses are aligned to the largest power of two
+ * dividing the size. This allows the architecture layer to cover the
+ * region with block/section descriptors where the MMU supports them
+ * (e.g. 2MB blocks on ARM64), greatly reducing TLB pressure for large
+ * buffers compared to individual page mappings.
+ *
+ * The mapping is always pinned as if K_MEM_MAP_LOCK had been passed:
+ * paging out individual pages would break up the contiguous run. It is
+ * incompatible with K_MEM_MAP_UNPAGED.
+ *
+ * Success depends on a sufficiently large aligned run of free page
+ * frames existing; unlike k_mem_map(), no pages are evicted to satisfy
+ * the request. Establish such mappings early, before physical memory
+ * fragments.
+ *
+ * Like k_mem_map(), the allocation includes a guard page immediately
+ * before and after the requested region, and the region may be released
+ * with k_mem_unmap().
+ *
+ * @param size Size of the memory mapping. This must be page-aligned.
+ * @param flags K_MEM_PERM_*, K_MEM_MAP_* control flags.
+ * @return The mapped memory location, or NULL if insufficient virtual
+ *         address space or no suitable run of free physical memory.
+ */
+void *k_mem_map_contiguous(size_t size, uint32_t flags);
+#endif
+
 #ifdef CONFIG_DEMAND_MAPPING
 /**
  * Create an unpaged mapping
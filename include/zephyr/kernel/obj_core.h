@@ -110,6 +110,7 @@ struct k_obj_type {
 	sys_snode_t    node;   /**< Node within list of object types */
 	sys_slist_t    list;   /**< List of objects of this object type */
 	uint32_t       id;     /**< Unique type ID */
+	uint32_t       gen;    /**< Bumped when an object is unlinked */
 	size_t         obj_core_offset;  /**< Offset to obj_core field */
 #ifdef CONFIG_OBJ_CORE_STATS
 	/** Pointer to object core statistics descriptor */
@@ -157,10 +158,13 @@ struct k_obj_type *k_obj_type_find(uint32_t type_id);
 /**
  * @brief Walk the object type's list of object cores
  *
- * This function takes a global spinlock and walks the object type's list
- * of object cores and invokes the callback function on each element while
+ * This function takes the object type's spinlock and walks its list of
+ * object cores and invokes the callback function on each element while
  * holding that lock. Although this will ensure that the list is not modified,
- * one can expect a significant penalty in terms of performance and latency.
+ * one can expect a significant penalty in terms of performance and latency
+ * proportional to the number of linked objects. Consider the incremental
+ * k_obj_type_walk_begin()/k_obj_type_walk_next() pair when that penalty is
+ * not acceptable.
  *
  * The callback function shall either return non-zero to stop further walking,
  * or it shall return 0 to continue walking.
@@ -179,7 +183,7 @@ int k_obj_type_walk_locked(struct k_obj_type *type,
  * @brief Walk the object type's list of object cores
  *
  * This function is similar to k_obj_type_walk_locked() except that it walks
- * the list without obtaining the global spinlock. No synchronization is
+ * the list without obtaining any spinlock. No synchronization is
  * provided here. Mutation of the list of objects while this function is in
  * progress must be prevented at the application layer, otherwise
  * undefined/unreliable behavior, corruption and/or crashes may result.
@@ -197,6 +201,60 @@ int k_obj_type_walk_unlocked(struct k_obj_type *type,
 			     int (*func)(struct k_obj_core *, void *),
 			     void *data);
 
+/** Token tracking the position of an incremental object type walk */
+struct k_obj_type_walk_token {
+	struct k_obj_type *type;  /**< Object type being walked */
+	sys_snode_t       *next;  /**< Next object core to process */
+	uint32_t           gen;   /**< Type generation when walk began */
+};
+
+/**
+ * @brief Begin an incremental walk of the object type's list of object cores
+ *
+ * This function initializes the walk token @a token to reference the first
+ * object core linked to the object type. Unlike k_obj_type_walk_locked(),
+ * an incremental walk does not hold the object type's spinlock for the
+ * duration of the walk; the lock is only held while k_obj_type_walk_next()
+ * processes a bounded batch of objects, thereby bounding the latency imposed
+ * upon other users of the object type.
+ *
+ * @param type  Pointer to the object type
+ * @param token Walk token to initialize
+ */
+void k_obj_type_walk_begin(struct k_obj_type *type,
+			   struct k_obj_type_walk_token *token);
+
+/**
+ * @brief Process the next batch of object cores in an incremental walk
+ *
+ * This function takes the object type's spinlock and invokes the callback
+ * function on up to @a limit object cores starting at the position recorded
+ * in @a token, releasing the lock before returning. Should an object be
+ * unlinked from the object type between calls, the walk is aborted with
+ * -EAGAIN as the token may reference a removed object; the caller is
+ * expected to restart it with k_obj_type_walk_begin(). Objects linked while
+ * the walk is in progress are appended to the list and will be visited.
+ *
+ * The callback function shall either return non-zero to stop further walking,
+ * or it shall return 0 to continue walking. As both positive callback return
+ * values and an incomplete walk are reported through the return value, a
+ * callback used with this function should return a negative value to stop
+ * the walk.
+ *
+ * @param token Walk token initialized by k_obj_type_walk_begin()
+ * @param func  Callback to invoke on each object core of the object type
+ * @param data  Custom data passed to the callback
+ * @param limit Maximum number of object cores to process in this call
+ *
+ * @retval -EAGAIN if the walk was invalidated by an unlinked object
+ * @retval non-zero if walk is terminated by the callback
+ * @retval 1 if the batch was processed and more objects remain
+ * @retval 0 if the walk is complete
+ */
+int k_obj_type_walk_next(struct k_obj_type_walk_token *token,
+			 int (*func)(struct k_obj_core *, void *),
+			 void *data, size_t limit);
+
 /**
  * @brief Initialize the core of the kernel object
  *
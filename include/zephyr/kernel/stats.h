@@ -30,4 +30,19 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/** Number of log2 buckets in a context switch duration histogram */
+#define K_SCHED_CYCLE_STATS_BINS 16
+
+/**
+ * Structure used to track per-CPU context switch timing.  Bucket N of
+ * the histogram counts switches that took [2^N, 2^(N+1)) cycles; the
+ * last bucket is open-ended.
+ */
+struct k_sched_cycle_stats {
+	uint64_t  total;    /**< total cycles spent context switching */
+	uint32_t  count;    /**< \# of context switches */
+	uint32_t  longest;  /**< longest single switch, in cycles */
+	uint32_t  hist[K_SCHED_CYCLE_STATS_BINS];  /**< duration histogram */
+};
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
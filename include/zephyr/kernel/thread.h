@@ -181,6 +181,15 @@ struct _thread_stack_info {
 		size_t sz;
 	} mapped;
 #endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
+
+#if defined(CONFIG_THREAD_STACK_WATERMARK)
+	/* Lowest unused-stack byte count observed so far, SIZE_MAX
+	 * until the first full scan. Updated by
+	 * k_thread_stack_space_get() so subsequent queries only
+	 * inspect the region the stack may have newly grown into.
+	 */
+	size_t unused_low;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 };
 
 typedef struct _thread_stack_info _thread_stack_info_t;
@@ -278,10 +287,12 @@ struct k_thread {
 
 	uint32_t   events;
 	uint32_t   event_options;
+#endif /* CONFIG_EVENTS */
 
+#if defined(CONFIG_EVENTS) || defined(CONFIG_KHEAP_SELECTIVE_WAKEUP)
 	/** true if timeout should not wake the thread */
 	bool no_wake_on_timeout;
-#endif /* CONFIG_EVENTS */
+#endif /* CONFIG_EVENTS || CONFIG_KHEAP_SELECTIVE_WAKEUP */
 
 #if defined(CONFIG_THREAD_MONITOR)
 	/** thread entry and parameters description */
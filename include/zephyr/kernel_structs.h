@@ -122,6 +122,10 @@ struct _priq_rb {
 struct _priq_mq {
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
+	/* Summary bitmap: bit N set iff bitmask[N] is non-zero, so the
+	 * best-priority lookup is two bit scans instead of a word scan.
+	 */
+	unsigned long toplevel;
 };
 
 struct _ready_q {
@@ -154,7 +158,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -187,6 +191,26 @@ struct _cpu {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	struct k_cycle_stats *usage;
 #endif
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+	/*
+	 * Ring of raw switch-out samples awaiting attribution. Only the
+	 * owning CPU appends to it (without synchronization); it is
+	 * flushed under the usage lock when full or when stats are read.
+	 */
+	struct {
+		struct k_thread *thread;
+		uint32_t cycles;
+	} usage_ring[CONFIG_SCHED_THREAD_USAGE_DEFERRED_RING_SIZE];
+	uint16_t usage_ring_count;
+#endif
+#endif
+
+#ifdef CONFIG_SCHED_CYCLE_STATS
+	/* cycle timestamp taken on entry to the context switch path */
+	uint32_t swap_start;
+
+	struct k_sched_cycle_stats swap_stats;
 #endif
 
 #ifdef CONFIG_OBJ_CORE_SYSTEM
@@ -210,7 +234,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -268,7 +292,27 @@ bool z_smp_cpu_mobile(void);
 #endif
 
 /* kernel wait queue record */
-#ifdef CONFIG_WAITQ_SCALABLE
+#if defined(CONFIG_WAITQ_PER_OBJECT)
+
+/* Defaults to the doubly-linked list backend; hot objects opt into the
+ * rbtree with z_waitq_init_scalable() and pay its cost only there.
+ */
+typedef struct {
+	union {
+		sys_dlist_t dlist;
+		struct _priq_rb tree;
+	} waitq;
+	/* True when this wait queue uses the rbtree backend */
+	bool scalable;
+} _wait_q_t;
+
+/* defined in kernel/priority_queues.c */
+bool z_priq_rb_lessthan(struct rbnode *a, struct rbnode *b);
+
+#define Z_WAIT_Q_INIT(wait_q) \
+	{ { .dlist = SYS_DLIST_STATIC_INIT(&(wait_q)->waitq.dlist) }, false }
+
+#elif defined(CONFIG_WAITQ_SCALABLE)
 
 typedef struct {
 	struct _priq_rb waitq;
@@ -302,6 +346,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Index of the per-CPU timeout queue holding this timeout */
+	uint8_t cpu;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_FLASH_RING_H_
+#define ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_FLASH_RING_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Get the capacity of the log flash ring partition.
+ *
+ * @return Partition size in bytes.
+ */
+size_t log_backend_flash_ring_capacity(void);
+
+/**
+ * @brief Read raw retained log data from the flash ring partition.
+ *
+ * Data is returned as stored, including regions which still hold the
+ * flash erase value. Extraction tooling is expected to strip erased
+ * gaps and decode the log stream.
+ *
+ * @param offset Offset within the partition to read from.
+ * @param buf Destination buffer.
+ * @param len Number of bytes to read.
+ *
+ * @return Number of bytes read on success, negative error code otherwise.
+ */
+ssize_t log_backend_flash_ring_read(size_t offset, void *buf, size_t len);
+
+/**
+ * @brief Erase the retained log data and restart the ring.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int log_backend_flash_ring_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_LOGGING_LOG_BACKEND_FLASH_RING_H_ */
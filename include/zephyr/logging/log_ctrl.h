@@ -196,6 +196,31 @@ uint32_t log_frontend_filter_get(int16_t source_id, bool runtime);
  */
 __syscall uint32_t log_frontend_filter_set(int16_t source_id, uint32_t level);
 
+/**
+ * @brief Set token bucket rate limit on given source.
+ *
+ * Requires @kconfig{CONFIG_LOG_RATE_LIMIT}. Messages exceeding the
+ * limit are dropped before reaching the message buffer and counted
+ * per source (see log_rate_limit_dropped_get()).
+ *
+ * @param source_id	Source (module or instance) ID. Negative value to set
+ *			the limit on all sources.
+ * @param msgs_per_sec	Token bucket refill rate. 0 to disable the limit.
+ * @param burst		Token bucket capacity (maximum burst length).
+ *
+ * @return 0 on success, -EINVAL on invalid arguments.
+ */
+int log_rate_limit_set(int16_t source_id, uint16_t msgs_per_sec, uint16_t burst);
+
+/**
+ * @brief Get number of messages dropped on given source by rate limiting.
+ *
+ * @param source_id	Source (module or instance) ID.
+ *
+ * @return Dropped message count.
+ */
+uint32_t log_rate_limit_dropped_get(int16_t source_id);
+
 /**
  *
  * @brief Enable backend with initial maximum filtering level.
@@ -29,6 +29,18 @@ struct log_source_const_data {
 /** @brief Dynamic data associated with the source of log messages. */
 struct log_source_dynamic_data {
 	uint32_t filters;
+#ifdef CONFIG_LOG_RATE_LIMIT
+	/** Token bucket state for per-source rate limiting. */
+	uint16_t rl_tokens;
+	/** Refill rate in messages per second, 0 means unlimited. */
+	uint16_t rl_rate;
+	/** Bucket capacity (burst size). */
+	uint16_t rl_burst;
+	/** Uptime (in ms, truncated) of the last bucket refill. */
+	uint32_t rl_last_ms;
+	/** Number of messages dropped by rate limiting. */
+	uint32_t rl_dropped;
+#endif
 #ifdef CONFIG_NIOS2
 	/* Workaround alert! Dummy data to ensure that structure is >8 bytes.
 	 * Nios2 uses global pointer register for structures <=8 bytes and
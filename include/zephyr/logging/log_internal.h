@@ -57,6 +57,24 @@ bool z_log_dropped_pending(void);
  */
 void z_log_free(void *buf);
 
+#ifdef CONFIG_LOG_RATE_LIMIT
+/** @brief Consume a token from the source rate limit bucket.
+ *
+ * @param source Pointer to the source dynamic data.
+ *
+ * @retval true Message is within the rate limit.
+ * @retval false Message shall be dropped, drop counted on the source.
+ */
+bool z_log_rate_limit_passed(const void *source);
+#else
+static inline bool z_log_rate_limit_passed(const void *source)
+{
+	ARG_UNUSED(source);
+
+	return true;
+}
+#endif
+
 /* Initialize runtime filters */
 void z_log_runtime_filters_init(void);
 
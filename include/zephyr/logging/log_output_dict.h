@@ -23,6 +23,10 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	/* Like MSG_NORMAL, but the format string pointer in the package
+	 * is replaced with a 16-bit offset into the log strings section.
+	 */
+	MSG_FMT_OFFSET = 2,
 };
 
 /**
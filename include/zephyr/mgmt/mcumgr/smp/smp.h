@@ -88,8 +88,30 @@ struct smp_streamer {
 #ifdef CONFIG_MCUMGR_SMP_VERBOSE_ERR_RESPONSE
 	const char *rc_rsn;
 #endif
+
+#ifdef CONFIG_MCUMGR_SMP_RESPONSE_SUPPRESSION
+	bool rsp_suppressed;
+#endif
 };
 
+#if defined(CONFIG_MCUMGR_SMP_RESPONSE_SUPPRESSION) || defined(__DOXYGEN__)
+/**
+ * @brief Suppress the response to the request currently being processed.
+ *
+ * May be called by a command handler to indicate that the successful response
+ * it has built should be dropped instead of transmitted, e.g. because a later
+ * pipelined request will be answered with a cumulative response.  Error
+ * responses are never suppressed.  The suppression only applies to the
+ * current request.
+ *
+ * @param streamer	The streamer processing the request.
+ */
+static inline void smp_rsp_suppress(struct smp_streamer *streamer)
+{
+	streamer->rsp_suppressed = true;
+}
+#endif
+
 /**
  * @brief Processes a single SMP request packet and sends all corresponding responses.
  *
@@ -193,6 +193,19 @@ void smp_rx_remove_invalid(struct smp_transport *zst, void *arg);
  */
 void smp_rx_clear(struct smp_transport *zst);
 
+/**
+ * @brief	Check if an SMP transport has more received requests waiting to
+ *		be processed.
+ *
+ * Can be used by command handlers to detect that a client is pipelining
+ * requests, e.g. to coalesce responses.
+ *
+ * @param smpt	The transport to query.
+ *
+ * @return	true if at least one received request is queued.
+ */
+bool smp_transport_rx_pending(struct smp_transport *smpt);
+
 /**
  * @brief Register a Zephyr SMP transport object for client.
  *
@@ -383,6 +383,33 @@ struct modbus_user_callbacks {
 
 	/** Floating Point Holding Register write callback */
 	int (*holding_reg_wr_fp)(uint16_t addr, float reg);
+
+	/**
+	 * Ranged Input Register read callback.
+	 *
+	 * If implemented, it is invoked once per request with the whole
+	 * register span instead of calling input_reg_rd per address.
+	 */
+	int (*input_reg_rd_range)(uint16_t start_addr, uint16_t *reg_buf,
+				  uint16_t num_regs);
+
+	/**
+	 * Ranged Holding Register read callback.
+	 *
+	 * If implemented, it is invoked once per request with the whole
+	 * register span instead of calling holding_reg_rd per address.
+	 */
+	int (*holding_reg_rd_range)(uint16_t start_addr, uint16_t *reg_buf,
+				    uint16_t num_regs);
+
+	/**
+	 * Ranged Holding Register write callback.
+	 *
+	 * If implemented, it is invoked once per request with the whole
+	 * register span instead of calling holding_reg_wr per address.
+	 */
+	int (*holding_reg_wr_range)(uint16_t start_addr, const uint16_t *reg_buf,
+				    uint16_t num_regs);
 };
 
 /**
@@ -12,6 +12,8 @@
 #ifndef ZEPHYR_INCLUDE_MULTI_HEAP_MANAGER_SMH_H_
 #define ZEPHYR_INCLUDE_MULTI_HEAP_MANAGER_SMH_H_
 
+#include <zephyr/sys/mem_stats.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -176,6 +178,50 @@ void shared_multi_heap_free(void *block);
  */
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data);
 
+#ifdef CONFIG_SHARED_MULTI_HEAP_FALLBACK
+/**
+ * @brief Set the attribute fallback chain for an attribute
+ *
+ * When all the regions carrying the requested attribute are exhausted, the
+ * allocation is retried against each attribute of the fallback chain in
+ * order before failing. This is useful to let allocations for a scarce
+ * memory type (for example DMA-capable SRAM) spill over into a more
+ * plentiful one (for example DDR) instead of failing.
+ *
+ * The chain replaces any previously set chain for the attribute. Passing a
+ * zero count removes the chain.
+ *
+ * @param attr		attribute the chain is set for.
+ * @param chain		array of attributes to fall back to, in order.
+ * @param count		number of attributes in the chain.
+ *
+ * @retval 0		on success.
+ * @retval -EINVAL	when an attribute is out-of-bound, the chain is too
+ *			long, or it contains the attribute itself.
+ */
+int shared_multi_heap_set_fallback(enum shared_multi_heap_attr attr,
+				   const enum shared_multi_heap_attr *chain,
+				   size_t count);
+#endif
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+/**
+ * @brief Get occupancy statistics for the regions of an attribute
+ *
+ * Sums the runtime statistics of all the heaps added with the given
+ * attribute, giving the current and maximum occupancy of that memory type
+ * so regions can be provisioned from live data.
+ *
+ * @param attr		attribute to report on.
+ * @param stats		pointer to the statistics structure to fill in.
+ *
+ * @retval 0		on success.
+ * @retval -EINVAL	when the attribute is out-of-bound or stats is NULL.
+ */
+int shared_multi_heap_runtime_stats_get(enum shared_multi_heap_attr attr,
+					struct sys_memory_stats *stats);
+#endif
+
 /**
  * @}
  */
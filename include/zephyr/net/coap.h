@@ -304,6 +304,10 @@ struct coap_observer {
 	uint8_t token[8];
 	/** Extended token length */
 	uint8_t tkl;
+	/** Identity hash over end point and token, maintained by
+	 * coap_observer_init() and used to short-circuit observer lookups.
+	 */
+	uint32_t hash;
 };
 
 /**
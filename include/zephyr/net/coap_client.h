@@ -85,6 +85,16 @@ struct coap_client_option {
 };
 
 /** @cond INTERNAL_HIDDEN */
+#if defined(CONFIG_COAP_CLIENT_BLOCK_PIPELINE) && (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+/* One in-flight block2 request of a pipelined block-wise receive. */
+struct coap_client_blk_slot {
+	struct coap_pending pending;
+	uint32_t block_num;
+	uint16_t mid;
+	bool busy;
+};
+#endif
+
 struct coap_client_internal_request {
 	uint8_t request_token[COAP_TOKEN_MAX_LEN];
 	uint32_t offset;
@@ -102,6 +112,19 @@ struct coap_client_internal_request {
 	/* For GETs with observe option set */
 	bool is_observe;
 	int last_response_id;
+
+#if defined(CONFIG_COAP_CLIENT_BLOCK_PIPELINE) && (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+	/* Pipelined block-wise receive state. The window covers blocks
+	 * [blk_window_base, blk_window_base + CONFIG_COAP_CLIENT_BLOCK_PIPELINE),
+	 * blk_recv_mask marks received blocks relative to the base.
+	 */
+	bool blk_pipeline_on;
+	struct coap_client_blk_slot blk_slots[CONFIG_COAP_CLIENT_BLOCK_PIPELINE];
+	uint32_t blk_window_base;
+	uint32_t blk_next_num;
+	uint32_t blk_total;
+	uint8_t blk_recv_mask;
+#endif
 };
 
 struct coap_client {
@@ -79,6 +79,14 @@ enum mqtt_evt_type {
 
 	/** Ping Response from server. */
 	MQTT_EVT_PINGRESP,
+
+	/** No acknowledgment for a published message with QoS 1 arrived
+	 *  within CONFIG_MQTT_QOS1_RETRY_TIMEOUT. The application should
+	 *  publish the message again with the DUP flag set. Only reported
+	 *  from @ref mqtt_live when CONFIG_MQTT_QOS1_INFLIGHT_WINDOW is
+	 *  larger than 0.
+	 */
+	MQTT_EVT_PUBACK_TIMEOUT,
 };
 
 /** @brief MQTT version protocol level. */
@@ -294,7 +302,9 @@ union mqtt_evt_param {
 	 */
 	struct mqtt_publish_param publish;
 
-	/** Parameters accompanying MQTT_EVT_PUBACK event. */
+	/** Parameters accompanying MQTT_EVT_PUBACK and
+	 *  MQTT_EVT_PUBACK_TIMEOUT events.
+	 */
 	struct mqtt_puback_param puback;
 
 	/** Parameters accompanying MQTT_EVT_PUBREC event. */
@@ -485,6 +495,26 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+	/** Internal. Bookkeeping for in-flight QoS 1 publishes. */
+	struct {
+		/** Message ID of the publish. */
+		uint16_t message_id;
+		/** Wall clock value (in milliseconds) of the transmission. */
+		uint32_t timestamp;
+		/** Entry is in use. */
+		bool used;
+	} qos1_inflight[CONFIG_MQTT_QOS1_INFLIGHT_WINDOW];
+#endif
+
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	/** Internal. Staging buffer for coalesced transport writes. */
+	uint8_t tx_coalesce[CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE];
+
+	/** Internal. Amount of staged data not yet written out. */
+	uint32_t tx_coalesce_datalen;
+#endif
 };
 
 /**
@@ -622,6 +652,10 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note When CONFIG_MQTT_QOS1_INFLIGHT_WINDOW is larger than 0, a QoS 1
+ *       publish fails with -EAGAIN while the in-flight window is full;
+ *       retry once a PUBACK has been received.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
  */
 int mqtt_publish(struct mqtt_client *client,
@@ -758,6 +792,21 @@ int mqtt_abort(struct mqtt_client *client);
  */
 int mqtt_live(struct mqtt_client *client);
 
+/**
+ * @brief Write out any packets staged in the TX coalescing buffer.
+ *
+ *        Only relevant when CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE is larger
+ *        than 0; without the coalescing buffer every packet is written
+ *        immediately and this call is a no-op. Staged packets are also
+ *        flushed by @ref mqtt_input and @ref mqtt_live.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_flush(struct mqtt_client *client);
+
 /**
  * @brief Helper function to determine when next keep alive message should be
  *        sent. Can be used for instance as a source for `poll` timeout.
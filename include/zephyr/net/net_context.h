@@ -368,6 +368,13 @@ __net_socket struct net_context {
 #endif
 	} options;
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+	/** Bytes of network buffer space currently held by packets
+	 *  owned by this context.
+	 */
+	atomic_t bufs_in_use;
+#endif
+
 	/** Protocol (UDP, TCP or IEEE 802.3 protocol value) */
 	uint16_t proto;
 
@@ -1153,6 +1160,29 @@ int net_context_send(struct net_context *context,
 		     k_timeout_t timeout,
 		     void *user_data);
 
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND) || defined(__DOXYGEN__)
+/**
+ * @brief Send data to a peer by reference, without copying it into
+ * network buffers.
+ *
+ * @details This function queues the given data for TCP transmission
+ * without staging it in network buffers. The data must stay valid and
+ * unmodified until the peer has acknowledged it, which makes the
+ * function only suitable for immutable data such as constant data kept
+ * in flash. Only connected, native (non-offloaded) TCP contexts are
+ * supported.
+ *
+ * @param context The network context to use.
+ * @param buf The data buffer to send
+ * @param len Length of the buffer
+ *
+ * @return number of bytes queued on success, a negative errno otherwise
+ */
+int net_context_send_nocopy(struct net_context *context,
+			    const void *buf,
+			    size_t len);
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 /**
  * @brief Send data to a peer specified by address.
  *
@@ -122,6 +122,24 @@ enum net_verdict {
  */
 int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
 
+/**
+ * @brief Called by lower network stack or network device driver when
+ * a burst of network packets has been received. The whole burst is pushed
+ * up in the network stack with one queue operation per traffic class,
+ * amortizing the per-packet handoff cost on high packet rates.
+ *
+ * Unlike net_recv_data(), this function always takes ownership of the
+ * packets: any packet that cannot be accepted is unreferenced here.
+ *
+ * @param iface Network interface where the packets were received.
+ * @param pkts Array of network packets.
+ * @param count Number of packets in the array.
+ *
+ * @return Number of packets pushed to the network stack.
+ */
+int net_recv_data_vec(struct net_if *iface, struct net_pkt **pkts,
+		      size_t count);
+
 /**
  * @brief Send data to network.
  *
@@ -136,6 +154,59 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt);
  */
 int net_send_data(struct net_pkt *pkt);
 
+/**
+ * @brief Result of one net_pktgen_run() benchmark round.
+ */
+struct net_pktgen_result {
+	/** Number of packets pushed through the stack */
+	uint32_t pkts;
+	/** Number of packets that could not be allocated */
+	uint32_t alloc_failures;
+	/** Elapsed time in milliseconds */
+	uint32_t time_ms;
+	/** Generated packets per second */
+	uint32_t pkts_per_sec;
+};
+
+/**
+ * @brief Benchmark the network stack with internally generated packets.
+ *
+ * @details Generates @a pkt_count UDP packets addressed to the own IPv4
+ * address of the interface and sends them with net_send_data(). As the
+ * destination is local, every packet is looped back and runs through the
+ * full RX pipeline without any network device involvement. Unless a UDP
+ * receiver is bound to port 9 (discard), the packets terminate at the
+ * connection lookup which acts as the sink; the drop reason statistics
+ * (CONFIG_NET_STATISTICS_DROP_REASON) then show where the packets died.
+ *
+ * The packets are generated at maximum rate in the context of the
+ * caller, so this function can run for a long time and starve lower
+ * priority threads. Only use it for benchmarking.
+ *
+ * @param iface Network interface to use, it must have an IPv4 address.
+ * @param pkt_count Number of packets to generate.
+ * @param payload_len UDP payload length of each generated packet.
+ * @param result Benchmark result, may be NULL if not needed.
+ *
+ * @return 0 if ok, <0 if error.
+ */
+#if defined(CONFIG_NET_PKTGEN)
+int net_pktgen_run(struct net_if *iface, uint32_t pkt_count,
+		   uint16_t payload_len, struct net_pktgen_result *result);
+#else
+static inline int net_pktgen_run(struct net_if *iface, uint32_t pkt_count,
+				 uint16_t payload_len,
+				 struct net_pktgen_result *result)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt_count);
+	ARG_UNUSED(payload_len);
+	ARG_UNUSED(result);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_NET_PKTGEN */
+
 /** @cond INTERNAL_HIDDEN */
 
 /* Some helper defines for traffic class support */
@@ -526,6 +526,18 @@ struct net_if_dhcpv4 {
 	/** NTP server address */
 	struct in_addr ntp_addr;
 #endif
+
+#ifdef CONFIG_NET_DHCPV4_LEASE_CACHE
+	/** Router address received with the current lease */
+	struct in_addr lease_router;
+#if defined(CONFIG_DNS_RESOLVER)
+	/** DNS servers received with the current lease */
+	struct in_addr lease_dns[CONFIG_DNS_RESOLVER_MAX_SERVERS];
+
+	/** Number of valid entries in lease_dns */
+	uint8_t lease_dns_count;
+#endif
+#endif
 };
 #endif /* CONFIG_NET_DHCPV4 */
 
@@ -612,6 +624,13 @@ struct net_traffic_class {
 	/** Fifo for handling this Tx or Rx packet */
 	struct k_fifo fifo;
 
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+	/** Number of submitted packets the handler thread has not yet
+	 * finished with. Only used for Tx traffic classes.
+	 */
+	atomic_t pkts_pending;
+#endif
+
 	/** Traffic class handler thread */
 	struct k_thread handler;
 
@@ -707,12 +726,28 @@ struct net_if {
 	int tx_pending;
 #endif
 
+#if CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT > 0
+	/** Bytes currently waiting in the TX traffic class queues */
+	atomic_t tx_bytes_queued;
+#endif
+
 	/** Mutex protecting this network interface instance */
 	struct k_mutex lock;
 
 	/** Mutex used when sending data */
 	struct k_mutex tx_lock;
 
+#if defined(CONFIG_NET_IF_CHECKSUM_OFFLOAD_CACHE)
+	/** Cached bitmaps of checksum types the driver cannot offload,
+	 * one per direction. Filled lazily on the first query as the
+	 * driver offloading capabilities do not change at runtime.
+	 */
+	uint32_t chksum_need_tx;
+
+	/** See chksum_need_tx */
+	uint32_t chksum_need_rx;
+#endif
+
 	/** Network interface specific flags */
 	/** Enable IPv6 privacy extension (RFC 8981), this is enabled
 	 * by default if PE support is enabled in configuration.
@@ -724,8 +759,19 @@ struct net_if {
 	 */
 	uint8_t pe_prefer_public : 1;
 
+#if defined(CONFIG_NET_IF_CHECKSUM_OFFLOAD_CACHE)
+	/** Is chksum_need_tx valid */
+	uint8_t chksum_need_tx_valid : 1;
+
+	/** Is chksum_need_rx valid */
+	uint8_t chksum_need_rx_valid : 1;
+
+	/** Unused bit flags (ignore) */
+	uint8_t _unused : 4;
+#else
 	/** Unused bit flags (ignore) */
 	uint8_t _unused : 6;
+#endif
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -3076,6 +3122,27 @@ static inline bool net_if_are_pending_tx_packets(struct net_if *iface)
 #endif
 }
 
+/**
+ * @brief Get the number of bytes currently waiting in the TX traffic
+ *        class queues of a network interface.
+ *
+ * Always returns 0 when CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT is 0.
+ *
+ * @param iface Pointer to network interface
+ *
+ * @return Number of bytes queued for transmission.
+ */
+static inline size_t net_if_tx_bytes_queued(struct net_if *iface)
+{
+#if CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT > 0
+	return (size_t)atomic_get(&iface->tx_bytes_queued);
+#else
+	ARG_UNUSED(iface);
+
+	return 0;
+#endif
+}
+
 #ifdef CONFIG_NET_POWER_MANAGEMENT
 /**
  * @brief Suspend a network interface from a power management perspective
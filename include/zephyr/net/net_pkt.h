@@ -110,6 +110,11 @@ struct net_pkt {
 	/** Network connection context */
 	struct net_context *context;
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+	/** Buffer bytes charged to the owning context for this packet */
+	uint32_t accounted_bytes;
+#endif
+
 	/** Network interface */
 	struct net_if *iface;
 
@@ -364,6 +369,19 @@ static inline void net_pkt_set_context(struct net_pkt *pkt,
 	pkt->context = ctx;
 }
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+static inline uint32_t net_pkt_accounted_bytes(struct net_pkt *pkt)
+{
+	return pkt->accounted_bytes;
+}
+
+static inline void net_pkt_set_accounted_bytes(struct net_pkt *pkt,
+					       uint32_t bytes)
+{
+	pkt->accounted_bytes = bytes;
+}
+#endif
+
 static inline struct net_if *net_pkt_iface(struct net_pkt *pkt)
 {
 	return pkt->iface;
@@ -1877,6 +1895,15 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer_debug(struct net_if *iface,
 	net_pkt_rx_alloc_with_buffer_debug(_iface, _size, _family,	\
 					   _proto, _timeout,		\
 					   __func__, __LINE__)
+
+struct net_pkt *net_pkt_rx_alloc_from_frags_debug(struct net_if *iface,
+						  struct net_buf *frags,
+						  k_timeout_t timeout,
+						  const char *caller,
+						  int line);
+#define net_pkt_rx_alloc_from_frags(_iface, _frags, _timeout)		\
+	net_pkt_rx_alloc_from_frags_debug(_iface, _frags, _timeout,	\
+					  __func__, __LINE__)
 #endif /* NET_PKT_DEBUG_ENABLED */
 /** @endcond */
 
@@ -2017,6 +2044,34 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 
 /** @endcond */
 
+/**
+ * @brief Allocate an RX packet adopting driver-filled fragments
+ *
+ * @details This is the zero-copy RX path for drivers that DMA received
+ *          frames straight into net_buf fragments: the driver
+ *          pre-allocates fragments (typically with
+ *          net_pkt_get_reserve_rx_data()) and posts their data pointers
+ *          into its DMA descriptor ring. On reception, it sets the
+ *          length of each filled fragment with net_buf_add(), chains
+ *          them if the frame spans several, and hands the chain to this
+ *          function, which wraps it into an RX packet without copying.
+ *          The packet is then passed up with net_recv_data() as usual.
+ *
+ *          Ownership of the fragments moves to the packet: once the
+ *          stack is done with it they are unreferenced back to their
+ *          pool, from which the driver re-arms its descriptor ring. On
+ *          failure the fragments remain owned by the caller.
+ *
+ * @param iface   The network interface the packet was received on.
+ * @param frags   Fragment (chain) holding the received frame.
+ * @param timeout Maximum time to wait for an allocation.
+ *
+ * @return a pointer to a newly allocated net_pkt on success, NULL otherwise.
+ */
+struct net_pkt *net_pkt_rx_alloc_from_frags(struct net_if *iface,
+					    struct net_buf *frags,
+					    k_timeout_t timeout);
+
 #endif
 
 /**
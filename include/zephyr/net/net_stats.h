@@ -240,6 +240,29 @@ struct net_stats_dns {
 	net_stats_t drop;
 };
 
+/**
+ * @brief Packet drop statistics by drop reason
+ */
+struct net_stats_drop {
+	/** Number of packets dropped due to net_pkt/net_buf allocation
+	 * failure.
+	 */
+	net_stats_t alloc_fail;
+
+	/** Number of packets dropped because a receive queue or receive
+	 * buffer budget was full.
+	 */
+	net_stats_t queue_full;
+
+	/** Number of packets dropped due to a bad transport checksum. */
+	net_stats_t chkerr;
+
+	/** Number of packets dropped because no connection handler
+	 * matched them.
+	 */
+	net_stats_t no_conn;
+};
+
 /**
  * @brief Network packet transfer times for calculating average TX time
  */
@@ -394,6 +417,11 @@ struct net_stats {
 	struct net_stats_dns dns;
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_DROP_REASON)
+	/** Packet drop statistics by drop reason */
+	struct net_stats_drop drop;
+#endif
+
 #if NET_TC_COUNT > 1
 	/** Traffic class statistics */
 	struct net_stats_tc tc;
@@ -673,6 +701,7 @@ enum net_request_stats_cmd {
 	NET_REQUEST_STATS_CMD_GET_PM,
 	NET_REQUEST_STATS_CMD_GET_WIFI,
 	NET_REQUEST_STATS_CMD_RESET_WIFI,
+	NET_REQUEST_STATS_CMD_GET_DROP_REASON,
 };
 
 /** @endcond */
@@ -772,6 +801,16 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_ETHERNET);
 /** @endcond */
 #endif /* CONFIG_NET_STATISTICS_ETHERNET */
 
+#if defined(CONFIG_NET_STATISTICS_DROP_REASON)
+/** Request packet drop statistics by drop reason */
+#define NET_REQUEST_STATS_GET_DROP_REASON			\
+	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_DROP_REASON)
+
+/** @cond INTERNAL_HIDDEN */
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_DROP_REASON);
+/** @endcond */
+#endif /* CONFIG_NET_STATISTICS_DROP_REASON */
+
 #if defined(CONFIG_NET_STATISTICS_PPP)
 /** Request PPP statistics */
 #define NET_REQUEST_STATS_GET_PPP				\
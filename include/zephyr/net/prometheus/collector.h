@@ -34,6 +34,10 @@ struct prometheus_collector {
 	const char *name;
 	/** Array of metrics associated with the collector */
 	struct prometheus_metric *metric[CONFIG_PROMETHEUS_MAX_METRICS];
+	/** Metric value entries resolved at registration time so that
+	 * scrapes do not search the metric sections by name.
+	 */
+	const void *entry[CONFIG_PROMETHEUS_MAX_METRICS];
 	/** Number of metrics associated with the collector */
 	size_t size;
 };
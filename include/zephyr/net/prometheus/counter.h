@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/net/prometheus/metric.h>
 
@@ -30,8 +31,16 @@
 struct prometheus_counter {
 	/** Base of the Prometheus counter metric */
 	struct prometheus_metric *base;
-	/** Value of the Prometheus counter metric */
+	/** Folded value of the Prometheus counter metric. Updated from
+	 * the per-CPU shards when the counter is read, do not access
+	 * directly, use prometheus_counter_value().
+	 */
 	uint64_t value;
+	/** Per-CPU increment shards. Updates only touch the shard of
+	 * the executing CPU so that high-frequency increments do not
+	 * bounce a shared cache line between CPUs.
+	 */
+	atomic_t shard[CONFIG_MP_MAX_NUM_CPUS];
 };
 
 /**
@@ -65,11 +74,34 @@ struct prometheus_counter {
 /**
  * @brief Increment the value of a Prometheus counter metric
  * Increments the value of the specified counter metric by one.
+ * The cost is one atomic add, the function is safe to call from
+ * any context, including ISRs.
  * @param counter Pointer to the counter metric to increment.
  * @return 0 on success, negative errno on error.
  */
 int prometheus_counter_inc(struct prometheus_counter *counter);
 
+/**
+ * @brief Increment the value of a Prometheus counter metric
+ * Increments the value of the specified counter metric by the given
+ * amount. The cost is one atomic add, the function is safe to call
+ * from any context, including ISRs.
+ * @param counter Pointer to the counter metric to increment.
+ * @param value Amount to increment the counter by.
+ * @return 0 on success, negative errno on error.
+ */
+int prometheus_counter_add(struct prometheus_counter *counter, uint32_t value);
+
+/**
+ * @brief Read the current value of a Prometheus counter metric
+ * Folds the per-CPU shards into the counter value and returns the
+ * total. Called at scrape time, concurrent increments are either
+ * included in this read or in the next one.
+ * @param counter Pointer to the counter metric to read.
+ * @return Current value of the counter.
+ */
+uint64_t prometheus_counter_value(struct prometheus_counter *counter);
+
 /**
  * @}
  */
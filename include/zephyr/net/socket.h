@@ -474,6 +474,23 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send multiple messages on a socket
+ *
+ * @details
+ * Sends up to @p vlen messages described by @p msgvec with one call,
+ * resolving the socket and taking its lock only once. The number of
+ * bytes sent per message is stored in the corresponding @c msg_len
+ * field. Processing stops at the first message that fails to send.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @return Number of messages sent on success, -1 and errno set
+ *         if the first message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -500,6 +517,87 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive multiple messages from a socket
+ *
+ * @details
+ * Receives up to @p vlen messages into @p msgvec with one call,
+ * resolving the socket and taking its lock only once. The number of
+ * bytes received per message is stored in the corresponding @c msg_len
+ * field. Processing stops when no more data is available; pass
+ * @c ZSOCK_MSG_DONTWAIT in @p flags to avoid blocking for the first
+ * message. This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @return Number of messages received on success, -1 and errno set
+ *         if the first message could not be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+#if defined(CONFIG_NET_SOCKETS_BUF_LOAN) || defined(__DOXYGEN__)
+struct net_buf;
+
+/**
+ * @brief Receive a datagram without copying it
+ *
+ * @details
+ * Dequeues the next received datagram and loans its net_buf fragment
+ * chain to the caller instead of copying the payload into a user
+ * buffer, so the application can parse the data in place. The chain
+ * starts at the application data, protocol headers are stripped. The
+ * caller must hand the chain back with zsock_recv_buf_return() once
+ * done, otherwise the network buffer pool is drained.
+ *
+ * Only plain native datagram sockets support this, and because the
+ * loaned buffers are kernel memory this interface is limited to
+ * kernel mode applications.
+ *
+ * @param sock Socket to receive from.
+ * @param buf Where to store the loaned fragment chain.
+ * @param flags Receive flags, e.g. @c ZSOCK_MSG_DONTWAIT.
+ * @param src_addr Source address of the datagram, can be NULL.
+ * @param addrlen Size of the source address, can be NULL.
+ *
+ * @return Length of the datagram on success, -1 and errno set on error.
+ */
+ssize_t zsock_recv_buf_loan(int sock, struct net_buf **buf, int flags,
+			    struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Return a fragment chain loaned by zsock_recv_buf_loan()
+ *
+ * @param buf Fragment chain to return, NULL is a no-op.
+ */
+void zsock_recv_buf_return(struct net_buf *buf);
+#endif /* CONFIG_NET_SOCKETS_BUF_LOAN */
+
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND) || defined(__DOXYGEN__)
+/**
+ * @brief Send immutable data to a connected peer without copying it.
+ *
+ * Queues the given data for TCP transmission by reference instead of
+ * staging it in network buffers. The data must stay valid and
+ * unmodified until the peer has acknowledged it, which makes this
+ * only suitable for immutable data such as constant data kept in
+ * flash.
+ *
+ * Only plain native stream sockets support this, and because the data
+ * pointer is queued as is this interface is limited to kernel mode
+ * applications. Returns -1 with errno set to @c EOPNOTSUPP for other
+ * socket types, in which case the caller should fall back to
+ * zsock_send().
+ *
+ * @param sock Socket to send to.
+ * @param buf Buffer to send, must stay valid until acknowledged.
+ * @param len Length of the buffer.
+ *
+ * @return Number of bytes queued on success, -1 (with errno set)
+ *         otherwise.
+ */
+ssize_t zsock_send_nocopy(int sock, const void *buf, size_t len);
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -903,6 +1001,20 @@ static inline ssize_t recvmsg(int sock, struct msghdr *msg, int flags)
 	return zsock_recvmsg(sock, msg, flags);
 }
 
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_poll */
 static inline int poll(struct zsock_pollfd *fds, int nfds, int timeout)
 {
@@ -42,6 +42,19 @@ struct net_socket_service_event;
  */
 typedef void (*net_socket_service_handler_t)(struct net_socket_service_event *pev);
 
+/** @brief The signature for a batched net socket service handler function.
+ *
+ * The function is invoked by the socket service once per poll round
+ * with every event of the service that became ready, instead of once
+ * per ready socket. Useful for services monitoring many sockets, where
+ * per-event dispatch overhead adds up.
+ *
+ * @param pevs Vector of ready socket service events.
+ * @param count Number of events in the vector.
+ */
+typedef void (*net_socket_service_batch_handler_t)(struct net_socket_service_event **pevs,
+						   int count);
+
 /**
  * This struct contains information which socket triggered
  * calls to the callback function.
@@ -81,6 +94,10 @@ struct net_socket_service_desc {
 	int pev_len;
 	/** Where are my pollfd entries in the global list */
 	int *idx;
+	/** Optional batched handler, called once per poll round with all
+	 * ready events of this service instead of the per-event callback.
+	 */
+	net_socket_service_batch_handler_t batch;
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -95,7 +112,7 @@ struct net_socket_service_desc {
 #define NET_SOCKET_SERVICE_OWNER
 #endif
 
-#define __z_net_socket_service_define(_name, _cb, _count, ...) \
+#define __z_net_socket_service_define(_name, _cb, _batch_cb, _count, ...) \
 	static int __z_net_socket_svc_get_idx(_name);			\
 	static struct net_socket_service_event				\
 			__z_net_socket_svc_get_name(_name)[_count] = {	\
@@ -110,6 +127,7 @@ struct net_socket_service_desc {
 		.pev = __z_net_socket_svc_get_name(_name),		\
 		.pev_len = (_count),					\
 		.idx = &__z_net_socket_svc_get_idx(_name),		\
+		.batch = _batch_cb,					\
 	}
 
 /** @endcond */
@@ -133,7 +151,7 @@ struct net_socket_service_desc {
  * @param count How many pollable sockets is needed for this service.
  */
 #define NET_SOCKET_SERVICE_SYNC_DEFINE(name, cb, count)	\
-	__z_net_socket_service_define(name, cb, count)
+	__z_net_socket_service_define(name, cb, NULL, count)
 
 /**
  * @brief Statically define a network socket service in a private (static) scope.
@@ -146,7 +164,31 @@ struct net_socket_service_desc {
  * @param count How many pollable sockets is needed for this service.
  */
 #define NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(name, cb, count)	\
-	__z_net_socket_service_define(name, cb, count, static)
+	__z_net_socket_service_define(name, cb, NULL, count, static)
+
+/**
+ * @brief Statically define a network socket service with batched dispatch.
+ *        The batch callback is called synchronously once per poll round
+ *        with a vector of every event of this service that became ready,
+ *        instead of once per ready socket.
+ *
+ * @param name Name of the service.
+ * @param batch_cb Callback function that is called with all ready events.
+ * @param count How many pollable sockets is needed for this service.
+ */
+#define NET_SOCKET_SERVICE_SYNC_BATCH_DEFINE(name, batch_cb, count)	\
+	__z_net_socket_service_define(name, NULL, batch_cb, count)
+
+/**
+ * @brief Statically define a network socket service with batched dispatch
+ *        in a private (static) scope.
+ *
+ * @param name Name of the service.
+ * @param batch_cb Callback function that is called with all ready events.
+ * @param count How many pollable sockets is needed for this service.
+ */
+#define NET_SOCKET_SERVICE_SYNC_BATCH_DEFINE_STATIC(name, batch_cb, count) \
+	__z_net_socket_service_define(name, NULL, batch_cb, count, static)
 
 /**
  * @brief Register pollable sockets.
@@ -657,6 +657,38 @@ enum wifi_ap_config_param {
 	WIFI_AP_CONFIG_PARAM_MAX_NUM_STA = BIT(1),
 };
 
+/** @brief Wi-Fi Multimedia (WMM) access categories, in increasing
+ * over-the-air priority order.
+ */
+enum wifi_access_category {
+	/** Background */
+	WIFI_AC_BK = 0,
+	/** Best effort */
+	WIFI_AC_BE,
+	/** Video */
+	WIFI_AC_VI,
+	/** Voice */
+	WIFI_AC_VO,
+};
+
+/** Helper function to map an 802.1D user priority, as carried in the
+ * network packet priority, to the WMM access category the frame should
+ * be queued on. Refer to IEEE Std 802.11 - Table 10-1.
+ *
+ * @param priority 802.1D user priority (0 - 7).
+ *
+ * @return Access category for the priority.
+ */
+static inline enum wifi_access_category wifi_priority_to_ac(uint8_t priority)
+{
+	static const uint8_t up_to_ac[8] = {
+		WIFI_AC_BE, WIFI_AC_BK, WIFI_AC_BK, WIFI_AC_BE,
+		WIFI_AC_VI, WIFI_AC_VI, WIFI_AC_VO, WIFI_AC_VO,
+	};
+
+	return (enum wifi_access_category)up_to_ac[priority & 0x7];
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -109,7 +109,9 @@ int zperf_tcp_upload(const struct zperf_upload_params *param,
 /**
  * @brief Asynchronous UDP upload operation.
  *
- * @note Only one asynchronous upload can be performed at a time.
+ * @note Up to @kconfig{CONFIG_NET_ZPERF_ASYNC_STREAMS} asynchronous
+ *       uploads can run concurrently, -EBUSY is returned when all
+ *       upload streams are in use.
  *
  * @param param Upload parameters.
  * @param callback Session results callback.
@@ -124,7 +126,9 @@ int zperf_udp_upload_async(const struct zperf_upload_params *param,
 /**
  * @brief Asynchronous TCP upload operation.
  *
- * @note Only one asynchronous upload can be performed at a time.
+ * @note Up to @kconfig{CONFIG_NET_ZPERF_ASYNC_STREAMS} asynchronous
+ *       uploads can run concurrently, -EBUSY is returned when all
+ *       upload streams are in use.
  *
  * @param param Upload parameters.
  * @param callback Session results callback.
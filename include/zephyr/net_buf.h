@@ -1070,6 +1070,23 @@ struct net_buf_data_alloc {
 
 /** @endcond */
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+/** @cond INTERNAL_HIDDEN */
+struct net_buf_pool_cache {
+	/** Protects the cache entries. Uncontended in practice, since the
+	 *  cache is only accessed cross-CPU when it is being flushed.
+	 */
+	struct k_spinlock lock;
+
+	/** Cached free buffers */
+	struct net_buf *bufs[CONFIG_NET_BUF_CACHE_SIZE];
+
+	/** Number of cached buffers */
+	uint8_t count;
+};
+/** @endcond */
+#endif /* CONFIG_NET_BUF_PER_CPU_CACHE */
+
 /**
  * @brief Network buffer pool representation.
  *
@@ -1091,10 +1108,21 @@ struct net_buf_pool {
 	/** Size of user data allocated to this pool */
 	uint8_t user_data_size;
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+	/** Per-CPU caches of free buffers */
+	struct net_buf_pool_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+
+	/** Number of threads blocked waiting for a free buffer */
+	atomic_t blocked;
+#endif /* CONFIG_NET_BUF_PER_CPU_CACHE */
+
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 	/** Amount of available buffers in the pool. */
 	atomic_t avail_count;
 
+	/** Lowest amount of available buffers observed (low watermark). */
+	atomic_t min_avail;
+
 	/** Total size of the pool. */
 	const uint16_t pool_size;
 
@@ -1115,6 +1143,7 @@ struct net_buf_pool {
 /** @cond INTERNAL_HIDDEN */
 #define NET_BUF_POOL_USAGE_INIT(_pool, _count) \
 	IF_ENABLED(CONFIG_NET_BUF_POOL_USAGE, (.avail_count = ATOMIC_INIT(_count),)) \
+	IF_ENABLED(CONFIG_NET_BUF_POOL_USAGE, (.min_avail = ATOMIC_INIT(_count),)) \
 	IF_ENABLED(CONFIG_NET_BUF_POOL_USAGE, (.name = STRINGIFY(_pool),))
 
 #define NET_BUF_POOL_INITIALIZER(_pool, _alloc, _bufs, _count, _ud_size, _destroy) \
@@ -1308,6 +1337,36 @@ extern const struct net_buf_data_cb net_buf_var_cb;
  */
 struct net_buf_pool *net_buf_pool_get(int id);
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+/** @cond INTERNAL_HIDDEN */
+/**
+ * @brief Release a buffer into a per-CPU free-list cache.
+ *
+ * Called by net_buf_destroy() instead of placing the buffer directly into
+ * the pool's LIFO. Falls back to the LIFO when the cache is full or when
+ * allocators are blocked waiting for a buffer.
+ *
+ * @param pool Pool the buffer belongs to.
+ * @param buf Buffer to release.
+ */
+void net_buf_cache_put(struct net_buf_pool *pool, struct net_buf *buf);
+/** @endcond */
+#endif /* CONFIG_NET_BUF_PER_CPU_CACHE */
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+/**
+ * @brief Get the lowest number of available buffers observed in a pool.
+ *
+ * @param pool Network buffer pool.
+ *
+ * @return Low watermark of the pool's available buffer count.
+ */
+static inline uint16_t net_buf_pool_min_avail_get(struct net_buf_pool *pool)
+{
+	return (uint16_t)atomic_get(&pool->min_avail);
+}
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+
 /**
  * @brief Get a zero-based index for a buffer.
  *
@@ -1477,7 +1536,11 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+	net_buf_cache_put(pool, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
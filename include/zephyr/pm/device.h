@@ -172,6 +172,8 @@ struct pm_device {
 	struct k_event event;
 	/** Work object for asynchronous calls */
 	struct k_work_delayable work;
+	/** Idle window applied by pm_device_runtime_put() before suspending */
+	k_timeout_t autosuspend_delay;
 #endif /* CONFIG_PM_DEVICE_RUNTIME */
 };
 
@@ -635,6 +637,37 @@ bool pm_device_is_powered(const struct device *dev);
  */
 int pm_device_driver_init(const struct device *dev, pm_device_action_cb_t action_cb);
 
+#if defined(CONFIG_PM_DEVICE_RETENTION) || defined(__DOXYGEN__)
+/**
+ * @brief Save device power states to retained RAM before system off.
+ *
+ * Records which devices are currently in @ref PM_DEVICE_STATE_SUSPENDED in
+ * the retention area chosen as ``zephyr,pm-device-retention``. On the boot
+ * that follows, the init function of each recorded device is skipped and the
+ * device comes up suspended, so it is brought back through its resume action
+ * instead of a full re-initialization.
+ *
+ * Intended to be called right before entering a system off state on SoCs
+ * whose peripheral and retained RAM contents survive it.
+ *
+ * @retval 0 On success.
+ * @retval -errno Error code from the retention device on failure.
+ */
+int pm_device_retention_save(void);
+
+/** @cond INTERNAL_HIDDEN */
+
+/**
+ * @brief Consume a retained power state record for a device during boot.
+ *
+ * @return true if the device init must be skipped and the device set up as
+ *	   suspended, false if normal initialization is required.
+ */
+bool pm_device_retention_resume(const struct device *dev);
+
+/** @endcond */
+#endif /* CONFIG_PM_DEVICE_RETENTION */
+
 #else
 static inline int pm_device_state_get(const struct device *dev,
 				      enum pm_device_state *state)
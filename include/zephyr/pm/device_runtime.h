@@ -144,6 +144,29 @@ int pm_device_runtime_put(const struct device *dev);
  */
 int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay);
 
+/**
+ * @brief Set the autosuspend idle window of a device.
+ *
+ * When a delay other than K_NO_WAIT is configured, pm_device_runtime_put()
+ * defers the suspension of the device by @p delay instead of suspending it
+ * immediately, equivalent to calling pm_device_runtime_put_async() with the
+ * configured delay. A pm_device_runtime_get() within the window cancels the
+ * pending suspension, so bursts of get/put cycles (e.g. polling a sensor) do
+ * not repeatedly power-cycle the device, nor the power domain or bus
+ * controller it sits on, which is only released once the deferred suspend
+ * actually runs.
+ *
+ * @param dev Device instance.
+ * @param delay Idle window before suspending, K_NO_WAIT to suspend
+ * immediately (the default).
+ *
+ * @retval 0 If it succeeds.
+ * @retval -ENOTSUP If the device does not support runtime PM or suspends
+ * from interrupt context (ISR safe devices suspend in place).
+ */
+int pm_device_runtime_autosuspend_set(const struct device *dev,
+				      k_timeout_t delay);
+
 /**
  * @brief Check if device runtime is enabled for a given device.
  *
@@ -209,6 +232,14 @@ static inline int pm_device_runtime_put_async(const struct device *dev,
 	return 0;
 }
 
+static inline int pm_device_runtime_autosuspend_set(const struct device *dev,
+		k_timeout_t delay)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(delay);
+	return 0;
+}
+
 static inline bool pm_device_runtime_is_enabled(const struct device *dev)
 {
 	ARG_UNUSED(dev);
@@ -1040,6 +1040,43 @@ static inline struct rtio_cqe *rtio_cqe_consume_block(struct rtio *r)
 	return cqe;
 }
 
+/**
+ * @brief Consume multiple completion queue events if available
+ *
+ * Consumes up to @p cqe_count events from the completion queue in a single
+ * pass without blocking. Each returned completion queue event must be
+ * released with rtio_cqe_release() at some point to release the cqe spot
+ * for the cqe producer.
+ *
+ * @param r RTIO context
+ * @param cqes Array where consumed completion queue events are stored
+ * @param cqe_count Capacity of @p cqes
+ *
+ * @retval Number of consumed completion queue events (0 to @p cqe_count)
+ */
+static inline size_t rtio_cqe_consume_batch(struct rtio *r, struct rtio_cqe **cqes,
+					    size_t cqe_count)
+{
+	struct mpsc_node *node;
+	size_t consumed = 0;
+
+	while (consumed < cqe_count) {
+#ifdef CONFIG_RTIO_CONSUME_SEM
+		if (k_sem_take(r->consume_sem, K_NO_WAIT) != 0) {
+			break;
+		}
+#endif
+
+		node = mpsc_pop(&r->cq);
+		if (node == NULL) {
+			break;
+		}
+		cqes[consumed++] = CONTAINER_OF(node, struct rtio_cqe, q);
+	}
+
+	return consumed;
+}
+
 /**
  * @brief Release consumed completion queue event
  *
@@ -1154,17 +1191,49 @@ static inline void rtio_iodev_sqe_err(struct rtio_iodev_sqe *iodev_sqe, int resu
 }
 
 /**
- * Submit a completion queue event with a given result and userdata
+ * Signal completion of @p count events to any waiters
  *
- * Called by the executor to produce a completion queue event, no inherent
- * locking is performed and this is not safe to do from multiple callers.
+ * Accounts for the completions in the total count and wakes up threads
+ * blocked in rtio_submit() or on the consume semaphore. Called by the
+ * executor, either through rtio_cqe_submit() or once per batch of
+ * completions produced with rtio_cqe_submit_no_signal().
+ *
+ * @param r RTIO context
+ * @param count Number of completed events to signal
+ */
+static inline void rtio_cqe_signal(struct rtio *r, uint32_t count)
+{
+	atomic_add(&r->cq_count, count);
+#ifdef CONFIG_RTIO_SUBMIT_SEM
+	if (r->submit_count > 0) {
+		r->submit_count -= MIN(count, r->submit_count);
+		if (r->submit_count == 0) {
+			k_sem_give(r->submit_sem);
+		}
+	}
+#endif
+#ifdef CONFIG_RTIO_CONSUME_SEM
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_give(r->consume_sem);
+	}
+#endif
+}
+
+/**
+ * Submit a completion queue event without signalling waiters
+ *
+ * Variant of rtio_cqe_submit() which only produces the completion queue
+ * event. The caller must follow up with a single rtio_cqe_signal() covering
+ * all events produced this way, allowing the wake-up cost for a batch of
+ * completions (e.g. a transaction) to be paid once.
  *
  * @param r RTIO context
  * @param result Integer result code (could be -errno)
  * @param userdata Userdata to pass along to completion
  * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
  */
-static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+static inline void rtio_cqe_submit_no_signal(struct rtio *r, int result, void *userdata,
+					     uint32_t flags)
 {
 	struct rtio_cqe *cqe = rtio_cqe_acquire(r);
 
@@ -1176,19 +1245,23 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		cqe->flags = flags;
 		rtio_cqe_produce(r, cqe);
 	}
+}
 
-	atomic_inc(&r->cq_count);
-#ifdef CONFIG_RTIO_SUBMIT_SEM
-	if (r->submit_count > 0) {
-		r->submit_count--;
-		if (r->submit_count == 0) {
-			k_sem_give(r->submit_sem);
-		}
-	}
-#endif
-#ifdef CONFIG_RTIO_CONSUME_SEM
-	k_sem_give(r->consume_sem);
-#endif
+/**
+ * Submit a completion queue event with a given result and userdata
+ *
+ * Called by the executor to produce a completion queue event, no inherent
+ * locking is performed and this is not safe to do from multiple callers.
+ *
+ * @param r RTIO context
+ * @param result Integer result code (could be -errno)
+ * @param userdata Userdata to pass along to completion
+ * @param flags Flags to use for the CEQ see RTIO_CQE_FLAG_*
+ */
+static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, uint32_t flags)
+{
+	rtio_cqe_submit_no_signal(r, result, userdata, flags);
+	rtio_cqe_signal(r, 1);
 }
 
 #define __RTIO_MEMPOOL_GET_NUM_BLKS(num_bytes, blk_size) (((num_bytes) + (blk_size)-1) / (blk_size))
@@ -282,6 +282,25 @@ int sensing_get_config(
 const struct sensing_sensor_info *sensing_get_sensor_info(
 		sensing_sensor_handle_t handle);
 
+/**
+ * @brief Decode a whole batch of 3-axis sensor samples in one call.
+ *
+ * Decode all frames of a raw sensor data buffer, as received in the
+ * \ref sensing_data_event_t callback, into a caller provided
+ * \ref sensing_sensor_value_3d_q31 array. The underlying sensor decoder
+ * converts the whole hardware FIFO window with one decode call, readings
+ * keep the fixed-point q31 representation of the decoder.
+ *
+ * @param handle The sensor instance handle.
+ * @param buf The raw data buffer received in the data event callback.
+ * @param values Caller provided buffer for the decoded readings, must have
+ *               room for \p max_count readings.
+ * @param max_count Maximum number of readings \p values can hold.
+ * @return Number of decoded readings on success or negative error value on failure.
+ */
+int sensing_decode_three_axis(sensing_sensor_handle_t handle, const void *buf,
+			      struct sensing_sensor_value_3d_q31 *values, uint16_t max_count);
+
 #ifdef __cplusplus
 }
 #endif
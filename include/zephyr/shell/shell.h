@@ -16,6 +16,7 @@
 #include <zephyr/logging/log_instance.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/util.h>
 
 #if defined CONFIG_SHELL_GETOPT
@@ -865,10 +866,25 @@ struct shell_ctx {
 	struct k_poll_signal signals[SHELL_SIGNALS];
 
 	/** Events that should be used only internally by shell thread.
-	 * Event for SHELL_SIGNAL_TXDONE is initialized but unused.
+	 * Event for SHELL_SIGNAL_TXDONE is initialized but unused,
+	 * unless CONFIG_SHELL_ASYNC_TX is enabled, in which case it
+	 * wakes the shell thread to drain the output ring buffer.
 	 */
 	struct k_poll_event events[SHELL_SIGNALS];
 
+#ifdef CONFIG_SHELL_ASYNC_TX
+	/** Ring buffer queuing output data so that producers never block
+	 * on the transport. Drained by the shell thread.
+	 */
+	struct ring_buf tx_ringbuf;
+
+	/** Data buffer for the output ring buffer. */
+	uint8_t tx_ringbuf_data[CONFIG_SHELL_ASYNC_TX_RING_SIZE];
+
+	/** Number of bytes dropped on output ring buffer overflow. */
+	atomic_t tx_dropped;
+#endif
+
 	struct k_mutex wr_mtx;
 	k_tid_t tid;
 	int ret_val;
@@ -20,6 +20,10 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
 
+#ifdef CONFIG_LOCK_PROFILING
+#include <zephyr/debug/lock_prof.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -78,8 +82,18 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_LOCK_PROFILING
+	/* Contention profiler bookkeeping, see kernel/lock_prof.c.
+	 * The call site string and cycle counts captured at lock time
+	 * are consumed when the lock is released.
+	 */
+	const char *prof_site;
+	uint32_t prof_contended;
+	uint32_t prof_acquired;
+#endif /* CONFIG_LOCK_PROFILING */
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_LOCK_PROFILING)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -151,39 +165,48 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
-/**
- * @brief Lock a spinlock
- *
- * This routine locks the specified spinlock, returning a key handle
- * representing interrupt state needed at unlock time.  Upon
- * returning, the calling thread is guaranteed not to be suspended or
- * interrupted on its current CPU until it calls k_spin_unlock().  The
- * implementation guarantees mutual exclusion: exactly one thread on
- * one CPU will return from k_spin_lock() at a time.  Other CPUs
- * trying to acquire a lock already held by another CPU will enter an
- * implementation-defined busy loop ("spinning") until the lock is
- * released.
- *
- * Separate spin locks may be nested. It is legal to lock an
- * (unlocked) spin lock while holding a different lock.  Spin locks
- * are not recursive, however: an attempt to acquire a spin lock that
- * the CPU already holds will deadlock.
- *
- * In circumstances where only one CPU exists, the behavior of
- * k_spin_lock() remains as specified above, though obviously no
- * spinning will take place.  Implementations may be free to optimize
- * in uniprocessor contexts such that the locking reduces to an
- * interrupt mask operation.
- *
- * @param l A pointer to the spinlock to lock
- * @return A key value that must be passed to k_spin_unlock() when the
- *         lock is released.
+#ifdef CONFIG_LOCK_PROFILING
+/* Record the acquisition of a profiled spinlock.  Runs with the lock
+ * held and interrupts masked on this CPU.
  */
-static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
+static ALWAYS_INLINE void z_spinlock_prof_post(struct k_spinlock *l,
+					       const char *site,
+					       uint32_t start)
+{
+	uint32_t now = sys_clock_cycle_get_32();
+
+	l->prof_site = site;
+	l->prof_contended = now - start;
+	l->prof_acquired = now;
+}
+
+/* Account the releasing of a profiled spinlock.  Must run before the
+ * lock is actually released so that per-site updates stay serialized.
+ */
+static ALWAYS_INLINE void z_spinlock_prof_release(struct k_spinlock *l)
+{
+	z_lock_prof_update(l->prof_site, LOCK_PROF_KIND_SPINLOCK,
+			   l->prof_contended,
+			   sys_clock_cycle_get_32() - l->prof_acquired);
+}
+#endif /* CONFIG_LOCK_PROFILING */
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Lock implementation shared by k_spin_lock() and k_spin_trylock().
+ * The call site string is only consumed by the contention profiler.
+ */
+static ALWAYS_INLINE k_spinlock_key_t z_spin_lock_site(struct k_spinlock *l,
+						       const char *site)
 {
 	ARG_UNUSED(l);
+	ARG_UNUSED(site);
 	k_spinlock_key_t k;
 
+#ifdef CONFIG_LOCK_PROFILING
+	uint32_t prof_start = sys_clock_cycle_get_32();
+#endif
+
 	/* Note that we need to use the underlying arch-specific lock
 	 * implementation.  The "irq_lock()" API in SMP context is
 	 * actually a wrapper for a global spinlock!
@@ -202,6 +225,25 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	while (atomic_get(&l->owner) != ticket) {
 		arch_spin_relax();
 	}
+#elif defined(CONFIG_SPIN_LOCK_BACKOFF)
+	uint32_t delay = 1;
+
+	while (!atomic_cas(&l->locked, 0, 1)) {
+		/* Wait with plain reads so the line stays shared between
+		 * the waiters, and back off exponentially so they don't
+		 * saturate the interconnect re-fetching it.  Only a release
+		 * (or another waiter's acquisition) invalidates the line
+		 * and ends the inner loop.
+		 */
+		do {
+			for (uint32_t i = 0; i < delay; i++) {
+				arch_spin_relax();
+			}
+			if (delay < CONFIG_SPIN_LOCK_BACKOFF_LIMIT) {
+				delay <<= 1;
+			}
+		} while (atomic_get(&l->locked) != 0);
+	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
 		arch_spin_relax();
@@ -209,26 +251,66 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_LOCK_PROFILING
+	z_spinlock_prof_post(l, site, prof_start);
+#endif
 
 	return k;
 }
 
+/** @endcond */
+
 /**
- * @brief Attempt to lock a spinlock
+ * @brief Lock a spinlock
  *
- * This routine makes one attempt to lock @p l. If it is successful, then
- * it will store the key into @p k.
+ * This routine locks the specified spinlock, returning a key handle
+ * representing interrupt state needed at unlock time.  Upon
+ * returning, the calling thread is guaranteed not to be suspended or
+ * interrupted on its current CPU until it calls k_spin_unlock().  The
+ * implementation guarantees mutual exclusion: exactly one thread on
+ * one CPU will return from k_spin_lock() at a time.  Other CPUs
+ * trying to acquire a lock already held by another CPU will enter an
+ * implementation-defined busy loop ("spinning") until the lock is
+ * released.
  *
- * @param[in] l A pointer to the spinlock to lock
- * @param[out] k A pointer to the spinlock key
- * @retval 0 on success
- * @retval -EBUSY if another thread holds the lock
+ * Separate spin locks may be nested. It is legal to lock an
+ * (unlocked) spin lock while holding a different lock.  Spin locks
+ * are not recursive, however: an attempt to acquire a spin lock that
+ * the CPU already holds will deadlock.
  *
- * @see k_spin_lock
- * @see k_spin_unlock
+ * In circumstances where only one CPU exists, the behavior of
+ * k_spin_lock() remains as specified above, though obviously no
+ * spinning will take place.  Implementations may be free to optimize
+ * in uniprocessor contexts such that the locking reduces to an
+ * interrupt mask operation.
+ *
+ * @param l A pointer to the spinlock to lock
+ * @return A key value that must be passed to k_spin_unlock() when the
+ *         lock is released.
  */
-static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *k)
+static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
+{
+	return z_spin_lock_site(l, "unknown");
+}
+
+#ifdef CONFIG_LOCK_PROFILING
+/* Shadow the function above so that every call site is identified by
+ * its file and line.  The function stays available for callers that
+ * suppress the macro expansion.
+ */
+#define k_spin_lock(l) z_spin_lock_site((l), __FILE__ ":" STRINGIFY(__LINE__))
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+static ALWAYS_INLINE int z_spin_trylock_site(struct k_spinlock *l,
+					     k_spinlock_key_t *k,
+					     const char *site)
 {
+	ARG_UNUSED(site);
+#ifdef CONFIG_LOCK_PROFILING
+	uint32_t prof_start = sys_clock_cycle_get_32();
+#endif
 	int key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
@@ -264,6 +346,9 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_LOCK_PROFILING
+	z_spinlock_prof_post(l, site, prof_start);
+#endif
 
 	k->key = key;
 
@@ -276,6 +361,32 @@ busy:
 #endif /* CONFIG_SMP */
 }
 
+/** @endcond */
+
+/**
+ * @brief Attempt to lock a spinlock
+ *
+ * This routine makes one attempt to lock @p l. If it is successful, then
+ * it will store the key into @p k.
+ *
+ * @param[in] l A pointer to the spinlock to lock
+ * @param[out] k A pointer to the spinlock key
+ * @retval 0 on success
+ * @retval -EBUSY if another thread holds the lock
+ *
+ * @see k_spin_lock
+ * @see k_spin_unlock
+ */
+static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *k)
+{
+	return z_spin_trylock_site(l, k, "unknown");
+}
+
+#ifdef CONFIG_LOCK_PROFILING
+#define k_spin_trylock(l, k) \
+	z_spin_trylock_site((l), (k), __FILE__ ":" STRINGIFY(__LINE__))
+#endif
+
 /**
  * @brief Unlock a spin lock
  *
@@ -313,6 +424,10 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_LOCK_PROFILING
+	z_spinlock_prof_release(l);
+#endif
+
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/* Give the spinlock to the next CPU in a FIFO */
@@ -362,6 +477,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_LOCK_PROFILING
+	z_spinlock_prof_release(l);
+#endif
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
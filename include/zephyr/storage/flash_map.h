@@ -291,6 +291,55 @@ const char *flash_area_label(const struct flash_area *fa);
  */
 uint8_t flash_area_erased_val(const struct flash_area *fa);
 
+#if defined(CONFIG_FLASH_MAP_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Accumulated access statistics of one flash area.
+ *
+ * Counters cover operations performed through the flash area API since
+ * boot, plus any persisted baseline loaded through the settings
+ * subsystem when @kconfig{CONFIG_FLASH_MAP_STATS_PERSIST} is enabled.
+ */
+struct flash_area_stats {
+	uint32_t write_count; /**< Number of successful write operations */
+	uint32_t erase_count; /**< Number of successful erase/flatten operations */
+	uint64_t bytes_written; /**< Total bytes written */
+	uint64_t bytes_erased; /**< Total bytes erased or flattened */
+};
+
+/**
+ * Get access statistics of a flash area.
+ *
+ * @param[in] fa Flash area.
+ * @param[out] stats Statistics snapshot.
+ *
+ * @return 0 on success, -ENOENT if the area is not tracked.
+ */
+int flash_area_stats_get(const struct flash_area *fa,
+			 struct flash_area_stats *stats);
+
+/**
+ * Reset access statistics of a flash area to zero.
+ *
+ * @param[in] fa Flash area.
+ *
+ * @return 0 on success, -ENOENT if the area is not tracked.
+ */
+int flash_area_stats_reset(const struct flash_area *fa);
+
+#if defined(CONFIG_FLASH_MAP_STATS_PERSIST) || defined(__DOXYGEN__)
+/**
+ * Persist the statistics of all tracked flash areas with the settings
+ * subsystem, so they accumulate across reboots.
+ *
+ * Saving writes to the settings backend and therefore itself causes
+ * wear; call it at a coarse cadence (e.g. hourly or on shutdown).
+ *
+ * @return 0 on success, negative errno code on first failure.
+ */
+int flash_area_stats_save(void);
+#endif
+#endif /* CONFIG_FLASH_MAP_STATS */
+
 /**
  * Returns non-0 value if fixed-partition of given DTS node label exists.
  *
@@ -24,6 +24,7 @@
  */
 
 #include <stdbool.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #ifdef __cplusplus
@@ -67,6 +68,16 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	uint8_t *buf_alt; /* Second buffer half, not being filled */
+	struct k_work write_work; /* Programs buf_alt in the background */
+	struct k_sem write_done; /* Signals completion of write_work */
+	uint8_t *write_buf; /* Buffer half being programmed */
+	size_t write_buf_bytes; /* Number of bytes being programmed */
+	size_t write_addr; /* Device offset being programmed */
+	int write_rc; /* Result of last background write */
+	bool write_pending; /* Background write submitted, not folded in */
+#endif
 };
 
 /**
@@ -168,11 +168,45 @@ struct _isr_list_sname {
 #ifdef CONFIG_SHARED_INTERRUPTS
 struct z_shared_isr_table_entry {
 	struct _isr_table_entry clients[CONFIG_SHARED_IRQ_MAX_NUM_CLIENTS];
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+	/* Optional per-client pre-check, indexed like clients[]. When set,
+	 * the client handler is only invoked if the pre-check reports that
+	 * the client's device raised the interrupt.
+	 */
+	bool (*precheck[CONFIG_SHARED_IRQ_MAX_NUM_CLIENTS])(const void *arg);
+#endif
 	size_t client_num;
 };
 
 void z_shared_isr(const void *data);
 
+#ifdef CONFIG_SHARED_INTERRUPTS_PRECHECK
+/**
+ * @brief Register a pre-check callback for a shared interrupt client.
+ *
+ * The pre-check is called from the shared interrupt demux with the client's
+ * argument and must report, typically from the device's interrupt status
+ * register, whether the device raised the interrupt. Clients whose pre-check
+ * returns false are skipped, and clients that served an interrupt are
+ * gradually promoted towards the front of the client list, so the hottest
+ * source ends up probed first.
+ *
+ * The callback runs in ISR context and must not sleep.
+ *
+ * @param irq IRQ line the client is registered on.
+ * @param routine Client ISR, as registered for the interrupt.
+ * @param parameter Client ISR argument, as registered for the interrupt.
+ * @param precheck Pre-check callback, NULL to remove a callback.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the IRQ line is invalid or not shared.
+ * @retval -ENOENT if no such client is registered on the IRQ line.
+ */
+int z_shared_irq_set_precheck(unsigned int irq, void (*routine)(const void *),
+			      const void *parameter,
+			      bool (*precheck)(const void *arg));
+#endif /* CONFIG_SHARED_INTERRUPTS_PRECHECK */
+
 extern struct z_shared_isr_table_entry z_shared_sw_isr_table[];
 #endif /* CONFIG_SHARED_INTERRUPTS */
 
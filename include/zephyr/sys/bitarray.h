@@ -36,6 +36,12 @@ struct sys_bitarray {
 	/* Number of bundles */
 	uint32_t num_bundles;
 
+	/* Index of the first bundle which may contain a cleared bit.
+	 * All bundles below it are fully set. Used as a scan start hint
+	 * by sys_bitarray_alloc(); 0 is always a safe value.
+	 */
+	uint32_t first_free_bundle;
+
 	/* Bundle of bits */
 	uint32_t *bundles;
 
@@ -223,6 +223,30 @@ static inline bool sys_hashmap_get(const struct sys_hashmap *map, uint64_t key,
 	return map->api->get(map, key, value);
 }
 
+/**
+ * @brief Reserve space for @p n entries in a @ref sys_hashmap
+ *
+ * Grow @p map so that it can hold at least @p n entries without exceeding
+ * its configured load factor, so that subsequent insertions do not trigger
+ * a rehash.
+ *
+ * @param map Hashmap to reserve space in
+ * @param n Number of entries to reserve space for
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if memory allocation failed
+ * @retval -ENOSPC if @p n exceeds the configured maximum size
+ * @retval -ENOSYS if the implementation does not support reservations
+ */
+static inline int sys_hashmap_reserve(struct sys_hashmap *map, size_t n)
+{
+	if (map->api->reserve == NULL) {
+		return -ENOSYS;
+	}
+
+	return map->api->reserve(map, n);
+}
+
 /**
  * @brief Check if @p map contains a value associated with @p key
  *
@@ -162,6 +162,24 @@ typedef bool (*sys_hashmap_remove_t)(struct sys_hashmap *map, uint64_t key, uint
  */
 typedef bool (*sys_hashmap_get_t)(const struct sys_hashmap *map, uint64_t key, uint64_t *value);
 
+/**
+ * @brief Reserve space for @p n entries in a @ref sys_hashmap
+ *
+ * Ensure that @p map can hold at least @p n entries without exceeding its
+ * configured load factor and therefore without rehashing on subsequent
+ * insertions.
+ *
+ * This method is optional and may be `NULL` for a given implementation.
+ *
+ * @param map Hashmap to reserve space in
+ * @param n Number of entries to reserve space for
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if memory allocation failed
+ * @retval -ENOSPC if @p n exceeds the configured maximum size
+ */
+typedef int (*sys_hashmap_reserve_t)(struct sys_hashmap *map, size_t n);
+
 /**
  * @brief Generic Hashmap API
  */
@@ -176,6 +194,8 @@ struct sys_hashmap_api {
 	sys_hashmap_remove_t remove;
 	/** Retrieve the value associated with a given key from the Hashmap */
 	sys_hashmap_get_t get;
+	/** Pre-size the Hashmap for an expected number of entries (optional) */
+	sys_hashmap_reserve_t reserve;
 };
 
 /**
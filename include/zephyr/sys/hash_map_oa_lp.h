@@ -29,6 +29,15 @@ struct sys_hashmap_oa_lp_data {
 	size_t n_buckets;
 	size_t size;
 	size_t n_tombstones;
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	/* previous table still being drained by incremental rehashing */
+	void *old_buckets;
+	size_t old_n_buckets;
+	/* entries left in the previous table */
+	size_t old_size;
+	/* next bucket of the previous table to migrate */
+	size_t migrate_pos;
+#endif
 };
 
 /**
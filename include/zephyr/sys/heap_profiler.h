@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H
+#define ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H
+
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup heap_profiler_apis Heap Profiler APIs
+ * @ingroup heaps
+ * @{
+ *
+ * The heap profiler attaches to the allocation and free events of one
+ * heap through the heap listener interface and aggregates them into a
+ * compact, fixed-size set of tables:
+ *
+ *  - a size-class histogram of allocation and free counts, with the
+ *    current and peak number of live blocks per power-of-two class;
+ *
+ *  - a table of outstanding allocations recording size, age and
+ *    allocating thread, to attribute live memory without rebuilding
+ *    with instrumented allocators;
+ *
+ *  - a logarithmic histogram of block lifetimes from which approximate
+ *    lifetime percentiles are derived;
+ *
+ *  - a ring of the most recent allocation and free events.
+ *
+ * The tables can be dumped and reset at run time from the shell with
+ * the "heap_prof" command.
+ */
+
+/**
+ * @brief Start profiling a heap
+ *
+ * Attaches the profiler to the heap identified by @p heap_id, as used by
+ * the heap listener interface (typically the address of the heap object,
+ * or 0 for the global libc heap). Only one heap can be profiled at a
+ * time. Events already aggregated are kept, so profiling may be stopped
+ * and resumed; use heap_profiler_reset() for a fresh start.
+ *
+ * @param heap_id Identifier of the heap to profile
+ *
+ * @retval 0 on success
+ * @retval -EALREADY if the profiler is already running
+ */
+int heap_profiler_start(uintptr_t heap_id);
+
+/**
+ * @brief Stop profiling
+ *
+ * Detaches the profiler from the heap. Aggregated data is retained and
+ * can still be dumped.
+ *
+ * @retval 0 on success
+ * @retval -EALREADY if the profiler is not running
+ */
+int heap_profiler_stop(void);
+
+/**
+ * @brief Discard all aggregated profiling data
+ */
+void heap_profiler_reset(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HEAP_PROFILER_H */
@@ -100,7 +100,16 @@ struct sys_mem_blocks {
 	/* Bitmap of allocated blocks */
 	sys_bitarray_t *bitmap;
 
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+	/* Summary bitmap with one bit per 32-block group, set when the
+	 * group is fully allocated.  Lets contiguous-run searches skip
+	 * allocated regions 32 or 1024 blocks at a time.
+	 */
+	uint32_t *contig_index;
+#endif
+
+#if defined(CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS) || \
+	defined(CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX)
 	/* Spinlock guarding access to memory block internals */
 	struct k_spinlock  lock;
 #endif
@@ -125,13 +134,26 @@ struct sys_multi_mem_blocks {
  * @param buf      Backing buffer of type uint8_t.
  * @param mbmod    Modifier to the memory block struct
  */
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+#define _SYS_MEM_BLOCKS_CONTIG_INDEX_DEFINE(name, num_blks, mbmod)	\
+	mbmod uint32_t _sys_mem_blocks_cindex_##name			\
+		[DIV_ROUND_UP(DIV_ROUND_UP(num_blks, 32), 32)];
+#define _SYS_MEM_BLOCKS_CONTIG_INDEX_INIT(name)				\
+	.contig_index = _sys_mem_blocks_cindex_##name,
+#else
+#define _SYS_MEM_BLOCKS_CONTIG_INDEX_DEFINE(name, num_blks, mbmod)
+#define _SYS_MEM_BLOCKS_CONTIG_INDEX_INIT(name)
+#endif
+
 #define _SYS_MEM_BLOCKS_DEFINE_WITH_EXT_BUF(name, blk_sz, num_blks, buf, mbmod) \
 	_SYS_BITARRAY_DEFINE(_sys_mem_blocks_bitmap_##name,		\
 			     num_blks, mbmod);				\
+	_SYS_MEM_BLOCKS_CONTIG_INDEX_DEFINE(name, num_blks, mbmod)	\
 	mbmod struct sys_mem_blocks name = {                            \
 		.info = {num_blks, ilog2(blk_sz)},                      \
 		.buffer = buf,						\
 		.bitmap = &_sys_mem_blocks_bitmap_##name,		\
+		_SYS_MEM_BLOCKS_CONTIG_INDEX_INIT(name)			\
 	};                                                              \
 	STRUCT_SECTION_ITERABLE_ALTERNATE(sys_mem_blocks_ptr,           \
 					  sys_mem_blocks *,             \
@@ -330,6 +352,38 @@ int sys_mem_blocks_runtime_stats_get(sys_mem_blocks_t *mem_block,
 int sys_mem_blocks_runtime_stats_reset_max(sys_mem_blocks_t *mem_block);
 #endif
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+/**
+ * @brief Fragmentation statistics of a memory block object
+ */
+struct sys_mem_blocks_frag_stats {
+	/** Number of free blocks */
+	uint32_t free_blocks;
+
+	/** Number of separate runs the free blocks form */
+	uint32_t free_runs;
+
+	/** Length of the longest free run, i.e. the biggest
+	 *  contiguous allocation that can currently succeed
+	 */
+	uint32_t largest_run;
+};
+
+/**
+ * @brief Get the fragmentation statistics of a memory block
+ *
+ * This function scans the allocation bitmap of @a mem_block and
+ * reports how the free blocks are distributed into contiguous runs.
+ *
+ * @param mem_block Pointer to system memory block
+ * @param stats Pointer to struct to copy statistics into
+ *
+ * @return -EINVAL if NULL pointer was passed, otherwise 0
+ */
+int sys_mem_blocks_frag_stats_get(sys_mem_blocks_t *mem_block,
+				  struct sys_mem_blocks_frag_stats *stats);
+#endif
+
 /**
  * @brief Initialize multi memory blocks allocator group
  *
@@ -64,6 +64,9 @@ extern "C" {
 /** @brief Flag indicated that buffer is currently full. */
 #define MPSC_PBUF_FULL BIT(3)
 
+/** @brief Flag indicating that usage is at or above the watermark. */
+#define MPSC_PBUF_ABOVE_WATERMARK BIT(4)
+
 /**@} */
 
 /* Forward declaration */
@@ -86,6 +89,17 @@ typedef uint32_t (*mpsc_pbuf_get_wlen)(const union mpsc_pbuf_generic *packet);
 typedef void (*mpsc_pbuf_notify_drop)(const struct mpsc_pbuf_buffer *buffer,
 				      const union mpsc_pbuf_generic *packet);
 
+/** @brief Callback called when buffer usage crosses the watermark.
+ *
+ * Called from the producer context when the amount of buffered data grows
+ * from below to at least the configured watermark. It is called again only
+ * after usage dropped below the watermark, so a consumer can use it to wake
+ * up and drain packets in batches instead of once per packet.
+ *
+ * @param buffer Packet buffer.
+ */
+typedef void (*mpsc_pbuf_notify_watermark)(const struct mpsc_pbuf_buffer *buffer);
+
 /** @brief MPSC packet buffer structure. */
 struct mpsc_pbuf_buffer {
 	/** Temporary write index. */
@@ -115,6 +129,15 @@ struct mpsc_pbuf_buffer {
 	/** Callback for getting packet length. */
 	mpsc_pbuf_get_wlen get_wlen;
 
+	/** User callback called when usage crosses the watermark.
+	 *
+	 * May be NULL if unneeded.
+	 */
+	mpsc_pbuf_notify_watermark notify_watermark;
+
+	/** Watermark in 32 bit words. */
+	uint32_t watermark;
+
 	/* Buffer. */
 	uint32_t *buf;
 
@@ -138,6 +161,10 @@ struct mpsc_pbuf_buffer_config {
 	/* Callbacks. */
 	mpsc_pbuf_notify_drop notify_drop;
 	mpsc_pbuf_get_wlen get_wlen;
+	mpsc_pbuf_notify_watermark notify_watermark;
+
+	/* Watermark in 32 bit words. 0 disables the notification. */
+	uint32_t watermark;
 
 	/* Configuration flags. */
 	uint32_t flags;
@@ -231,6 +258,26 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer,
  */
 const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer);
 
+/** @brief Claim a batch of pending packets.
+ *
+ * Up to @p n consecutive committed packets are claimed under a single lock
+ * operation, which is cheaper than claiming them one by one when a consumer
+ * (e.g. the log processing thread) drains the buffer in a loop.
+ *
+ * Claimed packets must be freed with @ref mpsc_pbuf_free in the order in
+ * which they were claimed.
+ *
+ * @param buffer Buffer.
+ *
+ * @param packets Destination array for claimed packet pointers.
+ *
+ * @param n Capacity of @p packets.
+ *
+ * @return Number of packets claimed, 0 if none was available.
+ */
+size_t mpsc_pbuf_claim_batch(struct mpsc_pbuf_buffer *buffer,
+			     const union mpsc_pbuf_generic **packets, size_t n);
+
 /** @brief Free a packet.
  *
  * @param buffer Buffer.
@@ -47,6 +47,11 @@ struct k_p4wq_work {
 #define K_P4WQ_DELAYED_START		BIT(1)
 #define K_P4WQ_USER_CPU_MASK		BIT(2)
 
+/* Order pending work by earliest deadline first instead of by priority.
+ * Must be set before the first item is submitted to the queue.
+ */
+#define K_P4WQ_EDF			BIT(3)
+
 /**
  * @brief P4 Queue
  *
@@ -69,6 +74,17 @@ struct k_p4wq {
 	/* Work items waiting for processing */
 	struct rbtree queue;
 
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	/* Per-CPU pending work shards, stolen from by idle workers */
+	struct {
+		struct k_spinlock lock;
+		struct rbtree queue;
+	} shards[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Number of items pending across all shards */
+	atomic_t pending;
+#endif
+
 	/* Work items in progress */
 	sys_dlist_t active;
 
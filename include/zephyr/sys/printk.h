@@ -60,6 +60,22 @@ static inline __printf_like(1, 0) void vprintk(const char *fmt, va_list ap)
 }
 #endif
 
+/**
+ * @brief Revert printk() to synchronous output
+ *
+ * Flushes any output buffered by CONFIG_PRINTK_ASYNC and makes all
+ * subsequent printk() calls emit characters synchronously.  Intended for
+ * panic paths where the background drain can no longer be relied upon; the
+ * kernel fatal error handler calls it automatically.
+ */
+#ifdef CONFIG_PRINTK_ASYNC
+void printk_panic(void);
+#else
+static inline void printk_panic(void)
+{
+}
+#endif
+
 #ifdef CONFIG_PICOLIBC
 
 #include <stdio.h>
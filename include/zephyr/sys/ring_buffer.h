@@ -284,6 +284,39 @@ uint32_t ring_buf_put_claim(struct ring_buf *buf,
 			    uint8_t **data,
 			    uint32_t size);
 
+/**
+ * @brief Allocate write space in a ring buffer as up to two segments.
+ *
+ * Equivalent to calling @ref ring_buf_put_claim twice, but returns both
+ * sides of a wrap-around in one call so that e.g. a scatter-gather DMA
+ * transfer can be programmed without a second round of bookkeeping.
+ * The total allocation must be confirmed with a single
+ * @ref ring_buf_put_finish.
+ *
+ * @warning
+ * Use cases involving multiple writers to the ring buffer must prevent
+ * concurrent write operations, either by preventing all writers from
+ * being preempted or by using a mutex to govern writes to the ring buffer.
+ *
+ * @warning
+ * Ring buffer instance should not mix byte access and item access
+ * (calls prefixed with ring_buf_item_).
+ *
+ * @param[in]  buf   Address of ring buffer.
+ * @param[out] data1 Set to the first (possibly only) segment.
+ * @param[out] size1 Set to the size of the first segment (in bytes).
+ * @param[out] data2 Set to the segment after the wrap, or NULL.
+ * @param[out] size2 Set to the size of the second segment (in bytes).
+ * @param[in]  size  Requested allocation size (in bytes).
+ *
+ * @return Total size of the allocated segments which can be smaller than
+ *	   requested if there is not enough free space.
+ */
+uint32_t ring_buf_put_claim2(struct ring_buf *buf,
+			     uint8_t **data1, uint32_t *size1,
+			     uint8_t **data2, uint32_t *size2,
+			     uint32_t size);
+
 /**
  * @brief Indicate number of bytes written to allocated buffers.
  *
@@ -358,6 +391,37 @@ uint32_t ring_buf_get_claim(struct ring_buf *buf,
 			    uint8_t **data,
 			    uint32_t size);
 
+/**
+ * @brief Get addresses of valid data in a ring buffer as up to two segments.
+ *
+ * Equivalent to calling @ref ring_buf_get_claim twice, but returns both
+ * sides of a wrap-around in one call. The total must be freed with a
+ * single @ref ring_buf_get_finish.
+ *
+ * @warning
+ * Use cases involving multiple reads of the ring buffer must prevent
+ * concurrent read operations, either by preventing all readers from
+ * being preempted or by using a mutex to govern reads to the ring buffer.
+ *
+ * @warning
+ * Ring buffer instance should not mix byte access and item access
+ * (calls prefixed with ring_buf_item_).
+ *
+ * @param[in]  buf   Address of ring buffer.
+ * @param[out] data1 Set to the first (possibly only) segment.
+ * @param[out] size1 Set to the size of the first segment (in bytes).
+ * @param[out] data2 Set to the segment after the wrap, or NULL.
+ * @param[out] size2 Set to the size of the second segment (in bytes).
+ * @param[in]  size  Requested size (in bytes).
+ *
+ * @return Total number of valid bytes in the returned segments which can be
+ *	   smaller than requested if there is not enough data.
+ */
+uint32_t ring_buf_get_claim2(struct ring_buf *buf,
+			     uint8_t **data1, uint32_t *size1,
+			     uint8_t **data2, uint32_t *size2,
+			     uint32_t size);
+
 /**
  * @brief Indicate number of bytes read from claimed buffer.
  *
@@ -32,6 +32,17 @@ extern "C" {
  */
 #define SPSC_PBUF_CACHE BIT(0)
 
+/** @brief Flag indicating that cache line padded layout shall be used.
+ *
+ * Layout is the same as with @ref SPSC_PBUF_CACHE but no cache maintenance
+ * operations are performed. It shall be used when a packet buffer is shared
+ * between two cores through hardware coherent memory, where false sharing of
+ * the cache line holding both indexes, not cache maintenance, is the cost.
+ * Flag is only effective when CONFIG_SPSC_PBUF_CACHE_FLAG is selected and
+ * the buffer must then be cache line aligned.
+ */
+#define SPSC_PBUF_PADDED BIT(1)
+
 /** @brief Size of the field which stores maximum utilization. */
 #define SPSC_PBUF_UTILIZATION_BITS 24
 
@@ -67,6 +78,11 @@ struct spsc_pbuf_common {
 	uint32_t len;		/* Length of data[] in bytes. */
 	uint32_t flags;		/* Flags. See @ref SPSC_PBUF_FLAGS */
 	uint32_t rd_idx;	/* Index of the first valid byte in data[] */
+	uint32_t wr_idx_shadow;	/* Reader's last known value of wr_idx.
+				 * Refreshed from wr_idx only when the buffer
+				 * looks empty, so the reader mostly stays on
+				 * its own cache line.
+				 */
 };
 
 /* Padding to fill cache line. */
@@ -81,12 +97,18 @@ struct spsc_pbuf_common {
 struct spsc_pbuf_ext_cache {
 	uint8_t reserved[Z_SPSC_PBUF_PADDING];
 	uint32_t wr_idx;	/* Index of the first free byte in data[] */
+	uint32_t rd_idx_shadow;	/* Writer's last known value of rd_idx.
+				 * Refreshed from rd_idx only when free space
+				 * is insufficient, so the writer mostly stays
+				 * on its own cache line.
+				 */
 	uint8_t data[];		/* Buffer data. */
 };
 
 /** @brief Remaining part of a packet buffer when cache is not used. */
 struct spsc_pbuf_ext_nocache {
 	uint32_t wr_idx;	/* Index of the first free byte in data[] */
+	uint32_t rd_idx_shadow;	/* Writer's last known value of rd_idx. */
 	uint8_t data[];		/* Buffer data. */
 };
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_
+#define ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <zephyr/sys/sys_heap.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Region/arena allocator for request-scoped allocations.
+ *
+ * An arena hands out memory by bumping an offset through a single
+ * contiguous region, so allocation is a pointer increment and there
+ * is no per-block bookkeeping at all.  Individual blocks cannot be
+ * freed; instead the whole arena is recycled with a single
+ * sys_arena_reset() when the work it served (a network request, a
+ * parse pass, ...) is finished.
+ *
+ * The region may be a static buffer or may be carved out of a
+ * sys_heap at init time and handed back on release.  Like sys_heap,
+ * the arena performs no locking of its own: callers serialize access
+ * or dedicate one arena per context.
+ */
+struct sys_arena {
+	uint8_t *base;
+	size_t size;
+	size_t offset;
+	struct sys_heap *backing;
+};
+
+/**
+ * @defgroup arena_allocator Arena Allocator
+ * @ingroup heaps
+ * @{
+ */
+
+/**
+ * @brief Initialize an arena over a caller-provided buffer
+ *
+ * Any buffer and size work; internal alignment padding means that
+ * not quite all bytes may be usable.
+ *
+ * @param arena Arena to initialize
+ * @param mem Untyped pointer to unused memory
+ * @param bytes Size of region pointed to by @a mem
+ */
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes);
+
+/**
+ * @brief Initialize an arena backed by a sys_heap
+ *
+ * Allocates @a bytes of region memory from @a heap and initializes
+ * the arena over it.  The memory is returned to the heap by
+ * sys_arena_release().  The caller is responsible for any locking
+ * the heap needs.
+ *
+ * @param arena Arena to initialize
+ * @param heap Heap to carve the region out of
+ * @param bytes Size of the arena region
+ * @retval 0 on success
+ * @retval -ENOMEM if the heap allocation failed
+ */
+int sys_arena_init_heap(struct sys_arena *arena, struct sys_heap *heap,
+			size_t bytes);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * Returns a pointer-aligned block of @a bytes bytes, or NULL if the
+ * remaining region is too small.  The block stays valid until the
+ * arena is reset or released; there is no per-block free.
+ *
+ * @param arena Arena from which to allocate
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_arena_alloc(struct sys_arena *arena, size_t bytes);
+
+/**
+ * @brief Allocate aligned memory from an arena
+ *
+ * Behaves as sys_arena_alloc() but the returned pointer is a
+ * multiple of @a align, which must be a power of two.
+ *
+ * @param arena Arena from which to allocate
+ * @param align Alignment of the returned pointer, power of two
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align,
+			      size_t bytes);
+
+/**
+ * @brief Recycle all arena memory at once
+ *
+ * Invalidates every block handed out since init or the previous
+ * reset and makes the full region available again.  O(1): this is
+ * the "N frees for free" operation the arena exists for.
+ *
+ * @param arena Arena to reset
+ */
+void sys_arena_reset(struct sys_arena *arena);
+
+/**
+ * @brief Tear down an arena
+ *
+ * Invalidates all outstanding blocks.  If the arena was created
+ * with sys_arena_init_heap(), the region is freed back to the
+ * backing heap; otherwise this is equivalent to sys_arena_reset().
+ *
+ * @param arena Arena to release
+ */
+void sys_arena_release(struct sys_arena *arena);
+
+/**
+ * @brief Remaining capacity of an arena
+ *
+ * @param arena Arena to query
+ * @return Largest pointer-aligned allocation that can still succeed
+ */
+size_t sys_arena_room(struct sys_arena *arena);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYS_ARENA_H_ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Batched system call submission.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis Syscall batching APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Maximum number of entries accepted by k_syscall_batch() */
+#define K_SYSCALL_BATCH_MAX 16
+
+/**
+ * @brief One system call of a batch.
+ *
+ * Describes a single system call by its generated identifier (the
+ * `K_SYSCALL_` constants from `zephyr/syscall_list.h`) and its arguments,
+ * cast to @c uintptr_t the same way the architecture syscall stubs pass
+ * them. Unused argument slots are ignored.
+ */
+struct k_syscall_batch_entry {
+	/** System call ID, one of the K_SYSCALL_ constants */
+	uintptr_t id;
+	/** System call arguments, in declaration order */
+	uintptr_t args[6];
+	/** Return value, written back when the entry has run */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Invoke a vector of system calls in one privilege transition.
+ *
+ * Dispatches up to @ref K_SYSCALL_BATCH_MAX system calls described by
+ * @p entries in order, paying the user/kernel transition cost once for
+ * the whole batch instead of once per call. Each entry goes through the
+ * regular system call verification, so a batch can do exactly what the
+ * individual system calls could do, no more. Return values are written
+ * back to the @c ret member of each entry as it completes.
+ *
+ * Only available to user mode threads; supervisor mode callers invoke
+ * kernel APIs directly and have nothing to amortize.
+ *
+ * @param entries Array of system call descriptors, executed in order.
+ * @param count Number of entries, at most @ref K_SYSCALL_BATCH_MAX.
+ *
+ * @retval 0 All entries were dispatched.
+ * @retval -EINVAL If @p count exceeds @ref K_SYSCALL_BATCH_MAX.
+ * @retval -ENOTSUP If called from supervisor mode.
+ */
+__syscall int k_syscall_batch(struct k_syscall_batch_entry *entries,
+			      size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <zephyr/syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Syscall-free time page for user mode threads.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+#define ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/time_units.h>
+
+#ifdef CONFIG_USERSPACE
+#include <zephyr/app_memory/app_memdomain.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup time_page_apis Time page APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Kernel-maintained time snapshot readable from user mode.
+ *
+ * The kernel refreshes this structure on every system clock announcement
+ * under a sequence lock; user threads read it directly instead of making
+ * a k_uptime_ticks() system call. On a ticking kernel the snapshot is at
+ * most one tick old. On a tickless kernel announcements only happen when
+ * a timeout expires, so the snapshot can lag further behind; the @c
+ * cycles member holds the hardware cycle count taken with the snapshot,
+ * allowing platforms whose cycle counter is readable from user mode to
+ * interpolate.
+ */
+struct sys_time_page {
+	/** Sequence counter, odd while an update is in progress */
+	uint32_t seq;
+	/** System clock ticks per second */
+	uint32_t ticks_per_sec;
+	/** Hardware cycles per second */
+	uint32_t cycles_per_sec;
+	uint32_t _reserved;
+	/** Uptime, in ticks, at the last clock announcement */
+	uint64_t uptime_ticks;
+	/** Hardware cycle count taken with @c uptime_ticks */
+	uint64_t cycles;
+};
+
+/** The time page instance, placed in a user-accessible memory partition */
+extern struct sys_time_page z_sys_time_page;
+
+#if defined(CONFIG_USERSPACE_TIME_PAGE) || defined(__DOXYGEN__)
+
+#ifdef CONFIG_USERSPACE
+/** Memory partition containing the time page */
+extern struct k_mem_partition z_time_page_partition;
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+void z_time_page_update(uint64_t uptime_ticks);
+/** @endcond */
+
+/** Consistent-read attempts before falling back to system calls */
+#define SYS_TIME_PAGE_READ_RETRIES 8
+
+/**
+ * @brief Read a consistent snapshot from the time page.
+ *
+ * Retries while an update is in progress, then returns the tick and
+ * cycle counts published together by the kernel. The retry loop is
+ * bounded: if a consistent snapshot cannot be obtained within
+ * @ref SYS_TIME_PAGE_READ_RETRIES attempts, the values are fetched
+ * through system calls instead of spinning indefinitely.
+ *
+ * @param[out] uptime_ticks Uptime, in ticks, at the last announcement.
+ * @param[out] cycles Cycle count at the last announcement, may be NULL.
+ */
+static inline void sys_time_page_read(uint64_t *uptime_ticks,
+				      uint64_t *cycles)
+{
+	const volatile struct sys_time_page *tp = &z_sys_time_page;
+	uint32_t seq;
+
+	for (int retry = 0; retry < SYS_TIME_PAGE_READ_RETRIES; retry++) {
+		seq = tp->seq;
+		barrier_dmem_fence_full();
+
+		*uptime_ticks = tp->uptime_ticks;
+		if (cycles != NULL) {
+			*cycles = tp->cycles;
+		}
+
+		barrier_dmem_fence_full();
+		if (((seq & 1U) == 0U) && (seq == tp->seq)) {
+			return;
+		}
+	}
+
+	*uptime_ticks = (uint64_t)k_uptime_ticks();
+	if (cycles != NULL) {
+		*cycles = (uint64_t)k_cycle_get_32();
+	}
+}
+
+/**
+ * @brief Uptime in ticks, without a system call.
+ *
+ * @return Uptime, in ticks, as of the last system clock announcement.
+ */
+static inline uint64_t sys_time_page_uptime_ticks(void)
+{
+	uint64_t ticks;
+
+	sys_time_page_read(&ticks, NULL);
+
+	return ticks;
+}
+
+/**
+ * @brief Uptime in milliseconds, without a system call.
+ *
+ * @return Uptime, in milliseconds, as of the last system clock
+ * announcement.
+ */
+static inline int64_t sys_time_page_uptime_ms(void)
+{
+	return k_ticks_to_ms_floor64(sys_time_page_uptime_ticks());
+}
+
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_TIME_PAGE_H_ */
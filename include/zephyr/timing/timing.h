@@ -7,6 +7,8 @@
 #ifndef ZEPHYR_INCLUDE_TIMING_TIMING_H_
 #define ZEPHYR_INCLUDE_TIMING_TIMING_H_
 
+#include <stddef.h>
+
 #include <zephyr/arch/arch_interface.h>
 #include <zephyr/timing/types.h>
 
@@ -360,6 +362,37 @@ static inline uint64_t timing_cycles_to_ns(uint64_t cycles)
 #endif
 }
 
+/**
+ * @brief Convert number of @p cycles into nanoseconds without dividing.
+ *
+ * Uses a multiply-shift conversion factor calibrated once in
+ * timing_init(), so each conversion costs two 64-bit multiplies instead
+ * of a 64-bit divide. Intended for hot instrumentation paths converting
+ * many samples, especially on cores without a hardware divider. The
+ * result may differ from timing_cycles_to_ns() by a few nanoseconds due
+ * to the fixed point rounding.
+ *
+ * Falls back to timing_cycles_to_ns() if timing_init() has not been
+ * called yet.
+ *
+ * @param cycles Number of cycles
+ * @return Converted time value
+ */
+uint64_t timing_cycles_to_ns_fast(uint64_t cycles);
+
+/**
+ * @brief Convert an array of cycle counts into nanoseconds.
+ *
+ * Batch variant of timing_cycles_to_ns_fast(). @p cycles and @p ns may
+ * point to the same array for in-place conversion.
+ *
+ * @param cycles Array of cycle counts to convert
+ * @param ns Output array of converted time values
+ * @param count Number of elements in the arrays
+ */
+void timing_cycles_to_ns_batch(const uint64_t *cycles, uint64_t *ns,
+			       size_t count);
+
 /**
  * @brief Convert number of @p cycles into nanoseconds with averaging.
  *
@@ -69,6 +69,15 @@ struct zbus_channel_data {
 	/** Number of times data has been published to this channel */
 	uint32_t publish_count;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK) || defined(__DOXYGEN__)
+	/** Message sequence counter. Incremented to an odd value before the
+	 * message is modified and to an even one afterwards, letting
+	 * zbus_chan_read detect and retry torn reads without taking the
+	 * semaphore.
+	 */
+	atomic_t seq;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
 };
 
 /**
@@ -120,6 +129,13 @@ struct zbus_observer_data {
 	/** Enabled flag. Indicates if observer is receiving notification. */
 	bool enabled;
 
+	/** Keep-latest flag. When set, a full notification queue drops the
+	 * oldest pending notification instead of blocking or failing the
+	 * publisher, so a slow subscriber always consumes the newest
+	 * publications.
+	 */
+	bool keep_latest;
+
 #if defined(CONFIG_ZBUS_PRIORITY_BOOST)
 	/** Subscriber attached thread priority. */
 	int priority;
@@ -879,6 +895,26 @@ struct zbus_observer_node {
  */
 int zbus_obs_set_enable(const struct zbus_observer *obs, bool enabled);
 
+/**
+ * @brief Change the observer keep-latest delivery mode.
+ *
+ * This routine changes how notifications are delivered when the observer's
+ * queue is full. With keep-latest enabled the event dispatcher drops the
+ * oldest pending notification and enqueues the new one without blocking, so
+ * publishers are never stalled by a slow subscriber and the subscriber
+ * consumes the newest publications. Intended for state-type channels where
+ * only the most recent sample matters.
+ *
+ * @param[in] obs The observer's reference. Must be a subscriber or message
+ * subscriber; listeners are notified synchronously and have no queue.
+ * @param[in] enabled When true the observer delivery uses keep-latest semantics.
+ *
+ * @retval 0 Observer keep-latest mode set.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_obs_set_keep_latest(const struct zbus_observer *obs, bool enabled);
+
 /**
  * @brief Get the observer state.
  *
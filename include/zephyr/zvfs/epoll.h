@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+#define ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_
+
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Register a new file descriptor with an epoll instance */
+#define ZVFS_EPOLL_CTL_ADD 1
+/** Remove a file descriptor from an epoll instance */
+#define ZVFS_EPOLL_CTL_DEL 2
+/** Change the event mask or user data of a registered file descriptor */
+#define ZVFS_EPOLL_CTL_MOD 3
+
+/**
+ * @brief Ready event reported by zvfs_epoll_wait()
+ */
+struct zvfs_epoll_event {
+	/** File descriptor the event occurred on */
+	int fd;
+	/** Reported events, ZVFS_POLL* bits */
+	uint32_t events;
+	/** User data registered with zvfs_epoll_ctl() */
+	void *data;
+};
+
+/**
+ * @brief Create a ZVFS epoll instance
+ *
+ * An epoll instance keeps a persistent set of watched file descriptors,
+ * so that waiting does not require the caller to rebuild and rescan the
+ * whole descriptor array on every call as zvfs_poll() does. The cost of
+ * processing a wakeup is proportional to the number of ready descriptors,
+ * not to the number of watched ones.
+ *
+ * The returned file descriptor only supports zvfs_epoll_ctl(),
+ * zvfs_epoll_wait() and close().
+ *
+ * @return New epoll file descriptor on success, -1 on error
+ */
+int zvfs_epoll_create(void);
+
+/**
+ * @brief Modify the set of file descriptors watched by an epoll instance
+ *
+ * The registration is persistent; it stays in effect across any number of
+ * zvfs_epoll_wait() calls until removed with @ref ZVFS_EPOLL_CTL_DEL or
+ * the epoll instance is closed. Closing a watched file descriptor does not
+ * remove its registration; such stale entries report ZVFS_POLLNVAL.
+ *
+ * Offloaded sockets implement polling in the device driver and cannot be
+ * watched through an epoll instance.
+ *
+ * @param epfd Epoll file descriptor
+ * @param op One of ZVFS_EPOLL_CTL_ADD, ZVFS_EPOLL_CTL_MOD, ZVFS_EPOLL_CTL_DEL
+ * @param fd File descriptor to watch
+ * @param events Requested events, ZVFS_POLL* bits (ignored for DEL)
+ * @param data Opaque user data reported back by zvfs_epoll_wait() (ignored
+ *             for DEL)
+ *
+ * @return 0 on success, -1 on error
+ */
+int zvfs_epoll_ctl(int epfd, int op, int fd, uint32_t events, void *data);
+
+/**
+ * @brief Wait for events on an epoll instance
+ *
+ * Blocks until at least one watched file descriptor is ready or the timeout
+ * expires, then reports up to @p maxevents ready descriptors. Readiness is
+ * level-triggered: a descriptor that stays ready is reported again by the
+ * next call.
+ *
+ * @param epfd Epoll file descriptor
+ * @param events Array where ready events are stored
+ * @param maxevents Capacity of the @p events array, must be > 0
+ * @param timeout Timeout in milliseconds, or -1 to wait forever
+ *
+ * @return Number of ready events on success (0 on timeout), -1 on error
+ */
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    int timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZEPHYR_ZVFS_EPOLL_H_ */
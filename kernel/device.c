@@ -7,6 +7,7 @@
 #include <stddef.h>
 #include <string.h>
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/kobject.h>
@@ -39,15 +40,19 @@ const struct device *z_impl_device_get_binding(const char *name)
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
 	 * performed. Reserve string comparisons for a fallback.
+	 *
+	 * The name is always matched before the readiness check, so that
+	 * lazy initialization is only ever triggered on the device being
+	 * looked up.
 	 */
 	STRUCT_SECTION_FOREACH(device, dev) {
-		if (z_impl_device_is_ready(dev) && (dev->name == name)) {
+		if ((dev->name == name) && z_impl_device_is_ready(dev)) {
 			return dev;
 		}
 	}
 
 	STRUCT_SECTION_FOREACH(device, dev) {
-		if (z_impl_device_is_ready(dev) && (strcmp(name, dev->name) == 0)) {
+		if ((strcmp(name, dev->name) == 0) && z_impl_device_is_ready(dev)) {
 			return dev;
 		}
 	}
@@ -139,6 +144,36 @@ size_t z_device_get_all_static(struct device const **devices)
 	return cnt;
 }
 
+#ifdef CONFIG_DEVICE_DEFERRED_INIT_LAZY
+static struct k_mutex lazy_init_lock = Z_MUTEX_INITIALIZER(lazy_init_lock);
+
+/**
+ * @brief Initialize a deferred device on first use.
+ *
+ * Runs the init function of a ``zephyr,deferred-init`` device exactly
+ * once, serializing concurrent first users on a mutex. Devices that
+ * are not in the deferred section are left alone (device_init()
+ * returns -ENOENT for them).
+ */
+static void device_lazy_init(const struct device *dev)
+{
+	if (k_is_pre_kernel() || k_is_in_isr()) {
+		/* Cannot run init functions in this context; the caller
+		 * just sees the device as not ready.
+		 */
+		return;
+	}
+
+	(void)k_mutex_lock(&lazy_init_lock, K_FOREVER);
+
+	if (!dev->state->initialized) {
+		(void)device_init(dev);
+	}
+
+	(void)k_mutex_unlock(&lazy_init_lock);
+}
+#endif /* CONFIG_DEVICE_DEFERRED_INIT_LAZY */
+
 bool z_impl_device_is_ready(const struct device *dev)
 {
 	/*
@@ -149,6 +184,12 @@ bool z_impl_device_is_ready(const struct device *dev)
 		return false;
 	}
 
+#ifdef CONFIG_DEVICE_DEFERRED_INIT_LAZY
+	if (!dev->state->initialized) {
+		device_lazy_init(dev);
+	}
+#endif /* CONFIG_DEVICE_DEFERRED_INIT_LAZY */
+
 	return dev->state->initialized && (dev->state->init_res == 0U);
 }
 
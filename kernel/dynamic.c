@@ -31,6 +31,132 @@ static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZ
 				   CONFIG_DYNAMIC_THREAD_STACK_SIZE);
 SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CLASSES
+
+/*
+ * Size-classed stack pools: requests are served from the smallest class
+ * that fits. Freed stacks are pushed onto a per-class LIFO (the node is
+ * stored in the unused stack memory itself) so the most recently used
+ * stack is handed out again first; slots never allocated before are
+ * carved off the end of the class's array.
+ */
+struct stack_class {
+	uint8_t *base;
+	size_t stride;
+	size_t stack_size;
+	size_t count;
+	size_t next_unused;
+	sys_slist_t free_list;
+};
+
+#if CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(small_stack,
+				   CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE,
+				   CONFIG_DYNAMIC_THREAD_POOL_SMALL_STACK_SIZE);
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE > 0 */
+
+#if CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(medium_stack,
+				   CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE,
+				   CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_STACK_SIZE);
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE > 0 */
+
+#if CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE > 0
+static K_THREAD_STACK_ARRAY_DEFINE(large_stack,
+				   CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE,
+				   CONFIG_DYNAMIC_THREAD_POOL_LARGE_STACK_SIZE);
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE > 0 */
+
+static struct stack_class stack_classes[] = {
+#if CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE > 0
+	{
+		.base = (uint8_t *)small_stack,
+		.stride = sizeof(small_stack[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_POOL_SMALL_STACK_SIZE,
+		.count = CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE,
+	},
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_SMALL_SIZE > 0 */
+#if CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE > 0
+	{
+		.base = (uint8_t *)medium_stack,
+		.stride = sizeof(medium_stack[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_STACK_SIZE,
+		.count = CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE,
+	},
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_MEDIUM_SIZE > 0 */
+#if CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE > 0
+	{
+		.base = (uint8_t *)large_stack,
+		.stride = sizeof(large_stack[0]),
+		.stack_size = CONFIG_DYNAMIC_THREAD_POOL_LARGE_STACK_SIZE,
+		.count = CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE,
+	},
+#endif /* CONFIG_DYNAMIC_THREAD_POOL_LARGE_SIZE > 0 */
+};
+
+BUILD_ASSERT(ARRAY_SIZE(stack_classes) > 0,
+	     "at least one stack class count must be nonzero");
+
+static struct k_spinlock stack_class_lock;
+
+static k_thread_stack_t *z_thread_stack_alloc_class(size_t size)
+{
+	k_thread_stack_t *stack = NULL;
+	struct stack_class *best = NULL;
+
+	k_spinlock_key_t key = k_spin_lock(&stack_class_lock);
+
+	ARRAY_FOR_EACH_PTR(stack_classes, cls) {
+		if ((size <= cls->stack_size) &&
+		    (!sys_slist_is_empty(&cls->free_list) ||
+		     (cls->next_unused < cls->count)) &&
+		    ((best == NULL) || (cls->stack_size < best->stack_size))) {
+			best = cls;
+		}
+	}
+
+	if (best != NULL) {
+		sys_snode_t *node = sys_slist_get(&best->free_list);
+
+		if (node != NULL) {
+			stack = (k_thread_stack_t *)node;
+		} else {
+			stack = (k_thread_stack_t *)
+				&best->base[best->next_unused * best->stride];
+			best->next_unused++;
+		}
+	} else {
+		LOG_DBG("no stack class can serve size %zu", size);
+	}
+
+	k_spin_unlock(&stack_class_lock, key);
+
+	return stack;
+}
+
+static bool z_thread_stack_free_class(k_thread_stack_t *stack)
+{
+	uint8_t *p = (uint8_t *)stack;
+	bool found = false;
+
+	k_spinlock_key_t key = k_spin_lock(&stack_class_lock);
+
+	ARRAY_FOR_EACH_PTR(stack_classes, cls) {
+		if ((p >= cls->base) &&
+		    (p < &cls->base[cls->count * cls->stride]) &&
+		    (((size_t)(p - cls->base) % cls->stride) == 0U)) {
+			sys_slist_prepend(&cls->free_list, (sys_snode_t *)p);
+			found = true;
+			break;
+		}
+	}
+
+	k_spin_unlock(&stack_class_lock, key);
+
+	return found;
+}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CLASSES */
+
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 {
 	return z_thread_aligned_alloc(align, size);
@@ -82,6 +208,13 @@ k_thread_stack_t *z_impl_k_thread_stack_alloc(size_t size, int flags)
 {
 	k_thread_stack_t *stack = NULL;
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CLASSES
+	stack = z_thread_stack_alloc_class(size);
+	if (stack != NULL) {
+		return stack;
+	}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CLASSES */
+
 	if (IS_ENABLED(CONFIG_DYNAMIC_THREAD_PREFER_ALLOC)) {
 		stack = stack_alloc_dyn(size, flags);
 		if (stack == NULL && CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
@@ -134,6 +267,12 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 		}
 	}
 
+#ifdef CONFIG_DYNAMIC_THREAD_STACK_CLASSES
+	if (z_thread_stack_free_class(stack)) {
+		return 0;
+	}
+#endif /* CONFIG_DYNAMIC_THREAD_STACK_CLASSES */
+
 	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
 		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
 			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
@@ -25,11 +25,13 @@
 #include <zephyr/kernel_structs.h>
 
 #include <zephyr/toolchain.h>
+#include <string.h>
 #include <zephyr/sys/dlist.h>
 #include <zephyr/init.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 /* private kernel APIs */
 #include <wait_q.h>
 #include <ksched.h>
@@ -49,10 +51,54 @@ struct event_walk_data {
 static struct k_obj_type obj_type_event;
 #endif /* CONFIG_OBJ_CORE_EVENT */
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+/*
+ * Waiters are indexed by the event bits they are waiting for: a per-bit
+ * waiter count plus a summary mask of all bits with at least one waiter.
+ * Posting events that no current waiter is interested in consults the
+ * summary mask and skips the wait queue walk entirely.
+ *
+ * Each waiter registers its desired bits before pending and deregisters
+ * them itself after waking (on any exit path), both under the event lock.
+ */
+static void event_waiter_index_add(struct k_event *event, uint32_t events)
+{
+	uint32_t bits = events;
+
+	while (bits != 0U) {
+		int bit = u32_count_trailing_zeros(bits);
+
+		bits &= bits - 1;
+		event->waiters_per_bit[bit]++;
+	}
+	event->waiters_mask |= events;
+}
+
+static void event_waiter_index_remove(struct k_event *event, uint32_t events)
+{
+	uint32_t bits = events;
+
+	while (bits != 0U) {
+		int bit = u32_count_trailing_zeros(bits);
+
+		bits &= bits - 1;
+		event->waiters_per_bit[bit]--;
+		if (event->waiters_per_bit[bit] == 0U) {
+			event->waiters_mask &= ~BIT(bit);
+		}
+	}
+}
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
+
 void z_impl_k_event_init(struct k_event *event)
 {
 	event->events = 0;
 	event->lock = (struct k_spinlock) {};
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	event->waiters_mask = 0;
+	(void)memset(event->waiters_per_bit, 0,
+		     sizeof(event->waiters_per_bit));
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
 
@@ -143,10 +189,29 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 					events_mask);
 
 	previous_events = event->events & events_mask;
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	uint32_t new_bits = (events & events_mask) & ~event->events;
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
 	event->events = events;
 	data.events = events;
+
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/*
+	 * Every pended waiter had its wait conditions checked (and not met)
+	 * under this lock before pending, so only newly set bits can satisfy
+	 * one now. If no waiter is indexed on any of them, skip the walk.
+	 */
+	if ((new_bits & event->waiters_mask) == 0U) {
+		k_spin_unlock(&event->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, post, event, events,
+					       events_mask);
+
+		return previous_events;
+	}
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
 	/*
 	 * Posting an event has the potential to wake multiple pended threads.
 	 * It is desirable to unpend all affected threads simultaneously. This
@@ -288,6 +353,10 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	event_waiter_index_add(event, events);
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
@@ -296,6 +365,13 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 		rv = thread->events;
 	}
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/* Deregister interest on every exit path, woken or timed out */
+	key = k_spin_lock(&event->lock);
+	event_waiter_index_remove(event, events);
+	k_spin_unlock(&event->lock, key);
+#endif /* CONFIG_EVENTS_WAITER_INDEX */
+
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_event, wait, event,
 				       events, rv & events);
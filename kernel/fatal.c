@@ -13,6 +13,7 @@
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/fatal.h>
+#include <zephyr/sys/printk.h>
 #include <zephyr/debug/coredump.h>
 
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
@@ -92,6 +93,9 @@ void z_fatal_error(unsigned int reason, const struct arch_esf *esf)
 	struct k_thread *thread = IS_ENABLED(CONFIG_MULTITHREADING) ?
 			_current : NULL;
 
+	/* Flush buffered printk() output and revert to synchronous mode. */
+	printk_panic();
+
 	/* twister looks for the "ZEPHYR FATAL ERROR" string, don't
 	 * change it without also updating twister
 	 */
@@ -24,7 +24,7 @@ static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 	return obj->data.futex_data;
 }
 
-int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
+int z_impl_k_futex_wake_n(struct k_futex *futex, uint32_t count)
 {
 	k_spinlock_key_t key;
 	unsigned int woken = 0U;
@@ -38,20 +38,36 @@ int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 
 	key = k_spin_lock(&futex_data->lock);
 
-	do {
+	while (woken < count) {
 		thread = z_unpend_first_thread(&futex_data->wait_q);
-		if (thread != NULL) {
-			woken++;
-			arch_thread_return_value_set(thread, 0);
-			z_ready_thread(thread);
+		if (thread == NULL) {
+			break;
 		}
-	} while (thread && wake_all);
+		woken++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
 
 	z_reschedule(&futex_data->lock, key);
 
 	return woken;
 }
 
+static inline int z_vrfy_k_futex_wake_n(struct k_futex *futex, uint32_t count)
+{
+	if (K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_wake_n(futex, count);
+}
+#include <zephyr/syscalls/k_futex_wake_n_mrsh.c>
+
+int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
+{
+	return z_impl_k_futex_wake_n(futex, wake_all ? UINT32_MAX : 1U);
+}
+
 static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 {
 	if (K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) {
@@ -62,6 +78,66 @@ static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 }
 #include <zephyr/syscalls/k_futex_wake_mrsh.c>
 
+int z_impl_k_futex_requeue(struct k_futex *futex, uint32_t wake_count,
+			   struct k_futex *target)
+{
+	k_spinlock_key_t key;
+	unsigned int woken = 0U;
+	struct k_thread *thread;
+	struct z_futex_data *futex_data;
+	struct z_futex_data *target_data;
+
+	futex_data = k_futex_find_data(futex);
+	if (futex_data == NULL) {
+		return -EINVAL;
+	}
+
+	target_data = k_futex_find_data(target);
+	if ((target_data == NULL) || (target_data == futex_data)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&futex_data->lock);
+
+	while (woken < wake_count) {
+		thread = z_unpend_first_thread(&futex_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		woken++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	/*
+	 * Move the remaining waiters without waking them. Wait queues are
+	 * protected by the scheduler spinlock, so the target futex's own
+	 * lock need not be held (which also avoids any lock ordering
+	 * concern); a concurrent wake on the target simply runs before or
+	 * after each move.
+	 */
+	while (z_requeue_first_thread(&futex_data->wait_q,
+				      &target_data->wait_q) != NULL) {
+	}
+
+	z_reschedule(&futex_data->lock, key);
+
+	return woken;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex,
+					 uint32_t wake_count,
+					 struct k_futex *target)
+{
+	if ((K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) ||
+	    (K_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0)) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, wake_count, target);
+}
+#include <zephyr/syscalls/k_futex_requeue_mrsh.c>
+
 int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 			k_timeout_t timeout)
 {
@@ -52,6 +52,8 @@ void z_sched_init(void);
 void z_move_thread_to_end_of_prio_q(struct k_thread *thread);
 void z_unpend_thread_no_timeout(struct k_thread *thread);
 struct k_thread *z_unpend1_no_timeout(_wait_q_t *wait_q);
+struct k_thread *z_requeue_first_thread(_wait_q_t *wait_q,
+					_wait_q_t *requeue_q);
 int z_pend_curr(struct k_spinlock *lock, k_spinlock_key_t key,
 	       _wait_q_t *wait_q, k_timeout_t timeout);
 void z_pend_thread(struct k_thread *thread, _wait_q_t *wait_q,
@@ -62,9 +64,16 @@ void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
 bool z_thread_prio_set(struct k_thread *thread, int prio);
 void *z_get_next_switch_handle(void *interrupted);
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+bool z_is_thread_active_elsewhere(struct k_thread *thread);
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
 
 void z_time_slice(void);
 void z_reset_time_slice(struct k_thread *curr);
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+bool z_sched_timeslice_peer_ready(struct k_thread *thread);
+void z_time_slice_thread_ready(struct k_thread *thread);
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
 void z_sched_ipi(void);
 void z_sched_start(struct k_thread *thread);
 void z_ready_thread(struct k_thread *thread);
@@ -349,4 +358,12 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
 
+#ifdef CONFIG_SCHED_CYCLE_STATS
+void z_sched_cycle_swap_start(void);
+void z_sched_cycle_swap_end(void);
+#else
+#define z_sched_cycle_swap_start()   do { } while (false)
+#define z_sched_cycle_swap_end()     do { } while (false)
+#endif /* CONFIG_SCHED_CYCLE_STATS */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_KSCHED_H_ */
@@ -104,6 +104,8 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	old_thread = _current;
 
+	z_sched_cycle_swap_start();
+
 	z_check_stack_sentinel();
 
 	old_thread->swap_retval = -EAGAIN;
@@ -163,6 +165,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 			new_thread->switch_handle = NULL;
 			barrier_dmem_fence_full(); /* write barrier */
 		}
+		z_sched_cycle_swap_end();
 		k_spin_release(&_sched_spinlock);
 		arch_switch(newsh, &old_thread->switch_handle);
 	} else {
@@ -47,8 +47,18 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *th
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread);
 #endif
 
+/* Per-object Wait Queue: dispatch on the queue's own backend flag.
+ * Call sites pass &wq->waitq, so recover the containing _wait_q_t.
+ */
+#if defined(CONFIG_WAITQ_PER_OBJECT)
+#define _priq_wait_add(pq, thread) \
+	z_priq_po_add(CONTAINER_OF(pq, _wait_q_t, waitq), thread)
+#define _priq_wait_remove(pq, thread) \
+	z_priq_po_remove(CONTAINER_OF(pq, _wait_q_t, waitq), thread)
+#define _priq_wait_best(pq) \
+	z_priq_po_best(CONTAINER_OF(pq, _wait_q_t, waitq))
 /* Scalable Wait Queue */
-#if defined(CONFIG_WAITQ_SCALABLE)
+#elif defined(CONFIG_WAITQ_SCALABLE)
 #define _priq_wait_add		z_priq_rb_add
 #define _priq_wait_remove	z_priq_rb_remove
 #define _priq_wait_best		z_priq_rb_best
@@ -134,25 +144,28 @@ static ALWAYS_INLINE struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 	return thread;
 }
 
+#ifdef CONFIG_64BIT
+#define PRIQ_CTZ(x) u64_count_trailing_zeros(x)
+#else
+#define PRIQ_CTZ(x) u32_count_trailing_zeros(x)
+#endif /* CONFIG_64BIT */
+
 static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
 	struct k_thread *thread = NULL;
 
-	for (int i = 0; i < PRIQ_BITMAP_SIZE; ++i) {
-		if (!pq->bitmask[i]) {
-			continue;
-		}
-
-#ifdef CONFIG_64BIT
-		sys_dlist_t *l = &pq->queues[i * 64 + u64_count_trailing_zeros(pq->bitmask[i])];
-#else
-		sys_dlist_t *l = &pq->queues[i * 32 + u32_count_trailing_zeros(pq->bitmask[i])];
-#endif
+	/* Two-level bitmap lookup: the toplevel word tells us which
+	 * bitmask word is non-empty, that word tells us the best
+	 * priority level.  Constant time regardless of the number of
+	 * configured priorities.
+	 */
+	if (pq->toplevel != 0UL) {
+		unsigned long idx = PRIQ_CTZ(pq->toplevel);
+		sys_dlist_t *l = &pq->queues[idx * BITS_PER_LONG + PRIQ_CTZ(pq->bitmask[idx])];
 		sys_dnode_t *n = sys_dlist_peek_head(l);
 
 		if (n != NULL) {
 			thread = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
-			break;
 		}
 	}
 
@@ -193,6 +206,7 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 
 	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
+	pq->toplevel |= BIT(pos.idx);
 }
 
 static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
@@ -203,6 +217,9 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[pos.offset_prio])) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
+		if (pq->bitmask[pos.idx] == 0UL) {
+			pq->toplevel &= ~BIT(pos.idx);
+		}
 	}
 }
 #endif /* CONFIG_SCHED_MULTIQ */
@@ -245,4 +262,96 @@ static ALWAYS_INLINE void z_priq_dumb_add(sys_dlist_t *pq,
 }
 #endif /* CONFIG_SCHED_DUMB || CONFIG_WAITQ_DUMB */
 
+#ifdef CONFIG_WAITQ_PER_OBJECT
+static ALWAYS_INLINE void z_priq_po_add(_wait_q_t *wq, struct k_thread *thread)
+{
+	if (wq->scalable) {
+		z_priq_rb_add(&wq->waitq.tree, thread);
+	} else {
+		z_priq_dumb_add(&wq->waitq.dlist, thread);
+	}
+}
+
+static ALWAYS_INLINE void z_priq_po_remove(_wait_q_t *wq, struct k_thread *thread)
+{
+	if (wq->scalable) {
+		z_priq_rb_remove(&wq->waitq.tree, thread);
+	} else {
+		z_priq_dumb_remove(&wq->waitq.dlist, thread);
+	}
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_po_best(_wait_q_t *wq)
+{
+	if (wq->scalable) {
+		return z_priq_rb_best(&wq->waitq.tree);
+	}
+	return z_priq_dumb_best(&wq->waitq.dlist);
+}
+#endif /* CONFIG_WAITQ_PER_OBJECT */
+
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+/* Backend probes answering "does the run queue hold another thread at
+ * the same base priority as this one?", used to decide whether the
+ * slice timer needs arming at all.  Base priority (not
+ * z_sched_prio_cmp()) is the right comparison: deadlines distinguish
+ * threads that round-robin still applies to.
+ */
+#if defined(CONFIG_SCHED_DUMB)
+#define _priq_run_same_prio_peer z_priq_dumb_same_prio_peer
+
+static ALWAYS_INLINE bool z_priq_dumb_same_prio_peer(sys_dlist_t *pq,
+						     struct k_thread *thread)
+{
+	sys_dnode_t *qn = &thread->base.qnode_dlist;
+	struct k_thread *t;
+	sys_dnode_t *n;
+
+	if ((thread->base.thread_state & _THREAD_QUEUED) != 0U) {
+		/* Equal priorities cluster in the sorted list, so only
+		 * the immediate neighbors need checking.
+		 */
+		n = sys_dlist_peek_next(pq, qn);
+		if (n != NULL) {
+			t = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+			if (t->base.prio == thread->base.prio) {
+				return true;
+			}
+		}
+		n = sys_dlist_peek_prev(pq, qn);
+		if (n != NULL) {
+			t = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+			if (t->base.prio == thread->base.prio) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/* Not queued (e.g. _current on SMP): the head is the best
+	 * ready thread; anything of equal priority sorts first.
+	 */
+	n = sys_dlist_peek_head(pq);
+	if (n != NULL) {
+		t = CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+		return t->base.prio == thread->base.prio;
+	}
+	return false;
+}
+#elif defined(CONFIG_SCHED_MULTIQ)
+#define _priq_run_same_prio_peer z_priq_mq_same_prio_peer
+
+static ALWAYS_INLINE bool z_priq_mq_same_prio_peer(struct _priq_mq *pq,
+						   struct k_thread *thread)
+{
+	sys_dlist_t *l = &pq->queues[get_prio_info(thread->base.prio).offset_prio];
+
+	if ((thread->base.thread_state & _THREAD_QUEUED) != 0U) {
+		return sys_dlist_peek_head(l) != sys_dlist_peek_tail(l);
+	}
+	return !sys_dlist_is_empty(l);
+}
+#endif
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_PRIORITY_Q_H_ */
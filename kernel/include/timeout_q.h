@@ -25,6 +25,10 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Aborting a never-armed timeout must index a valid queue */
+	to->cpu = 0U;
+#endif
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
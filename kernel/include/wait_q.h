@@ -19,7 +19,44 @@
 extern "C" {
 #endif
 
-#ifdef CONFIG_WAITQ_SCALABLE
+#if defined(CONFIG_WAITQ_PER_OBJECT)
+
+/* Iterates the default (list) backend only.  Use this solely on wait
+ * queues that are never switched to the rbtree backend; generic walkers
+ * must dispatch on the per-object flag (see z_sched_waitq_walk()).
+ */
+#define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
+	SYS_DLIST_FOR_EACH_CONTAINER(&((wq)->waitq.dlist), thread_ptr, \
+				     base.qnode_dlist)
+
+static inline void z_waitq_init(_wait_q_t *w)
+{
+	sys_dlist_init(&w->waitq.dlist);
+	w->scalable = false;
+}
+
+/* Switch an (empty) wait queue to the rbtree backend.  Only do this
+ * before the object is in use, or while nothing pends on it.
+ */
+static inline void z_waitq_init_scalable(_wait_q_t *w)
+{
+	w->waitq.tree = (struct _priq_rb) {
+		.tree = {
+			.lessthan_fn = z_priq_rb_lessthan
+		}
+	};
+	w->scalable = true;
+}
+
+static inline struct k_thread *z_waitq_head(_wait_q_t *w)
+{
+	if (w->scalable) {
+		return (struct k_thread *)rb_get_min(&w->waitq.tree.tree);
+	}
+	return (struct k_thread *)sys_dlist_peek_head(&w->waitq.dlist);
+}
+
+#elif defined(CONFIG_WAITQ_SCALABLE)
 
 #define _WAIT_Q_FOR_EACH(wq, thread_ptr) \
 	RB_FOR_EACH_CONTAINER(&(wq)->waitq.tree, thread_ptr, base.qnode_rb)
@@ -37,6 +37,7 @@
 #include <kswap.h>
 #include <zephyr/timing/timing.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
 #include <zephyr/internal/syscall_handler.h>
 LOG_MODULE_REGISTER(os, CONFIG_KERNEL_LOG_LEVEL);
@@ -308,6 +309,16 @@ static int do_device_init(const struct init_entry *entry)
 	int rc = 0;
 
 	if (entry->init_fn.dev != NULL) {
+#ifdef CONFIG_PM_DEVICE_RETENTION
+		/* Skip init of devices whose suspended state was retained
+		 * across system off; they resume through their PM action.
+		 */
+		if (pm_device_retention_resume(dev)) {
+			dev->state->initialized = true;
+
+			return 0;
+		}
+#endif
 		rc = entry->init_fn.dev(dev);
 		/* Mark device initialized. If initialization
 		 * failed, record the error condition.
@@ -333,6 +344,132 @@ static int do_device_init(const struct init_entry *entry)
 	return rc;
 }
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/* Range of consecutive device init entries being run by the worker pool */
+static struct {
+	const struct init_entry *start;
+	const struct init_entry *end;
+	enum init_level level;
+	struct k_spinlock lock;
+} init_pool;
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_worker_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+
+static bool init_dep_ready(const struct device *dep)
+{
+	if ((dep == NULL) || dep->state->initialized) {
+		return true;
+	}
+
+	/* Only wait for dependencies that are part of the range being
+	 * run: a dependency whose init is deferred, or sits in a later
+	 * level, would not have run before this device in the
+	 * sequential order either.
+	 */
+	for (const struct init_entry *entry = init_pool.start;
+	     entry < init_pool.end; entry++) {
+		if (entry->dev == dep) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool init_deps_ready(const struct device *dev)
+{
+	size_t count;
+	const device_handle_t *handles = device_required_handles_get(dev, &count);
+
+	for (size_t i = 0; i < count; i++) {
+		if (!init_dep_ready(device_from_handle(handles[i]))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		const struct init_entry *entry = NULL;
+		bool blocked = false;
+		int result;
+
+		k_spinlock_key_t key = k_spin_lock(&init_pool.lock);
+
+		for (const struct init_entry *e = init_pool.start;
+		     e < init_pool.end; e++) {
+			if (e->dev->state->init_claimed) {
+				continue;
+			}
+			if (init_deps_ready(e->dev)) {
+				e->dev->state->init_claimed = true;
+				entry = e;
+				break;
+			}
+			blocked = true;
+		}
+
+		k_spin_unlock(&init_pool.lock, key);
+
+		if (entry == NULL) {
+			if (!blocked) {
+				/* Every entry in the range is claimed */
+				break;
+			}
+			/* All remaining entries depend on inits still in
+			 * flight; check again shortly.
+			 */
+			k_usleep(100);
+			continue;
+		}
+
+		sys_trace_sys_init_enter(entry, init_pool.level);
+		result = do_device_init(entry);
+		sys_trace_sys_init_exit(entry, init_pool.level, result);
+	}
+}
+
+/*
+ * Run a range of consecutive device init entries on the worker pool.
+ * Returns once every entry in the range has been initialized.
+ */
+static void init_run_devices_parallel(enum init_level level,
+				      const struct init_entry *start,
+				      const struct init_entry *end)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	unsigned int workers = MIN((unsigned int)(end - start),
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS);
+	unsigned int i;
+
+	init_pool.start = start;
+	init_pool.end = end;
+	init_pool.level = level;
+
+	for (i = 0; i < workers; i++) {
+		k_thread_create(&init_worker_threads[i], init_worker_stacks[i],
+				CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE,
+				init_worker, NULL, NULL, NULL,
+				prio, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&init_worker_threads[i], "init_worker");
+	}
+
+	for (i = 0; i < workers; i++) {
+		(void)k_thread_join(&init_worker_threads[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -342,6 +479,11 @@ static int do_device_init(const struct init_entry *entry)
  * they need to be invoked, with symbols indicating where one level leaves
  * off and the next one begins.
  *
+ * When CONFIG_DEVICE_INIT_PARALLEL is enabled, runs of consecutive
+ * device entries in POST_KERNEL and later levels are handed to a pool
+ * of worker threads, ordered by their devicetree dependencies. Plain
+ * SYS_INIT() entries act as barriers between such runs.
+ *
  * @param level init level to run.
  */
 static void z_sys_init_run_level(enum init_level level)
@@ -360,6 +502,46 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if (level >= INIT_LEVEL_POST_KERNEL) {
+		entry = levels[level];
+
+		while (entry < levels[level + 1]) {
+			if (entry->dev == NULL) {
+				int result;
+
+				/* SYS_INIT() entries carry no dependency
+				 * information and run as barriers.
+				 */
+				sys_trace_sys_init_enter(entry, level);
+				result = entry->init_fn.sys();
+				sys_trace_sys_init_exit(entry, level, result);
+				entry++;
+			} else {
+				const struct init_entry *last = entry;
+
+				while ((last < levels[level + 1]) &&
+				       (last->dev != NULL)) {
+					last++;
+				}
+
+				if (last - entry == 1) {
+					int result;
+
+					sys_trace_sys_init_enter(entry, level);
+					result = do_device_init(entry);
+					sys_trace_sys_init_exit(entry, level, result);
+				} else {
+					init_run_devices_parallel(level, entry, last);
+				}
+				entry = last;
+			}
+		}
+
+		return;
+	}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 	for (entry = levels[level]; entry < levels[level+1]; entry++) {
 		const struct device *dev = entry->dev;
 		int result;
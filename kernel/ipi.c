@@ -13,11 +13,35 @@ extern void z_trace_sched_ipi(void);
 #endif
 
 
+#ifdef CONFIG_IPI_METRICS
+static struct {
+	atomic_t flag_events;
+	atomic_t cpu_targets;
+	atomic_t directed_ipis;
+	atomic_t broadcast_ipis;
+} ipi_metrics;
+
+void k_ipi_metrics_get(struct k_ipi_metrics *metrics)
+{
+	metrics->flag_events = (uint64_t)atomic_get(&ipi_metrics.flag_events);
+	metrics->cpu_targets = (uint64_t)atomic_get(&ipi_metrics.cpu_targets);
+	metrics->directed_ipis = (uint64_t)atomic_get(&ipi_metrics.directed_ipis);
+	metrics->broadcast_ipis = (uint64_t)atomic_get(&ipi_metrics.broadcast_ipis);
+}
+#endif /* CONFIG_IPI_METRICS */
+
 void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
 		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+#ifdef CONFIG_IPI_METRICS
+		if (ipi_mask != 0) {
+			atomic_inc(&ipi_metrics.flag_events);
+			atomic_add(&ipi_metrics.cpu_targets,
+				   (atomic_val_t)POPCOUNT(ipi_mask));
+		}
+#endif /* CONFIG_IPI_METRICS */
 	}
 #endif /* CONFIG_SCHED_IPI_SUPPORTED */
 }
@@ -83,8 +107,14 @@ void signal_pending_ipi(void)
 		if (cpu_bitmap != 0) {
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
 			arch_sched_directed_ipi(cpu_bitmap);
+#ifdef CONFIG_IPI_METRICS
+			atomic_inc(&ipi_metrics.directed_ipis);
+#endif
 #else
 			arch_sched_broadcast_ipi();
+#ifdef CONFIG_IPI_METRICS
+			atomic_inc(&ipi_metrics.broadcast_ipis);
+#endif
 #endif
 		}
 	}
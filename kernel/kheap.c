@@ -8,18 +8,242 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <string.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+/* Blocked allocators record their request in a descriptor on their own
+ * stack, linked from the thread's swap_data while it pends, so the free
+ * path can tell which waiters a freed block can actually satisfy.
+ */
+struct kheap_waiter {
+	size_t bytes;
+	struct k_thread *thread;
+	struct kheap_waiter *next;
+};
+
+struct kheap_wake_data {
+	size_t avail;
+	struct kheap_waiter *head;
+	bool visited_first;
+};
+
+static int kheap_waiter_walk_op(struct k_thread *thread, void *data)
+{
+	struct kheap_wake_data *wd = data;
+	struct kheap_waiter *waiter = thread->base.swap_data;
+
+	/* The walk visits waiters in queue order, so the first thread
+	 * seen is the highest priority waiter, which is always woken
+	 * (see kheap_wake_fitting()).
+	 */
+	if (!wd->visited_first || (waiter->bytes <= wd->avail)) {
+		/* The collected threads are woken once the walk has
+		 * completed.  Neutralize their timeouts here, under the
+		 * scheduler lock, so that a timeout firing in between
+		 * cannot wake a collected thread early and let it pend
+		 * elsewhere (or run) before the deferred wakeup reaches
+		 * it.  Same scheme as event_walk_op().
+		 */
+		thread->no_wake_on_timeout = true;
+		(void)z_abort_timeout(&thread->base.timeout);
+
+		waiter->next = wd->head;
+		wd->head = waiter;
+	}
+	wd->visited_first = true;
+
+	return 0;
+}
+
+/* Wake the waiters whose recorded request fits in @a avail freed bytes,
+ * and always the highest priority waiter: freed blocks coalesce with
+ * their neighbours, so a larger request than the hint may fit now, and
+ * waking the head keeps every waiter live at the cost of at most one
+ * spurious retry.  Called with the heap lock held, returns the number
+ * of threads woken.
+ */
+static int kheap_wake_fitting(struct k_heap *heap, size_t avail)
+{
+	struct kheap_wake_data wd = {
+		.avail = avail,
+		.head = NULL,
+		.visited_first = false,
+	};
+	int woken = 0;
+
+	if (z_waitq_head(&heap->wait_q) == NULL) {
+		return 0;
+	}
+
+	(void)z_sched_waitq_walk(&heap->wait_q, kheap_waiter_walk_op, &wd);
+
+	struct kheap_waiter *w = wd.head;
+
+	while (w != NULL) {
+		/* The descriptor lives on the waiter's stack, so the
+		 * link must be read before the thread is woken.
+		 */
+		struct kheap_waiter *next = w->next;
+
+		z_sched_wake_thread(w->thread, false);
+		woken++;
+		w = next;
+	}
+
+	return woken;
+}
+#endif /* CONFIG_KHEAP_SELECTIVE_WAKEUP */
+
+/* Wake blocked allocators after memory went back to the heap.  The
+ * @a avail hint is the usable size of the freed block.  Called with the
+ * heap lock held, returns the number of threads woken.
+ */
+static int kheap_wake_waiters(struct k_heap *heap, size_t avail)
+{
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+	return kheap_wake_fitting(heap, avail);
+#else
+	ARG_UNUSED(avail);
+
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		return 0;
+	}
+
+	return z_unpend_all(&heap->wait_q);
+#endif /* CONFIG_KHEAP_SELECTIVE_WAKEUP */
+}
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	sys_heap_init(&heap->heap, mem, bytes);
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+	memset(heap->magazine, 0, sizeof(heap->magazine));
+	heap->magazine_usable = 0;
+#endif
+
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+/* The magazines hold blocks of the one chunk size that a
+ * KHEAP_MAGAZINE_BLOCK_SIZE byte allocation maps to on this heap.
+ * Lock order is always magazine lock first, then heap->lock; the
+ * magazine locks are per-CPU so they see no cross-CPU contention on
+ * the hot path.
+ */
+
+static void *magazine_alloc(struct k_heap *heap)
+{
+	struct k_heap_magazine *mag = &heap->magazine[_current_cpu->id];
+	k_spinlock_key_t mag_key = k_spin_lock(&mag->lock);
+	void *ret = NULL;
+
+	if (mag->count == 0U) {
+		/* Batched refill: one trip through the shared lock
+		 * pays for several future allocations.
+		 */
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		while (mag->count < (CONFIG_KHEAP_MAGAZINE_DEPTH + 1) / 2) {
+			void *blk = sys_heap_alloc(&heap->heap,
+						   CONFIG_KHEAP_MAGAZINE_BLOCK_SIZE);
+
+			if (blk == NULL) {
+				break;
+			}
+			if (heap->magazine_usable == 0U) {
+				heap->magazine_usable =
+					sys_heap_usable_size(&heap->heap, blk);
+			}
+			mag->slots[mag->count++] = blk;
+		}
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	if (mag->count > 0U) {
+		ret = mag->slots[--mag->count];
+	}
+	k_spin_unlock(&mag->lock, mag_key);
+
+	return ret;
+}
+
+static bool magazine_free(struct k_heap *heap, void *mem)
+{
+	/* Only blocks of exactly the cached chunk size go back into
+	 * the magazine; sys_heap_usable_size() only reads the stable
+	 * header of an allocated chunk, so no lock is needed.
+	 */
+	if ((heap->magazine_usable == 0U) ||
+	    (sys_heap_usable_size(&heap->heap, mem) != heap->magazine_usable)) {
+		return false;
+	}
+
+	struct k_heap_magazine *mag = &heap->magazine[_current_cpu->id];
+	k_spinlock_key_t mag_key = k_spin_lock(&mag->lock);
+	bool flushed = false;
+
+	if (mag->count == CONFIG_KHEAP_MAGAZINE_DEPTH) {
+		/* Batched flush of half the magazine */
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		while (mag->count > CONFIG_KHEAP_MAGAZINE_DEPTH / 2) {
+			sys_heap_free(&heap->heap, mag->slots[--mag->count]);
+		}
+		k_spin_unlock(&heap->lock, key);
+		flushed = true;
+	}
+	mag->slots[mag->count++] = mem;
+	k_spin_unlock(&mag->lock, mag_key);
+
+	if (flushed) {
+		/* Memory went back to the shared heap: wake any waiters */
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		if (kheap_wake_waiters(heap, heap->magazine_usable) != 0) {
+			z_reschedule(&heap->lock, key);
+		} else {
+			k_spin_unlock(&heap->lock, key);
+		}
+	}
+
+	return true;
+}
+
+/* Return every cached block on every CPU to the shared heap.  Called
+ * before an allocation is allowed to fail or block, so the magazines
+ * never hold memory that a waiter needs.  Returns true if any block
+ * was freed.
+ */
+static bool magazine_drain(struct k_heap *heap)
+{
+	bool freed = false;
+
+	for (int i = 0; i < arch_num_cpus(); i++) {
+		struct k_heap_magazine *mag = &heap->magazine[i];
+		k_spinlock_key_t mag_key = k_spin_lock(&mag->lock);
+
+		if (mag->count > 0U) {
+			k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+			while (mag->count > 0U) {
+				sys_heap_free(&heap->heap, mag->slots[--mag->count]);
+			}
+			k_spin_unlock(&heap->lock, key);
+			freed = true;
+		}
+		k_spin_unlock(&mag->lock, mag_key);
+	}
+
+	return freed;
+}
+#endif /* CONFIG_KHEAP_MAGAZINE */
+
 static int statics_init(void)
 {
 	STRUCT_SECTION_FOREACH(k_heap, heap) {
@@ -76,9 +300,26 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 
 	bool blocked_alloc = false;
 
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+	struct kheap_waiter waiter = { .bytes = bytes, .thread = _current };
+#endif
+
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+		if (ret == NULL) {
+			k_spin_unlock(&heap->lock, key);
+
+			bool drained = magazine_drain(heap);
+
+			key = k_spin_lock(&heap->lock);
+			if (drained) {
+				continue;
+			}
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -95,6 +336,9 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 		}
 
 		timeout = sys_timepoint_timeout(end);
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+		_current->base.swap_data = &waiter;
+#endif
 		(void) z_pend_curr(&heap->lock, key, &heap->wait_q, timeout);
 		key = k_spin_lock(&heap->lock);
 	}
@@ -109,6 +353,17 @@ void *k_heap_alloc(struct k_heap *heap, size_t bytes, k_timeout_t timeout)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, alloc, heap, timeout);
 
+#ifdef CONFIG_KHEAP_MAGAZINE
+	if ((bytes > 0U) && (bytes <= CONFIG_KHEAP_MAGAZINE_BLOCK_SIZE)) {
+		void *cached = magazine_alloc(heap);
+
+		if (cached != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, cached);
+			return cached;
+		}
+	}
+#endif
+
 	void *ret = k_heap_aligned_alloc(heap, sizeof(void *), bytes, timeout);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, alloc, heap, timeout, ret);
@@ -127,6 +382,10 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+	struct kheap_waiter waiter = { .bytes = bytes, .thread = _current };
+#endif
+
 	while (ret == NULL) {
 		ret = sys_heap_aligned_realloc(&heap->heap, ptr, sizeof(void *), bytes);
 
@@ -136,6 +395,9 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 		}
 
 		timeout = sys_timepoint_timeout(end);
+#ifdef CONFIG_KHEAP_SELECTIVE_WAKEUP
+		_current->base.swap_data = &waiter;
+#endif
 		(void) z_pend_curr(&heap->lock, key, &heap->wait_q, timeout);
 		key = k_spin_lock(&heap->lock);
 	}
@@ -148,12 +410,28 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_KHEAP_MAGAZINE
+	if ((mem != NULL) && magazine_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	size_t avail = 0;
+
+	/* The usable size of the block is only needed as a wakeup hint
+	 * and must be read before the block goes back to the heap.
+	 */
+	if (IS_ENABLED(CONFIG_KHEAP_SELECTIVE_WAKEUP) && (mem != NULL) &&
+	    (z_waitq_head(&heap->wait_q) != NULL)) {
+		avail = sys_heap_usable_size(&heap->heap, mem);
+	}
 
 	sys_heap_free(&heap->heap, mem);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
-	if (IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0)) {
+	if (kheap_wake_waiters(heap, avail) != 0) {
 		z_reschedule(&heap->lock, key);
 	} else {
 		k_spin_unlock(&heap->lock, key);
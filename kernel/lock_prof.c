@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lock contention profiler.
+ *
+ * Call sites are aggregated in a fixed size, lock free hash table. An
+ * entry is claimed with a compare-and-set on its site pointer; all other
+ * fields are updated with plain read-modify-write operations, which is
+ * safe because updates for a given call site are serialized by the
+ * profiled lock itself (the update runs while the lock is still held).
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/debug/lock_prof.h>
+#include <zephyr/sys/atomic.h>
+
+struct lock_prof_entry {
+	atomic_ptr_t site;
+	uint8_t kind;
+	uint32_t count;
+	uint64_t contended_cycles;
+	uint32_t max_hold_cycles;
+};
+
+static struct lock_prof_entry entries[CONFIG_LOCK_PROFILING_NUM_ENTRIES];
+
+static struct lock_prof_entry *entry_find(const void *site)
+{
+	uint32_t idx = (uint32_t)((uintptr_t)site * 2654435761U) %
+		       CONFIG_LOCK_PROFILING_NUM_ENTRIES;
+
+	for (int probe = 0; probe < CONFIG_LOCK_PROFILING_NUM_ENTRIES;
+	     probe++) {
+		struct lock_prof_entry *entry = &entries[idx];
+		void *cur = atomic_ptr_get(&entry->site);
+
+		if (cur == site) {
+			return entry;
+		}
+
+		if (cur == NULL &&
+		    atomic_ptr_cas(&entry->site, NULL, (void *)site)) {
+			return entry;
+		}
+
+		idx = (idx + 1U) % CONFIG_LOCK_PROFILING_NUM_ENTRIES;
+	}
+
+	return NULL;
+}
+
+void z_lock_prof_update(const void *site, uint8_t kind,
+			uint32_t contended_cycles, uint32_t hold_cycles)
+{
+	struct lock_prof_entry *entry;
+
+	if (site == NULL) {
+		return;
+	}
+
+	entry = entry_find(site);
+	if (entry == NULL) {
+		/* Table full, sample dropped. */
+		return;
+	}
+
+	entry->kind = kind;
+	entry->count++;
+	entry->contended_cycles += contended_cycles;
+	if (hold_cycles > entry->max_hold_cycles) {
+		entry->max_hold_cycles = hold_cycles;
+	}
+}
+
+void lock_prof_foreach(lock_prof_cb_t cb, void *user_data)
+{
+	for (int i = 0; i < CONFIG_LOCK_PROFILING_NUM_ENTRIES; i++) {
+		struct lock_prof_entry *entry = &entries[i];
+		struct lock_prof_stats stats;
+
+		if (atomic_ptr_get(&entry->site) == NULL ||
+		    entry->count == 0U) {
+			continue;
+		}
+
+		stats.site = atomic_ptr_get(&entry->site);
+		stats.kind = (enum lock_prof_kind)entry->kind;
+		stats.count = entry->count;
+		stats.contended_cycles = entry->contended_cycles;
+		stats.max_hold_cycles = entry->max_hold_cycles;
+
+		cb(&stats, user_data);
+	}
+}
+
+void lock_prof_reset(void)
+{
+	/* Keep the claimed sites so that concurrent updates keep working,
+	 * only clear the counters.
+	 */
+	for (int i = 0; i < CONFIG_LOCK_PROFILING_NUM_ENTRIES; i++) {
+		entries[i].count = 0U;
+		entries[i].contended_cycles = 0U;
+		entries[i].max_hold_cycles = 0U;
+	}
+}
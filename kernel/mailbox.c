@@ -29,8 +29,11 @@ static struct k_obj_type  obj_type_mailbox;
 
 /* asynchronous message descriptor type */
 struct k_mbox_async {
-	struct _thread_base thread;		/* dummy thread object */
-	struct k_mbox_msg tx_msg;	/* transmit message descriptor */
+	struct _thread_base thread;	/* dummy thread object */
+	struct k_mbox_msg msg;		/* message descriptor (tx or rx) */
+	k_mbox_async_cb_t cb;		/* completion callback (may be NULL) */
+	void *user_data;		/* opaque callback argument */
+	void *rx_buffer;		/* receive buffer (async receive only) */
 };
 
 /* stack of unused asynchronous message descriptors */
@@ -176,9 +179,19 @@ static void mbox_message_dispose(struct k_mbox_msg *rx_msg)
 	 * dummy thread pair, then give semaphore (if needed)
 	 */
 	if ((sending_thread->base.thread_state & _THREAD_DUMMY) != 0U) {
+		struct k_mbox_async *async =
+			(struct k_mbox_async *)sending_thread;
 		struct k_sem *async_sem = tx_msg->_async_sem;
-
-		mbox_async_free((struct k_mbox_async *)sending_thread);
+		k_mbox_async_cb_t cb = async->cb;
+		void *user_data = async->user_data;
+
+		/* notify before the descriptor is recycled, while the
+		 * completed message contents are still valid
+		 */
+		if (cb != NULL) {
+			cb(tx_msg, user_data);
+		}
+		mbox_async_free(async);
 		if (async_sem != NULL) {
 			k_sem_give(async_sem);
 		}
@@ -193,6 +206,55 @@ static void mbox_message_dispose(struct k_mbox_msg *rx_msg)
 	z_reschedule_unlocked();
 }
 
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+/**
+ * @brief Complete a transfer to an asynchronous receiver.
+ *
+ * Copies the message data into the receiver's buffer, releases the sender,
+ * then runs the receiver's completion callback and recycles its descriptor.
+ * Neither side has a thread to wake up.
+ *
+ * Must be called without the mailbox lock held.
+ *
+ * @param async Pointer to the receiver's asynchronous message descriptor.
+ * @param sending_thread Matched sending thread (actual or dummy).
+ */
+static void mbox_async_rx_complete(struct k_mbox_async *async,
+				   struct k_thread *sending_thread)
+{
+	struct k_mbox_msg *rx_msg = &async->msg;
+	k_mbox_async_cb_t cb = async->cb;
+	void *user_data = async->user_data;
+
+	/* copy message data to the receive buffer, if any */
+	if (async->rx_buffer == NULL) {
+		rx_msg->size = 0;
+	} else if ((rx_msg->tx_data != NULL) && (rx_msg->size > 0U)) {
+		(void)memcpy(async->rx_buffer, rx_msg->tx_data, rx_msg->size);
+	}
+
+	if ((sending_thread->base.thread_state & _THREAD_DUMMY) != 0U) {
+		/* asynchronous send: dispose frees it and notifies */
+		mbox_message_dispose(rx_msg);
+	} else {
+		/*
+		 * synchronous send: the sender is the caller's context and
+		 * returns without pending, so just finalize its descriptor
+		 */
+		struct k_mbox_msg *tx_msg =
+			(struct k_mbox_msg *)sending_thread->base.swap_data;
+
+		tx_msg->size = rx_msg->size;
+		rx_msg->_syncing_thread = NULL;
+	}
+
+	if (cb != NULL) {
+		cb(rx_msg, user_data);
+	}
+	mbox_async_free(async);
+}
+#endif /* CONFIG_NUM_MBOX_ASYNC_MSGS */
+
 /**
  * @brief Send a mailbox message.
  *
@@ -231,6 +293,25 @@ static int mbox_message_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 		rx_msg = (struct k_mbox_msg *)receiving_thread->base.swap_data;
 
 		if (mbox_message_match(tx_msg, rx_msg) == 0) {
+#if (CONFIG_NUM_MBOX_ASYNC_MSGS > 0)
+			/*
+			 * asynchronous receiver: no thread to wake up, so
+			 * complete the entire exchange inline
+			 */
+			if ((receiving_thread->base.thread_state &
+			     _THREAD_DUMMY) != 0U) {
+				z_unpend_thread(receiving_thread);
+				k_spin_unlock(&mbox->lock, key);
+
+				mbox_async_rx_complete(
+					(struct k_mbox_async *)receiving_thread,
+					sending_thread);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, message_put, mbox,
+							       timeout, 0);
+				return 0;
+			}
+#endif /* CONFIG_NUM_MBOX_ASYNC_MSGS */
 			/* take receiver out of rx queue */
 			z_unpend_thread(receiving_thread);
 
@@ -323,13 +404,103 @@ void k_mbox_async_put(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
 
 	async->thread.prio = _current->base.prio;
 
-	async->tx_msg = *tx_msg;
-	async->tx_msg._syncing_thread = (struct k_thread *)&async->thread;
-	async->tx_msg._async_sem = sem;
+	async->msg = *tx_msg;
+	async->msg._syncing_thread = (struct k_thread *)&async->thread;
+	async->msg._async_sem = sem;
+	async->cb = NULL;
 
-	(void)mbox_message_put(mbox, &async->tx_msg, K_FOREVER);
+	(void)mbox_message_put(mbox, &async->msg, K_FOREVER);
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, async_put, mbox, sem);
 }
+
+void k_mbox_async_put_cb(struct k_mbox *mbox, struct k_mbox_msg *tx_msg,
+			 k_mbox_async_cb_t cb, void *user_data)
+{
+	struct k_mbox_async *async;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mbox, async_put, mbox, NULL);
+
+	/*
+	 * allocate an asynchronous message descriptor, configure both parts,
+	 * then send the message asynchronously
+	 */
+	mbox_async_alloc(&async);
+
+	async->thread.prio = _current->base.prio;
+
+	async->msg = *tx_msg;
+	async->msg._syncing_thread = (struct k_thread *)&async->thread;
+	async->msg._async_sem = NULL;
+	async->cb = cb;
+	async->user_data = user_data;
+
+	(void)mbox_message_put(mbox, &async->msg, K_FOREVER);
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, async_put, mbox, NULL);
+}
+
+void k_mbox_async_get(struct k_mbox *mbox, struct k_mbox_msg *rx_msg,
+		      void *buffer, k_mbox_async_cb_t cb, void *user_data)
+{
+	struct k_thread *sending_thread;
+	struct k_mbox_msg *tx_msg;
+	struct k_mbox_async *async;
+	k_spinlock_key_t key;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mbox, get, mbox, K_FOREVER);
+
+	/*
+	 * allocate an asynchronous message descriptor up front, since the
+	 * allocation may not be attempted with the mailbox lock held
+	 */
+	mbox_async_alloc(&async);
+
+	/* save receiver id so it can be used during message matching */
+	rx_msg->tx_target_thread = _current;
+
+	/* search mailbox's tx queue for a compatible sender */
+	key = k_spin_lock(&mbox->lock);
+
+	_WAIT_Q_FOR_EACH(&mbox->tx_msg_queue, sending_thread) {
+		tx_msg = (struct k_mbox_msg *)sending_thread->base.swap_data;
+
+		if (mbox_message_match(tx_msg, rx_msg) == 0) {
+			/* take sender out of mailbox's tx queue */
+			z_unpend_thread(sending_thread);
+
+			k_spin_unlock(&mbox->lock, key);
+
+			/* descriptor wasn't needed after all */
+			mbox_async_free(async);
+
+			/* retrieve message data, dispose of it and notify */
+			k_mbox_data_get(rx_msg, buffer);
+			if (cb != NULL) {
+				cb(rx_msg, user_data);
+			}
+
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, get, mbox, K_FOREVER, 0);
+			return;
+		}
+	}
+
+	/*
+	 * didn't find a matching sender: dummy receiver waits on rx queue
+	 * until a future send serves it
+	 */
+	async->thread.prio = _current->base.prio;
+
+	async->msg = *rx_msg;
+	async->cb = cb;
+	async->user_data = user_data;
+	async->rx_buffer = buffer;
+	async->thread.swap_data = &async->msg;
+
+	z_pend_thread((struct k_thread *)&async->thread, &mbox->rx_msg_queue,
+		      K_FOREVER);
+	k_spin_unlock(&mbox->lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mbox, get, mbox, K_FOREVER, 0);
+}
 #endif /* CONFIG_NUM_MBOX_ASYNC_MSGS */
 
 void k_mbox_data_get(struct k_mbox_msg *rx_msg, void *buffer)
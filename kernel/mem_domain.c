@@ -13,6 +13,9 @@
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/sys/libc-hooks.h>
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+#include <zephyr/sys/time_page.h>
+#endif
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
@@ -152,6 +155,17 @@ int k_mem_domain_init(struct k_mem_domain *domain, uint8_t num_parts,
 unlock_out:
 	k_spin_unlock(&z_mem_domain_lock, key);
 
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+	/* Every domain gets the time page, so user threads can take
+	 * timestamps without a system call regardless of which domain
+	 * they are assigned to.
+	 */
+	if (ret == 0) {
+		ret = k_mem_domain_add_partition(domain,
+						 &z_time_page_partition);
+	}
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+
 out:
 	return ret;
 }
@@ -18,6 +18,80 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+/* The free list head is packed into one atomic word: the low 16 bits
+ * hold the index of the first free block (SLAB_END when empty), the
+ * remaining bits a tag incremented on every successful pop so that a
+ * stale compare-and-swap loses even if the same block returned to the
+ * head in the meantime (ABA).  Links are stored in the free blocks
+ * themselves as indices.
+ */
+#define SLAB_END 0xffffU
+
+static inline uint32_t slab_head_index(atomic_val_t v)
+{
+	return (uint32_t)v & 0xffffU;
+}
+
+static inline atomic_val_t slab_head(atomic_val_t tag, uint32_t idx)
+{
+	return (atomic_val_t)((tag << 16) | idx);
+}
+
+static void *slab_pop(struct k_mem_slab *slab)
+{
+	atomic_val_t old, new;
+	char *blk;
+
+	do {
+		old = atomic_get(&slab->free_head);
+
+		uint32_t idx = slab_head_index(old);
+
+		if (idx == SLAB_END) {
+			return NULL;
+		}
+		blk = slab->buffer + (size_t)idx * slab->info.block_size;
+
+		/* Reading the link of a block another CPU may pop and
+		 * reuse concurrently is racy, but harmless: the tag
+		 * bump below makes the CAS fail in that case.
+		 */
+		new = slab_head((old >> 16) + 1, *(uint32_t *)blk);
+	} while (!atomic_cas(&slab->free_head, old, new));
+
+	atomic_inc(&slab->num_used);
+
+	return blk;
+}
+
+static void slab_push(struct k_mem_slab *slab, void *mem)
+{
+	atomic_val_t old, new;
+	uint32_t idx = (uint32_t)(((char *)mem - slab->buffer) /
+				  slab->info.block_size);
+
+	do {
+		old = atomic_get(&slab->free_head);
+		*(uint32_t *)mem = slab_head_index(old);
+		new = slab_head(old >> 16, idx);
+	} while (!atomic_cas(&slab->free_head, old, new));
+
+	atomic_dec(&slab->num_used);
+}
+
+/* Stats readers look at info.num_used; bring it up to date first */
+static inline void slab_sync_stats(struct k_mem_slab *slab)
+{
+	slab->info.num_used = (uint32_t)atomic_get(&slab->num_used);
+}
+#else
+static inline void slab_sync_stats(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
+
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 static struct k_obj_type obj_type_mem_slab;
 
@@ -32,6 +106,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	slab_sync_stats(slab);
 	memcpy(stats, &slab->info, sizeof(slab->info));
 	k_spin_unlock(&slab->lock, key);
 
@@ -48,6 +123,7 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
+	slab_sync_stats(slab);
 	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			  slab->info.block_size;
 	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
@@ -111,6 +187,22 @@ static int create_free_list(struct k_mem_slab *slab)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	CHECKIF(slab->info.num_blocks >= SLAB_END) {
+		return -EINVAL;
+	}
+
+	slab->free_list = NULL;
+	for (uint32_t i = 0; i < slab->info.num_blocks; i++) {
+		p = slab->buffer + (size_t)i * slab->info.block_size;
+		*(uint32_t *)p = (i + 1U == slab->info.num_blocks) ?
+				 SLAB_END : (i + 1U);
+	}
+	atomic_set(&slab->free_head,
+		   slab_head(0, (slab->info.num_blocks > 0U) ? 0U : SLAB_END));
+	atomic_set(&slab->num_used, 0);
+	atomic_set(&slab->waiters, 0);
+#else
 	slab->free_list = NULL;
 	p = slab->buffer + slab->info.block_size * (slab->info.num_blocks - 1);
 
@@ -119,6 +211,7 @@ static int create_free_list(struct k_mem_slab *slab)
 		slab->free_list = p;
 		p -= slab->info.block_size;
 	}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 	return 0;
 }
 
@@ -214,6 +307,97 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
+{
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+
+	*mem = slab_pop(slab);
+	if (*mem != NULL) {
+		result = 0;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
+		/* don't wait for a free block to become available */
+		result = -ENOMEM;
+	} else {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+		/* Advertise ourselves as a waiter, then re-check the
+		 * free list: a concurrent free pushes its block before
+		 * reading the waiter count, so either it sees us and
+		 * takes its locked path or this pop sees its block.
+		 */
+		atomic_inc(&slab->waiters);
+		*mem = slab_pop(slab);
+		if (*mem != NULL) {
+			atomic_dec(&slab->waiters);
+			k_spin_unlock(&slab->lock, key);
+			result = 0;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+			/* wait for a free block or timeout; the freeing
+			 * side retires our waiter advertisement when it
+			 * hands a block over
+			 */
+			result = z_pend_curr(&slab->lock, key, &slab->wait_q, timeout);
+			if (result == 0) {
+				*mem = _current->base.swap_data;
+			} else {
+				key = k_spin_lock(&slab->lock);
+				atomic_dec(&slab->waiters);
+				k_spin_unlock(&slab->lock, key);
+			}
+		}
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+
+	return result;
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	if (!slab_ptr_is_good(slab, mem)) {
+		__ASSERT(false, "Invalid memory pointer provided");
+		k_panic();
+		return;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	slab_push(slab, mem);
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+	    (atomic_get(&slab->waiters) > 0)) {
+		k_spinlock_key_t key = k_spin_lock(&slab->lock);
+		void *blk = slab_pop(slab);
+
+		if (blk != NULL) {
+			struct k_thread *pending_thread =
+				z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				atomic_dec(&slab->waiters);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+				z_thread_return_value_set_with_data(pending_thread, 0, blk);
+				z_ready_thread(pending_thread);
+				z_reschedule(&slab->lock, key);
+				return;
+			}
+			/* the block was grabbed or the waiter left */
+			slab_push(slab, blk);
+		}
+		k_spin_unlock(&slab->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+}
+#else /* !CONFIG_MEM_SLAB_LOCKLESS */
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -294,6 +478,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 
 	k_spin_unlock(&slab->lock, key);
 }
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -303,6 +488,7 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+	slab_sync_stats(slab);
 	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
 	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
 			    slab->info.block_size;
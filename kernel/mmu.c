@@ -424,6 +424,53 @@ static void free_page_frame_list_put(struct k_mem_page_frame *pf)
 	z_free_page_count++;
 }
 
+#ifdef CONFIG_KERNEL_CONTIG_MAP
+/* Find a physically contiguous run of free page frames whose base address
+ * is aligned to "align", and pull every frame in the run off the free list.
+ * Returns the first page frame of the run, or NULL if no such run exists.
+ *
+ * Unlike free_page_frame_list_get() this scans the page frame array, since
+ * the free list keeps no adjacency information. Removing each frame walks
+ * the free list, so this is expected to be used for long-lived mappings
+ * established at setup time, not on hot paths.
+ */
+static struct k_mem_page_frame *free_page_frame_run_get(size_t num_pages,
+							size_t align)
+{
+	size_t start = 0;
+	size_t run = 0;
+
+	for (size_t i = 0; i < K_MEM_NUM_PAGE_FRAMES; i++) {
+		struct k_mem_page_frame *pf = &k_mem_page_frames[i];
+
+		if (!k_mem_page_frame_is_free(pf)) {
+			run = 0;
+			continue;
+		}
+		if (run == 0) {
+			if (!IS_ALIGNED(k_mem_page_frame_to_phys(pf), align)) {
+				/* runs must start on an aligned address */
+				continue;
+			}
+			start = i;
+		}
+		run++;
+		if (run == num_pages) {
+			for (size_t j = start; j < (start + num_pages); j++) {
+				pf = &k_mem_page_frames[j];
+				(void)sys_sflist_find_and_remove(
+						&free_page_frame_list, &pf->node);
+				pf->va_and_flags = 0;
+				z_free_page_count--;
+			}
+			return &k_mem_page_frames[start];
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_KERNEL_CONTIG_MAP */
+
 static void free_page_frame_list_init(void)
 {
 	sys_sflist_init(&free_page_frame_list);
@@ -675,6 +722,127 @@ out:
 	return dst;
 }
 
+#ifdef CONFIG_KERNEL_CONTIG_MAP
+void *k_mem_map_contiguous(size_t size, uint32_t flags)
+{
+	uint8_t *dst;
+	uint8_t *aligned_dst;
+	uint8_t *pos;
+	struct k_mem_page_frame *pf;
+	uintptr_t phys;
+	size_t align, head_size, tail_size, total_size;
+	k_spinlock_key_t key;
+	bool uninit = (flags & K_MEM_MAP_UNINIT) != 0U;
+
+	__ASSERT(page_frames_initialized, "%s called too early", __func__);
+	__ASSERT((flags & K_MEM_CACHE_MASK) == 0U,
+		 "%s does not support explicit cache settings", __func__);
+	__ASSERT((flags & K_MEM_MAP_UNPAGED) == 0U,
+		 "%s does not support unpaged mappings", __func__);
+
+	if (((flags & K_MEM_PERM_USER) != 0U) && uninit) {
+		LOG_ERR("user access to anonymous uninitialized pages is forbidden");
+		return NULL;
+	}
+	if ((size % CONFIG_MMU_PAGE_SIZE) != 0U) {
+		LOG_ERR("unaligned size %zu passed to %s", size, __func__);
+		return NULL;
+	}
+	if (size == 0) {
+		LOG_ERR("zero sized memory mapping");
+		return NULL;
+	}
+
+	/* The run is always pinned: paging out individual pages would
+	 * break it up.
+	 */
+	flags |= K_MEM_MAP_LOCK | K_MEM_CACHE_WB;
+
+	/* Align the virtual and physical bases to the largest power of
+	 * two dividing the size, so the arch layer can cover the region
+	 * with the largest block/section descriptors it supports.
+	 */
+	align = size & ~(size - 1U);
+
+	/* Need extra for the guard pages (before and after) which we
+	 * won't map, plus alignment play carved off below.
+	 */
+	if (size_add_overflow(size, align + (CONFIG_MMU_PAGE_SIZE * 2),
+			      &total_size)) {
+		LOG_ERR("too large size %zu passed to %s", size, __func__);
+		return NULL;
+	}
+
+	key = k_spin_lock(&z_mm_lock);
+
+	dst = virt_region_alloc(total_size, CONFIG_MMU_PAGE_SIZE);
+	if (dst == NULL) {
+		/* Address space has no free region */
+		goto out;
+	}
+
+	/* Put the mapped region on the alignment boundary with its
+	 * "before" guard page immediately preceding it, and give the
+	 * unused head and tail of the allocation back, the same way
+	 * virt_region_alloc() does for its own alignment requests.
+	 */
+	aligned_dst = (uint8_t *)ROUND_UP((uintptr_t)dst + CONFIG_MMU_PAGE_SIZE,
+					  align);
+	head_size = (size_t)(aligned_dst - CONFIG_MMU_PAGE_SIZE - dst);
+	tail_size = total_size - head_size - size - (CONFIG_MMU_PAGE_SIZE * 2);
+	if (head_size > 0) {
+		virt_region_free(dst, head_size);
+	}
+	if (tail_size > 0) {
+		virt_region_free(aligned_dst + size + CONFIG_MMU_PAGE_SIZE,
+				 tail_size);
+	}
+	dst = aligned_dst;
+
+	/* Unmap both guard pages to make sure accessing them
+	 * will generate fault.
+	 */
+	arch_mem_unmap(dst - CONFIG_MMU_PAGE_SIZE, CONFIG_MMU_PAGE_SIZE);
+	arch_mem_unmap(dst + size, CONFIG_MMU_PAGE_SIZE);
+
+	pf = free_page_frame_run_get(size / CONFIG_MMU_PAGE_SIZE, align);
+	if (pf == NULL) {
+		/* No eviction fallback here: evicting pages one at a
+		 * time cannot produce a contiguous run.
+		 */
+		LOG_ERR("no physically contiguous run of %zu bytes", size);
+		virt_region_free(dst - CONFIG_MMU_PAGE_SIZE,
+				 size + (CONFIG_MMU_PAGE_SIZE * 2));
+		dst = NULL;
+		goto out;
+	}
+	phys = k_mem_page_frame_to_phys(pf);
+
+	/* One mapping call for the whole run: with the virtual address,
+	 * physical address and size all aligned, the arch layer can use
+	 * block/section descriptors instead of individual page entries.
+	 */
+	arch_mem_map(dst, phys, size, flags);
+
+	VIRT_FOREACH(dst, size, pos) {
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
+		frame_mapped_set(pf, pos);
+		pf++;
+	}
+
+	LOG_DBG("memory mapping contiguous %zu bytes %p -> 0x%lx", size, dst, phys);
+
+out:
+	k_spin_unlock(&z_mm_lock, key);
+
+	if (dst != NULL && !uninit) {
+		memset(dst, 0, size);
+	}
+
+	return dst;
+}
+#endif /* CONFIG_KERNEL_CONTIG_MAP */
+
 void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 {
 	uintptr_t phys;
@@ -1509,6 +1677,90 @@ out:
 	return ret;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+/* Wakes the write-back thread; limit 1 so repeated faults coalesce */
+static K_SEM_DEFINE(writeback_wake_sem, 0, 1);
+
+/* Evict one page frame into the free pool on behalf of future page
+ * faults, writing it out first if dirty.  Returns 0 if more evictions
+ * are wanted, 1 once the pool reached the high watermark, negative on
+ * error.
+ */
+static int writeback_evict_one(void)
+{
+	struct k_mem_page_frame *pf;
+	uintptr_t location;
+	k_spinlock_key_t key;
+	bool dirty = false;
+	int ret;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+#ifdef CONFIG_SMP
+	k_mutex_lock(&z_mm_paging_lock, K_FOREVER);
+#else
+	k_sched_lock();
+#endif
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	key = k_spin_lock(&z_mm_lock);
+
+	if (z_free_page_count >= CONFIG_DEMAND_PAGING_WRITEBACK_HIGH_WATERMARK) {
+		ret = 1;
+		goto out;
+	}
+
+	pf = k_mem_paging_eviction_select(&dirty);
+	if (pf == NULL) {
+		ret = -ENOMEM;
+		goto out;
+	}
+	LOG_DBG("write-back evicting %p at 0x%lx",
+		k_mem_page_frame_to_virt(pf), k_mem_page_frame_to_phys(pf));
+	ret = page_frame_prepare_locked(pf, &dirty, false, &location);
+	if (ret != 0) {
+		goto out;
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_spin_unlock(&z_mm_lock, key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(location);
+	}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	key = k_spin_lock(&z_mm_lock);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	page_frame_free_locked(pf);
+out:
+	k_spin_unlock(&z_mm_lock, key);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+#ifdef CONFIG_SMP
+	k_mutex_unlock(&z_mm_paging_lock);
+#else
+	k_sched_unlock();
+#endif
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	return ret;
+}
+
+static void writeback_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&writeback_wake_sem, K_FOREVER);
+
+		while (writeback_evict_one() == 0) {
+		}
+	}
+}
+
+K_THREAD_DEFINE(z_mem_paging_writeback,
+		CONFIG_DEMAND_PAGING_WRITEBACK_STACK_SIZE,
+		writeback_thread_fn, NULL, NULL, NULL,
+		CONFIG_DEMAND_PAGING_WRITEBACK_PRIORITY, 0, 0);
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
+
 static inline void paging_stats_faults_inc(struct k_thread *faulting_thread,
 					   int key)
 {
@@ -1711,6 +1963,14 @@ static bool do_page_fault(void *addr, bool pin)
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
 	}
+#ifdef CONFIG_DEMAND_PAGING_WRITEBACK
+	/* Replenish the free pool in the background so the next faults
+	 * don't have to evict (and possibly write out) synchronously.
+	 */
+	if (z_free_page_count < CONFIG_DEMAND_PAGING_WRITEBACK_LOW_WATERMARK) {
+		k_sem_give(&writeback_wake_sem);
+	}
+#endif /* CONFIG_DEMAND_PAGING_WRITEBACK */
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
 
@@ -47,6 +47,11 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
 	msgq->flags = 0;
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	msgq->slot_states = NULL;
+	msgq->reserved_msgs = 0;
+	msgq->claimed_msgs = 0;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
@@ -121,6 +126,213 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 }
 
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+
+/* Slot states for the reserve/commit API */
+#define MSGQ_SLOT_FREE      0U
+#define MSGQ_SLOT_RESERVED  1U
+#define MSGQ_SLOT_COMMITTED 2U
+#define MSGQ_SLOT_CLAIMED   3U
+
+static inline uint32_t msgq_slot_index(struct k_msgq *msgq, void *slot)
+{
+	return (uint32_t)(((char *)slot - msgq->buffer_start) / msgq->msg_size);
+}
+
+/* Wake every waiter so it re-evaluates its condition.  Producers and
+ * consumers share the wait queue, so a targeted wakeup could unpend
+ * the wrong kind of waiter and lose the event.
+ */
+static bool msgq_wake_all(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool need_sched = false;
+
+	for (pending_thread = z_unpend_first_thread(&msgq->wait_q); pending_thread != NULL;
+	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		need_sched = true;
+	}
+
+	return need_sched;
+}
+
+void k_msgq_zero_copy_init(struct k_msgq *msgq, char *buffer,
+			   size_t msg_size, uint32_t max_msgs,
+			   uint8_t *slot_states)
+{
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+
+	(void)memset(slot_states, 0, max_msgs);
+	msgq->slot_states = slot_states;
+}
+
+int k_msgq_put_reserve(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT_NO_MSG(msgq->slot_states != NULL);
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		uint32_t occupied = msgq->used_msgs + msgq->reserved_msgs +
+				    msgq->claimed_msgs;
+		uint32_t widx = msgq_slot_index(msgq, msgq->write_ptr);
+
+		/* The slot at the write pointer can still be held by a
+		 * consumer when claims are finished out of order, so
+		 * the occupancy count alone is not sufficient.
+		 */
+		if ((occupied < msgq->max_msgs) &&
+		    (msgq->slot_states[widx] == MSGQ_SLOT_FREE)) {
+			msgq->slot_states[widx] = MSGQ_SLOT_RESERVED;
+			*slot = msgq->write_ptr;
+			msgq->write_ptr += msgq->msg_size;
+			if (msgq->write_ptr == msgq->buffer_end) {
+				msgq->write_ptr = msgq->buffer_start;
+			}
+			msgq->reserved_msgs++;
+			result = 0;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		/* Woken by a commit or finish: re-evaluate.  Note that
+		 * the wait period restarts after a spurious wakeup.
+		 */
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result != 0) {
+			return result;
+		}
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+void k_msgq_put_commit(struct k_msgq *msgq, void *slot)
+{
+	k_spinlock_key_t key;
+	uint32_t idx = msgq_slot_index(msgq, slot);
+
+	key = k_spin_lock(&msgq->lock);
+
+	__ASSERT(msgq->slot_states[idx] == MSGQ_SLOT_RESERVED,
+		 "commit of a slot that is not reserved");
+
+	msgq->slot_states[idx] = MSGQ_SLOT_COMMITTED;
+
+	/* Publish the contiguous run of committed slots following the
+	 * consumed region; a slot committed out of order becomes
+	 * visible once its predecessors commit.
+	 */
+	while (msgq->reserved_msgs > 0U) {
+		char *next = msgq->read_ptr +
+			     (msgq->used_msgs * msgq->msg_size);
+
+		if (next >= msgq->buffer_end) {
+			next -= (msgq->buffer_end - msgq->buffer_start);
+		}
+		if (msgq->slot_states[msgq_slot_index(msgq, next)] !=
+		    MSGQ_SLOT_COMMITTED) {
+			break;
+		}
+		msgq->used_msgs++;
+		msgq->reserved_msgs--;
+	}
+
+#ifdef CONFIG_POLL
+	if (msgq->used_msgs > 0U) {
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	}
+#endif /* CONFIG_POLL */
+
+	if (msgq_wake_all(msgq)) {
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+}
+
+int k_msgq_get_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT_NO_MSG(msgq->slot_states != NULL);
+
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		if (msgq->used_msgs > 0U) {
+			uint32_t ridx = msgq_slot_index(msgq, msgq->read_ptr);
+
+			__ASSERT_NO_MSG(msgq->slot_states[ridx] ==
+					MSGQ_SLOT_COMMITTED);
+			msgq->slot_states[ridx] = MSGQ_SLOT_CLAIMED;
+			*slot = msgq->read_ptr;
+			msgq->read_ptr += msgq->msg_size;
+			if (msgq->read_ptr == msgq->buffer_end) {
+				msgq->read_ptr = msgq->buffer_start;
+			}
+			msgq->used_msgs--;
+			msgq->claimed_msgs++;
+			result = 0;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result != 0) {
+			return result;
+		}
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+void k_msgq_get_finish(struct k_msgq *msgq, void *slot)
+{
+	k_spinlock_key_t key;
+	uint32_t idx = msgq_slot_index(msgq, slot);
+
+	key = k_spin_lock(&msgq->lock);
+
+	__ASSERT(msgq->slot_states[idx] == MSGQ_SLOT_CLAIMED,
+		 "finish of a slot that is not claimed");
+
+	msgq->slot_states[idx] = MSGQ_SLOT_FREE;
+	msgq->claimed_msgs--;
+
+	if (msgq_wake_all(msgq)) {
+		z_reschedule(&msgq->lock, key);
+		return;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+}
+
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
 {
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
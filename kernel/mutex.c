@@ -39,6 +39,9 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#ifdef CONFIG_LOCK_PROFILING
+#include <zephyr/debug/lock_prof.h>
+#endif /* CONFIG_LOCK_PROFILING */
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -56,6 +59,12 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	mutex->adaptive_spin = false;
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+#ifdef CONFIG_LOCK_PROFILING
+	mutex->prof_site = NULL;
+#endif /* CONFIG_LOCK_PROFILING */
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -70,6 +79,13 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 	return 0;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+void k_mutex_spin_set(struct k_mutex *mutex, bool enable)
+{
+	mutex->adaptive_spin = enable;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_init(struct k_mutex *mutex)
 {
@@ -88,6 +104,22 @@ static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
 	return new_prio;
 }
 
+#ifdef CONFIG_LOCK_PROFILING
+/* Record the acquisition of a mutex for the contention profiler.  Only
+ * called for the outermost lock, recursive locks keep the original
+ * acquisition time.
+ */
+static inline void mutex_prof_acquired(struct k_mutex *mutex,
+				       const void *site, uint32_t start)
+{
+	uint32_t now = k_cycle_get_32();
+
+	mutex->prof_site = site;
+	mutex->prof_wait = now - start;
+	mutex->prof_acquired = now;
+}
+#endif /* CONFIG_LOCK_PROFILING */
+
 static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 {
 	if (mutex->owner->base.prio != new_prio) {
@@ -108,6 +140,11 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	k_spinlock_key_t key;
 	bool resched = false;
 
+#ifdef CONFIG_LOCK_PROFILING
+	const void *prof_site = __builtin_return_address(0);
+	uint32_t prof_start = k_cycle_get_32();
+#endif /* CONFIG_LOCK_PROFILING */
+
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
@@ -127,6 +164,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 			_current, mutex, mutex->lock_count,
 			mutex->owner_orig_prio);
 
+#ifdef CONFIG_LOCK_PROFILING
+		if (mutex->lock_count == 1U) {
+			mutex_prof_acquired(mutex, prof_site, prof_start);
+		}
+#endif /* CONFIG_LOCK_PROFILING */
+
 		k_spin_unlock(&lock, key);
 
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
@@ -142,6 +185,47 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/* Before paying for a pend/wakeup pair, poll the lock while the
+	 * owner is making progress on another CPU.  Short critical
+	 * sections will release within the spin budget; otherwise (or
+	 * when the owner is preempted) fall through and pend as usual.
+	 */
+	if (mutex->adaptive_spin) {
+		for (uint32_t i = 0U;
+		     i < CONFIG_MUTEX_ADAPTIVE_SPIN_LIMIT; i++) {
+			if (!z_is_thread_active_elsewhere(mutex->owner)) {
+				break;
+			}
+
+			k_spin_unlock(&lock, key);
+			arch_spin_relax();
+			key = k_spin_lock(&lock);
+
+			if (mutex->lock_count == 0U) {
+				mutex->owner_orig_prio = _current->base.prio;
+				mutex->lock_count = 1U;
+				mutex->owner = _current;
+
+				LOG_DBG("%p took mutex %p by spinning",
+					_current, mutex);
+
+#ifdef CONFIG_LOCK_PROFILING
+				mutex_prof_acquired(mutex, prof_site,
+						    prof_start);
+#endif /* CONFIG_LOCK_PROFILING */
+
+				k_spin_unlock(&lock, key);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock,
+							       mutex, timeout, 0);
+
+				return 0;
+			}
+		}
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -161,6 +245,9 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		got_mutex ? 'y' : 'n');
 
 	if (got_mutex == 0) {
+#ifdef CONFIG_LOCK_PROFILING
+		mutex_prof_acquired(mutex, prof_site, prof_start);
+#endif /* CONFIG_LOCK_PROFILING */
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
 		return 0;
 	}
@@ -249,6 +336,16 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
+#ifdef CONFIG_LOCK_PROFILING
+	/* Outermost release: account the full hold time.  When ownership
+	 * is handed over below, the new owner records its own acquisition
+	 * data when its k_mutex_lock() call returns.
+	 */
+	z_lock_prof_update(mutex->prof_site, LOCK_PROF_KIND_MUTEX,
+			   mutex->prof_wait,
+			   k_cycle_get_32() - mutex->prof_acquired);
+#endif /* CONFIG_LOCK_PROFILING */
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	adjust_owner_prio(mutex, mutex->owner_orig_prio);
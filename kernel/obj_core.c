@@ -7,16 +7,37 @@
 #include <zephyr/kernel.h>
 #include <zephyr/kernel/obj_core.h>
 
+/* Protects the list of object types (z_obj_type_list) only */
+
 static struct k_spinlock  lock;
 
+/*
+ * The per-type object lists are protected by a set of locks sharded by
+ * object type so that operating on the objects of one type (such as a
+ * statistics sweep) does not stall the creation or destruction of objects
+ * of an unrelated type on another CPU. As object types are statically
+ * allocated and never destroyed, hashing their addresses gives each type
+ * a stable lock.
+ */
+
+#define NUM_TYPE_LOCKS  8
+
+static struct k_spinlock  type_locks[NUM_TYPE_LOCKS];
+
 sys_slist_t z_obj_type_list = SYS_SLIST_STATIC_INIT(&z_obj_type_list);
 
+static struct k_spinlock *obj_type_lock(struct k_obj_type *type)
+{
+	return &type_locks[((uintptr_t)type >> 3) % NUM_TYPE_LOCKS];
+}
+
 struct k_obj_type *z_obj_type_init(struct k_obj_type *type,
 				   uint32_t id, size_t off)
 {
 	sys_slist_init(&type->list);
 	sys_slist_append(&z_obj_type_list, &type->node);
 	type->id = id;
+	type->gen = 0;
 	type->obj_core_offset = off;
 
 	return type;
@@ -33,11 +54,12 @@ void k_obj_core_init(struct k_obj_core *obj_core, struct k_obj_type *type)
 
 void k_obj_core_link(struct k_obj_core *obj_core)
 {
-	k_spinlock_key_t  key = k_spin_lock(&lock);
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
+	k_spinlock_key_t  key = k_spin_lock(lck);
 
 	sys_slist_append(&obj_core->type->list, &obj_core->node);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 }
 
 void k_obj_core_init_and_link(struct k_obj_core *obj_core,
@@ -49,11 +71,16 @@ void k_obj_core_init_and_link(struct k_obj_core *obj_core,
 
 void k_obj_core_unlink(struct k_obj_core *obj_core)
 {
-	k_spinlock_key_t  key = k_spin_lock(&lock);
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
+	k_spinlock_key_t  key = k_spin_lock(lck);
 
 	sys_slist_find_and_remove(&obj_core->type->list, &obj_core->node);
 
-	k_spin_unlock(&lock, key);
+	/* Invalidate any incremental walks in progress on this type */
+
+	obj_core->type->gen++;
+
+	k_spin_unlock(lck, key);
 }
 
 struct k_obj_type *k_obj_type_find(uint32_t type_id)
@@ -81,12 +108,13 @@ int k_obj_type_walk_locked(struct k_obj_type *type,
 			   int (*func)(struct k_obj_core *, void *),
 			   void *data)
 {
+	struct k_spinlock *lck = obj_type_lock(type);
 	k_spinlock_key_t  key;
 	struct k_obj_core *obj_core;
 	sys_snode_t *node;
 	int  status = 0;
 
-	key = k_spin_lock(&lock);
+	key = k_spin_lock(lck);
 
 	SYS_SLIST_FOR_EACH_NODE(&type->list, node) {
 		obj_core = CONTAINER_OF(node, struct k_obj_core, node);
@@ -96,7 +124,7 @@ int k_obj_type_walk_locked(struct k_obj_type *type,
 		}
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return status;
 }
@@ -121,12 +149,64 @@ int k_obj_type_walk_unlocked(struct k_obj_type *type,
 	return status;
 }
 
+void k_obj_type_walk_begin(struct k_obj_type *type,
+			   struct k_obj_type_walk_token *token)
+{
+	struct k_spinlock *lck = obj_type_lock(type);
+	k_spinlock_key_t  key = k_spin_lock(lck);
+
+	token->type = type;
+	token->gen = type->gen;
+	token->next = sys_slist_peek_head(&type->list);
+
+	k_spin_unlock(lck, key);
+}
+
+int k_obj_type_walk_next(struct k_obj_type_walk_token *token,
+			 int (*func)(struct k_obj_core *, void *),
+			 void *data, size_t limit)
+{
+	struct k_spinlock *lck = obj_type_lock(token->type);
+	k_spinlock_key_t  key;
+	struct k_obj_core *obj_core;
+	int  status = 0;
+
+	key = k_spin_lock(lck);
+
+	if (token->gen != token->type->gen) {
+		/* An object was unlinked; <next> can not be trusted */
+		k_spin_unlock(lck, key);
+		return -EAGAIN;
+	}
+
+	while (token->next != NULL) {
+		if (limit == 0) {
+			status = 1;
+			break;
+		}
+
+		obj_core = CONTAINER_OF(token->next, struct k_obj_core, node);
+		token->next = sys_slist_peek_next(&obj_core->node);
+		limit--;
+
+		status = func(obj_core, data);
+		if (status != 0) {
+			break;
+		}
+	}
+
+	k_spin_unlock(lck, key);
+
+	return status;
+}
+
 #ifdef CONFIG_OBJ_CORE_STATS
 int k_obj_core_stats_register(struct k_obj_core *obj_core, void *stats,
 			      size_t stats_len)
 {
 	int rv;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	if (obj_core->type->stats_desc == NULL) {
 		/* Object type not configured for statistics. */
@@ -139,7 +219,7 @@ int k_obj_core_stats_register(struct k_obj_core *obj_core, void *stats,
 		rv = 0;
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -147,7 +227,8 @@ int k_obj_core_stats_register(struct k_obj_core *obj_core, void *stats,
 int k_obj_core_stats_deregister(struct k_obj_core *obj_core)
 {
 	int rv;
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	if (obj_core->type->stats_desc == NULL) {
 		/* Object type not configured  for statistics. */
@@ -157,7 +238,7 @@ int k_obj_core_stats_deregister(struct k_obj_core *obj_core)
 		rv = 0;
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -167,8 +248,9 @@ int k_obj_core_stats_raw(struct k_obj_core *obj_core, void *stats,
 {
 	int rv;
 	struct k_obj_core_stats_desc *desc;
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	desc = obj_core->type->stats_desc;
 	if ((desc == NULL) || (desc->raw == NULL)) {
@@ -184,7 +266,7 @@ int k_obj_core_stats_raw(struct k_obj_core *obj_core, void *stats,
 		rv = desc->raw(obj_core, stats);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -194,8 +276,9 @@ int k_obj_core_stats_query(struct k_obj_core *obj_core, void *stats,
 {
 	int rv;
 	struct k_obj_core_stats_desc *desc;
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	desc = obj_core->type->stats_desc;
 	if ((desc == NULL) || (desc->query == NULL)) {
@@ -211,7 +294,7 @@ int k_obj_core_stats_query(struct k_obj_core *obj_core, void *stats,
 		rv = desc->query(obj_core, stats);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -220,8 +303,9 @@ int k_obj_core_stats_reset(struct k_obj_core *obj_core)
 {
 	int rv;
 	struct k_obj_core_stats_desc *desc;
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
 
-	k_spinlock_key_t  key = k_spin_lock(&lock);
+	k_spinlock_key_t  key = k_spin_lock(lck);
 
 	desc = obj_core->type->stats_desc;
 	if ((desc == NULL) || (desc->reset == NULL)) {
@@ -234,7 +318,7 @@ int k_obj_core_stats_reset(struct k_obj_core *obj_core)
 		rv = desc->reset(obj_core);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -243,8 +327,9 @@ int k_obj_core_stats_disable(struct k_obj_core *obj_core)
 {
 	int rv;
 	struct k_obj_core_stats_desc *desc;
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	desc = obj_core->type->stats_desc;
 	if ((desc == NULL) || (desc->disable == NULL)) {
@@ -257,7 +342,7 @@ int k_obj_core_stats_disable(struct k_obj_core *obj_core)
 		rv = desc->disable(obj_core);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
@@ -266,8 +351,9 @@ int k_obj_core_stats_enable(struct k_obj_core *obj_core)
 {
 	int rv;
 	struct k_obj_core_stats_desc *desc;
+	struct k_spinlock *lck = obj_type_lock(obj_core->type);
 
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(lck);
 
 	desc = obj_core->type->stats_desc;
 	if ((desc == NULL) || (desc->enable == NULL)) {
@@ -280,7 +366,7 @@ int k_obj_core_stats_enable(struct k_obj_core *obj_core)
 		rv = desc->enable(obj_core);
 	}
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(lck, key);
 
 	return rv;
 }
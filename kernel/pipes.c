@@ -44,6 +44,10 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
 	pipe->lock = (struct k_spinlock){};
+#ifdef CONFIG_PIPE_CLAIM
+	pipe->write_claim_len = 0U;
+	pipe->read_claim_len = 0U;
+#endif /* CONFIG_PIPE_CLAIM */
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
 	SYS_PORT_TRACING_OBJ_INIT(k_pipe, pipe);
@@ -810,6 +814,235 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 #include <zephyr/syscalls/k_pipe_write_avail_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_PIPE_CLAIM
+
+/**
+ * @brief Copy buffered data directly to pended readers' buffers
+ *
+ * @return true if a reschedule is needed
+ */
+static bool pipe_drain_to_waiters(struct k_pipe *pipe)
+{
+	sys_dlist_t        dest_list;
+	struct _pipe_desc *dest;
+	bool               resched = false;
+
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_waiter_list_populate(&dest_list, &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+	while ((dest != NULL) && (pipe->bytes_used > 0U)) {
+		size_t run = MIN(pipe->bytes_used,
+				 pipe->size - pipe->read_index);
+
+		run = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
+				&pipe->buffer[pipe->read_index], run);
+
+		dest->buffer        += run;
+		dest->bytes_to_xfer -= run;
+
+		pipe->bytes_used -= run;
+		pipe->read_index += run;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index -= pipe->size;
+		}
+
+		if (dest->bytes_to_xfer == 0U) {
+
+			/* The thread's read request has been satisfied. */
+
+			z_unpend_thread(dest->thread);
+			z_ready_thread(dest->thread);
+
+			resched = true;
+
+			dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+		}
+	}
+
+	return resched;
+}
+
+/**
+ * @brief Refill the pipe buffer from pended writers
+ *
+ * @return true if a reschedule is needed
+ */
+static bool pipe_refill_from_waiters(struct k_pipe *pipe)
+{
+	struct _pipe_desc  pipe_desc[2];
+	sys_dlist_t        src_list;
+	sys_dlist_t        pipe_list;
+	bool               resched = false;
+
+	if (pipe->bytes_used == pipe->size) {
+		return false;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list, &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, &resched);
+
+	return resched;
+}
+
+int k_pipe_write_claim(struct k_pipe *pipe, void **data, size_t *size)
+{
+	size_t run;
+
+	CHECKIF((pipe->buffer == NULL) || (pipe->size == 0U) ||
+		(data == NULL) || (size == NULL)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	if ((pipe->flags & K_PIPE_FLAG_WRITE_CLAIM) != 0U) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EBUSY;
+	}
+
+	if (pipe->bytes_used == pipe->size) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EAGAIN;
+	}
+
+	/* Contiguous free run starting at the write index */
+
+	if (pipe->write_index >= pipe->read_index) {
+		run = pipe->size - pipe->write_index;
+	} else {
+		run = pipe->read_index - pipe->write_index;
+	}
+
+	pipe->flags |= K_PIPE_FLAG_WRITE_CLAIM;
+	pipe->write_claim_len = run;
+
+	*data = &pipe->buffer[pipe->write_index];
+	*size = run;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return 0;
+}
+
+int k_pipe_write_finish(struct k_pipe *pipe, size_t bytes_written)
+{
+	bool resched;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(((pipe->flags & K_PIPE_FLAG_WRITE_CLAIM) == 0U) ||
+		(bytes_written > pipe->write_claim_len)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->flags &= ~K_PIPE_FLAG_WRITE_CLAIM;
+	pipe->write_claim_len = 0U;
+
+	pipe->bytes_used += bytes_written;
+	pipe->write_index += bytes_written;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	resched = pipe_drain_to_waiters(pipe);
+
+	if ((pipe->bytes_used != 0U) && (bytes_written != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	if (resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+int k_pipe_read_claim(struct k_pipe *pipe, void **data, size_t *size)
+{
+	size_t run;
+
+	CHECKIF((pipe->buffer == NULL) || (pipe->size == 0U) ||
+		(data == NULL) || (size == NULL)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	if ((pipe->flags & K_PIPE_FLAG_READ_CLAIM) != 0U) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EBUSY;
+	}
+
+	if (pipe->bytes_used == 0U) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EAGAIN;
+	}
+
+	/* Contiguous data run starting at the read index */
+
+	run = MIN(pipe->bytes_used, pipe->size - pipe->read_index);
+
+	pipe->flags |= K_PIPE_FLAG_READ_CLAIM;
+	pipe->read_claim_len = run;
+
+	*data = &pipe->buffer[pipe->read_index];
+	*size = run;
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return 0;
+}
+
+int k_pipe_read_finish(struct k_pipe *pipe, size_t bytes_read)
+{
+	bool resched;
+
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF(((pipe->flags & K_PIPE_FLAG_READ_CLAIM) == 0U) ||
+		(bytes_read > pipe->read_claim_len)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	pipe->flags &= ~K_PIPE_FLAG_READ_CLAIM;
+	pipe->read_claim_len = 0U;
+
+	pipe->bytes_used -= bytes_read;
+	pipe->read_index += bytes_read;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	resched = pipe_refill_from_waiters(pipe);
+
+	if (resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_PIPE_CLAIM */
+
 #ifdef CONFIG_OBJ_CORE_PIPE
 static int init_pipe_obj_core_list(void)
 {
@@ -352,6 +352,103 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events,
 	return swap_rc;
 }
 
+#ifdef CONFIG_POLL_SET
+
+static _wait_q_t poll_set_wait_q = Z_WAIT_Q_INIT(&poll_set_wait_q);
+
+void k_poll_set_init(struct k_poll_set *pset, struct k_poll_event *events,
+		     int num_events)
+{
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events >= 0, "<0 events\n");
+
+	pset->events = events;
+	pset->num_events = num_events;
+	pset->poller = NULL;
+}
+
+int k_poll_set_wait(struct k_poll_set *pset, k_timeout_t timeout)
+{
+	struct z_poller *poller = &_current->poller;
+	k_spinlock_key_t key;
+	bool ready = false;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT((pset->poller == NULL) || (pset->poller == poller),
+		 "poll set waited on by another thread\n");
+
+	poller->is_polling = true;
+	poller->mode = MODE_POLL;
+	pset->poller = poller;
+
+	/* Arm events that are not currently registered.  Events that
+	 * stayed armed from a previous call are skipped, so the
+	 * steady-state cost is proportional to the number of events
+	 * that actually triggered (their registration is consumed by
+	 * the signaling side).
+	 */
+	for (int ii = 0; ii < pset->num_events; ii++) {
+		struct k_poll_event *event = &pset->events[ii];
+		uint32_t state;
+
+		key = k_spin_lock(&lock);
+		if (event->state != K_POLL_STATE_NOT_READY) {
+			ready = true;
+			poller->is_polling = false;
+		} else if (event->poller == NULL) {
+			if (is_condition_met(event, &state)) {
+				set_event_ready(event, state);
+				ready = true;
+				poller->is_polling = false;
+			} else {
+				register_event(event, poller);
+			}
+		} else {
+			/* Still armed from a previous call. */
+			;
+		}
+		k_spin_unlock(&lock, key);
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (ready || !poller->is_polling) {
+		poller->is_polling = false;
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	poller->is_polling = false;
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+		return -EAGAIN;
+	}
+
+	/* Registrations deliberately stay armed on the way out,
+	 * whether we were signaled or timed out.
+	 */
+	return z_pend_curr(&lock, key, &poll_set_wait_q, timeout);
+}
+
+void k_poll_set_disarm(struct k_poll_set *pset)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (int ii = 0; ii < pset->num_events; ii++) {
+		if (pset->events[ii].poller != NULL) {
+			clear_event_registration(&pset->events[ii]);
+		}
+		k_spin_unlock(&lock, key);
+		key = k_spin_lock(&lock);
+	}
+
+	pset->poller = NULL;
+	k_spin_unlock(&lock, key);
+}
+
+#endif /* CONFIG_POLL_SET */
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_poll(struct k_poll_event *events,
 				int num_events, k_timeout_t timeout)
@@ -63,6 +63,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	atomic_ptr_set(&queue->stage, NULL);
+	atomic_set(&queue->sleepers, 0);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
 
 	SYS_PORT_TRACING_OBJ_INIT(k_queue, queue);
 
@@ -84,6 +88,62 @@ static void prepare_thread_to_run(struct k_thread *thread, void *data)
 	z_ready_thread(thread);
 }
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+/* Sleeper accounting for the lock-free append path: every thread that
+ * pends on the queue advertises itself first, and whoever unpends a
+ * thread retracts the advertisement.  Producers consult the count
+ * after pushing to decide whether the locked wakeup path is needed.
+ */
+static inline void queue_sleeper_add(struct k_queue *queue)
+{
+	atomic_inc(&queue->sleepers);
+}
+
+static inline void queue_sleeper_remove(struct k_queue *queue)
+{
+	atomic_dec(&queue->sleepers);
+}
+
+/* Fold the staging stack into the queue proper.  Must be called with
+ * the queue lock held.  Push order is LIFO, so the chain is reversed
+ * to restore FIFO order before being appended.
+ */
+static void queue_mpsc_drain(struct k_queue *queue)
+{
+	sys_sfnode_t *node = atomic_ptr_set(&queue->stage, NULL);
+	sys_sfnode_t *head = NULL;
+	sys_sfnode_t *tail = node;
+
+	if (node == NULL) {
+		return;
+	}
+
+	while (node != NULL) {
+		sys_sfnode_t *next = (sys_sfnode_t *)node->next_and_flags;
+
+		node->next_and_flags = (uintptr_t)head;
+		head = node;
+		node = next;
+	}
+
+	sys_sflist_append_list(&queue->data_q, head, tail);
+}
+#else
+#define queue_sleeper_add(queue)      do { } while (false)
+#define queue_sleeper_remove(queue)   do { } while (false)
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
+static struct k_thread *queue_unpend_first(struct k_queue *queue)
+{
+	struct k_thread *thread = z_unpend_first_thread(&queue->wait_q);
+
+	if (thread != NULL) {
+		queue_sleeper_remove(queue);
+	}
+
+	return thread;
+}
+
 static inline void handle_poll_events(struct k_queue *queue, uint32_t state)
 {
 #ifdef CONFIG_POLL
@@ -101,7 +161,7 @@ void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *first_pending_thread;
 
-	first_pending_thread = z_unpend_first_thread(&queue->wait_q);
+	first_pending_thread = queue_unpend_first(queue);
 
 	if (first_pending_thread != NULL) {
 		prepare_thread_to_run(first_pending_thread, NULL);
@@ -131,7 +191,7 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
-	first_pending_thread = z_unpend_first_thread(&queue->wait_q);
+	first_pending_thread = queue_unpend_first(queue);
 
 	if (unlikely(first_pending_thread != NULL)) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
@@ -193,6 +253,51 @@ void k_queue_append(struct k_queue *queue, void *data)
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
 }
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+void k_queue_append_mpsc(struct k_queue *queue, void *data)
+{
+	sys_sfnode_t *node = data;
+	void *head;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, append, queue);
+
+	do {
+		head = atomic_ptr_get(&queue->stage);
+		node->next_and_flags = (uintptr_t)head;
+	} while (!atomic_ptr_cas(&queue->stage, head, data));
+
+	/* The push above and the sleeper advertisement in k_queue_get()
+	 * are both sequentially consistent, so either this producer sees
+	 * the sleeper or the consumer's re-drain sees the item; the
+	 * wakeup cannot be lost.
+	 */
+	if (atomic_get(&queue->sleepers) > 0) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		queue_mpsc_drain(queue);
+		if (!sys_sflist_is_empty(&queue->data_q)) {
+			struct k_thread *thread = queue_unpend_first(queue);
+
+			if (thread != NULL) {
+				sys_sfnode_t *first =
+					sys_sflist_get_not_empty(&queue->data_q);
+
+				prepare_thread_to_run(thread,
+						      z_queue_node_peek(first, true));
+				z_reschedule(&queue->lock, key);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
+
+				return;
+			}
+		}
+		k_spin_unlock(&queue->lock, key);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, append, queue);
+}
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 void k_queue_prepend(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, prepend, queue);
@@ -259,13 +364,13 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	struct k_thread *thread = NULL;
 
 	if (head != NULL) {
-		thread = z_unpend_first_thread(&queue->wait_q);
+		thread = queue_unpend_first(queue);
 	}
 
 	while ((head != NULL) && (thread != NULL)) {
 		prepare_thread_to_run(thread, head);
 		head = *(void **)head;
-		thread = z_unpend_first_thread(&queue->wait_q);
+		thread = queue_unpend_first(queue);
 	}
 
 	if (head != NULL) {
@@ -321,6 +426,10 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	queue_mpsc_drain(queue);
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -343,8 +452,41 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 		return NULL;
 	}
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	/* Advertise ourselves before the final staging check, so that a
+	 * concurrent producer either observes the sleeper count or we
+	 * observe its item here.
+	 */
+	queue_sleeper_add(queue);
+	queue_mpsc_drain(queue);
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node;
+
+		queue_sleeper_remove(queue);
+		node = sys_sflist_get_not_empty(&queue->data_q);
+		data = z_queue_node_peek(node, true);
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, data);
+
+		return data;
+	}
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+	if (ret != 0) {
+		/* Nobody unpended us, so the advertisement is still
+		 * outstanding and must be retracted here.
+		 */
+		key = k_spin_lock(&queue->lock);
+		queue_sleeper_remove(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
 		(ret != 0) ? NULL : _current->base.swap_data);
 
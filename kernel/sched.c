@@ -100,6 +100,20 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	 */
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
+	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	/* Queue on the CPU the thread last ran on, falling back to the
+	 * first CPU allowed by the mask.  base.cpu and cpu_mask cannot
+	 * change while the thread is queued, so removal recomputes the
+	 * same queue (stealing CPUs update base.cpu only after dequeue).
+	 */
+	int cpu = thread->base.cpu;
+	uint32_t m = thread->base.cpu_mask;
+
+	if ((m & BIT(cpu)) == 0U) {
+		cpu = (m == 0U) ? 0 : u32_count_trailing_zeros(m);
+	}
+
 	return &_kernel.cpus[cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
@@ -109,7 +123,7 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
@@ -132,7 +146,30 @@ static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
-	return _priq_run_best(curr_cpu_runq());
+	struct k_thread *thread = _priq_run_best(curr_cpu_runq());
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Nothing runnable locally: steal the best eligible thread
+	 * from a sibling CPU's queue.  The mask-aware best function
+	 * already skips threads that cannot run on this CPU.
+	 */
+	if (thread == NULL) {
+		int id = _current_cpu->id;
+		unsigned int num_cpus = arch_num_cpus();
+
+		for (unsigned int i = 1; i < num_cpus; i++) {
+			struct k_thread *t = _priq_run_best(
+				&_kernel.cpus[(id + i) % num_cpus].ready_q.runq);
+
+			if ((t != NULL) &&
+			    ((thread == NULL) || (z_sched_prio_cmp(t, thread) > 0))) {
+				thread = t;
+			}
+		}
+	}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
+	return thread;
 }
 
 /* _current is never in the run queue until context switch on
@@ -370,6 +407,13 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+bool z_is_thread_active_elsewhere(struct k_thread *thread)
+{
+	return thread_active_elsewhere(thread) != NULL;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -385,6 +429,10 @@ static void ready_thread(struct k_thread *thread)
 		queue_thread(thread);
 		update_cache(0);
 
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+		z_time_slice_thread_ready(thread);
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
+
 		flag_ipi(ipi_mask_create(thread));
 	}
 }
@@ -617,7 +665,7 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 		bool killed = (thread->base.thread_state &
 				(_THREAD_DEAD | _THREAD_ABORTING));
 
-#ifdef CONFIG_EVENTS
+#if defined(CONFIG_EVENTS) || defined(CONFIG_KHEAP_SELECTIVE_WAKEUP)
 		bool do_nothing = thread->no_wake_on_timeout && is_timeout;
 
 		thread->no_wake_on_timeout = false;
@@ -625,7 +673,7 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout)
 		if (do_nothing) {
 			continue;
 		}
-#endif /* CONFIG_EVENTS */
+#endif /* CONFIG_EVENTS || CONFIG_KHEAP_SELECTIVE_WAKEUP */
 
 		if (!killed) {
 			/* The thread is not being killed */
@@ -696,6 +744,26 @@ void z_unpend_thread(struct k_thread *thread)
 	(void)z_abort_thread_timeout(thread);
 }
 
+/* Move the highest priority thread pended on wait_q to pend on requeue_q
+ * without waking it. An armed wait timeout stays in place and fires
+ * against the new queue.
+ */
+struct k_thread *z_requeue_first_thread(_wait_q_t *wait_q, _wait_q_t *requeue_q)
+{
+	struct k_thread *thread = NULL;
+
+	K_SPINLOCK(&_sched_spinlock) {
+		thread = _priq_wait_best(&wait_q->waitq);
+
+		if (thread != NULL) {
+			unpend_thread_no_timeout(thread);
+			add_to_waitq_locked(thread, requeue_q);
+		}
+	}
+
+	return thread;
+}
+
 /* Priority set utility that does no rescheduling, it just changes the
  * run queue state, returning true if a reschedule is needed later.
  */
@@ -973,7 +1041,7 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
@@ -1533,6 +1601,30 @@ int z_sched_waitq_walk(_wait_q_t  *wait_q,
 	int  status = 0;
 
 	K_SPINLOCK(&_sched_spinlock) {
+#ifdef CONFIG_WAITQ_PER_OBJECT
+		/*
+		 * Invoke the callback function on each waiting thread
+		 * for as long as there are both waiting threads AND
+		 * it returns 0, dispatching on the per-object backend.
+		 */
+		if (wait_q->scalable) {
+			RB_FOR_EACH_CONTAINER(&wait_q->waitq.tree.tree, thread,
+					      base.qnode_rb) {
+				status = func(thread, data);
+				if (status != 0) {
+					break;
+				}
+			}
+		} else {
+			SYS_DLIST_FOR_EACH_CONTAINER(&wait_q->waitq.dlist, thread,
+						     base.qnode_dlist) {
+				status = func(thread, data);
+				if (status != 0) {
+					break;
+				}
+			}
+		}
+#else
 		_WAIT_Q_FOR_EACH(wait_q, thread) {
 
 			/*
@@ -1546,11 +1638,23 @@ int z_sched_waitq_walk(_wait_q_t  *wait_q,
 				break;
 			}
 		}
+#endif /* CONFIG_WAITQ_PER_OBJECT */
 	}
 
 	return status;
 }
 
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+/* Requires _sched_spinlock be held.  True when another ready thread
+ * shares the base priority of @p thread, i.e. round-robin could apply
+ * and the slice timer actually needs arming.
+ */
+bool z_sched_timeslice_peer_ready(struct k_thread *thread)
+{
+	return _priq_run_same_prio_peer(thread_runq(thread), thread);
+}
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
+
 /* This routine exists for benchmarking purposes. It is not used in
  * general production code.
  */
@@ -72,6 +72,19 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 	return 0;
 }
 
+#ifdef CONFIG_WAITQ_PER_OBJECT
+/* Kernel mode only: re-initializes the wait queue, so the semaphore
+ * must have no waiters (typically call right after k_sem_init()).
+ */
+void k_sem_waitq_scalable_set(struct k_sem *sem)
+{
+	__ASSERT(z_waitq_head(&sem->wait_q) == NULL,
+		 "wait queue in use");
+
+	z_waitq_init_scalable(&sem->wait_q);
+}
+#endif /* CONFIG_WAITQ_PER_OBJECT */
+
 #ifdef CONFIG_USERSPACE
 int z_vrfy_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
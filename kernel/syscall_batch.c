@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/syscall_batch.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_batch_entry *entries, size_t count)
+{
+	ARG_UNUSED(entries);
+	ARG_UNUSED(count);
+
+	/* From supervisor mode there is no privilege transition to
+	 * amortize; call the kernel APIs directly instead.
+	 */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_batch_entry *entries,
+					 size_t count)
+{
+	if (count > K_SYSCALL_BATCH_MAX) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct k_syscall_batch_entry entry;
+
+		/* Work on a kernel copy so the ID and arguments cannot be
+		 * swapped from another user thread after validation.
+		 */
+		K_OOPS(k_usermode_from_copy(&entry, &entries[i],
+					    sizeof(entry)));
+
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id < K_SYSCALL_LIMIT,
+					    "invalid syscall id %lu",
+					    (unsigned long)entry.id));
+		K_OOPS(K_SYSCALL_VERIFY_MSG(entry.id != K_SYSCALL_K_SYSCALL_BATCH,
+					    "batch may not nest"));
+
+		/* Dispatch through the regular table so every entry gets
+		 * the same argument verification as a direct system call.
+		 */
+		entry.ret = _k_syscall_table[entry.id](entry.args[0],
+						       entry.args[1],
+						       entry.args[2],
+						       entry.args[3],
+						       entry.args[4],
+						       entry.args[5],
+						       _current->syscall_frame);
+
+		K_OOPS(k_usermode_to_copy(&entries[i].ret, &entry.ret,
+					  sizeof(entry.ret)));
+	}
+
+	return 0;
+}
+#include <zephyr/syscalls/k_syscall_batch_mrsh.c>
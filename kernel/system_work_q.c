@@ -13,6 +13,42 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
+#include <zephyr/sys/printk.h>
+
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_stacks, CONFIG_MP_MAX_NUM_CPUS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+
+struct k_work_q k_sys_work_qs[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Storage for the queue thread names; k_thread_name_set() keeps the
+ * pointer rather than copying.
+ */
+static char sys_work_q_names[CONFIG_MP_MAX_NUM_CPUS][sizeof("sysworkqXX")];
+
+static int k_sys_work_q_init(void)
+{
+	for (int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		struct k_work_queue_config cfg = {
+			.name = sys_work_q_names[cpu],
+			.no_yield = IS_ENABLED(CONFIG_SYSTEM_WORKQUEUE_NO_YIELD),
+			.essential = true,
+			.cpu_mask = BIT(cpu),
+		};
+
+		snprintk(sys_work_q_names[cpu], sizeof(sys_work_q_names[cpu]),
+			 "sysworkq%d", cpu);
+
+		k_work_queue_start(&k_sys_work_qs[cpu],
+				   sys_work_q_stacks[cpu],
+				   K_KERNEL_STACK_SIZEOF(sys_work_q_stacks[cpu]),
+				   CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+	}
+	return 0;
+}
+
+#else /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
 
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
@@ -34,4 +70,6 @@ static int k_sys_work_q_init(void)
 	return 0;
 }
 
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
+
 SYS_INIT(k_sys_work_q_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
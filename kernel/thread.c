@@ -507,6 +507,10 @@ static char *setup_thread_stack(struct k_thread *new_thread,
 	new_thread->stack_info.start = (uintptr_t)stack_buf_start;
 	new_thread->stack_info.size = stack_buf_size;
 	new_thread->stack_info.delta = delta;
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	/* No low point known yet, the first query does a full scan */
+	new_thread->stack_info.unused_low = SIZE_MAX;
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
 #endif /* CONFIG_THREAD_STACK_INFO */
 	stack_ptr -= delta;
 
@@ -591,9 +595,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	/* Initialize custom data field (value is opaque to kernel) */
 	new_thread->custom_data = NULL;
 #endif /* CONFIG_THREAD_CUSTOM_DATA */
-#ifdef CONFIG_EVENTS
+#if defined(CONFIG_EVENTS) || defined(CONFIG_KHEAP_SELECTIVE_WAKEUP)
 	new_thread->no_wake_on_timeout = false;
-#endif /* CONFIG_EVENTS */
+#endif /* CONFIG_EVENTS || CONFIG_KHEAP_SELECTIVE_WAKEUP */
 #ifdef CONFIG_THREAD_MONITOR
 	new_thread->entry.pEntry = entry;
 	new_thread->entry.parameter1 = p1;
@@ -866,17 +870,76 @@ int z_stack_space_get(const uint8_t *stack_start, size_t size, size_t *unused_pt
 	return 0;
 }
 
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+/*
+ * Resume the scan below the last known low point. Bytes above it are
+ * known to have been used and stay so for the life of the thread, so
+ * only the region the stack may have newly grown into needs to be
+ * walked, from the low point down to the first byte still holding the
+ * fill pattern. In the steady state this touches a handful of bytes
+ * instead of the whole unused region.
+ */
+static int stack_space_get_below(const struct k_thread *thread, size_t low,
+				 size_t *unused_ptr)
+{
+	const uint8_t *checked_stack = (const uint8_t *)thread->stack_info.start;
+	size_t size = thread->stack_info.size;
+	/* Same shallow stack pointer bound as in z_stack_space_get() */
+	const uint8_t *stack_pointer = (const uint8_t *)&thread;
+
+	if ((stack_pointer > checked_stack) && (stack_pointer <= (checked_stack + size)) &&
+	    IS_ENABLED(CONFIG_NO_UNUSED_STACK_INSPECTION)) {
+		return -ENOTSUP;
+	}
+
+	if (IS_ENABLED(CONFIG_STACK_SENTINEL)) {
+		/* Match the sentinel offset applied by z_stack_space_get() */
+		checked_stack += 4;
+	}
+
+	while ((low > 0) && (checked_stack[low - 1] != 0xaaU)) {
+		low--;
+	}
+
+	*unused_ptr = low;
+
+	return 0;
+}
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
 int z_impl_k_thread_stack_space_get(const struct k_thread *thread,
 				    size_t *unused_ptr)
 {
+	int ret;
+
 #ifdef CONFIG_THREAD_STACK_MEM_MAPPED
 	if (thread->stack_info.mapped.addr == NULL) {
 		return -EINVAL;
 	}
 #endif /* CONFIG_THREAD_STACK_MEM_MAPPED */
 
-	return z_stack_space_get((const uint8_t *)thread->stack_info.start,
-				 thread->stack_info.size, unused_ptr);
+#ifdef CONFIG_THREAD_STACK_WATERMARK
+	size_t low = thread->stack_info.unused_low;
+
+	if (low <= thread->stack_info.size) {
+		ret = stack_space_get_below(thread, low, unused_ptr);
+	} else {
+		ret = z_stack_space_get((const uint8_t *)thread->stack_info.start,
+					thread->stack_info.size, unused_ptr);
+	}
+
+	if (ret == 0) {
+		/* The watermark is a cached scan result, updating it does
+		 * not modify observable thread state.
+		 */
+		((struct k_thread *)thread)->stack_info.unused_low = *unused_ptr;
+	}
+#else
+	ret = z_stack_space_get((const uint8_t *)thread->stack_info.start,
+				thread->stack_info.size, unused_ptr);
+#endif /* CONFIG_THREAD_STACK_WATERMARK */
+
+	return ret;
 }
 
 #ifdef CONFIG_USERSPACE
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/time_page.h>
+
+/* The page is shared by every memory domain, so it must not be
+ * writable from user mode: a single user-mode store could corrupt the
+ * timestamps observed by all domains, or wedge readers by leaving the
+ * sequence counter odd. This requires the architecture to express
+ * kernel-RW/user-RO partition attributes.
+ */
+#ifndef K_MEM_PARTITION_P_RW_U_RO
+#error "CONFIG_USERSPACE_TIME_PAGE requires kernel-RW/user-RO memory partition support"
+#endif
+
+/* Expansion of K_APPMEM_PARTITION_DEFINE(), except that the partition
+ * attribute makes the partition read-only to user mode.
+ */
+extern char Z_APP_START(z_time_page_partition)[];
+extern char Z_APP_SIZE(z_time_page_partition)[];
+struct k_mem_partition z_time_page_partition = {
+	.start = (uintptr_t) &Z_APP_START(z_time_page_partition)[0],
+	.size = (size_t) &Z_APP_SIZE(z_time_page_partition)[0],
+	.attr = K_MEM_PARTITION_P_RW_U_RO
+};
+extern char Z_APP_BSS_START(z_time_page_partition)[];
+extern char Z_APP_BSS_SIZE(z_time_page_partition)[];
+Z_GENERIC_SECTION(.app_regions.z_time_page_partition)
+const struct z_app_region z_time_page_partition_region = {
+	.bss_start = &Z_APP_BSS_START(z_time_page_partition)[0],
+	.bss_size = (size_t) &Z_APP_BSS_SIZE(z_time_page_partition)[0]
+};
+Z_APPMEM_PLACEHOLDER(z_time_page_partition);
+
+K_APP_DMEM(z_time_page_partition) struct sys_time_page z_sys_time_page;
+
+/* Called from sys_clock_announce() with the timeout lock held, which
+ * serializes writers; readers synchronize through the sequence counter.
+ */
+void z_time_page_update(uint64_t uptime_ticks)
+{
+	struct sys_time_page *tp = &z_sys_time_page;
+
+	tp->seq++;
+	barrier_dmem_fence_full();
+
+	tp->uptime_ticks = uptime_ticks;
+	tp->cycles = (uint64_t)k_cycle_get_32();
+
+	barrier_dmem_fence_full();
+	tp->seq++;
+}
+
+static int time_page_init(void)
+{
+	z_sys_time_page.ticks_per_sec = CONFIG_SYS_CLOCK_TICKS_PER_SEC;
+	z_sys_time_page.cycles_per_sec = sys_clock_hw_cycles_per_sec();
+	z_time_page_update(0);
+
+	return 0;
+}
+
+SYS_INIT(time_page_init, PRE_KERNEL_2, 0);
@@ -11,10 +11,16 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+#include <zephyr/sys/time_page.h>
+#endif
 
 static uint64_t curr_tick;
 
+#if !defined(CONFIG_TIMEOUT_WHEEL) && !defined(CONFIG_TIMEOUT_PER_CPU)
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif
 
 static struct k_spinlock timeout_lock;
 
@@ -36,6 +42,226 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+/* Hashed hierarchical timer wheel.  Each level has WHEEL_SLOTS slots;
+ * level N slots are WHEEL_SLOTS^N ticks wide.  A timeout lives in the
+ * lowest level whose span covers its remaining delta, hashed by its
+ * absolute expiry tick, so insert and cancel are O(1).  When the clock
+ * crosses a level boundary the matching higher-level slot is
+ * "cascaded": its entries are re-hashed into lower levels.  Entries too
+ * far out for the top level park in its furthest slot and re-cascade.
+ *
+ * In this mode the dticks field of struct _timeout holds the absolute
+ * expiry tick (truncated to the field width; deltas are recovered by
+ * wrap-safe subtraction) rather than a delta from the previous node.
+ *
+ * The per-level occupancy bitmaps are conservative: bits are set on
+ * insert but only cleared when a slot is fired or cascaded, so a
+ * cancelled timeout can leave a stale bit behind.  Stale bits cost at
+ * worst a spurious wakeup that sweeps them; they never delay an expiry.
+ */
+#define WHEEL_SHIFT  6
+#define WHEEL_SLOTS  BIT(WHEEL_SHIFT)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS 4
+
+static struct {
+	sys_dlist_t slots[WHEEL_SLOTS];
+	uint64_t occupied;
+} wheel[WHEEL_LEVELS];
+
+static bool wheel_ready;
+
+/* Earliest tick the timer hardware is known to be programmed for */
+static uint64_t programmed_tick = UINT64_MAX;
+
+static void wheel_init(void)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		for (int i = 0; i < WHEEL_SLOTS; i++) {
+			sys_dlist_init(&wheel[l].slots[i]);
+		}
+	}
+	wheel_ready = true;
+}
+
+static int64_t wheel_delta(const struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	return t->dticks - (int64_t)curr_tick;
+#else
+	return (int32_t)(t->dticks - (int32_t)curr_tick);
+#endif
+}
+
+static void wheel_insert(struct _timeout *t)
+{
+	int64_t delta = wheel_delta(t);
+	uint64_t gran = 1U;
+	int level = 0;
+
+	if (unlikely(!wheel_ready)) {
+		wheel_init();
+	}
+
+	while ((level < (WHEEL_LEVELS - 1)) &&
+	       (delta >= (int64_t)(gran << WHEEL_SHIFT))) {
+		gran <<= WHEEL_SHIFT;
+		level++;
+	}
+
+	/* Clamp beyond-horizon entries into the top rotation */
+	delta = MIN(delta, (int64_t)((gran << WHEEL_SHIFT) - 1));
+
+	uint64_t slot = ((curr_tick + delta) / gran) & WHEEL_MASK;
+
+	sys_dlist_append(&wheel[level].slots[slot], &t->node);
+	wheel[level].occupied |= BIT64(slot);
+}
+
+static void wheel_remove(struct _timeout *t)
+{
+	/* The occupancy bit is left as-is (see note above) */
+	sys_dlist_remove(&t->node);
+}
+
+static bool wheel_empty(void)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		if (wheel[l].occupied != 0U) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* Ticks from curr_tick to the next slot that needs attention (expiry or
+ * cascade), or a negative value if no timeouts are pending.
+ */
+static int64_t wheel_next_slot(void)
+{
+	int64_t best = -1;
+	uint64_t gran = 1U;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++, gran <<= WHEEL_SHIFT) {
+		uint64_t occ = wheel[level].occupied;
+
+		if (occ == 0U) {
+			continue;
+		}
+
+		uint32_t pos = (curr_tick / gran) & WHEEL_MASK;
+		uint64_t rot = (pos == 0U) ? occ :
+			((occ >> pos) | (occ << (WHEEL_SLOTS - pos)));
+		uint32_t d = u64_count_trailing_zeros(rot);
+		int64_t dist;
+
+		if (d == 0U) {
+			/* Current slot: already swept, so this is a
+			 * stale bit from a cancel.  Sweep it again no
+			 * later than one slot (level 0: one rotation)
+			 * from now.
+			 */
+			dist = (level == 0) ? (int64_t)WHEEL_SLOTS : (int64_t)gran;
+		} else {
+			/* Wake at the slot boundary so cascading can
+			 * refine the expiry; for level 0 the slot
+			 * distance is exact.
+			 */
+			dist = (int64_t)(d * gran) - (int64_t)(curr_tick & (gran - 1U));
+		}
+
+		if ((best < 0) || (dist < best)) {
+			best = dist;
+		}
+	}
+
+	return best;
+}
+#elif defined(CONFIG_TIMEOUT_PER_CPU)
+/* Per-CPU timeout queues.  Each CPU keeps its own expiry-ordered list
+ * under its own lock; a timeout is queued on the CPU that armed it and
+ * its handler runs from that CPU's timer interrupt, so per-core
+ * periodic timers never touch another core's cache lines and timeout
+ * expiry no longer funnels through a single announcing CPU.
+ *
+ * In this mode the dticks field of struct _timeout holds the absolute
+ * expiry tick (truncated to the field width, as with the wheel
+ * backend) rather than a delta from the previous node, which keeps the
+ * queues independent of the globally-accounted tick announcements.
+ *
+ * The backend relies on the system timer driver having a per-CPU
+ * comparator: sys_clock_set_timeout() must program the comparator of
+ * the calling CPU and sys_clock_announce() must run on the CPU whose
+ * comparator fired (the ARM architected timer behaves this way).
+ */
+struct timeout_cpu_q {
+	sys_dlist_t list;
+	struct k_spinlock lock;
+	/* Earliest tick this CPU's comparator is known to be set for */
+	uint64_t programmed;
+};
+
+static struct timeout_cpu_q timeout_cpu_q[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Wrap-safe signed distance from "now" to the timeout's expiry tick */
+static int64_t cpu_q_delta(const struct _timeout *t, uint64_t now)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	return t->dticks - (int64_t)now;
+#else
+	return (int32_t)(t->dticks - (int32_t)now);
+#endif
+}
+
+/* Lock and return the current CPU's queue.  The caller may migrate
+ * between reading the CPU index and acquiring the lock; once the lock
+ * is held interrupts are masked and the CPU is pinned, so re-check and
+ * retry if that happened.
+ */
+static struct timeout_cpu_q *cpu_q_claim(k_spinlock_key_t *key)
+{
+	struct timeout_cpu_q *q;
+
+	while (true) {
+		q = &timeout_cpu_q[_current_cpu->id];
+		*key = k_spin_lock(&q->lock);
+		if (q == &timeout_cpu_q[_current_cpu->id]) {
+			break;
+		}
+		k_spin_unlock(&q->lock, *key);
+	}
+
+	/* Queues live in zeroed memory; initialize on first use */
+	if (unlikely(q->list.head == NULL)) {
+		sys_dlist_init(&q->list);
+		q->programmed = UINT64_MAX;
+	}
+
+	return q;
+}
+
+/* Ticks from "now" until the queue's next expiry, in the form
+ * sys_clock_set_timeout() expects.  Requires the queue lock.
+ */
+static int32_t cpu_q_next_timeout(struct timeout_cpu_q *q, uint64_t now)
+{
+	sys_dnode_t *n = sys_dlist_peek_head(&q->list);
+	int64_t delta;
+
+	if (n == NULL) {
+		return MAX_WAIT;
+	}
+
+	delta = cpu_q_delta(CONTAINER_OF(n, struct _timeout, node), now);
+	if (delta > (int64_t)INT_MAX) {
+		return MAX_WAIT;
+	}
+
+	return MAX(0, (int32_t)delta);
+}
+#else /* CONFIG_TIMEOUT_WHEEL */
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -58,6 +284,7 @@ static void remove_timeout(struct _timeout *t)
 
 	sys_dlist_remove(&t->node);
 }
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
 static int32_t elapsed(void)
 {
@@ -80,8 +307,22 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+#ifndef CONFIG_TIMEOUT_PER_CPU
 static int32_t next_timeout(void)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	int64_t dist = wheel_next_slot();
+	int32_t ticks_elapsed = elapsed();
+	int32_t ret;
+
+	if ((dist < 0) || ((dist - ticks_elapsed) > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, (int32_t)dist - ticks_elapsed);
+	}
+
+	return ret;
+#else
 	struct _timeout *to = first();
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
@@ -94,7 +335,9 @@ static int32_t next_timeout(void)
 	}
 
 	return ret;
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
+#endif /* !CONFIG_TIMEOUT_PER_CPU */
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
@@ -110,7 +353,70 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	/* Read the clock before taking the queue lock: sys_clock_tick_get()
+	 * takes timeout_lock internally and the two locks must never nest.
+	 */
+	uint64_t now = sys_clock_tick_get();
+	struct timeout_cpu_q *q;
+	k_spinlock_key_t key;
+	uint64_t expiry;
+	sys_dnode_t *n;
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+	    (Z_TICK_ABS(timeout.ticks) >= 0)) {
+		expiry = MAX(now + 1, (uint64_t)Z_TICK_ABS(timeout.ticks));
+	} else {
+		expiry = now + timeout.ticks + 1;
+	}
+
+	q = cpu_q_claim(&key);
+
+	to->cpu = (uint8_t)(q - timeout_cpu_q);
+	to->dticks = (k_ticks_t)expiry;
+
+	for (n = sys_dlist_peek_head(&q->list); n != NULL;
+	     n = sys_dlist_peek_next(&q->list, n)) {
+		struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+		if (cpu_q_delta(t, now) > (int64_t)(expiry - now)) {
+			sys_dlist_insert(n, &to->node);
+			break;
+		}
+	}
+
+	if (n == NULL) {
+		sys_dlist_append(&q->list, &to->node);
+	}
+
+	if (expiry < q->programmed) {
+		q->programmed = expiry;
+		sys_clock_set_timeout(cpu_q_next_timeout(q, now), false);
+	}
+
+	k_spin_unlock(&q->lock, key);
+#else
 	K_SPINLOCK(&timeout_lock) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+		k_ticks_t delta;
+
+		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
+			delta = MAX(1, Z_TICK_ABS(timeout.ticks) - curr_tick);
+		} else {
+			delta = timeout.ticks + 1 + elapsed();
+		}
+
+		uint64_t expiry = curr_tick + delta;
+
+		to->dticks = (k_ticks_t)expiry;
+		wheel_insert(to);
+
+		if ((announce_remaining == 0) && (expiry < programmed_tick)) {
+			programmed_tick = expiry;
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+#else
 		struct _timeout *t;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
@@ -138,19 +444,49 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		if (to == first() && announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
+#endif /* CONFIG_TIMEOUT_WHEEL */
 	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
 int z_abort_timeout(struct _timeout *to)
 {
 	int ret = -EINVAL;
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	struct timeout_cpu_q *q;
+	k_spinlock_key_t key;
+
+	/* The queue index can be rewritten by a concurrent re-arm from
+	 * another CPU; re-check it under the queue lock.
+	 */
+	while (true) {
+		q = &timeout_cpu_q[to->cpu];
+		key = k_spin_lock(&q->lock);
+		if (q == &timeout_cpu_q[to->cpu]) {
+			break;
+		}
+		k_spin_unlock(&q->lock, key);
+	}
+
+	if (sys_dnode_is_linked(&to->node)) {
+		sys_dlist_remove(&to->node);
+		ret = 0;
+	}
+
+	k_spin_unlock(&q->lock, key);
+#else
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
+#ifdef CONFIG_TIMEOUT_WHEEL
+			wheel_remove(to);
+#else
 			remove_timeout(to);
+#endif
 			ret = 0;
 		}
 	}
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 
 	return ret;
 }
@@ -158,6 +494,11 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	return (k_ticks_t)wheel_delta(timeout);
+#elif defined(CONFIG_TIMEOUT_PER_CPU)
+	return (k_ticks_t)cpu_q_delta(timeout, curr_tick);
+#else
 	k_ticks_t ticks = 0;
 
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
@@ -168,6 +509,7 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 	}
 
 	return ticks;
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -199,14 +541,81 @@ k_ticks_t z_timeout_expires(const struct _timeout *timeout)
 
 int32_t z_get_next_timeout_expiry(void)
 {
+#ifdef CONFIG_TIMEOUT_PER_CPU
+	uint64_t now = sys_clock_tick_get();
+	k_spinlock_key_t key;
+	struct timeout_cpu_q *q = cpu_q_claim(&key);
+	int32_t ret = cpu_q_next_timeout(q, now);
+
+	k_spin_unlock(&q->lock, key);
+
+	return ret;
+#else
 	int32_t ret = (int32_t) K_TICKS_FOREVER;
 
 	K_SPINLOCK(&timeout_lock) {
 		ret = next_timeout();
 	}
 	return ret;
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 }
 
+#ifdef CONFIG_TIMEOUT_PER_CPU
+void sys_clock_announce(int32_t ticks)
+{
+	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	uint64_t now;
+
+	/* Tick accounting stays global: every announcing CPU reports
+	 * the ticks elapsed since the previous announcement by any CPU,
+	 * so concurrent announcements simply sum under the lock.  Only
+	 * the announcing CPU's own queue is expired below, without the
+	 * global lock held.
+	 */
+	curr_tick += ticks;
+	now = curr_tick;
+
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+	z_time_page_update(curr_tick);
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
+
+	k_spin_unlock(&timeout_lock, key);
+
+	struct timeout_cpu_q *q = cpu_q_claim(&key);
+	sys_dnode_t *n;
+
+	while ((n = sys_dlist_peek_head(&q->list)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+		if (cpu_q_delta(t, now) > 0) {
+			break;
+		}
+
+		sys_dlist_remove(&t->node);
+
+		k_spin_unlock(&q->lock, key);
+		t->fn(t);
+		key = k_spin_lock(&q->lock);
+	}
+
+	/* A handler may have re-armed its timeout and reprogrammed the
+	 * comparator meanwhile; recompute from the actual queue head.
+	 */
+	if (n != NULL) {
+		q->programmed = now + (uint64_t)cpu_q_delta(
+			CONTAINER_OF(n, struct _timeout, node), now);
+	} else {
+		q->programmed = UINT64_MAX;
+	}
+	sys_clock_set_timeout(cpu_q_next_timeout(q, now), false);
+
+	k_spin_unlock(&q->lock, key);
+
+#ifdef CONFIG_TIMESLICING
+	z_time_slice();
+#endif /* CONFIG_TIMESLICING */
+}
+#else /* CONFIG_TIMEOUT_PER_CPU */
 void sys_clock_announce(int32_t ticks)
 {
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
@@ -225,6 +634,117 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+	if (unlikely(!wheel_ready)) {
+		wheel_init();
+	}
+
+	while (announce_remaining > 0) {
+		if (wheel_empty()) {
+			/* Nothing pending: consume the rest in one step */
+			curr_tick += announce_remaining;
+			announce_remaining = 0;
+			break;
+		}
+
+		curr_tick++;
+
+		/* Cascade each level whose slot boundary we just
+		 * crossed, re-hashing its entries into lower levels.
+		 */
+		uint64_t gran = WHEEL_SLOTS;
+
+		for (int level = 1; level < WHEEL_LEVELS; level++, gran <<= WHEEL_SHIFT) {
+			if ((curr_tick & (gran - 1U)) != 0U) {
+				break;
+			}
+
+			uint64_t slot = (curr_tick / gran) & WHEEL_MASK;
+			sys_dnode_t *n;
+
+			wheel[level].occupied &= ~BIT64(slot);
+			while ((n = sys_dlist_get(&wheel[level].slots[slot])) != NULL) {
+				wheel_insert(CONTAINER_OF(n, struct _timeout, node));
+			}
+		}
+
+		/* Fire everything hashed to this tick's level-0 slot */
+		uint64_t slot = curr_tick & WHEEL_MASK;
+		sys_dnode_t *n;
+
+		wheel[0].occupied &= ~BIT64(slot);
+		while ((n = sys_dlist_get(&wheel[0].slots[slot])) != NULL) {
+			struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		/* Decremented only after this tick's handlers have run
+		 * so that elapsed() reads as 0 for reschedules made
+		 * from within them, as with the list backend.
+		 */
+		announce_remaining--;
+	}
+
+	announce_remaining = 0;
+
+	programmed_tick = UINT64_MAX;
+	sys_clock_set_timeout(next_timeout(), false);
+#elif defined(CONFIG_TIMEOUT_ANNOUNCE_BATCH)
+	struct _timeout *t;
+
+	for (t = first();
+	     (t != NULL) && (t->dticks <= announce_remaining);
+	     t = first()) {
+		int dt = t->dticks;
+
+		curr_tick += dt;
+
+		/* Dequeue the run of timeouts expiring on this tick in
+		 * one critical section, collected into a local array.
+		 * The entries must not carry any chaining state of
+		 * their own: the moment the lock is dropped, a handler
+		 * or another CPU may re-arm a dequeued entry, which
+		 * rewrites its node links.  Fully unlinked entries
+		 * also keep abort-after-expiry failing with -EINVAL
+		 * exactly as it does with per-entry dequeue.
+		 */
+		do {
+			struct _timeout *batch[8];
+			int count = 0;
+
+			do {
+				t->dticks = 0;
+				remove_timeout(t);
+				batch[count++] = t;
+				t = first();
+			} while ((t != NULL) && (t->dticks == 0) &&
+				 (count < (int)ARRAY_SIZE(batch)));
+
+			k_spin_unlock(&timeout_lock, key);
+
+			for (int i = 0; i < count; i++) {
+				batch[i]->fn(batch[i]);
+			}
+
+			key = k_spin_lock(&timeout_lock);
+			t = first();
+		} while ((t != NULL) && (t->dticks == 0));
+
+		announce_remaining -= dt;
+	}
+
+	if (t != NULL) {
+		t->dticks -= announce_remaining;
+	}
+
+	curr_tick += announce_remaining;
+	announce_remaining = 0;
+
+	sys_clock_set_timeout(next_timeout(), false);
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -250,6 +770,11 @@ void sys_clock_announce(int32_t ticks)
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(), false);
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
+#ifdef CONFIG_USERSPACE_TIME_PAGE
+	z_time_page_update(curr_tick);
+#endif /* CONFIG_USERSPACE_TIME_PAGE */
 
 	k_spin_unlock(&timeout_lock, key);
 
@@ -257,6 +782,7 @@ void sys_clock_announce(int32_t ticks)
 	z_time_slice();
 #endif /* CONFIG_TIMESLICING */
 }
+#endif /* CONFIG_TIMEOUT_PER_CPU */
 
 int64_t sys_clock_tick_get(void)
 {
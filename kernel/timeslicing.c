@@ -72,11 +72,44 @@ void z_reset_time_slice(struct k_thread *thread)
 	z_abort_timeout(&slice_timeouts[cpu]);
 	slice_expired[cpu] = false;
 	if (thread_is_sliceable(thread)) {
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+		/* No ready peer at this priority: nothing to slice
+		 * against, so skip the timer reprogram.  The timer is
+		 * armed on demand when a peer becomes ready.
+		 */
+		if (!z_sched_timeslice_peer_ready(thread)) {
+			return;
+		}
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
 		z_add_timeout(&slice_timeouts[cpu], slice_timeout,
 			      K_TICKS(slice_time(thread) - 1));
 	}
 }
 
+#ifdef CONFIG_TIMESLICE_LAZY_ARM
+/* Called under the scheduler lock when a thread is made ready: if it is
+ * a round-robin peer of a running thread whose slice timer is lazily
+ * unarmed, arm that timer now.
+ */
+void z_time_slice_thread_ready(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if ((curr != NULL) &&
+		    !sys_dnode_is_linked(&slice_timeouts[i].node) &&
+		    (curr->base.prio == thread->base.prio) &&
+		    thread_is_sliceable(curr)) {
+			slice_expired[i] = false;
+			z_add_timeout(&slice_timeouts[i], slice_timeout,
+				      K_TICKS(slice_time(curr) - 1));
+		}
+	}
+}
+#endif /* CONFIG_TIMESLICE_LAZY_ARM */
+
 void k_sched_time_slice_set(int32_t slice, int prio)
 {
 	K_SPINLOCK(&_sched_spinlock) {
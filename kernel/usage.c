@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,6 +72,35 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+/*
+ * Attribute every buffered switch-out sample in a CPU's ring to its
+ * thread (and CPU) usage counters. Must be called with usage_lock held,
+ * and only for the caller's own CPU: remote rings are appended to by
+ * their owners without synchronization.
+ */
+static void sched_usage_flush(struct _cpu *cpu)
+{
+	for (uint16_t i = 0; i < cpu->usage_ring_count; i++) {
+		struct k_thread *thread = cpu->usage_ring[i].thread;
+		uint32_t cycles = cpu->usage_ring[i].cycles;
+
+		if (thread->base.usage.track_usage) {
+			sched_thread_update_usage(thread, cycles);
+		}
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+		if (cpu->usage->track_usage &&
+		    (thread != cpu->idle_thread)) {
+			cpu->usage->total += cycles;
+		}
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+	}
+
+	cpu->usage_ring_count = 0;
+}
+#endif /* CONFIG_SCHED_THREAD_USAGE_DEFERRED */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
@@ -96,6 +126,42 @@ void z_sched_usage_start(struct k_thread *thread)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+void z_sched_usage_stop(void)
+{
+	struct _cpu *cpu = _current_cpu;
+
+	uint32_t u0 = cpu->usage0;
+
+	if (u0 != 0) {
+		/*
+		 * This runs on the context switch path, so a plain store
+		 * into our own CPU's ring needs no synchronization; the
+		 * sample is attributed later under usage_lock.
+		 */
+		cpu->usage_ring[cpu->usage_ring_count].thread = cpu->current;
+		cpu->usage_ring[cpu->usage_ring_count].cycles =
+			usage_now() - u0;
+		cpu->usage_ring_count++;
+
+		/*
+		 * An exiting thread's samples must be attributed before
+		 * its thread object can be reused, hence the extra flush
+		 * on its final switch-out.
+		 */
+		if ((cpu->usage_ring_count ==
+		     CONFIG_SCHED_THREAD_USAGE_DEFERRED_RING_SIZE) ||
+		    z_is_thread_state_set(cpu->current, _THREAD_DEAD)) {
+			k_spinlock_key_t k = k_spin_lock(&usage_lock);
+
+			sched_usage_flush(cpu);
+			k_spin_unlock(&usage_lock, k);
+		}
+	}
+
+	cpu->usage0 = 0;
+}
+#else
 void z_sched_usage_stop(void)
 {
 	k_spinlock_key_t k   = k_spin_lock(&usage_lock);
@@ -117,6 +183,7 @@ void z_sched_usage_stop(void)
 	cpu->usage0 = 0;
 	k_spin_unlock(&usage_lock, k);
 }
+#endif /* CONFIG_SCHED_THREAD_USAGE_DEFERRED */
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
@@ -127,6 +194,9 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	key = k_spin_lock(&usage_lock);
 	cpu = _current_cpu;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+	sched_usage_flush(cpu);
+#endif /* CONFIG_SCHED_THREAD_USAGE_DEFERRED */
 
 	if (&_kernel.cpus[cpu_id] == cpu) {
 		uint32_t  now = usage_now();
@@ -179,6 +249,9 @@ void z_sched_thread_usage(struct k_thread *thread,
 	key = k_spin_lock(&usage_lock);
 	cpu = _current_cpu;
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+	sched_usage_flush(cpu);
+#endif /* CONFIG_SCHED_THREAD_USAGE_DEFERRED */
 
 	if (thread == cpu->current) {
 		uint32_t now = usage_now();
@@ -327,6 +400,10 @@ void k_sys_runtime_stats_disable(void)
 		return;
 	}
 
+#ifdef CONFIG_SCHED_THREAD_USAGE_DEFERRED
+	sched_usage_flush(_current_cpu);
+#endif /* CONFIG_SCHED_THREAD_USAGE_DEFERRED */
+
 	uint32_t now = usage_now();
 
 	unsigned int num_cpus = arch_num_cpus();
@@ -483,3 +560,50 @@ int z_kernel_stats_query(struct k_obj_core *obj_core, void *stats)
 	return k_thread_runtime_stats_all_get(stats);
 }
 #endif /* CONFIG_OBJ_CORE_STATS_SYSTEM */
+
+#ifdef CONFIG_SCHED_CYCLE_STATS
+void z_sched_cycle_swap_start(void)
+{
+	/* As with usage0, a single write to our own CPU's record needs
+	 * no synchronization.
+	 */
+	_current_cpu->swap_start = usage_now();
+}
+
+void z_sched_cycle_swap_end(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&usage_lock);
+
+	struct _cpu *cpu = _current_cpu;
+	struct k_sched_cycle_stats *stats = &cpu->swap_stats;
+
+	uint32_t cycles = usage_now() - cpu->swap_start;
+	uint32_t bin = 31U - (uint32_t)u32_count_leading_zeros(cycles | 1U);
+
+	bin = MIN(bin, K_SCHED_CYCLE_STATS_BINS - 1U);
+
+	stats->total += cycles;
+	stats->count++;
+	if (stats->longest < cycles) {
+		stats->longest = cycles;
+	}
+	stats->hist[bin]++;
+
+	k_spin_unlock(&usage_lock, key);
+}
+
+int k_sched_stats_get(int cpu, struct k_sched_cycle_stats *stats)
+{
+	CHECKIF((cpu < 0) || (cpu >= CONFIG_MP_MAX_NUM_CPUS) ||
+		(stats == NULL)) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&usage_lock);
+
+	*stats = _kernel.cpus[cpu].swap_stats;
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_CYCLE_STATS */
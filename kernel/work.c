@@ -422,12 +422,34 @@ int k_work_submit(struct k_work *work)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit, work);
 
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+	/* Queue locally; racing with a CPU migration just means the
+	 * item lands on the queue of the CPU we were on.
+	 */
+	int ret = k_work_submit_to_queue(&k_sys_work_qs[arch_curr_cpu()->id], work);
+#else
 	int ret = k_work_submit_to_queue(&k_sys_work_q, work);
+#endif
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, submit, work, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_SYSTEM_WORKQUEUE_PER_CPU
+int k_work_submit_to_cpu(struct k_work *work, int cpu)
+{
+	__ASSERT_NO_MSG((cpu >= 0) && (cpu < arch_num_cpus()));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit, work);
+
+	int ret = k_work_submit_to_queue(&k_sys_work_qs[cpu], work);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, submit, work, ret);
 
 	return ret;
 }
+#endif /* CONFIG_SYSTEM_WORKQUEUE_PER_CPU */
 
 /* Flush the work item if necessary.
  *
@@ -765,6 +787,17 @@ void k_work_queue_start(struct k_work_q *queue,
 		queue->thread.base.user_options |= K_ESSENTIAL;
 	}
 
+#ifdef CONFIG_SCHED_CPU_MASK
+	if ((cfg != NULL) && (cfg->cpu_mask != 0U)) {
+		(void)k_thread_cpu_mask_clear(&queue->thread);
+		for (int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+			if ((cfg->cpu_mask & BIT(cpu)) != 0U) {
+				(void)k_thread_cpu_mask_enable(&queue->thread, cpu);
+			}
+		}
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
 	k_thread_start(&queue->thread);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
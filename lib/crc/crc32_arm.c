@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* IEEE CRC32 using the Armv8 CRC32 extension (CRC32B/H/W/X instructions).
+ * The instructions implement the reflected 0xedb88320 polynomial directly,
+ * reducing the cost to roughly one cycle per eight input bytes.
+ *
+ * The target attribute enables the CRC extension for these functions only,
+ * so the rest of the image is unaffected by the extra ISA requirement.
+ */
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <arm_acle.h>
+
+#define CRC32_TARGET __attribute__((target("+crc")))
+
+CRC32_TARGET uint32_t crc32_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	crc = ~crc;
+
+	while (len >= 8) {
+		crc = __crc32d(crc, sys_get_le64(data));
+		data += 8;
+		len -= 8;
+	}
+
+	if (len >= 4) {
+		crc = __crc32w(crc, sys_get_le32(data));
+		data += 4;
+		len -= 4;
+	}
+
+	if (len >= 2) {
+		crc = __crc32h(crc, sys_get_le16(data));
+		data += 2;
+		len -= 2;
+	}
+
+	if (len) {
+		crc = __crc32b(crc, *data);
+	}
+
+	return ~crc;
+}
+
+uint32_t crc32_ieee(const uint8_t *data, size_t len)
+{
+	return crc32_ieee_update(0x0, data, len);
+}
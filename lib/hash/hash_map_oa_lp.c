@@ -34,13 +34,12 @@ BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, n_buckets) ==
 BUILD_ASSERT(offsetof(struct sys_hashmap_oa_lp_data, size) ==
 	     offsetof(struct sys_hashmap_data, size));
 
-static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
-						 bool used_ok, bool unused_ok, bool tombstone_ok)
+static struct oalp_entry *oalp_find_in(const struct sys_hashmap *map, struct oalp_entry *buckets,
+				       size_t n_buckets, uint64_t key, bool used_ok, bool unused_ok,
+				       bool tombstone_ok)
 {
 	struct oalp_entry *entry = NULL;
-	const size_t n_buckets = map->data->n_buckets;
 	uint32_t hash = map->hash_func(&key, sizeof(key));
-	struct oalp_entry *const buckets = map->data->buckets;
 
 	for (size_t i = 0, j = hash; i < n_buckets; ++i, ++j) {
 		j &= (n_buckets - 1);
@@ -73,6 +72,13 @@ static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map,
 	return NULL;
 }
 
+static struct oalp_entry *sys_hashmap_oa_lp_find(const struct sys_hashmap *map, uint64_t key,
+						 bool used_ok, bool unused_ok, bool tombstone_ok)
+{
+	return oalp_find_in(map, (struct oalp_entry *)map->data->buckets, map->data->n_buckets, key,
+			    used_ok, unused_ok, tombstone_ok);
+}
+
 static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t key, uint64_t value,
 					      uint64_t *old_value)
 {
@@ -110,23 +116,69 @@ static int sys_hashmap_oa_lp_insert_no_rehash(struct sys_hashmap *map, uint64_t
 	return ret;
 }
 
-static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+/*
+ * Move a single entry from the table being drained into the current table.
+ *
+ * The entry is already accounted for in @a size, so compensate for the
+ * increment performed by sys_hashmap_oa_lp_insert_no_rehash().
+ */
+static void oalp_migrate_entry(struct sys_hashmap *map, struct oalp_entry *entry)
+{
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	--data->size;
+	(void)sys_hashmap_oa_lp_insert_no_rehash(map, entry->key, entry->value, NULL);
+	entry->state = TOMBSTONE;
+	--data->old_size;
+}
+
+/*
+ * Migrate up to @a batch buckets from the old table into the current one,
+ * freeing the old table once it has been fully drained.
+ */
+static void sys_hashmap_oa_lp_migrate(struct sys_hashmap *map, size_t batch)
+{
+	struct oalp_entry *entry;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *const old_buckets = (struct oalp_entry *)data->old_buckets;
+
+	if (old_buckets == NULL) {
+		return;
+	}
+
+	for (; batch > 0 && data->migrate_pos < data->old_n_buckets && data->old_size > 0;
+	     --batch, ++data->migrate_pos) {
+		entry = &old_buckets[data->migrate_pos];
+
+		if (entry->state == USED) {
+			oalp_migrate_entry(map, entry);
+		}
+	}
+
+	if (data->migrate_pos == data->old_n_buckets || data->old_size == 0) {
+		map->alloc_func(old_buckets, 0);
+		data->old_buckets = NULL;
+		data->old_n_buckets = 0;
+		data->old_size = 0;
+		data->migrate_pos = 0;
+	}
+}
+#endif /* CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH */
+
+static int sys_hashmap_oa_lp_rehash_to(struct sys_hashmap *map, size_t new_n_buckets)
 {
 	size_t old_size;
 	size_t old_n_buckets;
-	size_t new_n_buckets = 0;
 	struct oalp_entry *entry;
 	struct oalp_entry *old_buckets;
 	struct oalp_entry *new_buckets;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
-	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
-		return 0;
-	}
-
-	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
-		return -ENOSPC;
-	}
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	/* only one table may be draining at a time - finish any pending migration */
+	sys_hashmap_oa_lp_migrate(map, SIZE_MAX);
+#endif
 
 	/* extract all entries from the hashmap */
 	old_size = data->size;
@@ -143,11 +195,24 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 		memset(new_buckets, 0, new_n_buckets * sizeof(*new_buckets));
 	}
 
-	data->size = 0;
 	data->buckets = new_buckets;
 	data->n_buckets = new_n_buckets;
+	data->n_tombstones = 0;
+
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	if (old_size > 0 && new_buckets != NULL) {
+		/* drain the old table a few buckets at a time */
+		data->old_buckets = old_buckets;
+		data->old_n_buckets = old_n_buckets;
+		data->old_size = old_size;
+		data->migrate_pos = 0;
+		sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_OA_LP_MIGRATE_BATCH);
+		return 0;
+	}
+#endif
 
 	/* re-insert all entries into the hashmap */
+	data->size = 0;
 	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
 		entry = &old_buckets[i];
 
@@ -163,6 +228,22 @@ static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
 	return 0;
 }
 
+static int sys_hashmap_oa_lp_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t new_n_buckets = 0;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	if (!sys_hashmap_should_rehash(map, grow, data->n_tombstones, &new_n_buckets)) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	return sys_hashmap_oa_lp_rehash_to(map, new_n_buckets);
+}
+
 static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 {
 	size_t i;
@@ -173,6 +254,35 @@ static void sys_hashmap_oa_lp_iter_next(struct sys_hashmap_iterator *it)
 	__ASSERT(it->size == map->data->size, "Concurrent modification!");
 	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+	struct oalp_entry *old_buckets = (struct oalp_entry *)data->old_buckets;
+
+	/* visit the table still being drained first */
+	if (it->pos == 0 && old_buckets != NULL) {
+		it->state = old_buckets;
+	}
+
+	if (old_buckets != NULL && (uintptr_t)it->state >= (uintptr_t)old_buckets &&
+	    (uintptr_t)it->state < (uintptr_t)&old_buckets[data->old_n_buckets]) {
+		for (i = (struct oalp_entry *)it->state - old_buckets; i < data->old_n_buckets;
+		     ++i) {
+			entry = &old_buckets[i];
+			if (entry->state == USED) {
+				it->state = (i + 1 == data->old_n_buckets) ? buckets
+									   : &old_buckets[i + 1];
+				it->key = entry->key;
+				it->value = entry->value;
+				++it->pos;
+				return;
+			}
+		}
+
+		/* old table exhausted - continue in the current table */
+		it->state = buckets;
+	}
+#endif /* CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH */
+
 	if (it->pos == 0) {
 		it->state = buckets;
 	}
@@ -209,11 +319,12 @@ static void sys_hashmap_oa_lp_iter(const struct sys_hashmap *map, struct sys_has
 static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
 				    void *cookie)
 {
+	size_t j = 0;
 	struct oalp_entry *entry;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 	struct oalp_entry *buckets = data->buckets;
 
-	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+	for (size_t i = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
 		entry = &buckets[i];
 		if (entry->state == USED) {
 			cb(entry->key, entry->value, cookie);
@@ -221,6 +332,27 @@ static void sys_hashmap_oa_lp_clear(struct sys_hashmap *map, sys_hashmap_callbac
 		}
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	buckets = (struct oalp_entry *)data->old_buckets;
+
+	for (size_t i = 0; cb != NULL && i < data->old_n_buckets && j < data->size; ++i) {
+		entry = &buckets[i];
+		if (entry->state == USED) {
+			cb(entry->key, entry->value, cookie);
+			++j;
+		}
+	}
+
+	if (data->old_buckets != NULL) {
+		map->alloc_func(data->old_buckets, 0);
+		data->old_buckets = NULL;
+	}
+
+	data->old_n_buckets = 0;
+	data->old_size = 0;
+	data->migrate_pos = 0;
+#endif
+
 	if (data->buckets != NULL) {
 		map->alloc_func(data->buckets, 0);
 		data->buckets = NULL;
@@ -241,6 +373,23 @@ static inline int sys_hashmap_oa_lp_insert(struct sys_hashmap *map, uint64_t key
 		return ret;
 	}
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	if (data->old_buckets != NULL) {
+		struct oalp_entry *entry =
+			oalp_find_in(map, (struct oalp_entry *)data->old_buckets,
+				     data->old_n_buckets, key, true, true, false);
+
+		/* pull a duplicate key out of the old table before inserting */
+		if (entry != NULL && entry->state == USED) {
+			oalp_migrate_entry(map, entry);
+		}
+
+		sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_OA_LP_MIGRATE_BATCH);
+	}
+#endif
+
 	return sys_hashmap_oa_lp_insert_no_rehash(map, key, value, old_value);
 }
 
@@ -249,8 +398,31 @@ static bool sys_hashmap_oa_lp_remove(struct sys_hashmap *map, uint64_t key, uint
 	struct oalp_entry *entry;
 	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
 
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	sys_hashmap_oa_lp_migrate(map, CONFIG_SYS_HASH_MAP_OA_LP_MIGRATE_BATCH);
+#endif
+
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
 	if (entry == NULL || entry->state == UNUSED) {
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+		entry = oalp_find_in(map, (struct oalp_entry *)data->old_buckets,
+				     data->old_n_buckets, key, true, true, false);
+		if (entry != NULL && entry->state == USED) {
+			if (value != NULL) {
+				*value = entry->value;
+			}
+
+			/* old-table tombstones are dropped with the table itself */
+			entry->state = TOMBSTONE;
+			--data->size;
+			--data->old_size;
+
+			/* ignore a possible -ENOMEM since the table will remain intact */
+			(void)sys_hashmap_oa_lp_rehash(map, false);
+
+			return true;
+		}
+#endif
 		return false;
 	}
 
@@ -273,6 +445,14 @@ static bool sys_hashmap_oa_lp_get(const struct sys_hashmap *map, uint64_t key, u
 	struct oalp_entry *entry;
 
 	entry = sys_hashmap_oa_lp_find(map, key, true, true, false);
+#ifdef CONFIG_SYS_HASH_MAP_OA_LP_INCREMENTAL_REHASH
+	if (entry == NULL || entry->state == UNUSED) {
+		struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+		entry = oalp_find_in(map, (struct oalp_entry *)data->old_buckets,
+				     data->old_n_buckets, key, true, true, false);
+	}
+#endif
 	if (entry == NULL || entry->state == UNUSED) {
 		return false;
 	}
@@ -284,10 +464,35 @@ static bool sys_hashmap_oa_lp_get(const struct sys_hashmap *map, uint64_t key, u
 	return true;
 }
 
+static int sys_hashmap_oa_lp_reserve(struct sys_hashmap *map, size_t n)
+{
+	size_t new_n_buckets;
+	struct sys_hashmap_oa_lp_data *data = (struct sys_hashmap_oa_lp_data *)map->data;
+
+	if (n == 0) {
+		return 0;
+	}
+
+	if (map->config->max_size != SIZE_MAX && n > map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	/* maximum size imposed by the implementation */
+	__ASSERT_NO_MSG(n < SIZE_MAX / 100);
+
+	new_n_buckets = NHPOT(DIV_ROUND_UP(n * 100, map->config->load_factor));
+	if (new_n_buckets <= data->n_buckets) {
+		return 0;
+	}
+
+	return sys_hashmap_oa_lp_rehash_to(map, new_n_buckets);
+}
+
 const struct sys_hashmap_api sys_hashmap_oa_lp_api = {
 	.iter = sys_hashmap_oa_lp_iter,
 	.clear = sys_hashmap_oa_lp_clear,
 	.insert = sys_hashmap_oa_lp_insert,
 	.remove = sys_hashmap_oa_lp_remove,
 	.get = sys_hashmap_oa_lp_get,
+	.reserve = sys_hashmap_oa_lp_reserve,
 };
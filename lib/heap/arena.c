@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <errno.h>
+#include <zephyr/sys/sys_arena.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/sys/__assert.h>
+
+void sys_arena_init(struct sys_arena *arena, void *mem, size_t bytes)
+{
+	arena->base = mem;
+	arena->size = bytes;
+	arena->offset = 0;
+	arena->backing = NULL;
+}
+
+int sys_arena_init_heap(struct sys_arena *arena, struct sys_heap *heap,
+			size_t bytes)
+{
+	void *mem = sys_heap_alloc(heap, bytes);
+
+	if (mem == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_arena_init(arena, mem, bytes);
+	arena->backing = heap;
+
+	return 0;
+}
+
+void *sys_arena_aligned_alloc(struct sys_arena *arena, size_t align,
+			      size_t bytes)
+{
+	__ASSERT((align & (align - 1)) == 0, "align must be a power of 2");
+
+	uintptr_t addr = (uintptr_t)&arena->base[arena->offset];
+	size_t pad = ROUND_UP(addr, align) - addr;
+
+	if ((bytes == 0U) ||
+	    (bytes + pad < bytes) ||
+	    (bytes + pad > arena->size - arena->offset)) {
+		return NULL;
+	}
+
+	arena->offset += pad;
+
+	void *ret = &arena->base[arena->offset];
+
+	arena->offset += bytes;
+
+	return ret;
+}
+
+void *sys_arena_alloc(struct sys_arena *arena, size_t bytes)
+{
+	return sys_arena_aligned_alloc(arena, sizeof(void *), bytes);
+}
+
+void sys_arena_reset(struct sys_arena *arena)
+{
+	arena->offset = 0;
+}
+
+void sys_arena_release(struct sys_arena *arena)
+{
+	sys_arena_reset(arena);
+
+	if (arena->backing != NULL) {
+		sys_heap_free(arena->backing, arena->base);
+		arena->base = NULL;
+		arena->size = 0;
+		arena->backing = NULL;
+	}
+}
+
+size_t sys_arena_room(struct sys_arena *arena)
+{
+	uintptr_t addr = (uintptr_t)&arena->base[arena->offset];
+	size_t pad = ROUND_UP(addr, sizeof(void *)) - addr;
+	size_t left = arena->size - arena->offset;
+
+	return (left > pad) ? (left - pad) : 0;
+}
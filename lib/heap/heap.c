@@ -148,6 +148,82 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+/*
+ * Exact-size bins of recently freed small chunks, indexed by chunk size
+ * in CHUNK_UNITs.  Cached chunks keep their "used" flag so neighbors
+ * never merge with them (deferred coalescing), and the FREE_NEXT field
+ * is reused to link each bin's LIFO.  A hit on either side therefore
+ * costs O(1) with no bucket scan and no header rewrites beyond the
+ * cache link itself.
+ */
+static bool small_cache_push(struct z_heap *h, chunkid_t c)
+{
+	chunksz_t sz = chunk_size(h, c);
+
+	if ((sz >= CONFIG_SYS_HEAP_SMALL_CACHE_MAX_UNITS) ||
+	    (h->small_cache_count[sz] >= CONFIG_SYS_HEAP_SMALL_CACHE_DEPTH)) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, h->small_cache[sz]);
+	h->small_cache[sz] = c;
+	h->small_cache_count[sz]++;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+
+	return true;
+}
+
+static chunkid_t small_cache_pop(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c;
+
+	if ((sz >= CONFIG_SYS_HEAP_SMALL_CACHE_MAX_UNITS) ||
+	    (h->small_cache[sz] == 0U)) {
+		return 0;
+	}
+
+	c = h->small_cache[sz];
+	h->small_cache[sz] = next_free_chunk(h, c);
+	h->small_cache_count[sz]--;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+
+	return c;
+}
+
+/* Return every cached chunk to the real free lists, coalescing with
+ * neighbors as usual.  Called when an allocation would otherwise fail,
+ * so deferred coalescing never costs capacity.
+ */
+static void small_cache_flush(struct z_heap *h)
+{
+	for (chunksz_t sz = 0; sz < CONFIG_SYS_HEAP_SMALL_CACHE_MAX_UNITS; sz++) {
+		chunkid_t c = h->small_cache[sz];
+
+		h->small_cache[sz] = 0;
+		h->small_cache_count[sz] = 0;
+
+		while (c != 0U) {
+			chunkid_t next = next_free_chunk(h, c);
+
+			set_chunk_used(h, c, false);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+			/* free_list_add() will re-account these bytes */
+			h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+			free_chunk(h, c);
+			c = next;
+		}
+	}
+}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,6 +260,20 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	if (small_cache_push(h, c)) {
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+		heap_listener_notify_free(HEAP_ID_FROM_POINTER(heap), mem,
+					  chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+		return;
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
+
 	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
@@ -270,7 +360,35 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
+
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	chunkid_t c = small_cache_pop(h, chunk_sz);
+
+	if (c != 0U) {
+		/* Cached chunks are already marked used */
+		mem = chunk_mem(h, c);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		increase_allocated_bytes(h, chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+
+#ifdef CONFIG_SYS_HEAP_LISTENER
+		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(heap), mem,
+					   chunksz_to_bytes(h, chunk_size(h, c)));
+#endif
+
+		IF_ENABLED(CONFIG_MSAN, (__msan_allocated_memory(mem, bytes)));
+		return mem;
+	}
+
+	c = alloc_chunk(h, chunk_sz);
+	if (c == 0U) {
+		small_cache_flush(h);
+		c = alloc_chunk(h, chunk_sz);
+	}
+#else
 	chunkid_t c = alloc_chunk(h, chunk_sz);
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
 	if (c == 0U) {
 		return NULL;
 	}
@@ -335,6 +453,12 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
 	chunkid_t c0 = alloc_chunk(h, padded_sz);
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	if (c0 == 0) {
+		small_cache_flush(h);
+		c0 = alloc_chunk(h, padded_sz);
+	}
+#endif /* CONFIG_SYS_HEAP_SMALL_CACHE */
 	if (c0 == 0) {
 		return NULL;
 	}
@@ -517,6 +641,11 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	h->max_allocated_bytes = 0;
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	memset(h->small_cache, 0, sizeof(h->small_cache));
+	memset(h->small_cache_count, 0, sizeof(h->small_cache_count));
+#endif
+
 	int nb_buckets = bucket_idx(h, heap_sz) + 1;
 	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
 				     nb_buckets * sizeof(struct z_heap_bucket));
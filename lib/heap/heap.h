@@ -73,6 +73,14 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SMALL_CACHE
+	/* Exact-size bins of recently freed small chunks, one per chunk
+	 * size in CHUNK_UNITs.  Cached chunks stay marked "used" so they
+	 * are never coalesced until the cache is flushed.
+	 */
+	chunkid_t small_cache[CONFIG_SYS_HEAP_SMALL_CACHE_MAX_UNITS];
+	uint8_t small_cache_count[CONFIG_SYS_HEAP_SMALL_CACHE_MAX_UNITS];
 #endif
 	struct z_heap_bucket buckets[0];
 };
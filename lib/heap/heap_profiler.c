@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/heap_listener.h>
+#include <zephyr/sys/heap_profiler.h>
+#include <zephyr/sys/util.h>
+
+/* One class per power of two, indexed with find_msb_set(bytes) */
+#define NUM_SIZE_CLASSES 33
+
+/* One bin per power of two of lifetime cycles */
+#define NUM_LIFETIME_BINS 33
+
+struct profiler_size_class {
+	uint32_t alloc_count;
+	uint32_t free_count;
+	uint32_t live_count;
+	uint32_t max_live_count;
+};
+
+/* Outstanding allocation, tracked to compute lifetime and attribute
+ * live memory to the allocating thread.
+ */
+struct profiler_live_alloc {
+	void *mem;
+	uint32_t bytes;
+	uint32_t cycle;
+	k_tid_t thread;
+};
+
+struct profiler_event {
+	uintptr_t mem;
+	uint32_t bytes;
+	uint32_t cycle;
+	uint8_t type;		/* HEAP_ALLOC or HEAP_FREE */
+};
+
+static struct k_spinlock profiler_lock;
+static bool profiler_active;
+
+static struct profiler_size_class size_classes[NUM_SIZE_CLASSES];
+static uint32_t lifetime_bins[NUM_LIFETIME_BINS];
+static struct profiler_live_alloc live_table[CONFIG_HEAP_PROFILER_LIVE_TABLE_SIZE];
+static struct profiler_event event_ring[CONFIG_HEAP_PROFILER_EVENT_RING_SIZE];
+static uint32_t event_head;
+
+/* Allocations dropped because the live table was full, and frees with
+ * no matching live entry (dropped above, or predating profiling).
+ */
+static uint32_t live_table_drops;
+static uint32_t unmatched_frees;
+
+static inline uint32_t live_table_hash(void *mem)
+{
+	/* Heap blocks are at least 8-byte aligned */
+	return (uint32_t)((POINTER_TO_UINT(mem) >> 3) * 2654435761U) %
+	       CONFIG_HEAP_PROFILER_LIVE_TABLE_SIZE;
+}
+
+static struct profiler_live_alloc *live_table_find(void *mem)
+{
+	uint32_t idx = live_table_hash(mem);
+
+	for (uint32_t i = 0; i < CONFIG_HEAP_PROFILER_LIVE_TABLE_SIZE; i++) {
+		struct profiler_live_alloc *entry = &live_table[idx];
+
+		if (entry->mem == mem) {
+			return entry;
+		}
+		idx = (idx + 1) % CONFIG_HEAP_PROFILER_LIVE_TABLE_SIZE;
+	}
+
+	return NULL;
+}
+
+static void event_ring_push(void *mem, size_t bytes, uint32_t cycle, uint8_t type)
+{
+	struct profiler_event *evt =
+		&event_ring[event_head % CONFIG_HEAP_PROFILER_EVENT_RING_SIZE];
+
+	evt->mem = POINTER_TO_UINT(mem);
+	evt->bytes = (uint32_t)bytes;
+	evt->cycle = cycle;
+	evt->type = type;
+	event_head++;
+}
+
+static void profiler_alloc_cb(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	uint32_t cycle = k_cycle_get_32();
+	k_spinlock_key_t key = k_spin_lock(&profiler_lock);
+	struct profiler_size_class *class = &size_classes[find_msb_set((uint32_t)bytes)];
+	struct profiler_live_alloc *entry;
+
+	ARG_UNUSED(heap_id);
+
+	class->alloc_count++;
+	class->live_count++;
+	class->max_live_count = MAX(class->max_live_count, class->live_count);
+
+	entry = live_table_find(NULL);
+	if (entry != NULL) {
+		entry->mem = mem;
+		entry->bytes = (uint32_t)bytes;
+		entry->cycle = cycle;
+		entry->thread = k_current_get();
+	} else {
+		live_table_drops++;
+	}
+
+	event_ring_push(mem, bytes, cycle, HEAP_ALLOC);
+
+	k_spin_unlock(&profiler_lock, key);
+}
+
+static void profiler_free_cb(uintptr_t heap_id, void *mem, size_t bytes)
+{
+	uint32_t cycle = k_cycle_get_32();
+	k_spinlock_key_t key = k_spin_lock(&profiler_lock);
+	struct profiler_size_class *class = &size_classes[find_msb_set((uint32_t)bytes)];
+	struct profiler_live_alloc *entry;
+
+	ARG_UNUSED(heap_id);
+
+	class->free_count++;
+	if (class->live_count > 0) {
+		class->live_count--;
+	}
+
+	entry = live_table_find(mem);
+	if (entry != NULL) {
+		lifetime_bins[find_msb_set(cycle - entry->cycle)]++;
+		entry->mem = NULL;
+	} else {
+		unmatched_frees++;
+	}
+
+	event_ring_push(mem, bytes, cycle, HEAP_FREE);
+
+	k_spin_unlock(&profiler_lock, key);
+}
+
+static struct heap_listener profiler_alloc_listener = {
+	.event = HEAP_ALLOC,
+	.alloc_cb = profiler_alloc_cb,
+};
+
+static struct heap_listener profiler_free_listener = {
+	.event = HEAP_FREE,
+	.free_cb = profiler_free_cb,
+};
+
+int heap_profiler_start(uintptr_t heap_id)
+{
+	k_spinlock_key_t key = k_spin_lock(&profiler_lock);
+
+	if (profiler_active) {
+		k_spin_unlock(&profiler_lock, key);
+		return -EALREADY;
+	}
+	profiler_alloc_listener.heap_id = heap_id;
+	profiler_free_listener.heap_id = heap_id;
+	profiler_active = true;
+	k_spin_unlock(&profiler_lock, key);
+
+	heap_listener_register(&profiler_alloc_listener);
+	heap_listener_register(&profiler_free_listener);
+
+	return 0;
+}
+
+int heap_profiler_stop(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&profiler_lock);
+
+	if (!profiler_active) {
+		k_spin_unlock(&profiler_lock, key);
+		return -EALREADY;
+	}
+	profiler_active = false;
+	k_spin_unlock(&profiler_lock, key);
+
+	heap_listener_unregister(&profiler_alloc_listener);
+	heap_listener_unregister(&profiler_free_listener);
+
+	return 0;
+}
+
+void heap_profiler_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&profiler_lock);
+
+	memset(size_classes, 0, sizeof(size_classes));
+	memset(lifetime_bins, 0, sizeof(lifetime_bins));
+	memset(live_table, 0, sizeof(live_table));
+	memset(event_ring, 0, sizeof(event_ring));
+	event_head = 0;
+	live_table_drops = 0;
+	unmatched_frees = 0;
+
+	k_spin_unlock(&profiler_lock, key);
+}
+
+#ifdef CONFIG_HEAP_PROFILER_SHELL
+
+#include <stdlib.h>
+#include <zephyr/shell/shell.h>
+
+/* Upper bound, in cycles, under which the given percentage of observed
+ * lifetimes fall, computed from the logarithmic histogram.
+ */
+static uint64_t lifetime_percentile(unsigned int pct)
+{
+	uint64_t total = 0;
+	uint64_t acc = 0;
+
+	for (int i = 0; i < NUM_LIFETIME_BINS; i++) {
+		total += lifetime_bins[i];
+	}
+	if (total == 0) {
+		return 0;
+	}
+
+	for (int i = 0; i < NUM_LIFETIME_BINS; i++) {
+		acc += lifetime_bins[i];
+		if ((acc * 100) >= (total * pct)) {
+			/* Bin i holds lifetimes in [2^(i-1), 2^i) */
+			return BIT64(i);
+		}
+	}
+
+	return BIT64(NUM_LIFETIME_BINS);
+}
+
+static int cmd_heap_prof_start(const struct shell *sh, size_t argc, char **argv)
+{
+	uintptr_t heap_id = (uintptr_t)strtoul(argv[1], NULL, 0);
+	int ret = heap_profiler_start(heap_id);
+
+	if (ret != 0) {
+		shell_error(sh, "profiler already running");
+		return ret;
+	}
+
+	shell_print(sh, "profiling heap 0x%lx", (unsigned long)heap_id);
+	return 0;
+}
+
+static int cmd_heap_prof_stop(const struct shell *sh, size_t argc, char **argv)
+{
+	int ret = heap_profiler_stop();
+
+	if (ret != 0) {
+		shell_error(sh, "profiler not running");
+		return ret;
+	}
+
+	shell_print(sh, "profiler stopped");
+	return 0;
+}
+
+static int cmd_heap_prof_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	heap_profiler_reset();
+	shell_print(sh, "profiler data discarded");
+	return 0;
+}
+
+static int cmd_heap_prof_dump(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t now = k_cycle_get_32();
+
+	/* Read without the profiler lock: these are statistics and
+	 * shell output must not run with interrupts locked.
+	 */
+	shell_print(sh, "size class      allocs      frees       live   max live");
+	for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+		struct profiler_size_class *class = &size_classes[i];
+
+		if (class->alloc_count == 0 && class->free_count == 0) {
+			continue;
+		}
+		shell_print(sh, "<= %8u %10u %10u %10u %10u",
+			    (uint32_t)BIT(i) - 1, class->alloc_count,
+			    class->free_count, class->live_count,
+			    class->max_live_count);
+	}
+
+	shell_print(sh, "lifetime p50/p90/p99 (cycles): %llu / %llu / %llu",
+		    lifetime_percentile(50), lifetime_percentile(90),
+		    lifetime_percentile(99));
+	shell_print(sh, "live table drops: %u, unmatched frees: %u",
+		    live_table_drops, unmatched_frees);
+
+	shell_print(sh, "live allocations:");
+	for (uint32_t i = 0; i < CONFIG_HEAP_PROFILER_LIVE_TABLE_SIZE; i++) {
+		struct profiler_live_alloc *entry = &live_table[i];
+
+		if (entry->mem == NULL) {
+			continue;
+		}
+
+		const char *name = k_thread_name_get(entry->thread);
+
+		shell_print(sh, "  %p %10u bytes, age %10u cycles, by %s (%p)",
+			    entry->mem, entry->bytes, now - entry->cycle,
+			    (name != NULL) ? name : "<unnamed>", entry->thread);
+	}
+
+	return 0;
+}
+
+static int cmd_heap_prof_ring(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t count = MIN(event_head, CONFIG_HEAP_PROFILER_EVENT_RING_SIZE);
+
+	/* Oldest first */
+	for (uint32_t i = event_head - count; i != event_head; i++) {
+		struct profiler_event *evt =
+			&event_ring[i % CONFIG_HEAP_PROFILER_EVENT_RING_SIZE];
+
+		shell_print(sh, "%10u %s 0x%lx %u bytes", evt->cycle,
+			    (evt->type == HEAP_ALLOC) ? "alloc" : "free ",
+			    (unsigned long)evt->mem, evt->bytes);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_heap_prof,
+	SHELL_CMD_ARG(start, NULL, "Start profiling a heap: start <heap id>",
+		      cmd_heap_prof_start, 2, 0),
+	SHELL_CMD(stop, NULL, "Stop profiling", cmd_heap_prof_stop),
+	SHELL_CMD(dump, NULL, "Dump histograms, percentiles and live allocations",
+		  cmd_heap_prof_dump),
+	SHELL_CMD(ring, NULL, "Dump the recent event ring", cmd_heap_prof_ring),
+	SHELL_CMD(reset, NULL, "Discard aggregated data", cmd_heap_prof_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(heap_prof, &sub_heap_prof, "Heap profiler commands", NULL);
+
+#endif /* CONFIG_HEAP_PROFILER_SHELL */
@@ -16,23 +16,62 @@ static struct sys_multi_heap shared_multi_heap;
 static struct {
 	struct sys_heap heap_pool[MAX_MULTI_HEAPS];
 	unsigned int heap_cnt;
+#ifdef CONFIG_SHARED_MULTI_HEAP_FALLBACK
+	uint8_t fallback[MAX_SHARED_MULTI_HEAP_ATTR];
+	uint8_t fallback_cnt;
+#endif
 } smh_data[MAX_SHARED_MULTI_HEAP_ATTR];
 
-static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
+static void *smh_alloc_from_attr(enum shared_multi_heap_attr attr, size_t align, size_t size)
 {
 	struct sys_heap *h;
-	enum shared_multi_heap_attr attr;
 	void *block;
 
-	attr = (enum shared_multi_heap_attr)(long) cfg;
-
-	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || size == 0) {
-		return NULL;
-	}
-
 	/* Set in case the user requested a non-existing attr */
 	block = NULL;
 
+#ifdef CONFIG_SHARED_MULTI_HEAP_BEST_FIT
+	uint32_t tried = 0;
+
+	/* Prefer the candidate heap with the least free memory that may
+	 * still satisfy the request, keeping the larger reserves of free
+	 * space intact for larger allocations. Free bytes do not account
+	 * for fragmentation, so on failure move on to the next-fullest
+	 * heap rather than giving up.
+	 */
+	while (true) {
+		struct sys_memory_stats stats;
+		size_t best_free = SIZE_MAX;
+		int best = -1;
+
+		for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
+			h = &smh_data[attr].heap_pool[hdx];
+
+			if (h->heap == NULL) {
+				break;
+			}
+			if ((tried & BIT(hdx)) != 0U) {
+				continue;
+			}
+			(void)sys_heap_runtime_stats_get(h, &stats);
+			if (stats.free_bytes >= size && stats.free_bytes < best_free) {
+				best_free = stats.free_bytes;
+				best = (int)hdx;
+			}
+		}
+
+		if (best < 0) {
+			break;
+		}
+
+		block = sys_heap_aligned_alloc(&smh_data[attr].heap_pool[best],
+					       align, size);
+		if (block != NULL) {
+			break;
+		}
+		tried |= BIT(best);
+	}
+#else
 	for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
 		h = &smh_data[attr].heap_pool[hdx];
 
@@ -45,10 +84,90 @@ static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, s
 			break;
 		}
 	}
+#endif /* CONFIG_SHARED_MULTI_HEAP_BEST_FIT */
+
+	return block;
+}
+
+static void *smh_choice(struct sys_multi_heap *mheap, void *cfg, size_t align, size_t size)
+{
+	enum shared_multi_heap_attr attr;
+	void *block;
+
+	attr = (enum shared_multi_heap_attr)(long) cfg;
+
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || size == 0) {
+		return NULL;
+	}
+
+	block = smh_alloc_from_attr(attr, align, size);
+
+#ifdef CONFIG_SHARED_MULTI_HEAP_FALLBACK
+	/* Regions with the requested attribute are exhausted, walk the
+	 * user-provided fallback chain in order.
+	 */
+	for (uint8_t fdx = 0; block == NULL && fdx < smh_data[attr].fallback_cnt; fdx++) {
+		block = smh_alloc_from_attr(
+			(enum shared_multi_heap_attr)smh_data[attr].fallback[fdx],
+			align, size);
+	}
+#endif
 
 	return block;
 }
 
+#ifdef CONFIG_SHARED_MULTI_HEAP_FALLBACK
+int shared_multi_heap_set_fallback(enum shared_multi_heap_attr attr,
+				   const enum shared_multi_heap_attr *chain,
+				   size_t count)
+{
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR ||
+	    count > MAX_SHARED_MULTI_HEAP_ATTR ||
+	    (count > 0 && chain == NULL)) {
+		return -EINVAL;
+	}
+
+	for (size_t fdx = 0; fdx < count; fdx++) {
+		if (chain[fdx] >= MAX_SHARED_MULTI_HEAP_ATTR || chain[fdx] == attr) {
+			return -EINVAL;
+		}
+	}
+
+	for (size_t fdx = 0; fdx < count; fdx++) {
+		smh_data[attr].fallback[fdx] = (uint8_t)chain[fdx];
+	}
+	smh_data[attr].fallback_cnt = (uint8_t)count;
+
+	return 0;
+}
+#endif /* CONFIG_SHARED_MULTI_HEAP_FALLBACK */
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int shared_multi_heap_runtime_stats_get(enum shared_multi_heap_attr attr,
+					struct sys_memory_stats *stats)
+{
+	struct sys_memory_stats heap_stats;
+
+	if (attr >= MAX_SHARED_MULTI_HEAP_ATTR || stats == NULL) {
+		return -EINVAL;
+	}
+
+	stats->free_bytes = 0;
+	stats->allocated_bytes = 0;
+	stats->max_allocated_bytes = 0;
+
+	for (size_t hdx = 0; hdx < smh_data[attr].heap_cnt; hdx++) {
+		(void)sys_heap_runtime_stats_get(&smh_data[attr].heap_pool[hdx],
+						 &heap_stats);
+		stats->free_bytes += heap_stats.free_bytes;
+		stats->allocated_bytes += heap_stats.allocated_bytes;
+		stats->max_allocated_bytes += heap_stats.max_allocated_bytes;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
 int shared_multi_heap_add(struct shared_multi_heap_region *region, void *user_data)
 {
 	enum shared_multi_heap_attr attr;
@@ -13,25 +13,131 @@
 #include <zephyr/init.h>
 #include <string.h>
 
+/* The internal lock is needed whenever the contiguity index must stay
+ * consistent with the bitmap, not just for statistics.
+ */
+#if defined(CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS) || \
+	defined(CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX)
+#define MEM_BLOCKS_LOCK 1
+#endif
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+#define BLOCKS_PER_GROUP 32
+
+/* Bitmap word of group @a g with the bits past the end of the pool
+ * reported as allocated.
+ */
+static uint32_t group_word(sys_mem_blocks_t *mem_block, size_t g)
+{
+	uint32_t word = mem_block->bitmap->bundles[g];
+	size_t base = g * BLOCKS_PER_GROUP;
+	size_t valid = mem_block->info.num_blocks - base;
+
+	if (valid < BLOCKS_PER_GROUP) {
+		word |= ~(BIT(valid) - 1U);
+	}
+
+	return word;
+}
+
+/* Recompute the "group fully allocated" summary bits of the groups
+ * overlapping the region.  Must be called with the block lock held
+ * after every bitmap mutation.
+ */
+static void contig_index_update(sys_mem_blocks_t *mem_block, size_t offset,
+				size_t num_blocks)
+{
+	size_t first = offset / BLOCKS_PER_GROUP;
+	size_t last = (offset + num_blocks - 1) / BLOCKS_PER_GROUP;
+
+	for (size_t g = first; g <= last; g++) {
+		if (group_word(mem_block, g) == UINT32_MAX) {
+			mem_block->contig_index[g / 32] |= BIT(g % 32);
+		} else {
+			mem_block->contig_index[g / 32] &= ~BIT(g % 32);
+		}
+	}
+}
+
+/* Find a run of @a count free blocks, skipping fully allocated groups
+ * through the summary index: 32 blocks per summary bit and 1024 blocks
+ * per summary word.  Must be called with the block lock held.
+ */
+static int contig_find_run(sys_mem_blocks_t *mem_block, size_t count,
+			   size_t *out_offset)
+{
+	size_t num_groups = DIV_ROUND_UP(mem_block->info.num_blocks,
+					 BLOCKS_PER_GROUP);
+	size_t run = 0;
+	size_t start = 0;
+
+	for (size_t g = 0; g < num_groups; g++) {
+		if (((g % 32) == 0) &&
+		    (mem_block->contig_index[g / 32] == UINT32_MAX)) {
+			g += 31;
+			run = 0;
+			continue;
+		}
+		if ((mem_block->contig_index[g / 32] & BIT(g % 32)) != 0U) {
+			run = 0;
+			continue;
+		}
+
+		uint32_t word = group_word(mem_block, g);
+
+		if (word == 0U) {
+			if (run == 0) {
+				start = g * BLOCKS_PER_GROUP;
+			}
+			run += BLOCKS_PER_GROUP;
+		} else {
+			for (size_t j = 0; j < BLOCKS_PER_GROUP; j++) {
+				if ((word & BIT(j)) == 0U) {
+					if (run == 0) {
+						start = g * BLOCKS_PER_GROUP + j;
+					}
+					run++;
+					if (run >= count) {
+						break;
+					}
+				} else {
+					run = 0;
+				}
+			}
+		}
+
+		if (run >= count) {
+			*out_offset = start;
+			return 0;
+		}
+	}
+
+	return -ENOMEM;
+}
+#endif /* CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX */
+
 static void *alloc_blocks(sys_mem_blocks_t *mem_block, size_t num_blocks)
 {
 	size_t offset;
 	int r;
 	uint8_t *blk;
 
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef MEM_BLOCKS_LOCK
 	k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
 #endif
 
 	/* Find an unallocated block */
 	r = sys_bitarray_alloc(mem_block->bitmap, num_blocks, &offset);
 	if (r != 0) {
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef MEM_BLOCKS_LOCK
 		k_spin_unlock(&mem_block->lock, key);
 #endif
 		return NULL;
 	}
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+	contig_index_update(mem_block, offset, num_blocks);
+#endif
 
 #ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
 	mem_block->info.used_blocks += (uint32_t)num_blocks;
@@ -39,7 +145,9 @@ static void *alloc_blocks(sys_mem_blocks_t *mem_block, size_t num_blocks)
 	if (mem_block->info.max_used_blocks < mem_block->info.used_blocks) {
 		mem_block->info.max_used_blocks = mem_block->info.used_blocks;
 	}
+#endif
 
+#ifdef MEM_BLOCKS_LOCK
 	k_spin_unlock(&mem_block->lock, key);
 #endif
 
@@ -69,16 +177,24 @@ static int free_blocks(sys_mem_blocks_t *mem_block, void *ptr,
 		goto out;
 	}
 
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef MEM_BLOCKS_LOCK
 	k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
 #endif
 	ret = sys_bitarray_free(mem_block->bitmap, num_blocks, offset);
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+	if (ret == 0) {
+		contig_index_update(mem_block, offset, num_blocks);
+	}
+#endif
+
 #ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
 	if (ret == 0) {
 		mem_block->info.used_blocks -= (uint32_t)num_blocks;
 	}
+#endif
 
+#ifdef MEM_BLOCKS_LOCK
 	k_spin_unlock(&mem_block->lock, key);
 #endif
 
@@ -106,12 +222,47 @@ int sys_mem_blocks_alloc_contiguous(sys_mem_blocks_t *mem_block, size_t count,
 		goto out;
 	}
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+	size_t offset;
+	void *ptr = NULL;
+	k_spinlock_key_t key = k_spin_lock(&mem_block->lock);
+
+	ret = contig_find_run(mem_block, count, &offset);
+	if (ret == 0) {
+		int r = sys_bitarray_test_and_set_region(mem_block->bitmap,
+							 count, offset, true);
+
+		__ASSERT_NO_MSG(r == 0);
+		ARG_UNUSED(r);
+
+		contig_index_update(mem_block, offset, count);
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+		mem_block->info.used_blocks += (uint32_t)count;
+
+		if (mem_block->info.max_used_blocks <
+		    mem_block->info.used_blocks) {
+			mem_block->info.max_used_blocks =
+				mem_block->info.used_blocks;
+		}
+#endif
+
+		ptr = mem_block->buffer +
+		      (offset << mem_block->info.blk_sz_shift);
+	}
+	k_spin_unlock(&mem_block->lock, key);
+
+	if (ptr == NULL) {
+		goto out;
+	}
+#else
 	void *ptr = alloc_blocks(mem_block, count);
 
 	if (ptr == NULL) {
 		ret = -ENOMEM;
 		goto out;
 	}
+#endif /* CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX */
 
 	*out_block = ptr;
 #ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
@@ -214,7 +365,7 @@ int sys_mem_blocks_get(sys_mem_blocks_t *mem_block, void *in_block, size_t count
 		goto out;
 	}
 
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef MEM_BLOCKS_LOCK
 	k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
 #endif
 
@@ -222,20 +373,26 @@ int sys_mem_blocks_get(sys_mem_blocks_t *mem_block, void *in_block, size_t count
 					       offset, true);
 
 	if (ret != 0) {
-#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+#ifdef MEM_BLOCKS_LOCK
 		k_spin_unlock(&mem_block->lock, key);
 #endif
 		ret = -ENOMEM;
 		goto out;
 	}
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+	contig_index_update(mem_block, offset, count);
+#endif
+
 #ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
 	mem_block->info.used_blocks += (uint32_t)count;
 
 	if (mem_block->info.max_used_blocks < mem_block->info.used_blocks) {
 		mem_block->info.max_used_blocks = mem_block->info.used_blocks;
 	}
+#endif
 
+#ifdef MEM_BLOCKS_LOCK
 	k_spin_unlock(&mem_block->lock, key);
 #endif
 
@@ -457,6 +614,56 @@ int sys_mem_blocks_runtime_stats_reset_max(sys_mem_blocks_t *mem_block)
 }
 #endif
 
+#ifdef CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX
+int sys_mem_blocks_frag_stats_get(sys_mem_blocks_t *mem_block,
+				  struct sys_mem_blocks_frag_stats *stats)
+{
+	size_t num_groups;
+	size_t run = 0;
+
+	if ((mem_block == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	stats->free_blocks = 0;
+	stats->free_runs = 0;
+	stats->largest_run = 0;
+
+	num_groups = DIV_ROUND_UP(mem_block->info.num_blocks,
+				  BLOCKS_PER_GROUP);
+
+	k_spinlock_key_t key = k_spin_lock(&mem_block->lock);
+
+	for (size_t g = 0; g < num_groups; g++) {
+		if ((mem_block->contig_index[g / 32] & BIT(g % 32)) != 0U) {
+			run = 0;
+			continue;
+		}
+
+		uint32_t word = group_word(mem_block, g);
+
+		for (size_t j = 0; j < BLOCKS_PER_GROUP; j++) {
+			if ((word & BIT(j)) == 0U) {
+				if (run == 0) {
+					stats->free_runs++;
+				}
+				run++;
+				stats->free_blocks++;
+				if (run > stats->largest_run) {
+					stats->largest_run = run;
+				}
+			} else {
+				run = 0;
+			}
+		}
+	}
+
+	k_spin_unlock(&mem_block->lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MEM_BLOCKS_CONTIG_INDEX */
+
 #ifdef CONFIG_OBJ_CORE_STATS_SYS_MEM_BLOCKS
 static int sys_mem_blocks_stats_raw(struct k_obj_core *obj_core, void *stats)
 {
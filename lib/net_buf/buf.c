@@ -208,6 +208,137 @@ const struct net_buf_data_alloc net_buf_heap_alloc = {
 
 #endif /* K_HEAP_MEM_POOL_SIZE > 0 */
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+/* Number of buffers pulled from the shared LIFO when the local cache runs
+ * empty. Leaves room in the cache for buffers freed on this CPU.
+ */
+#define CACHE_REFILL MAX(1, CONFIG_NET_BUF_CACHE_SIZE / 2)
+
+static inline struct net_buf_pool_cache *pool_cache_get(struct net_buf_pool *pool)
+{
+#if defined(CONFIG_SMP)
+	/* Migration between the check and the access is harmless: the
+	 * per-cache lock keeps the cache consistent, the entry just ends up
+	 * in (or comes from) another CPU's cache.
+	 */
+	return &pool->cache[arch_curr_cpu()->id];
+#else
+	return &pool->cache[0];
+#endif
+}
+
+static bool cache_push(struct net_buf_pool_cache *cache, struct net_buf *buf)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count == ARRAY_SIZE(cache->bufs)) {
+		k_spin_unlock(&cache->lock, key);
+		return false;
+	}
+
+	cache->bufs[cache->count++] = buf;
+	k_spin_unlock(&cache->lock, key);
+
+	return true;
+}
+
+static struct net_buf *cache_pop(struct net_buf_pool_cache *cache)
+{
+	struct net_buf *buf = NULL;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+
+	if (cache->count > 0) {
+		buf = cache->bufs[--cache->count];
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return buf;
+}
+
+/* Return every cached buffer to the shared LIFO, so that blocked allocators
+ * can see them.
+ */
+static void cache_flush(struct net_buf_pool *pool)
+{
+	for (int i = 0; i < ARRAY_SIZE(pool->cache); i++) {
+		struct net_buf *buf;
+
+		while ((buf = cache_pop(&pool->cache[i]))) {
+			k_lifo_put(&pool->free, buf);
+		}
+	}
+}
+
+static struct net_buf *cache_alloc(struct net_buf_pool *pool)
+{
+	struct net_buf_pool_cache *cache = pool_cache_get(pool);
+	struct net_buf *buf;
+
+	buf = cache_pop(cache);
+	if (buf) {
+		return buf;
+	}
+
+	/* Don't hoard buffers in the cache while allocators are blocked on
+	 * the shared LIFO.
+	 */
+	if (atomic_get(&pool->blocked) > 0) {
+		return NULL;
+	}
+
+	/* Batch refill: pull one buffer for the caller and stash a few more
+	 * in the local cache, so subsequent allocations on this CPU avoid
+	 * the shared LIFO altogether.
+	 */
+	buf = k_lifo_get(&pool->free, K_NO_WAIT);
+	if (!buf) {
+		return NULL;
+	}
+
+	for (int i = 1; i < CACHE_REFILL; i++) {
+		struct net_buf *extra = k_lifo_get(&pool->free, K_NO_WAIT);
+
+		if (!extra) {
+			break;
+		}
+
+		if (!cache_push(cache, extra)) {
+			k_lifo_put(&pool->free, extra);
+			break;
+		}
+	}
+
+	return buf;
+}
+
+void net_buf_cache_put(struct net_buf_pool *pool, struct net_buf *buf)
+{
+	struct net_buf_pool_cache *cache = pool_cache_get(pool);
+
+	if (atomic_get(&pool->blocked) > 0 || !cache_push(cache, buf)) {
+		k_lifo_put(&pool->free, buf);
+		return;
+	}
+
+	/* Close the race against an allocator that blocked between the check
+	 * above and the push: donate a cached buffer back to the LIFO. If
+	 * instead the allocator blocked after this check, its pre-block
+	 * cache flush is guaranteed to see the buffer pushed above.
+	 */
+	if (atomic_get(&pool->blocked) > 0) {
+		buf = cache_pop(cache);
+		if (buf) {
+			k_lifo_put(&pool->free, buf);
+		}
+	}
+}
+#endif /* CONFIG_NET_BUF_PER_CPU_CACHE */
+
 static uint8_t *data_alloc(struct net_buf *buf, size_t *size, k_timeout_t timeout)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
@@ -239,6 +370,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+	buf = cache_alloc(pool);
+	if (buf) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -277,6 +415,19 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+	/* The per-CPU caches must be emptied into the LIFO before waiting on
+	 * it, both so that this allocation can use the cached buffers of the
+	 * other CPUs and so that a blocked allocator cannot miss a buffer
+	 * freed into a cache. Frees go straight to the LIFO while `blocked`
+	 * is non-zero.
+	 */
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		atomic_inc(&pool->blocked);
+	}
+	cache_flush(pool);
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -306,6 +457,13 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 #else
 	buf = k_lifo_get(&pool->free, timeout);
 #endif
+
+#if defined(CONFIG_NET_BUF_PER_CPU_CACHE)
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		atomic_dec(&pool->blocked);
+	}
+#endif
+
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
 		return NULL;
@@ -344,6 +502,14 @@ success:
 #if defined(CONFIG_NET_BUF_POOL_USAGE)
 	atomic_dec(&pool->avail_count);
 	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+
+	/* Best-effort low watermark; a concurrent allocation may skip an
+	 * update, but the stored value always corresponds to an observed
+	 * available count.
+	 */
+	if (atomic_get(&pool->avail_count) < atomic_get(&pool->min_avail)) {
+		atomic_set(&pool->min_avail, atomic_get(&pool->avail_count));
+	}
 #endif
 	return buf;
 }
@@ -19,6 +19,11 @@
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/cbprintf.h>
 
+#ifdef CONFIG_CBPRINTF_FMT_CACHE
+#include <zephyr/sys/atomic.h>
+#include <zephyr/linker/linker-defs.h>
+#endif
+
 /* newlib doesn't declare this function unless __POSIX_VISIBLE >= 200809.  No
  * idea how to make that happen, so lets put it right here.
  */
@@ -307,6 +312,96 @@ struct conversion {
 	};
 };
 
+#ifdef CONFIG_CBPRINTF_FMT_CACHE
+
+/* Pre-parsed conversion specification of a cached format string. */
+struct fmt_cache_op {
+	/** Offset of the '%' introducing the specification. */
+	uint16_t offset;
+
+	/** Length of the specification in characters. */
+	uint8_t len;
+
+	/** Specification as parsed by extract_conversion(). */
+	struct conversion conv;
+};
+
+enum fmt_cache_state {
+	FMT_CACHE_EMPTY,
+	/** Slot claimed by a writer which is publishing an op list. */
+	FMT_CACHE_RECORDING,
+	/** Slot holds a complete op list and can be replayed. */
+	FMT_CACHE_COMPLETE,
+};
+
+struct fmt_cache_entry {
+	atomic_t state;
+	const char *fmt;
+	uint8_t num_ops;
+	struct fmt_cache_op ops[CONFIG_CBPRINTF_FMT_CACHE_OPS];
+};
+
+static struct fmt_cache_entry fmt_cache[CONFIG_CBPRINTF_FMT_CACHE_SLOTS];
+
+static struct fmt_cache_entry *fmt_cache_slot(const char *fmt)
+{
+	/* Only formats in read-only memory have a stable address-to-content
+	 * mapping; anything else must not be cached.
+	 */
+	if ((fmt < (const char *)__rodata_region_start) ||
+	    (fmt >= (const char *)__rodata_region_end)) {
+		return NULL;
+	}
+
+	return &fmt_cache[((uintptr_t)fmt >> 2) % ARRAY_SIZE(fmt_cache)];
+}
+
+static const struct fmt_cache_entry *fmt_cache_find(const char *fmt)
+{
+	const struct fmt_cache_entry *entry = fmt_cache_slot(fmt);
+
+	/* Entries are never evicted, so once a slot is observed complete
+	 * its content is immutable and can be used without locking.
+	 */
+	if ((entry != NULL) &&
+	    (atomic_get(&entry->state) == FMT_CACHE_COMPLETE) &&
+	    (entry->fmt == fmt)) {
+		return entry;
+	}
+
+	return NULL;
+}
+
+static bool fmt_cache_recordable(const char *fmt)
+{
+	const struct fmt_cache_entry *entry = fmt_cache_slot(fmt);
+
+	return (entry != NULL) && (atomic_get(&entry->state) == FMT_CACHE_EMPTY);
+}
+
+static void fmt_cache_publish(const char *fmt, const struct fmt_cache_op *ops,
+			      uint8_t num_ops)
+{
+	struct fmt_cache_entry *entry = fmt_cache_slot(fmt);
+
+	/* The slot is claimed atomically so that concurrent publishers
+	 * (including ones in ISRs) cannot corrupt it. Losing the race or
+	 * colliding with another cached format just leaves this format
+	 * uncached.
+	 */
+	if ((entry == NULL) ||
+	    !atomic_cas(&entry->state, FMT_CACHE_EMPTY, FMT_CACHE_RECORDING)) {
+		return;
+	}
+
+	entry->fmt = fmt;
+	entry->num_ops = num_ops;
+	memcpy(entry->ops, ops, num_ops * sizeof(*ops));
+	atomic_set(&entry->state, FMT_CACHE_COMPLETE);
+}
+
+#endif /* CONFIG_CBPRINTF_FMT_CACHE */
+
 /** Get a size represented as a sequence of decimal digits.
  *
  * @param[inout] str where to read from.  Updated to point to the first
@@ -1377,6 +1472,14 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 	const bool tagged_ap = (flags & Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS)
 			       == Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS;
 
+#ifdef CONFIG_CBPRINTF_FMT_CACHE
+	const char *const fmt_begin = fp;
+	const struct fmt_cache_entry *cached = fmt_cache_find(fp);
+	struct fmt_cache_op record_ops[CONFIG_CBPRINTF_FMT_CACHE_OPS];
+	bool record = (cached == NULL) && fmt_cache_recordable(fp);
+	uint8_t op_idx = 0;
+#endif
+
 /* Output character, returning EOF if output failed, otherwise
  * updating count.
  *
@@ -1431,7 +1534,30 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 		const char *bpe = buf + sizeof(buf);
 		char sign = 0;
 
+#ifdef CONFIG_CBPRINTF_FMT_CACHE
+		if ((cached != NULL) && (op_idx < cached->num_ops) &&
+		    (cached->ops[op_idx].offset == (size_t)(sp - fmt_begin))) {
+			*conv = cached->ops[op_idx].conv;
+			fp = sp + cached->ops[op_idx].len;
+			op_idx++;
+		} else {
+			fp = extract_conversion(conv, sp);
+			if (record) {
+				if ((op_idx < ARRAY_SIZE(record_ops)) &&
+				    ((size_t)(sp - fmt_begin) <= UINT16_MAX) &&
+				    ((size_t)(fp - sp) <= UINT8_MAX)) {
+					record_ops[op_idx].offset = sp - fmt_begin;
+					record_ops[op_idx].len = fp - sp;
+					record_ops[op_idx].conv = *conv;
+					op_idx++;
+				} else {
+					record = false;
+				}
+			}
+		}
+#else
 		fp = extract_conversion(conv, sp);
+#endif
 
 		if (conv->specifier_cat != SPECIFIER_INVALID) {
 			if (IS_ENABLED(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
@@ -1877,6 +2003,15 @@ int z_cbvprintf_impl(cbprintf_cb __out, void *ctx, const char *fp,
 		}
 	}
 
+#ifdef CONFIG_CBPRINTF_FMT_CACHE
+	/* Publish the op list only when the whole format was parsed;
+	 * formats without any conversion gain nothing from caching.
+	 */
+	if (record && (op_idx > 0)) {
+		fmt_cache_publish(fmt_begin, record_ops, op_idx);
+	}
+#endif
+
 	return count;
 #undef OUTS
 #undef OUTC
@@ -35,6 +35,10 @@ struct fd_entry {
 	struct k_condvar cond;
 	size_t offset;
 	uint32_t mode;
+#ifdef CONFIG_ZVFS_LOCKFREE_LOOKUP
+	/* Sequence counter, odd while the entry is being mutated */
+	atomic_t seq;
+#endif
 };
 
 #if defined(CONFIG_POSIX_DEVICE_IO)
@@ -76,6 +80,73 @@ static struct fd_entry fdtable[CONFIG_ZVFS_OPEN_MAX] = {
 
 static K_MUTEX_DEFINE(fdtable_lock);
 
+#ifdef CONFIG_ZVFS_LOCKFREE_LOOKUP
+/* Seqcount-style publication of fd entries: writers bracket mutations of
+ * the (obj, vtable, mode) tuple with two increments so that the counter is
+ * odd while an update is in flight, and lock-free readers retry when they
+ * observe an odd or changed counter.  Writers run in preemptible thread
+ * context, so they hold the scheduler lock across the update; otherwise a
+ * higher-priority reader preempting a writer mid-update would spin on the
+ * odd counter forever.  The entries themselves live in a static array and
+ * are never reclaimed, so no deferred freeing is needed.
+ */
+static inline void fd_entry_write_begin(struct fd_entry *entry)
+{
+	k_sched_lock();
+	(void)atomic_inc(&entry->seq);
+}
+
+static inline void fd_entry_write_end(struct fd_entry *entry)
+{
+	(void)atomic_inc(&entry->seq);
+	k_sched_unlock();
+}
+
+/* Lock-free snapshot of a bounds-checked fd entry.  Returns false if the
+ * entry is not in use.
+ */
+static bool fd_entry_read(int fd, void **obj, const struct fd_op_vtable **vtable)
+{
+	struct fd_entry *entry = &fdtable[fd];
+
+	while (true) {
+		atomic_val_t seq = atomic_get(&entry->seq);
+
+		if (seq & 1) {
+			/* Mutation in flight, wait for it to finish */
+			continue;
+		}
+
+		void *e_obj = entry->obj;
+		const struct fd_op_vtable *e_vtable = entry->vtable;
+		bool used = atomic_get(&entry->refcount) != 0;
+
+		if (atomic_get(&entry->seq) == seq) {
+			if (!used) {
+				return false;
+			}
+
+			*obj = e_obj;
+			if (vtable != NULL) {
+				*vtable = e_vtable;
+			}
+
+			return true;
+		}
+	}
+}
+#else
+static inline void fd_entry_write_begin(struct fd_entry *entry)
+{
+	ARG_UNUSED(entry);
+}
+
+static inline void fd_entry_write_end(struct fd_entry *entry)
+{
+	ARG_UNUSED(entry);
+}
+#endif /* CONFIG_ZVFS_LOCKFREE_LOOKUP */
+
 static int z_fd_ref(int fd)
 {
 	return atomic_inc(&fdtable[fd].refcount) + 1;
@@ -101,8 +172,10 @@ static int z_fd_unref(int fd)
 		return old_rc - 1;
 	}
 
+	fd_entry_write_begin(&fdtable[fd]);
 	fdtable[fd].obj = NULL;
 	fdtable[fd].vtable = NULL;
+	fd_entry_write_end(&fdtable[fd]);
 
 	return 0;
 }
@@ -164,6 +237,29 @@ bool fdtable_fd_is_initialized(int fd)
 
 void *zvfs_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err)
 {
+#ifdef CONFIG_ZVFS_LOCKFREE_LOOKUP
+	void *obj;
+	const struct fd_op_vtable *entry_vtable;
+
+	if ((fd < 0) || (fd >= ARRAY_SIZE(fdtable))) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	fd = k_array_index_sanitize(fd, ARRAY_SIZE(fdtable));
+
+	if (!fd_entry_read(fd, &obj, &entry_vtable)) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	if ((vtable != NULL) && (entry_vtable != vtable)) {
+		errno = err;
+		return NULL;
+	}
+
+	return obj;
+#else
 	struct fd_entry *entry;
 
 	if (_check_fd(fd) < 0) {
@@ -178,6 +274,7 @@ void *zvfs_get_fd_obj(int fd, const struct fd_op_vtable *vtable, int err)
 	}
 
 	return entry->obj;
+#endif /* CONFIG_ZVFS_LOCKFREE_LOOKUP */
 }
 
 static int z_get_fd_by_obj_and_vtable(void *obj, const struct fd_op_vtable *vtable)
@@ -221,6 +318,27 @@ bool zvfs_get_obj_lock_and_cond(void *obj, const struct fd_op_vtable *vtable, st
 void *zvfs_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable,
 			      struct k_mutex **lock)
 {
+#ifdef CONFIG_ZVFS_LOCKFREE_LOOKUP
+	void *obj;
+
+	if ((fd < 0) || (fd >= ARRAY_SIZE(fdtable))) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	fd = k_array_index_sanitize(fd, ARRAY_SIZE(fdtable));
+
+	if (!fd_entry_read(fd, &obj, vtable)) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	if (lock != NULL) {
+		*lock = &fdtable[fd].lock;
+	}
+
+	return obj;
+#else
 	struct fd_entry *entry;
 
 	if (_check_fd(fd) < 0) {
@@ -235,6 +353,7 @@ void *zvfs_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable,
 	}
 
 	return entry->obj;
+#endif /* CONFIG_ZVFS_LOCKFREE_LOOKUP */
 }
 
 int zvfs_reserve_fd(void)
@@ -246,11 +365,13 @@ int zvfs_reserve_fd(void)
 	fd = _find_fd_entry();
 	if (fd >= 0) {
 		/* Mark entry as used, zvfs_finalize_fd() will fill it in. */
+		fd_entry_write_begin(&fdtable[fd]);
 		(void)z_fd_ref(fd);
 		fdtable[fd].obj = NULL;
 		fdtable[fd].vtable = NULL;
 		k_mutex_init(&fdtable[fd].lock);
 		k_condvar_init(&fdtable[fd].cond);
+		fd_entry_write_end(&fdtable[fd]);
 	}
 
 	k_mutex_unlock(&fdtable_lock);
@@ -271,9 +392,11 @@ void zvfs_finalize_typed_fd(int fd, void *obj, const struct fd_op_vtable *vtable
 	 */
 	k_object_recycle(obj);
 #endif
+	fd_entry_write_begin(&fdtable[fd]);
 	fdtable[fd].obj = obj;
 	fdtable[fd].vtable = vtable;
 	fdtable[fd].mode = mode;
+	fd_entry_write_end(&fdtable[fd]);
 
 	/* Let the object know about the lock just in case it needs it
 	 * for something. For BSD sockets, the lock is used with condition
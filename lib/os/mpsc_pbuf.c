@@ -31,6 +31,8 @@ void mpsc_pbuf_init(struct mpsc_pbuf_buffer *buffer,
 	memset(buffer, 0, offsetof(struct mpsc_pbuf_buffer, buf));
 	buffer->get_wlen = cfg->get_wlen;
 	buffer->notify_drop = cfg->notify_drop;
+	buffer->notify_watermark = cfg->notify_watermark;
+	buffer->watermark = cfg->watermark;
 	buffer->buf = cfg->buf;
 	buffer->size = cfg->size;
 	buffer->max_usage = 0;
@@ -115,6 +117,28 @@ static inline void max_utilization_update(struct mpsc_pbuf_buffer *buffer)
 	buffer->max_usage = MAX(buffer->max_usage, get_usage(buffer));
 }
 
+/* Check if buffer usage just crossed the watermark. Must be called with the
+ * buffer lock held after data was added; the notification itself has to be
+ * invoked after releasing the lock.
+ *
+ * @retval true when usage grew from below to at least the watermark.
+ */
+static inline bool watermark_crossed(struct mpsc_pbuf_buffer *buffer)
+{
+	if ((buffer->notify_watermark == NULL) ||
+	    (buffer->flags & MPSC_PBUF_ABOVE_WATERMARK)) {
+		return false;
+	}
+
+	if (get_usage(buffer) < buffer->watermark) {
+		return false;
+	}
+
+	buffer->flags |= MPSC_PBUF_ABOVE_WATERMARK;
+
+	return true;
+}
+
 static inline bool is_valid(union mpsc_pbuf_generic *item)
 {
 	return item->hdr.valid;
@@ -291,6 +315,7 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 			const union mpsc_pbuf_generic item)
 {
 	bool cont;
+	bool notify = false;
 	uint32_t free_wlen;
 	k_spinlock_key_t key;
 	union mpsc_pbuf_generic *dropped_item = NULL;
@@ -315,6 +340,7 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 			cont = false;
 			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, 1);
 			max_utilization_update(buffer);
+			notify = watermark_crossed(buffer);
 		} else {
 			tmp_wr_idx_val = buffer->tmp_wr_idx;
 			cont = drop_item_locked(buffer, free_wlen,
@@ -331,6 +357,10 @@ void mpsc_pbuf_put_word(struct mpsc_pbuf_buffer *buffer,
 			dropped_item = NULL;
 		}
 	} while (cont);
+
+	if (notify) {
+		buffer->notify_watermark(buffer);
+	}
 }
 
 union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
@@ -410,6 +440,7 @@ union mpsc_pbuf_generic *mpsc_pbuf_alloc(struct mpsc_pbuf_buffer *buffer,
 void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 		       union mpsc_pbuf_generic *item)
 {
+	bool notify;
 	uint32_t wlen = buffer->get_wlen(item);
 
 	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
@@ -417,7 +448,12 @@ void mpsc_pbuf_commit(struct mpsc_pbuf_buffer *buffer,
 	item->hdr.valid = 1;
 	buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, wlen);
 	max_utilization_update(buffer);
+	notify = watermark_crossed(buffer);
 	k_spin_unlock(&buffer->lock, key);
+
+	if (notify) {
+		buffer->notify_watermark(buffer);
+	}
 	MPSC_PBUF_DBG(buffer, "committed %p", item);
 }
 
@@ -429,6 +465,7 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 		(sizeof(item) + sizeof(data)) / sizeof(uint32_t);
 	union mpsc_pbuf_generic *dropped_item = NULL;
 	bool cont;
+	bool notify = false;
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
 
@@ -456,6 +493,7 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 			buffer->wr_idx = idx_inc(buffer, buffer->wr_idx, l);
 			cont = false;
 			max_utilization_update(buffer);
+			notify = watermark_crossed(buffer);
 		} else if (wrap) {
 			add_skip_item(buffer, free_wlen);
 			cont = true;
@@ -475,12 +513,17 @@ void mpsc_pbuf_put_word_ext(struct mpsc_pbuf_buffer *buffer,
 			dropped_item = NULL;
 		}
 	} while (cont);
+
+	if (notify) {
+		buffer->notify_watermark(buffer);
+	}
 }
 
 void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 			size_t wlen)
 {
 	bool cont;
+	bool notify = false;
 	union mpsc_pbuf_generic *dropped_item = NULL;
 	uint32_t tmp_wr_idx_shift = 0;
 	uint32_t tmp_wr_idx_val = 0;
@@ -506,6 +549,7 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 			tmp_wr_idx_inc(buffer, wlen);
 			cont = false;
 			max_utilization_update(buffer);
+			notify = watermark_crossed(buffer);
 		} else if (wrap) {
 			add_skip_item(buffer, free_wlen);
 			cont = true;
@@ -526,6 +570,10 @@ void mpsc_pbuf_put_data(struct mpsc_pbuf_buffer *buffer, const uint32_t *data,
 			dropped_item = NULL;
 		}
 	} while (cont);
+
+	if (notify) {
+		buffer->notify_watermark(buffer);
+	}
 }
 
 const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
@@ -574,6 +622,47 @@ const union mpsc_pbuf_generic *mpsc_pbuf_claim(struct mpsc_pbuf_buffer *buffer)
 	return item;
 }
 
+size_t mpsc_pbuf_claim_batch(struct mpsc_pbuf_buffer *buffer,
+			     const union mpsc_pbuf_generic **packets, size_t n)
+{
+	size_t cnt = 0;
+	k_spinlock_key_t key = k_spin_lock(&buffer->lock);
+
+	while (cnt < n) {
+		uint32_t a;
+		union mpsc_pbuf_generic *item;
+
+		(void)available(buffer, &a);
+		item = (union mpsc_pbuf_generic *)
+			&buffer->buf[buffer->tmp_rd_idx];
+
+		if (!a || is_invalid(item)) {
+			break;
+		}
+
+		uint32_t skip = get_skip(item);
+
+		if (skip || !is_valid(item)) {
+			uint32_t inc = skip ? skip : buffer->get_wlen(item);
+
+			buffer->tmp_rd_idx =
+				idx_inc(buffer, buffer->tmp_rd_idx, inc);
+			rd_idx_inc(buffer, inc);
+			continue;
+		}
+
+		item->hdr.busy = 1;
+		buffer->tmp_rd_idx = idx_inc(buffer, buffer->tmp_rd_idx,
+					     buffer->get_wlen(item));
+		MPSC_PBUF_DBG(buffer, ">>claimed %d: %p", a, item);
+		packets[cnt++] = item;
+	}
+
+	k_spin_unlock(&buffer->lock, key);
+
+	return cnt;
+}
+
 void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		     const union mpsc_pbuf_generic *item)
 {
@@ -600,6 +689,12 @@ void mpsc_pbuf_free(struct mpsc_pbuf_buffer *buffer,
 		MPSC_PBUF_DBG(buffer, "Allocation occurred during claim");
 		witem->skip.len = wlen;
 	}
+
+	if ((buffer->flags & MPSC_PBUF_ABOVE_WATERMARK) &&
+	    (get_usage(buffer) < buffer->watermark)) {
+		/* Re-arm the watermark notification. */
+		buffer->flags &= ~MPSC_PBUF_ABOVE_WATERMARK;
+	}
 	MPSC_PBUF_DBG(buffer, "<<freed: %p", item);
 
 	k_spin_unlock(&buffer->lock, key);
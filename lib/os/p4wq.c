@@ -39,6 +39,41 @@ static bool rb_lessthan(struct rbnode *a, struct rbnode *b)
 	return (uintptr_t)a < (uintptr_t)b;
 }
 
+/* As above, but deadline-major: the tree maximum is the item with the
+ * earliest absolute deadline, with priority only breaking ties.
+ */
+static bool rb_lessthan_edf(struct rbnode *a, struct rbnode *b)
+{
+	struct k_p4wq_work *aw = CONTAINER_OF(a, struct k_p4wq_work, rbnode);
+	struct k_p4wq_work *bw = CONTAINER_OF(b, struct k_p4wq_work, rbnode);
+
+	if (aw->deadline != bw->deadline) {
+		return aw->deadline - bw->deadline > 0;
+	}
+
+	if (aw->priority != bw->priority) {
+		return aw->priority > bw->priority;
+	}
+
+	return (uintptr_t)a < (uintptr_t)b;
+}
+
+/* Bind the comparison function matching the queue's flags.  Called once
+ * the flags are known; the trees must still be empty at that point.
+ */
+static void p4wq_set_lessthan(struct k_p4wq *queue)
+{
+	bool (*cmp)(struct rbnode *, struct rbnode *) =
+		(queue->flags & K_P4WQ_EDF) ? rb_lessthan_edf : rb_lessthan;
+
+	queue->queue.lessthan_fn = cmp;
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		queue->shards[i].queue.lessthan_fn = cmp;
+	}
+#endif
+}
+
 static void thread_set_requeued(struct k_thread *th)
 {
 	th->base.user_options |= K_CALLBACK_STATE;
@@ -59,8 +94,16 @@ static bool thread_was_requeued(struct k_thread *th)
  * pointer value to break ties where priorities are equal, here we
  * tolerate equality as meaning "not lessthan"
  */
-static inline bool item_lessthan(struct k_p4wq_work *a, struct k_p4wq_work *b)
+static inline bool item_lessthan(struct k_p4wq *queue, struct k_p4wq_work *a,
+				 struct k_p4wq_work *b)
 {
+	if (queue->flags & K_P4WQ_EDF) {
+		if (a->deadline != b->deadline) {
+			return a->deadline - b->deadline > 0;
+		}
+		return a->priority > b->priority;
+	}
+
 	if (a->priority > b->priority) {
 		return true;
 	} else if ((a->priority == b->priority) &&
@@ -72,6 +115,87 @@ static inline bool item_lessthan(struct k_p4wq_work *a, struct k_p4wq_work *b)
 	return false;
 }
 
+#ifdef CONFIG_P4WQ_WORK_STEALING
+/* Pop the best item from the calling CPU's shard, stealing from the
+ * other shards when the local one is empty.
+ */
+static struct k_p4wq_work *p4wq_shard_get(struct k_p4wq *queue)
+{
+	unsigned int num_cpus = arch_num_cpus();
+#ifdef CONFIG_SMP
+	unsigned int start = arch_curr_cpu()->id;
+#else
+	unsigned int start = 0;
+#endif
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		unsigned int s = (start + i) % num_cpus;
+		k_spinlock_key_t k = k_spin_lock(&queue->shards[s].lock);
+		struct rbnode *r = rb_get_max(&queue->shards[s].queue);
+
+		if (r != NULL) {
+			rb_remove(&queue->shards[s].queue, r);
+			k_spin_unlock(&queue->shards[s].lock, k);
+			atomic_dec(&queue->pending);
+			return CONTAINER_OF(r, struct k_p4wq_work, rbnode);
+		}
+
+		k_spin_unlock(&queue->shards[s].lock, k);
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_P4WQ_WORK_STEALING */
+
+#ifdef CONFIG_P4WQ_WORK_STEALING
+static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	struct k_p4wq *queue = p0;
+
+	while (true) {
+		struct k_p4wq_work *w = p4wq_shard_get(queue);
+		k_spinlock_key_t k = k_spin_lock(&queue->lock);
+
+		if (w != NULL) {
+			w->thread = _current;
+			sys_dlist_append(&queue->active, &w->dlnode);
+			set_prio(_current, w);
+			thread_clear_requeued(_current);
+
+			k_spin_unlock(&queue->lock, k);
+
+			w->handler(w);
+
+			k = k_spin_lock(&queue->lock);
+
+			/* Remove from the active list only if it
+			 * wasn't resubmitted already
+			 */
+			if (!thread_was_requeued(_current)) {
+				sys_dlist_remove(&w->dlnode);
+				w->thread = NULL;
+				k_sem_give(&w->done_sem);
+			}
+
+			k_spin_unlock(&queue->lock, k);
+		} else {
+			/* Submitters bump the pending count before they
+			 * look for a thread to wake, so re-checking it
+			 * under the lock closes the sleep/wake race with
+			 * an item that landed after our shard scan.
+			 */
+			if (atomic_get(&queue->pending) > 0) {
+				k_spin_unlock(&queue->lock, k);
+				continue;
+			}
+
+			z_pend_curr(&queue->lock, k, &queue->waitq, K_FOREVER);
+		}
+	}
+}
+#else /* !CONFIG_P4WQ_WORK_STEALING */
 static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 {
 	ARG_UNUSED(p1);
@@ -112,6 +236,7 @@ static FUNC_NORETURN void p4wq_loop(void *p0, void *p1, void *p2)
 		}
 	}
 }
+#endif /* CONFIG_P4WQ_WORK_STEALING */
 
 /* Must be called to regain ownership of the work item */
 int k_p4wq_wait(struct k_p4wq_work *work, k_timeout_t timeout)
@@ -128,6 +253,11 @@ void k_p4wq_init(struct k_p4wq *queue)
 	memset(queue, 0, sizeof(*queue));
 	z_waitq_init(&queue->waitq);
 	queue->queue.lessthan_fn = rb_lessthan;
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		queue->shards[i].queue.lessthan_fn = rb_lessthan;
+	}
+#endif
 	sys_dlist_init(&queue->active);
 }
 
@@ -135,6 +265,9 @@ void k_p4wq_add_thread(struct k_p4wq *queue, struct k_thread *thread,
 			k_thread_stack_t *stack,
 			size_t stack_size)
 {
+	/* pick up a K_P4WQ_EDF flag set after k_p4wq_init() */
+	p4wq_set_lessthan(queue);
+
 	k_thread_create(thread, stack, stack_size,
 			p4wq_loop, queue, NULL, NULL,
 			K_HIGHEST_THREAD_PRIO, 0,
@@ -155,6 +288,7 @@ static int static_init(void)
 			}
 
 			q->flags = pp->flags;
+			p4wq_set_lessthan(q);
 
 			/*
 			 * If the user wants to specify CPU affinity, we have to
@@ -237,6 +371,33 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 	}
 	__ASSERT_NO_MSG(item->thread == NULL);
 
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	/* Publish to the submitting CPU's shard.  The pending count must
+	 * be raised before we look for a thread to wake (see p4wq_loop()).
+	 */
+#ifdef CONFIG_SMP
+	unsigned int s = arch_curr_cpu()->id;
+#else
+	unsigned int s = 0;
+#endif
+	bool is_top;
+	k_spinlock_key_t sk;
+
+	atomic_inc(&queue->pending);
+	sk = k_spin_lock(&queue->shards[s].lock);
+	rb_insert(&queue->shards[s].queue, &item->rbnode);
+	is_top = rb_get_max(&queue->shards[s].queue) == &item->rbnode;
+	k_spin_unlock(&queue->shards[s].lock, sk);
+	item->queue = queue;
+
+	/* If there were other items already ahead of it in its shard,
+	 * then we don't need to revisit active thread state and can
+	 * return.
+	 */
+	if (!is_top) {
+		goto out;
+	}
+#else
 	rb_insert(&queue->queue, &item->rbnode);
 	item->queue = queue;
 
@@ -247,6 +408,7 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 	if (rb_get_max(&queue->queue) != &item->rbnode) {
 		goto out;
 	}
+#endif /* CONFIG_P4WQ_WORK_STEALING */
 
 	/* Check the list of active (running or preempted) items, if
 	 * there are at least an "active target" of those that are
@@ -262,7 +424,7 @@ void k_p4wq_submit(struct k_p4wq *queue, struct k_p4wq_work *item)
 		 * !item_lessthan(a, b) counts all work items with higher or
 		 * equal priority
 		 */
-		if (!item_lessthan(wi, item)) {
+		if (!item_lessthan(queue, wi, item)) {
 			n_beaten_by++;
 		}
 	}
@@ -297,12 +459,32 @@ out:
 bool k_p4wq_cancel(struct k_p4wq *queue, struct k_p4wq_work *item)
 {
 	k_spinlock_key_t k = k_spin_lock(&queue->lock);
+#ifdef CONFIG_P4WQ_WORK_STEALING
+	bool ret = false;
+
+	for (unsigned int s = 0; !ret && s < arch_num_cpus(); s++) {
+		k_spinlock_key_t sk = k_spin_lock(&queue->shards[s].lock);
+
+		if (rb_contains(&queue->shards[s].queue, &item->rbnode)) {
+			rb_remove(&queue->shards[s].queue, &item->rbnode);
+			ret = true;
+		}
+
+		k_spin_unlock(&queue->shards[s].lock, sk);
+	}
+
+	if (ret) {
+		atomic_dec(&queue->pending);
+		k_sem_give(&item->done_sem);
+	}
+#else
 	bool ret = rb_contains(&queue->queue, &item->rbnode);
 
 	if (ret) {
 		rb_remove(&queue->queue, &item->rbnode);
 		k_sem_give(&item->done_sem);
 	}
+#endif /* CONFIG_P4WQ_WORK_STEALING */
 
 	k_spin_unlock(&queue->lock, k);
 	return ret;
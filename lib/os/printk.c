@@ -21,6 +21,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/llext/symbol.h>
 #include <sys/types.h>
 
@@ -65,6 +66,69 @@ printk_hook_fn_t __printk_get_hook(void)
 	return _char_out;
 }
 
+#ifdef CONFIG_PRINTK_ASYNC
+RING_BUF_DECLARE(printk_async_rb, CONFIG_PRINTK_ASYNC_BUFFER_SIZE);
+static struct k_spinlock printk_async_lock;
+static bool printk_async_off;
+
+static void printk_async_drain(struct k_work *work)
+{
+	uint8_t *data;
+	uint32_t len;
+
+	ARG_UNUSED(work);
+
+	/* Single consumer; producers only ever move the write index. */
+	while ((len = ring_buf_get_claim(&printk_async_rb, &data,
+					 CONFIG_PRINTK_ASYNC_BUFFER_SIZE)) > 0) {
+		for (uint32_t i = 0; i < len; i++) {
+			_char_out(data[i]);
+		}
+		ring_buf_get_finish(&printk_async_rb, len);
+	}
+}
+
+static K_WORK_DEFINE(printk_async_work, printk_async_drain);
+
+void printk_panic(void)
+{
+	/* Give up on the background drain: flush what is buffered and emit
+	 * synchronously from here on.  A drain running on another CPU may
+	 * duplicate a few characters, which is acceptable on a panic path.
+	 */
+	printk_async_off = true;
+	printk_async_drain(NULL);
+}
+
+static void printk_char_emit(int c)
+{
+	uint8_t ch = (uint8_t)c;
+	bool queued = false;
+
+	if (printk_async_off || k_is_pre_kernel()) {
+		(void)_char_out(c);
+		return;
+	}
+
+	K_SPINLOCK(&printk_async_lock) {
+		/* If the buffer is full the character is dropped; blocking
+		 * here would re-introduce the stall this path exists to
+		 * avoid.
+		 */
+		queued = ring_buf_put(&printk_async_rb, &ch, 1) == 1;
+	}
+
+	if (queued) {
+		k_work_submit(&printk_async_work);
+	}
+}
+#else
+static inline void printk_char_emit(int c)
+{
+	(void)_char_out(c);
+}
+#endif /* CONFIG_PRINTK_ASYNC */
+
 struct buf_out_context {
 #ifdef CONFIG_PICOLIBC
 	FILE file;
@@ -95,7 +159,8 @@ static int buf_char_out(int c, void *ctx_p)
 static int char_out(int c, void *ctx_p)
 {
 	ARG_UNUSED(ctx_p);
-	return _char_out(c);
+	printk_char_emit(c);
+	return c;
 }
 
 void vprintk(const char *fmt, va_list ap)
@@ -151,7 +216,7 @@ void z_impl_k_str_out(char *c, size_t n)
 #endif
 
 	for (i = 0; i < n; i++) {
-		_char_out(c[i]);
+		printk_char_emit(c[i]);
 	}
 
 #ifdef CONFIG_PRINTK_SYNC
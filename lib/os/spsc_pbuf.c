@@ -59,6 +59,17 @@ static inline void cache_inv(void *data, size_t len, uint32_t flags)
 	}
 }
 
+/* Check if the layout with indexes on separate cache lines is used. It is the
+ * case when cache is handled or when the SPSC_PBUF_PADDED layout is requested
+ * for hardware coherent memory (no cache maintenance but false sharing cost).
+ */
+static inline bool use_padded_layout(uint32_t flags)
+{
+	return IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
+	       (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) &&
+		(flags & (SPSC_PBUF_CACHE | SPSC_PBUF_PADDED)));
+}
+
 static uint32_t *get_rd_idx_loc(struct spsc_pbuf *pb, uint32_t flags)
 {
 	return &pb->common.rd_idx;
@@ -66,18 +77,25 @@ static uint32_t *get_rd_idx_loc(struct spsc_pbuf *pb, uint32_t flags)
 
 static uint32_t *get_wr_idx_loc(struct spsc_pbuf *pb, uint32_t flags)
 {
-	if (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
-	    (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_PBUF_CACHE))) {
+	if (use_padded_layout(flags)) {
 		return &pb->ext.cache.wr_idx;
 	}
 
 	return &pb->ext.nocache.wr_idx;
 }
 
+static uint32_t *get_rd_idx_shadow_loc(struct spsc_pbuf *pb, uint32_t flags)
+{
+	if (use_padded_layout(flags)) {
+		return &pb->ext.cache.rd_idx_shadow;
+	}
+
+	return &pb->ext.nocache.rd_idx_shadow;
+}
+
 static uint8_t *get_data_loc(struct spsc_pbuf *pb, uint32_t flags)
 {
-	if (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
-	    (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_PBUF_CACHE))) {
+	if (use_padded_layout(flags)) {
 		return pb->ext.cache.data;
 	}
 
@@ -88,8 +106,7 @@ static uint32_t get_len(size_t blen, uint32_t flags)
 {
 	uint32_t len = blen - sizeof(struct spsc_pbuf_common);
 
-	if (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
-	    (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_PBUF_CACHE))) {
+	if (use_padded_layout(flags)) {
 		return len - sizeof(struct spsc_pbuf_ext_cache);
 	}
 
@@ -98,8 +115,7 @@ static uint32_t get_len(size_t blen, uint32_t flags)
 
 static bool check_alignment(void *buf, uint32_t flags)
 {
-	if ((Z_SPSC_PBUF_DCACHE_LINE > 0) && (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
-	    (IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_PBUF_CACHE)))) {
+	if ((Z_SPSC_PBUF_DCACHE_LINE > 0) && use_padded_layout(flags)) {
 		return ((uintptr_t)buf & (Z_SPSC_PBUF_DCACHE_LINE - 1)) == 0;
 	}
 
@@ -123,12 +139,18 @@ struct spsc_pbuf *spsc_pbuf_init(void *buf, size_t blen, uint32_t flags)
 
 	pb->common.len = get_len(blen, flags);
 	pb->common.rd_idx = 0;
+	pb->common.wr_idx_shadow = 0;
 	pb->common.flags = flags;
 	*wr_idx_loc = 0;
+	*get_rd_idx_shadow_loc(pb, flags) = 0;
 
+	/* After initialization shadow indexes are private to their owning
+	 * side and need no further cache maintenance.
+	 */
 	__sync_synchronize();
 	cache_wb(&pb->common, sizeof(pb->common), flags);
 	cache_wb(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+	cache_wb(get_rd_idx_shadow_loc(pb, flags), sizeof(uint32_t), flags);
 
 	return pb;
 }
@@ -142,54 +164,82 @@ int spsc_pbuf_alloc(struct spsc_pbuf *pb, uint16_t len, char **buf)
 	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
 	uint8_t *data_loc = get_data_loc(pb, flags);
 
-	uint32_t space = len + LEN_SZ; /* data + length field */
+	uint32_t *rd_idx_shadow_loc = get_rd_idx_shadow_loc(pb, flags);
 
 	if (len == 0 || len > SPSC_PBUF_MAX_LEN) {
 		/* Incorrect call. */
 		return -EINVAL;
 	}
 
-	cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
-	__sync_synchronize();
-
+	/* Start with the local copy of the read index. The consumer can only
+	 * have moved it forward, so free space computed from the copy is never
+	 * overestimated. Touching the consumer's cache line is needed only
+	 * when the copy shows too little space.
+	 */
 	uint32_t wr_idx = *wr_idx_loc;
-	uint32_t rd_idx = *rd_idx_loc;
+	uint32_t rd_idx = *rd_idx_shadow_loc;
+	bool fresh = false;
 	int32_t free_space;
+	bool padding;
+
+	do {
+		uint32_t space = len + LEN_SZ; /* data + length field */
+
+		padding = false;
+		if (wr_idx >= rd_idx) {
+			int32_t remaining = pblen - wr_idx;
+			/* If SPSC_PBUF_MAX_LEN is set as length try to allocate maximum
+			 * possible packet till wrap or from the beginning.
+			 * If len is bigger than SPSC_PBUF_MAX_LEN then try to allocate
+			 * maximum packet length even if that results in adding a padding.
+			 */
+			if (len == SPSC_PBUF_MAX_LEN) {
+				/* At least space for 1 byte packet. */
+				space = LEN_SZ + 1;
+			}
+
+			if ((remaining >= space) || (rd_idx <= space)) {
+				/* Packet will fit at the end. Free space depends on
+				 * presence of data at the beginning of the buffer since
+				 * there must be one word not used to distinguish between
+				 * empty and full state.
+				 */
+				free_space = remaining - ((rd_idx > 0) ? 0 : FREE_SPACE_DISTANCE);
+			} else {
+				padding = true;
+				/* Obligatory one word empty space. */
+				free_space = rd_idx - FREE_SPACE_DISTANCE;
+			}
+		} else {
+			/* Obligatory one word empty space. */
+			free_space = rd_idx - wr_idx - FREE_SPACE_DISTANCE;
+		}
 
-	if (wr_idx >= rd_idx) {
-		int32_t remaining = pblen - wr_idx;
-		/* If SPSC_PBUF_MAX_LEN is set as length try to allocate maximum
-		 * possible packet till wrap or from the beginning.
-		 * If len is bigger than SPSC_PBUF_MAX_LEN then try to allocate
-		 * maximum packet length even if that results in adding a padding.
+		/* Use the local copy only when it proves that the whole request
+		 * fits without padding. A "largest possible" request and any
+		 * shortage or wrapping must be decided on the fresh read index.
 		 */
-		if (len == SPSC_PBUF_MAX_LEN) {
-			/* At least space for 1 byte packet. */
-			space = LEN_SZ + 1;
+		if (fresh || ((len != SPSC_PBUF_MAX_LEN) && !padding &&
+			      (free_space >= (int32_t)space))) {
+			break;
 		}
 
-		if ((remaining >= space) || (rd_idx <= space)) {
-			/* Packet will fit at the end. Free space depends on
-			 * presence of data at the beginning of the buffer since
-			 * there must be one word not used to distinguish between
-			 * empty and full state.
-			 */
-			free_space = remaining - ((rd_idx > 0) ? 0 : FREE_SPACE_DISTANCE);
-		} else {
-			/* Padding must be added. */
-			data_loc[wr_idx] = PADDING_MARK;
-			__sync_synchronize();
-			cache_wb(&data_loc[wr_idx], sizeof(uint8_t), flags);
+		cache_inv(rd_idx_loc, sizeof(*rd_idx_loc), flags);
+		__sync_synchronize();
 
-			wr_idx = 0;
-			*wr_idx_loc = wr_idx;
+		rd_idx = *rd_idx_loc;
+		*rd_idx_shadow_loc = rd_idx;
+		fresh = true;
+	} while (true);
 
-			/* Obligatory one word empty space. */
-			free_space = rd_idx - FREE_SPACE_DISTANCE;
-		}
-	} else {
-		/* Obligatory one word empty space. */
-		free_space = rd_idx - wr_idx - FREE_SPACE_DISTANCE;
+	if (padding) {
+		/* Padding must be added. */
+		data_loc[wr_idx] = PADDING_MARK;
+		__sync_synchronize();
+		cache_wb(&data_loc[wr_idx], sizeof(uint8_t), flags);
+
+		wr_idx = 0;
+		*wr_idx_loc = wr_idx;
 	}
 
 	len = MIN(len, MAX(free_space - (int32_t)LEN_SZ, 0));
@@ -255,14 +305,24 @@ uint16_t spsc_pbuf_claim(struct spsc_pbuf *pb, char **buf)
 	uint32_t *wr_idx_loc = get_wr_idx_loc(pb, flags);
 	uint8_t *data_loc = get_data_loc(pb, flags);
 
-	cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
-	__sync_synchronize();
-
-	uint32_t wr_idx = *wr_idx_loc;
+	/* Start with the local copy of the write index and touch the
+	 * producer's cache line only when the buffer looks empty. The copy is
+	 * an older value of the write index, so any data it proves to exist
+	 * is already committed.
+	 */
 	uint32_t rd_idx = *rd_idx_loc;
+	uint32_t wr_idx = pb->common.wr_idx_shadow;
 
 	if (rd_idx == wr_idx) {
-		return 0;
+		cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
+		__sync_synchronize();
+
+		wr_idx = *wr_idx_loc;
+		pb->common.wr_idx_shadow = wr_idx;
+
+		if (rd_idx == wr_idx) {
+			return 0;
+		}
 	}
 
 	uint32_t bytes_stored = idx_occupied(pblen, wr_idx, rd_idx);
@@ -290,7 +350,9 @@ uint16_t spsc_pbuf_claim(struct spsc_pbuf *pb, char **buf)
 		 * padding (at the beginning of the buffer).
 		 */
 		cache_inv(wr_idx_loc, sizeof(*wr_idx_loc), flags);
-		if (rd_idx == *wr_idx_loc) {
+		wr_idx = *wr_idx_loc;
+		pb->common.wr_idx_shadow = wr_idx;
+		if (rd_idx == wr_idx) {
 			return 0;
 		}
 
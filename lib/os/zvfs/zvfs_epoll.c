@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Sockets register at most one k_poll event each for POLLIN and POLLOUT */
+#define ZVFS_EPOLL_EVENTS_PER_FD 2
+
+struct zvfs_epoll_entry {
+	int fd;
+	uint32_t events;
+	void *data;
+};
+
+struct zvfs_epoll {
+	struct k_mutex lock;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_ENTRIES];
+	struct k_poll_event poll_events[ZVFS_EPOLL_EVENTS_PER_FD *
+					CONFIG_ZVFS_EPOLL_MAX_ENTRIES];
+	int num_entries;
+	bool in_use;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static struct zvfs_epoll_entry *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	for (int i = 0; i < ep->num_entries; i++) {
+		if (ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static ssize_t zvfs_epoll_read_op(void *obj, void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t zvfs_epoll_write_op(void *obj, const void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+	int err;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	if (!ep->in_use) {
+		k_mutex_unlock(&ep->lock);
+		errno = EBADF;
+		return -1;
+	}
+
+	ep->in_use = false;
+	ep->num_entries = 0;
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	k_mutex_unlock(&ep->lock);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	/* An epoll fd cannot itself be polled or configured via ioctl */
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.read = zvfs_epoll_read_op,
+	.write = zvfs_epoll_write_op,
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+int zvfs_epoll_create(void)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_mutex_init(&ep->lock);
+	ep->num_entries = 0;
+	ep->in_use = true;
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, uint32_t events, void *data)
+{
+	struct zvfs_epoll_entry *entry;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0 || fd == epfd) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	if (!ep->in_use) {
+		errno = EBADF;
+		ret = -1;
+		goto unlock;
+	}
+
+	entry = zvfs_epoll_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			errno = EEXIST;
+			ret = -1;
+			break;
+		}
+
+		if (ep->num_entries == ARRAY_SIZE(ep->entries)) {
+			errno = ENOMEM;
+			ret = -1;
+			break;
+		}
+
+		entry = &ep->entries[ep->num_entries++];
+		entry->fd = fd;
+		entry->events = events;
+		entry->data = data;
+		break;
+
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		entry->events = events;
+		entry->data = data;
+		break;
+
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			errno = ENOENT;
+			ret = -1;
+			break;
+		}
+
+		/* The registration table is unordered, move the last entry
+		 * into the vacated slot to keep it dense.
+		 */
+		*entry = ep->entries[--ep->num_entries];
+		break;
+
+	default:
+		errno = EINVAL;
+		ret = -1;
+		break;
+	}
+
+unlock:
+	k_mutex_unlock(&ep->lock);
+
+	return ret;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents,
+		    int epoll_timeout)
+{
+	bool already[CONFIG_ZVFS_EPOLL_MAX_ENTRIES];
+	uint8_t ev_count[CONFIG_ZVFS_EPOLL_MAX_ENTRIES];
+	const struct fd_op_vtable *vtable;
+	struct k_poll_event *pev;
+	struct k_poll_event *pev_end;
+	struct zvfs_epoll *ep;
+	struct k_mutex *lock;
+	k_timeout_t timeout;
+	k_timepoint_t end;
+	int nevents = 0;
+	bool retry;
+	int ret;
+	int i;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (epoll_timeout < 0) {
+		timeout = K_FOREVER;
+	} else {
+		timeout = K_MSEC(epoll_timeout);
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	if (!ep->in_use) {
+		errno = EBADF;
+		ret = -1;
+		goto unlock;
+	}
+
+	pev = ep->poll_events;
+	pev_end = ep->poll_events + ARRAY_SIZE(ep->poll_events);
+
+	for (i = 0; i < ep->num_entries; i++) {
+		struct zvfs_epoll_entry *entry = &ep->entries[i];
+		struct zvfs_pollfd pfd = {
+			.fd = entry->fd,
+			.events = entry->events,
+		};
+		struct k_poll_event *pev_start = pev;
+		int result;
+		void *ctx;
+
+		already[i] = false;
+		ev_count[i] = 0;
+
+		ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+		if (ctx == NULL) {
+			/* Watched fd has been closed, report ZVFS_POLLNVAL
+			 * in the ready pass without waiting.
+			 */
+			already[i] = true;
+			timeout = K_NO_WAIT;
+			end = sys_timepoint_calc(timeout);
+			continue;
+		}
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+
+		result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+						 pev_end);
+
+		k_mutex_unlock(lock);
+
+		if (result == -EALREADY) {
+			/* The fd is already ready, do not wait but still
+			 * run k_poll() to pick up as many events as possible.
+			 */
+			already[i] = true;
+			timeout = K_NO_WAIT;
+			end = sys_timepoint_calc(timeout);
+			result = 0;
+		} else if (result == -EXDEV) {
+			/* Offloaded sockets have no k_poll backend and can
+			 * only be multiplexed with zvfs_poll().
+			 */
+			result = -EOPNOTSUPP;
+		}
+
+		if (result < 0) {
+			errno = -result;
+			ret = -1;
+			goto unlock;
+		}
+
+		ev_count[i] = pev - pev_start;
+	}
+
+	timeout = sys_timepoint_timeout(end);
+
+	do {
+		ret = k_poll(ep->poll_events, pev - ep->poll_events, timeout);
+		/* EAGAIN when timeout expired, EINTR when cancelled (i.e. EOF) */
+		if (ret != 0 && ret != -EAGAIN && ret != -EINTR) {
+			errno = -ret;
+			ret = -1;
+			goto unlock;
+		}
+
+		retry = false;
+		nevents = 0;
+
+		pev = ep->poll_events;
+		for (i = 0; i < ep->num_entries && nevents < maxevents; i++) {
+			struct zvfs_epoll_entry *entry = &ep->entries[i];
+			struct k_poll_event *entry_pev = pev;
+			bool ready = already[i];
+			struct zvfs_pollfd pfd;
+			int result;
+			void *ctx;
+
+			pev += ev_count[i];
+
+			for (int j = 0; !ready && j < ev_count[i]; j++) {
+				if (entry_pev[j].state != K_POLL_STATE_NOT_READY) {
+					ready = true;
+				}
+			}
+
+			/* Only ready fds pay the POLL_UPDATE cost, idle ones
+			 * are skipped. This is what makes the wakeup cost
+			 * track the number of active fds.
+			 */
+			if (!ready) {
+				continue;
+			}
+
+			pfd.fd = entry->fd;
+			pfd.events = entry->events;
+			pfd.revents = 0;
+
+			ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+			if (ctx == NULL) {
+				pfd.revents = ZVFS_POLLNVAL;
+			} else {
+				(void)k_mutex_lock(lock, K_FOREVER);
+
+				result = zvfs_fdtable_call_ioctl(vtable, ctx,
+								 ZFD_IOCTL_POLL_UPDATE, &pfd,
+								 &entry_pev);
+
+				k_mutex_unlock(lock);
+
+				if (result == -EAGAIN) {
+					retry = true;
+					continue;
+				} else if (result != 0) {
+					errno = -result;
+					ret = -1;
+					goto unlock;
+				}
+			}
+
+			if (pfd.revents != 0) {
+				events[nevents].fd = entry->fd;
+				events[nevents].events = pfd.revents;
+				events[nevents].data = entry->data;
+				nevents++;
+			}
+		}
+
+		if (retry) {
+			if (nevents > 0) {
+				break;
+			}
+
+			timeout = sys_timepoint_timeout(end);
+
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				break;
+			}
+		}
+	} while (retry);
+
+	ret = nevents;
+
+unlock:
+	k_mutex_unlock(&ep->lock);
+
+	return ret;
+}
@@ -114,11 +114,18 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	struct k_mutex *m = NULL;
 	struct k_thread *owner = NULL;
 
-	SYS_SEM_LOCK(&lock) {
-		m = to_posix_mutex(mu);
+	if (*mu != PTHREAD_MUTEX_INITIALIZER) {
+		/*
+		 * Fast path: an already-associated mutex resolves with a
+		 * bounds-checked pool index and a bitarray test, neither of
+		 * which requires the pool lock. owner and lock_count only
+		 * need to be coherent when the caller itself holds the
+		 * mutex, in which case they cannot change underneath us.
+		 */
+		m = get_posix_mutex(*mu);
 		if (m == NULL) {
 			ret = EINVAL;
-			SYS_SEM_LOCK_BREAK;
+			goto handle_error;
 		}
 
 		LOG_DBG("Locking mutex %p with timeout %llx", m, timeout.ticks);
@@ -128,6 +135,23 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 		type = posix_mutex_type[bit];
 		owner = m->owner;
 		lock_count = m->lock_count;
+	} else {
+		SYS_SEM_LOCK(&lock) {
+			/* Automatically associate a statically initialized mutex */
+			m = to_posix_mutex(mu);
+			if (m == NULL) {
+				ret = EINVAL;
+				SYS_SEM_LOCK_BREAK;
+			}
+
+			LOG_DBG("Locking mutex %p with timeout %llx", m, timeout.ticks);
+
+			ret = 0;
+			bit = posix_mutex_to_offset(m);
+			type = posix_mutex_type[bit];
+			owner = m->owner;
+			lock_count = m->lock_count;
+		}
 	}
 
 	if (ret != 0) {
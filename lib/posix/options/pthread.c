@@ -173,6 +173,25 @@ struct posix_thread *to_posix_thread(pthread_t pthread)
 	return &posix_thread_pool[bit];
 }
 
+/*
+ * Resolve the calling thread's posix_thread without taking the pool lock.
+ *
+ * The calling thread can always recover its own slot with pointer arithmetic
+ * and that slot cannot be recycled while the thread is still running in it,
+ * so no pool lock is required. Returns NULL if the caller is not a pthread.
+ */
+static struct posix_thread *to_posix_thread_self(void)
+{
+	struct posix_thread *t =
+		CONTAINER_OF(k_current_get(), struct posix_thread, thread);
+
+	if (posix_thread_to_offset(t) >= ARRAY_SIZE(posix_thread_pool)) {
+		return NULL;
+	}
+
+	return t;
+}
+
 pthread_t pthread_self(void)
 {
 	size_t bit;
@@ -204,15 +223,14 @@ void __z_pthread_cleanup_push(void *cleanup[3], void (*routine)(void *arg), void
 	struct posix_thread *t = NULL;
 	struct __pthread_cleanup *const c = (struct __pthread_cleanup *)cleanup;
 
-	SYS_SEM_LOCK(&pthread_pool_lock) {
-		t = to_posix_thread(pthread_self());
-		BUILD_ASSERT(3 * sizeof(void *) == sizeof(*c));
-		__ASSERT_NO_MSG(t != NULL);
-		__ASSERT_NO_MSG(c != NULL);
-		__ASSERT_NO_MSG(routine != NULL);
-		__z_pthread_cleanup_init(c, routine, arg);
-		sys_slist_prepend(&t->cleanup_list, &c->node);
-	}
+	/* cleanup_list is only ever touched by its owning thread: no lock */
+	t = to_posix_thread_self();
+	BUILD_ASSERT(3 * sizeof(void *) == sizeof(*c));
+	__ASSERT_NO_MSG(t != NULL);
+	__ASSERT_NO_MSG(c != NULL);
+	__ASSERT_NO_MSG(routine != NULL);
+	__z_pthread_cleanup_init(c, routine, arg);
+	sys_slist_prepend(&t->cleanup_list, &c->node);
 }
 
 void __z_pthread_cleanup_pop(int execute)
@@ -221,15 +239,14 @@ void __z_pthread_cleanup_pop(int execute)
 	struct __pthread_cleanup *c = NULL;
 	struct posix_thread *t = NULL;
 
-	SYS_SEM_LOCK(&pthread_pool_lock) {
-		t = to_posix_thread(pthread_self());
-		__ASSERT_NO_MSG(t != NULL);
-		node = sys_slist_get(&t->cleanup_list);
-		__ASSERT_NO_MSG(node != NULL);
-		c = CONTAINER_OF(node, struct __pthread_cleanup, node);
-		__ASSERT_NO_MSG(c != NULL);
-		__ASSERT_NO_MSG(c->routine != NULL);
-	}
+	/* cleanup_list is only ever touched by its owning thread: no lock */
+	t = to_posix_thread_self();
+	__ASSERT_NO_MSG(t != NULL);
+	node = sys_slist_get(&t->cleanup_list);
+	__ASSERT_NO_MSG(node != NULL);
+	c = CONTAINER_OF(node, struct __pthread_cleanup, node);
+	__ASSERT_NO_MSG(c != NULL);
+	__ASSERT_NO_MSG(c->routine != NULL);
 	if (execute) {
 		c->routine(c->arg);
 	}
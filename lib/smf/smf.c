@@ -56,9 +56,24 @@ static const struct smf_state *get_last_of(const struct smf_state *states)
 	return get_child_of(states, NULL);
 }
 
+static size_t get_depth_of(const struct smf_state *state)
+{
+	size_t depth = 0;
+
+	for (; state != NULL; state = state->parent) {
+		depth++;
+	}
+
+	return depth;
+}
+
 /**
  * @brief Find the Least Common Ancestor (LCA) of two states
  *
+ * The caller has already established that neither state is an ancestor of the
+ * other, so the LCA is found by aligning both ancestor chains to the same
+ * depth and walking them up in lockstep.
+ *
  * @param source transition source
  * @param dest transition destination
  * @return LCA state, or NULL if states have no LCA.
@@ -66,16 +81,25 @@ static const struct smf_state *get_last_of(const struct smf_state *states)
 static const struct smf_state *get_lca_of(const struct smf_state *source,
 					  const struct smf_state *dest)
 {
-	for (const struct smf_state *ancestor = source->parent; ancestor != NULL;
-	     ancestor = ancestor->parent) {
-		if (ancestor == dest) {
-			return ancestor->parent;
-		} else if (share_paren(dest, ancestor)) {
-			return ancestor;
-		}
+	size_t source_depth = get_depth_of(source);
+	size_t dest_depth = get_depth_of(dest);
+
+	while (source_depth > dest_depth) {
+		source = source->parent;
+		source_depth--;
+	}
+
+	while (dest_depth > source_depth) {
+		dest = dest->parent;
+		dest_depth--;
+	}
+
+	while (source != dest) {
+		source = source->parent;
+		dest = dest->parent;
 	}
 
-	return NULL;
+	return source;
 }
 
 /**
@@ -92,11 +116,52 @@ static bool smf_execute_all_entry_actions(struct smf_ctx *const ctx,
 {
 	struct internal_ctx *const internal = (void *)&ctx->internal;
 
+	const struct smf_state *path[CONFIG_SMF_ANCESTOR_MAX_DEPTH];
+	size_t depth = 0;
+
 	if (new_state == topmost) {
 		/* There are no child states, so do nothing */
 		return false;
 	}
 
+	/* Flatten the entry path into a table, deepest state first, so the
+	 * entry actions below run as a single table walk instead of one
+	 * ancestor-chain traversal per level.
+	 */
+	for (const struct smf_state *state = new_state; state != topmost; state = state->parent) {
+		if (depth < ARRAY_SIZE(path)) {
+			path[depth] = state;
+		}
+		depth++;
+	}
+
+	if (depth <= ARRAY_SIZE(path)) {
+		/* Execute every entry action EXCEPT that of the topmost state,
+		 * parents first, the new state last.
+		 */
+		for (size_t i = depth; i > 0; i--) {
+			const struct smf_state *to_execute = path[i - 1];
+
+			/* Keep track of the executing entry action in case it
+			 * calls smf_set_state()
+			 */
+			ctx->executing = to_execute;
+			if (to_execute->entry) {
+				to_execute->entry(ctx);
+
+				/* No need to continue if terminate was set */
+				if (internal->terminate) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	/* Nested deeper than the scratch table, fall back to walking the
+	 * ancestor chain once per level.
+	 */
 	for (const struct smf_state *to_execute = get_child_of(new_state, topmost);
 	     to_execute != NULL && to_execute != new_state;
 	     to_execute = get_child_of(new_state, to_execute)) {
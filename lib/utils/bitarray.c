@@ -210,6 +210,14 @@ static void set_region(sys_bitarray_t *bitarray, size_t offset,
 	}
 }
 
+/* Bits at or above this bundle were cleared: lower the scan start hint
+ * used by sys_bitarray_alloc() if needed. Must be called with the lock held.
+ */
+static inline void free_hint_lower(sys_bitarray_t *bitarray, size_t idx)
+{
+	bitarray->first_free_bundle = MIN(bitarray->first_free_bundle, (uint32_t)idx);
+}
+
 int sys_bitarray_popcount_region(sys_bitarray_t *bitarray, size_t num_bits, size_t offset,
 				 size_t *count)
 {
@@ -309,6 +317,9 @@ int sys_bitarray_xor(sys_bitarray_t *dst, sys_bitarray_t *other, size_t num_bits
 		}
 	}
 
+	/* Bits in the region may have been cleared. */
+	free_hint_lower(dst, bd.sidx);
+
 	ret = 0;
 
 out:
@@ -365,6 +376,7 @@ int sys_bitarray_clear_bit(sys_bitarray_t *bitarray, size_t bit)
 	off = bit % bundle_bitness(bitarray);
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	free_hint_lower(bitarray, idx);
 
 	ret = 0;
 
@@ -480,6 +492,7 @@ int sys_bitarray_test_and_clear_bit(sys_bitarray_t *bitarray, size_t bit, int *p
 	}
 
 	bitarray->bundles[idx] &= ~BIT(off);
+	free_hint_lower(bitarray, idx);
 
 	ret = 0;
 
@@ -513,21 +526,24 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
+	bit_idx = bitarray->num_bits;
 
 	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
+	 * instead of individual bits. Bundles below first_free_bundle
+	 * are known to be fully allocated so the scan starts there and
+	 * the hint is advanced past any full bundle encountered.
 	 *
 	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
 	 * So don't use this on RISCV64.
 	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
+	for (size_t idx = bitarray->first_free_bundle; idx < bitarray->num_bundles; idx++) {
 		if (~bitarray->bundles[idx] == 0U) {
 			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
+			bitarray->first_free_bundle = idx + 1;
 			continue;
 		}
 
+		bit_idx = idx * bundle_bitness(bitarray);
 		if (bitarray->bundles[idx] != 0U) {
 			/* Find the first free bit in bundle if not all free */
 			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
@@ -539,6 +555,19 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 
 	off_end = bitarray->num_bits - num_bits;
 	ret = -ENOSPC;
+
+	if (num_bits == 1) {
+		/* The scan above already found the first cleared bit. */
+		if (bit_idx <= off_end) {
+			bitarray->bundles[bit_idx / bundle_bitness(bitarray)] |=
+				BIT(bit_idx % bundle_bitness(bitarray));
+
+			*offset = bit_idx;
+			ret = 0;
+		}
+		goto out;
+	}
+
 	while (bit_idx <= off_end) {
 		if (match_region(bitarray, bit_idx, num_bits, false,
 				 &bd, &mismatch)) {
@@ -566,6 +595,7 @@ int sys_bitarray_find_nth_set(sys_bitarray_t *bitarray, size_t n, size_t num_bit
 	k_spinlock_key_t key;
 	size_t count, idx;
 	uint32_t mask;
+	uint32_t bundle;
 	struct bundle_data bd;
 	int ret;
 
@@ -618,18 +648,18 @@ int sys_bitarray_find_nth_set(sys_bitarray_t *bitarray, size_t n, size_t num_bit
 
 found:
 	/* The bit we are looking for must be in the current bundle idx.
-	 * Find out the exact index of the bit.
+	 * Clear the n - 1 least significant bits set; the bit we are looking
+	 * for is then the least significant bit left.
 	 */
-	for (int j = 0; j <= bundle_bitness(bitarray) - 1; j++) {
-		if (bitarray->bundles[idx] & mask & BIT(j)) {
-			if (--n <= 0) {
-				*found_at = idx * bundle_bitness(bitarray) + j;
-				ret = 0;
-				break;
-			}
-		}
+	bundle = bitarray->bundles[idx] & mask;
+	while (n > 1) {
+		bundle &= bundle - 1;
+		n--;
 	}
 
+	*found_at = idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1;
+	ret = 0;
+
 out:
 	k_spin_unlock(&bitarray->lock, key);
 	return ret;
@@ -662,6 +692,7 @@ int sys_bitarray_free(sys_bitarray_t *bitarray, size_t num_bits,
 	 */
 	if (match_region(bitarray, offset, num_bits, true, &bd, NULL)) {
 		set_region(bitarray, offset, num_bits, false, &bd);
+		free_hint_lower(bitarray, bd.sidx);
 		ret = 0;
 	} else {
 		ret = -EFAULT;
@@ -729,6 +760,9 @@ static int set_clear_region(sys_bitarray_t *bitarray, size_t num_bits,
 	}
 
 	set_region(bitarray, offset, num_bits, to_set, NULL);
+	if (!to_set) {
+		free_hint_lower(bitarray, offset / bundle_bitness(bitarray));
+	}
 	ret = 0;
 
 out:
@@ -761,6 +795,9 @@ int sys_bitarray_test_and_set_region(sys_bitarray_t *bitarray, size_t num_bits,
 	region_clear = match_region(bitarray, offset, num_bits, !to_set, &bd, NULL);
 	if (region_clear) {
 		set_region(bitarray, offset, num_bits, to_set, &bd);
+		if (!to_set) {
+			free_hint_lower(bitarray, bd.sidx);
+		}
 		ret = 0;
 	} else {
 		ret = -EEXIST;
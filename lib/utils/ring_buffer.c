@@ -33,6 +33,28 @@ uint32_t ring_buf_put_claim(struct ring_buf *buf, uint8_t **data, uint32_t size)
 	return size;
 }
 
+uint32_t ring_buf_put_claim2(struct ring_buf *buf,
+			     uint8_t **data1, uint32_t *size1,
+			     uint8_t **data2, uint32_t *size2,
+			     uint32_t size)
+{
+	uint32_t total;
+
+	*size1 = ring_buf_put_claim(buf, data1, size);
+	total = *size1;
+
+	if (total < size) {
+		/* first segment ended at the wrap, claim the rest */
+		*size2 = ring_buf_put_claim(buf, data2, size - total);
+		total += *size2;
+	} else {
+		*data2 = NULL;
+		*size2 = 0U;
+	}
+
+	return total;
+}
+
 int ring_buf_put_finish(struct ring_buf *buf, uint32_t size)
 {
 	uint32_t finish_space, wrap_size;
@@ -56,18 +78,17 @@ int ring_buf_put_finish(struct ring_buf *buf, uint32_t size)
 
 uint32_t ring_buf_put(struct ring_buf *buf, const uint8_t *data, uint32_t size)
 {
-	uint8_t *dst;
-	uint32_t partial_size;
-	uint32_t total_size = 0U;
+	uint8_t *dst1, *dst2;
+	uint32_t size1, size2;
+	uint32_t total_size;
 	int err;
 
-	do {
-		partial_size = ring_buf_put_claim(buf, &dst, size);
-		memcpy(dst, data, partial_size);
-		total_size += partial_size;
-		size -= partial_size;
-		data += partial_size;
-	} while (size && partial_size);
+	total_size = ring_buf_put_claim2(buf, &dst1, &size1, &dst2, &size2, size);
+
+	memcpy(dst1, data, size1);
+	if (size2 > 0U) {
+		memcpy(dst2, data + size1, size2);
+	}
 
 	err = ring_buf_put_finish(buf, total_size);
 	__ASSERT_NO_MSG(err == 0);
@@ -100,6 +121,28 @@ uint32_t ring_buf_get_claim(struct ring_buf *buf, uint8_t **data, uint32_t size)
 	return size;
 }
 
+uint32_t ring_buf_get_claim2(struct ring_buf *buf,
+			     uint8_t **data1, uint32_t *size1,
+			     uint8_t **data2, uint32_t *size2,
+			     uint32_t size)
+{
+	uint32_t total;
+
+	*size1 = ring_buf_get_claim(buf, data1, size);
+	total = *size1;
+
+	if (total < size) {
+		/* first segment ended at the wrap, claim the rest */
+		*size2 = ring_buf_get_claim(buf, data2, size - total);
+		total += *size2;
+	} else {
+		*data2 = NULL;
+		*size2 = 0U;
+	}
+
+	return total;
+}
+
 int ring_buf_get_finish(struct ring_buf *buf, uint32_t size)
 {
 	uint32_t finish_space, wrap_size;
@@ -123,20 +166,19 @@ int ring_buf_get_finish(struct ring_buf *buf, uint32_t size)
 
 uint32_t ring_buf_get(struct ring_buf *buf, uint8_t *data, uint32_t size)
 {
-	uint8_t *src;
-	uint32_t partial_size;
-	uint32_t total_size = 0U;
+	uint8_t *src1, *src2;
+	uint32_t size1, size2;
+	uint32_t total_size;
 	int err;
 
-	do {
-		partial_size = ring_buf_get_claim(buf, &src, size);
-		if (data) {
-			memcpy(data, src, partial_size);
-			data += partial_size;
+	total_size = ring_buf_get_claim2(buf, &src1, &size1, &src2, &size2, size);
+
+	if (data) {
+		memcpy(data, src1, size1);
+		if (size2 > 0U) {
+			memcpy(data + size1, src2, size2);
 		}
-		total_size += partial_size;
-		size -= partial_size;
-	} while (size && partial_size);
+	}
 
 	err = ring_buf_get_finish(buf, total_size);
 	__ASSERT_NO_MSG(err == 0);
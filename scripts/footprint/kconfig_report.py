@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+# A script to attribute footprint to subsystems and flag size-for-speed
+# Kconfig tradeoffs, using the json reports generated by size_report and
+# the .config of the build. When you call the ram_report or rom_report
+# targets you end up with ram.json/rom.json in the build directory that
+# can be used as input for this script; pass a report from an earlier
+# build with --baseline to track deltas between builds.
+
+# Example:
+#    ./scripts/footprint/kconfig_report.py build/rom.json \
+#        -c build/zephyr/.config --baseline old/rom.json
+
+from anytree.importer import DictImporter
+from anytree import PreOrderIter
+
+import colorama
+from colorama import Fore
+import json
+import argparse
+
+importer = DictImporter()
+
+# Kconfig options that trade size for speed: option as set in .config,
+# mapped to the advice shown when it is in its size-for-speed state.
+TRADEOFFS = [
+    ("CONFIG_SPEED_OPTIMIZATIONS", "y",
+     "compiler optimizes for speed; CONFIG_SIZE_OPTIMIZATIONS=y reclaims flash"),
+    ("CONFIG_LTO", None,
+     "link time optimization is off; CONFIG_LTO=y typically shrinks flash"),
+    ("CONFIG_CBPRINTF_COMPLETE", "y",
+     "full cbprintf formatter linked; CONFIG_CBPRINTF_NANO=y is much smaller"),
+    ("CONFIG_CBPRINTF_FULL_INTEGRAL", "y",
+     "64-bit format conversions linked; consider CONFIG_CBPRINTF_REDUCED_INTEGRAL=y"),
+    ("CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE", None,
+     "unrolled word-wise string routines linked; "
+     "CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE=y uses compact byte loops"),
+    ("CONFIG_LOG_MODE_MINIMAL", None,
+     "full logging backend linked; CONFIG_LOG_MODE_MINIMAL=y is much smaller"),
+    ("CONFIG_SHELL_MINIMAL", None,
+     "shell built with default features; CONFIG_SHELL_MINIMAL=y trims them"),
+]
+
+# Tree depth used for attribution: 2 keeps e.g. subsys/net and
+# drivers/serial apart while not splitting on individual files.
+GROUP_DEPTH = 2
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+                description="Attribute footprint per subsystem and flag "
+                            "size-for-speed Kconfig tradeoffs.", allow_abbrev=False)
+    parser.add_argument("report", help="ram.json or rom.json generated by size_report")
+    parser.add_argument("-c", "--config", help=".config of the build")
+    parser.add_argument("-b", "--baseline",
+                        help="report from an earlier build to diff against")
+    parser.add_argument("-n", "--top", type=int, default=20,
+                        help="number of groups to show (default: 20)")
+
+    return parser.parse_args()
+
+
+def load_config(path):
+    config = {}
+    with open(path, "r") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("#") or "=" not in line:
+                continue
+            key, value = line.split("=", 1)
+            config[key] = value.strip('"')
+    return config
+
+
+def group_sizes(data):
+    """Sum leaf symbol sizes per path group of at most GROUP_DEPTH components"""
+    groups = {}
+    for ch in data['symbols']['children']:
+        root = importer.import_(ch)
+        for node in PreOrderIter(root):
+            if hasattr(node, "children") and node.children:
+                continue
+            parts = str(node.identifier).split("/")
+            group = "/".join(parts[:GROUP_DEPTH])
+            groups[group] = groups.get(group, 0) + node.size
+    return groups
+
+
+def main():
+    colorama.init()
+
+    args = parse_args()
+
+    with open(args.report, "r") as f:
+        data = json.load(f)
+
+    groups = group_sizes(data)
+    base_groups = {}
+    if args.baseline:
+        with open(args.baseline, "r") as f:
+            base_groups = group_sizes(json.load(f))
+
+    total = data['total_size']
+    print(f"Total size: {total} bytes\n")
+
+    ranked = sorted(groups.items(), key=lambda kv: kv[1], reverse=True)
+    for group, size in ranked[:args.top]:
+        line = f"{size:10d} {100 * size / total:6.2f}%  {group}"
+        if args.baseline:
+            diff = size - base_groups.get(group, 0)
+            if diff > 0:
+                line += Fore.RED + f"  +{diff}" + Fore.RESET
+            elif diff < 0:
+                line += Fore.GREEN + f"  {diff}" + Fore.RESET
+        print(line)
+
+    for group, size in sorted(base_groups.items()):
+        if group not in groups:
+            print(Fore.GREEN + f"{-size:10d}        -  {group} (removed)" + Fore.RESET)
+
+    if args.config:
+        config = load_config(args.config)
+        advice = [hint for option, state, hint in TRADEOFFS
+                  if config.get(option) == state]
+        if advice:
+            print("\nSize-for-speed tradeoffs in this configuration:")
+            for hint in advice:
+                print(Fore.YELLOW + f"  - {hint}" + Fore.RESET)
+
+
+if __name__ == "__main__":
+    main()
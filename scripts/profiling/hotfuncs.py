@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Hot function extractor for XIP RAM placement
+
+This ranks functions by self samples (innermost frame) from stack samples
+captured by the perf subsystem, using the .elf file to resolve addresses,
+and optionally emits a CMake fragment that relocates the source files
+defining the hottest functions into RAM via zephyr_code_relocate()
+(CONFIG_CODE_DATA_RELOCATION). Relocation granularity is the translation
+unit: the generated fragment lists each defining source file once, ranked
+by the samples accumulated over all of its hot functions.
+
+Usage:
+    ./scripts/profiling/hotfuncs.py <file with perf printbuf output> <ELF file> \\
+        [-n TOP] [-o relocate.cmake]
+
+Include the generated fragment from the application CMakeLists.txt and
+enable CONFIG_CODE_DATA_RELOCATION=y to apply the placement on the next
+build.
+"""
+
+import re
+import sys
+import struct
+import argparse
+import binascii
+from collections import Counter
+from functools import lru_cache
+from elftools.elf.elffile import ELFFile
+
+
+@lru_cache(maxsize=None)
+def addr_to_sym(addr, elf):
+    symtab = elf.get_section_by_name(".symtab")
+    for sym in symtab.iter_symbols():
+        if sym.entry.st_info.type == "STT_FUNC" and sym.entry.st_value <= addr < sym.entry.st_value + sym.entry.st_size:
+            return sym.name
+    if addr == 0:
+        return "nullptr"
+    return "[unknown]"
+
+
+def count_self_samples(buf, elf):
+    counts = Counter()
+    while buf:
+        count, = struct.unpack_from(">Q", buf)
+        assert count > 0
+        addrs = struct.unpack_from(f">{count}Q", buf, 8)
+
+        # first address is the innermost frame, i.e. where the sample hit
+        counts[addr_to_sym(addrs[0], elf)] += 1
+        buf = buf[8 + 8 * count:]
+    return counts
+
+
+def func_to_file_map(elf):
+    """Map function names to defining source files using DWARF info"""
+    mapping = {}
+    if not elf.has_dwarf_info():
+        return mapping
+    for cu in elf.get_dwarf_info().iter_CUs():
+        path = cu.get_top_DIE().get_full_path()
+        for die in cu.iter_DIEs():
+            if die.tag != "DW_TAG_subprogram":
+                continue
+            name = die.attributes.get("DW_AT_name")
+            if name is not None:
+                mapping.setdefault(name.value.decode(), path)
+    return mapping
+
+
+def emit_cmake(path, hot, file_map, total):
+    file_samples = Counter()
+    unmapped = []
+    for func, samples in hot:
+        src = file_map.get(func)
+        if src is None:
+            unmapped.append(func)
+        else:
+            file_samples[src] += samples
+
+    with open(path, "w") as out:
+        out.write("# Generated by hotfuncs.py - do not edit\n")
+        out.write("# Requires CONFIG_CODE_DATA_RELOCATION=y\n")
+        for func in unmapped:
+            out.write(f"# no source file found for {func} (missing debug info?)\n")
+        for src, samples in file_samples.most_common():
+            out.write(f"# {samples}/{total} samples\n")
+            out.write(f"zephyr_code_relocate(FILES {src} LOCATION RAM)\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter,
+                                     allow_abbrev=False)
+    parser.add_argument("perf_output", help="file with perf printbuf output")
+    parser.add_argument("elf_file", help="ELF file the samples were captured from")
+    parser.add_argument("-n", "--top", type=int, default=10,
+                        help="number of hottest functions to select (default: 10)")
+    parser.add_argument("-o", "--output",
+                        help="write a zephyr_code_relocate() CMake fragment to this file")
+    args = parser.parse_args()
+
+    elf = ELFFile(open(args.elf_file, "rb"))
+    with open(args.perf_output, "r") as f:
+        inp = f.read()
+
+    lines = inp.splitlines()
+    assert int(re.match(r"Perf buf length (\d+)", lines[0]).group(1)) == len(lines) - 1
+    buf = binascii.unhexlify("".join(lines[1:]))
+
+    counts = count_self_samples(buf, elf)
+    total = sum(counts.values())
+    hot = [(func, samples) for func, samples in counts.most_common(args.top)
+           if func not in ("[unknown]", "nullptr")]
+
+    file_map = func_to_file_map(elf)
+    for func, samples in hot:
+        src = file_map.get(func, "?")
+        print(f"{samples:8d} {100 * samples / total:6.2f}% {func} ({src})")
+
+    if args.output:
+        emit_cmake(args.output, hot, file_map, total)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -5116,6 +5116,43 @@ static void vs_set_min_used_chans(struct net_buf *buf, struct net_buf **evt)
 }
 #endif /* CONFIG_BT_CTLR_MIN_USED_CHAN && CONFIG_BT_PERIPHERAL */
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+static void vs_read_sched_stats(struct net_buf *buf, struct net_buf **evt)
+{
+	struct bt_hci_cp_vs_read_sched_stats *cmd = (void *)buf->data;
+	struct bt_hci_rp_vs_read_sched_stats *rp;
+	struct lll_sched_stats stats;
+	uint8_t i;
+
+	BUILD_ASSERT(BT_HCI_VS_SCHED_STATS_LAZY_BUCKETS ==
+		     LLL_SCHED_STATS_LAZY_BUCKETS);
+	BUILD_ASSERT(BT_HCI_VS_SCHED_STATS_ROLE_COUNT ==
+		     LLL_SCHED_STATS_ROLE_COUNT);
+
+	lll_sched_stats_get(&stats);
+
+	if (cmd->clear) {
+		lll_sched_stats_reset();
+	}
+
+	rp = hci_cmd_complete(evt, sizeof(*rp));
+	rp->status = 0x00;
+	rp->prepare_count = sys_cpu_to_le32(stats.prepare_count);
+	rp->resume_count = sys_cpu_to_le32(stats.resume_count);
+	rp->prepare_queued = sys_cpu_to_le32(stats.prepare_queued);
+	rp->preempt_stop_fail = sys_cpu_to_le32(stats.preempt_stop_fail);
+	for (i = 0U; i < BT_HCI_VS_SCHED_STATS_LAZY_BUCKETS; i++) {
+		rp->prepare_lazy[i] = sys_cpu_to_le32(stats.prepare_lazy[i]);
+	}
+	rp->prepare_lazy_max = sys_cpu_to_le16(stats.prepare_lazy_max);
+	for (i = 0U; i < BT_HCI_VS_SCHED_STATS_ROLE_COUNT; i++) {
+		rp->done_count[i] = sys_cpu_to_le32(stats.done_count[i]);
+	}
+	rp->done_aborted = sys_cpu_to_le32(stats.done_aborted);
+	rp->done_late = sys_cpu_to_le32(stats.done_late);
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 #if defined(CONFIG_BT_CTLR_VS_SCAN_REQ_RX)
 static void vs_set_scan_req_reports(struct net_buf *buf, struct net_buf **evt)
 {
@@ -5711,6 +5748,12 @@ int hci_vendor_cmd_handle_common(uint16_t ocf, struct net_buf *cmd,
 		break;
 #endif /* CONFIG_BT_CTLR_MIN_USED_CHAN && CONFIG_BT_PERIPHERAL */
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	case BT_OCF(BT_HCI_OP_VS_READ_SCHED_STATS):
+		vs_read_sched_stats(cmd, evt);
+		break;
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 #if defined(CONFIG_BT_HCI_MESH_EXT)
 	case BT_OCF(BT_HCI_OP_VS_MESH):
 		mesh_cmd_handle(cmd, evt);
@@ -632,3 +632,42 @@ int lll_prepare_resolve(lll_is_abort_cb_t is_abort_cb, lll_abort_cb_t abort_cb,
 			lll_prepare_cb_t prepare_cb,
 			struct lll_prepare_param *prepare_param,
 			uint8_t is_resume, uint8_t is_dequeue);
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+/* Histogram buckets for skipped ticker expirations (lazy) at prepare:
+ * 0, 1, 2 and 3-or-more.
+ */
+#define LLL_SCHED_STATS_LAZY_BUCKETS 4
+
+enum lll_sched_stats_role {
+	LLL_SCHED_STATS_ROLE_CONN,
+	LLL_SCHED_STATS_ROLE_ADV,
+	LLL_SCHED_STATS_ROLE_SCAN,
+	LLL_SCHED_STATS_ROLE_SYNC,
+	LLL_SCHED_STATS_ROLE_ISO,
+	LLL_SCHED_STATS_ROLE_OTHER,
+
+	LLL_SCHED_STATS_ROLE_COUNT
+};
+
+struct lll_sched_stats {
+	/* Prepare pipeline */
+	uint32_t prepare_count;
+	uint32_t resume_count;
+	uint32_t prepare_queued;
+	uint32_t preempt_stop_fail;
+	uint32_t prepare_lazy[LLL_SCHED_STATS_LAZY_BUCKETS];
+	uint16_t prepare_lazy_max;
+
+	/* Radio event outcomes */
+	uint32_t done_count[LLL_SCHED_STATS_ROLE_COUNT];
+	uint32_t done_aborted;
+	uint32_t done_late;
+};
+
+void lll_sched_stats_prepare(struct lll_prepare_param *prepare_param, int err);
+void lll_sched_stats_resume(void);
+void lll_sched_stats_done(uint8_t role, uint8_t result);
+void lll_sched_stats_get(struct lll_sched_stats *stats);
+void lll_sched_stats_reset(void);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
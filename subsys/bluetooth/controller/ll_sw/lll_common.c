@@ -5,8 +5,11 @@
  */
 
 #include <errno.h>
+#include <string.h>
+
 #include <zephyr/types.h>
 #include <zephyr/device.h>
+#include <zephyr/sys/util.h>
 
 #include "util/mem.h"
 #include "util/memq.h"
@@ -64,6 +67,10 @@ int lll_prepare(lll_is_abort_cb_t is_abort_cb, lll_abort_cb_t abort_cb,
 
 	err = lll_prepare_resolve(is_abort_cb, abort_cb, prepare_cb, prepare_param, 0U, 0U);
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	lll_sched_stats_prepare(prepare_param, err);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 	return err;
 }
 
@@ -76,7 +83,68 @@ void lll_resume(void *param)
 	err = lll_prepare_resolve(next->is_abort_cb, next->abort_cb, next->prepare_cb,
 				  &next->prepare_param, next->is_resume, 1U);
 	LL_ASSERT(!err || err == -EINPROGRESS);
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	lll_sched_stats_resume();
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+}
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+/* Counters are incremented from LLL and ULL execution contexts and read
+ * from the HCI command path without locking; individual 32-bit loads and
+ * stores are atomic on supported architectures and the statistics are
+ * best-effort by design.
+ */
+static struct lll_sched_stats sched_stats;
+
+void lll_sched_stats_prepare(struct lll_prepare_param *prepare_param, int err)
+{
+	uint16_t lazy = prepare_param->lazy;
+
+	sched_stats.prepare_count++;
+
+	sched_stats.prepare_lazy[MIN(lazy, LLL_SCHED_STATS_LAZY_BUCKETS - 1)]++;
+	if (lazy > sched_stats.prepare_lazy_max) {
+		sched_stats.prepare_lazy_max = lazy;
+	}
+
+	if (err == -EINPROGRESS) {
+		/* Event in progress, prepare was queued in the pipeline */
+		sched_stats.prepare_queued++;
+	} else if (err > 0) {
+		/* TICKER_STATUS_FAILURE or TICKER_STATUS_BUSY from the
+		 * preemption ticker stop.
+		 */
+		sched_stats.preempt_stop_fail++;
+	}
+}
+
+void lll_sched_stats_resume(void)
+{
+	sched_stats.resume_count++;
+}
+
+void lll_sched_stats_done(uint8_t role, uint8_t result)
+{
+	sched_stats.done_count[role]++;
+
+	if (result == DONE_ABORTED) {
+		sched_stats.done_aborted++;
+	} else if (result == DONE_LATE) {
+		sched_stats.done_late++;
+	}
+}
+
+void lll_sched_stats_get(struct lll_sched_stats *stats)
+{
+	*stats = sched_stats;
+}
+
+void lll_sched_stats_reset(void)
+{
+	memset(&sched_stats, 0, sizeof(sched_stats));
 }
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
 
 #if defined(CONFIG_BT_CTLR_JIT_SCHEDULING)
 void lll_done_score(void *param, uint8_t result)
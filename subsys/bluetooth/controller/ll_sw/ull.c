@@ -2968,6 +2968,77 @@ static inline void rx_demux_rx(memq_link_t *link, struct node_rx_hdr *rx)
 	}
 }
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+static void sched_stats_done(struct node_rx_event_done *done)
+{
+	uint8_t result = DONE_COMPLETED;
+	uint8_t role;
+
+#if defined(CONFIG_BT_CTLR_JIT_SCHEDULING)
+	result = done->extra.result;
+#endif /* CONFIG_BT_CTLR_JIT_SCHEDULING */
+
+	switch (done->extra.type) {
+#if defined(CONFIG_BT_CONN)
+	case EVENT_DONE_EXTRA_TYPE_CONN:
+		role = LLL_SCHED_STATS_ROLE_CONN;
+		break;
+#endif /* CONFIG_BT_CONN */
+
+#if defined(CONFIG_BT_CTLR_ADV_EXT) || defined(CONFIG_BT_CTLR_JIT_SCHEDULING)
+#if defined(CONFIG_BT_BROADCASTER)
+	case EVENT_DONE_EXTRA_TYPE_ADV:
+	case EVENT_DONE_EXTRA_TYPE_ADV_AUX:
+		role = LLL_SCHED_STATS_ROLE_ADV;
+		break;
+
+#if defined(CONFIG_BT_CTLR_ADV_ISO)
+	case EVENT_DONE_EXTRA_TYPE_ADV_ISO_COMPLETE:
+	case EVENT_DONE_EXTRA_TYPE_ADV_ISO_TERMINATE:
+		role = LLL_SCHED_STATS_ROLE_ISO;
+		break;
+#endif /* CONFIG_BT_CTLR_ADV_ISO */
+#endif /* CONFIG_BT_BROADCASTER */
+#endif /* CONFIG_BT_CTLR_ADV_EXT || CONFIG_BT_CTLR_JIT_SCHEDULING */
+
+#if defined(CONFIG_BT_OBSERVER)
+#if defined(CONFIG_BT_CTLR_ADV_EXT)
+	case EVENT_DONE_EXTRA_TYPE_SCAN:
+	case EVENT_DONE_EXTRA_TYPE_SCAN_AUX:
+		role = LLL_SCHED_STATS_ROLE_SCAN;
+		break;
+
+#if defined(CONFIG_BT_CTLR_SYNC_PERIODIC)
+	case EVENT_DONE_EXTRA_TYPE_SYNC:
+		role = LLL_SCHED_STATS_ROLE_SYNC;
+		break;
+
+#if defined(CONFIG_BT_CTLR_SYNC_ISO)
+	case EVENT_DONE_EXTRA_TYPE_SYNC_ISO_ESTAB:
+	case EVENT_DONE_EXTRA_TYPE_SYNC_ISO:
+	case EVENT_DONE_EXTRA_TYPE_SYNC_ISO_TERMINATE:
+		role = LLL_SCHED_STATS_ROLE_ISO;
+		break;
+#endif /* CONFIG_BT_CTLR_SYNC_ISO */
+#endif /* CONFIG_BT_CTLR_SYNC_PERIODIC */
+#endif /* CONFIG_BT_CTLR_ADV_EXT */
+#endif /* CONFIG_BT_OBSERVER */
+
+#if defined(CONFIG_BT_CTLR_CONN_ISO)
+	case EVENT_DONE_EXTRA_TYPE_CIS:
+		role = LLL_SCHED_STATS_ROLE_ISO;
+		break;
+#endif /* CONFIG_BT_CTLR_CONN_ISO */
+
+	default:
+		role = LLL_SCHED_STATS_ROLE_OTHER;
+		break;
+	}
+
+	lll_sched_stats_done(role, result);
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 static inline void rx_demux_event_done(memq_link_t *link,
 				       struct node_rx_event_done *done)
 {
@@ -2981,6 +3052,10 @@ static inline void rx_demux_event_done(memq_link_t *link,
 		ull_ref_dec(ull_hdr);
 	}
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	sched_stats_done(done);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 	/* Process role dependent event done */
 	switch (done->extra.type) {
 #if defined(CONFIG_BT_CONN)
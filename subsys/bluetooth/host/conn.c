@@ -92,6 +92,9 @@ void bt_tx_irq_raise(void);
 #define CONN_UPDATE_TIMEOUT  K_MSEC(CONFIG_BT_CONN_PARAM_UPDATE_TIMEOUT)
 
 static void deferred_work(struct k_work *work);
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+static void auto_tune_work(struct k_work *work);
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
 static void notify_connected(struct bt_conn *conn);
 
 static struct bt_conn acl_conns[CONFIG_BT_MAX_CONN];
@@ -360,6 +363,9 @@ struct bt_conn *bt_conn_new(struct bt_conn *conns, size_t size)
 #if defined(CONFIG_BT_CONN)
 	k_work_init_delayable(&conn->deferred_work, deferred_work);
 #endif /* CONFIG_BT_CONN */
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+	k_work_init_delayable(&conn->tune.work, auto_tune_work);
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
 #if defined(CONFIG_BT_CONN_TX)
 	k_work_init(&conn->tx_complete_work, tx_complete_work);
 #endif /* CONFIG_BT_CONN_TX */
@@ -1105,6 +1111,12 @@ void bt_conn_tx_processor(void)
 		goto exit;
 	}
 
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+	if (conn->type == BT_CONN_TYPE_LE) {
+		conn->tune.tx_bytes += buf_len;
+	}
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
+
 	/* Always kick the TX work. It will self-suspend if it doesn't get
 	 * resources or there is nothing left to send.
 	 */
@@ -1235,6 +1247,18 @@ void bt_conn_set_state(struct bt_conn *conn, bt_conn_state_t state)
 			k_work_schedule(&conn->deferred_work,
 					CONN_UPDATE_TIMEOUT);
 		}
+
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+		if (conn->type == BT_CONN_TYPE_LE) {
+			conn->tune.tx_bytes = 0U;
+			conn->tune.busy_windows = 0U;
+			conn->tune.idle_windows = 0U;
+			conn->tune.fast = false;
+			conn->tune.boosted = false;
+			k_work_schedule(&conn->tune.work,
+					K_MSEC(CONFIG_BT_CONN_AUTO_TUNE_WINDOW_MS));
+		}
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
 #endif /* CONFIG_BT_CONN */
 
 		break;
@@ -1258,6 +1282,10 @@ void bt_conn_set_state(struct bt_conn *conn, bt_conn_state_t state)
 
 			bt_conn_reset_rx_state(conn);
 
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+			k_work_cancel_delayable(&conn->tune.work);
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
+
 			LOG_DBG("trigger disconnect work");
 			k_work_reschedule(&conn->deferred_work, K_NO_WAIT);
 
@@ -2294,6 +2322,112 @@ static void deferred_work(struct k_work *work)
 	atomic_set_bit(conn->flags, BT_CONN_PERIPHERAL_PARAM_UPDATE);
 }
 
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+/* Number of consecutive busy windows before tuning for throughput */
+#define AUTO_TUNE_BUSY_WINDOWS 2
+
+static void auto_tune_boost(struct bt_conn *conn)
+{
+	int err;
+
+	if (BT_FEAT_LE_PHY_2M(bt_dev.le.features) &&
+	    !uses_symmetric_2mbit_phy(conn)) {
+		err = bt_le_set_phy(conn, 0U, BT_HCI_LE_PHY_PREFER_2M,
+				    BT_HCI_LE_PHY_PREFER_2M,
+				    BT_HCI_LE_PHY_CODED_ANY);
+		if (err) {
+			LOG_WRN("conn %p: failed LE Set PHY (%d)", conn, err);
+		}
+	}
+
+	if (BT_FEAT_LE_DLE(bt_dev.le.features)) {
+		uint16_t tx_octets, tx_time;
+
+		err = bt_hci_le_read_max_data_len(&tx_octets, &tx_time);
+		if (!err) {
+			err = bt_le_set_data_len(conn, tx_octets, tx_time);
+			if (err) {
+				LOG_WRN("conn %p: failed to set data len (%d)",
+					conn, err);
+			}
+		}
+	}
+}
+
+static void auto_tune_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_conn *conn = CONTAINER_OF(dwork, struct bt_conn, tune.work);
+	const struct bt_le_conn_param *param;
+	uint32_t tx_bytes;
+	bool busy;
+	int err;
+
+	if (conn->state != BT_CONN_CONNECTED || conn->type != BT_CONN_TYPE_LE) {
+		return;
+	}
+
+	tx_bytes = conn->tune.tx_bytes;
+	conn->tune.tx_bytes = 0U;
+
+	/* The connection is considered busy when data was still queued at
+	 * the end of the window, or when the achieved rate exceeded the
+	 * configured threshold.
+	 */
+	busy = (conn->has_data != NULL && conn->has_data(conn)) ||
+	       ((tx_bytes * MSEC_PER_SEC) / CONFIG_BT_CONN_AUTO_TUNE_WINDOW_MS >
+		CONFIG_BT_CONN_AUTO_TUNE_THRESHOLD);
+
+	if (busy) {
+		conn->tune.busy_windows++;
+		conn->tune.idle_windows = 0U;
+	} else {
+		conn->tune.idle_windows++;
+		conn->tune.busy_windows = 0U;
+	}
+
+	if (!conn->tune.fast &&
+	    conn->tune.busy_windows >= AUTO_TUNE_BUSY_WINDOWS) {
+		if (!conn->tune.boosted) {
+			auto_tune_boost(conn);
+			conn->tune.boosted = true;
+		}
+
+		param = BT_LE_CONN_PARAM(CONFIG_BT_CONN_AUTO_TUNE_FAST_INT,
+					 CONFIG_BT_CONN_AUTO_TUNE_FAST_INT,
+					 0, conn->le.timeout);
+
+		LOG_DBG("conn %p: busy (%u B/window), tuning for throughput",
+			conn, tx_bytes);
+
+		err = bt_conn_le_param_update(conn, param);
+		if (err) {
+			LOG_WRN("conn %p: param update failed (err %d)", conn, err);
+		} else {
+			conn->tune.fast = true;
+		}
+	} else if (conn->tune.fast &&
+		   conn->tune.idle_windows >= CONFIG_BT_CONN_AUTO_TUNE_IDLE_WINDOWS) {
+		param = BT_LE_CONN_PARAM(CONFIG_BT_CONN_AUTO_TUNE_SLOW_INT,
+					 CONFIG_BT_CONN_AUTO_TUNE_SLOW_INT,
+					 CONFIG_BT_CONN_AUTO_TUNE_SLOW_LATENCY,
+					 conn->le.timeout);
+
+		LOG_DBG("conn %p: idle, relaxing connection parameters", conn);
+
+		err = bt_conn_le_param_update(conn, param);
+		if (err) {
+			LOG_WRN("conn %p: param update failed (err %d)", conn, err);
+		} else {
+			conn->tune.fast = false;
+		}
+	}
+
+	k_work_schedule(&conn->tune.work,
+			K_MSEC(CONFIG_BT_CONN_AUTO_TUNE_WINDOW_MS));
+}
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
+
 static struct bt_conn *acl_conn_new(void)
 {
 	return bt_conn_new(acl_conns, ARRAY_SIZE(acl_conns));
@@ -262,6 +262,21 @@ struct bt_conn {
 	 */
 	struct k_work_delayable	deferred_work;
 
+#if defined(CONFIG_BT_CONN_AUTO_TUNE)
+	/* Closed-loop connection parameter tuner state */
+	struct {
+		struct k_work_delayable work;
+		/* ACL bytes sent during the current measurement window */
+		uint32_t tx_bytes;
+		uint8_t busy_windows;
+		uint8_t idle_windows;
+		/* Currently tuned for throughput */
+		bool fast;
+		/* PHY and data length updates have been requested */
+		bool boosted;
+	} tune;
+#endif /* CONFIG_BT_CONN_AUTO_TUNE */
+
 	union {
 		struct bt_conn_le	le;
 #if defined(CONFIG_BT_CLASSIC)
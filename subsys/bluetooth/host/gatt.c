@@ -1243,6 +1243,97 @@ BT_GATT_SERVICE_DEFINE(_1_gatt_svc,
 #endif /* CONFIG_BT_GATT_SERVICE_CHANGED */
 );
 
+#if defined(CONFIG_BT_GATT_HANDLE_INDEX)
+/* Handle-indexed view of the attribute database. Rebuilt lazily on the
+ * first lookup after a registration change, which always happens under
+ * k_sched_lock().
+ */
+static const struct bt_gatt_attr *attr_index[CONFIG_BT_GATT_HANDLE_INDEX_MAX];
+static uint8_t attr_index_key[CONFIG_BT_GATT_HANDLE_INDEX_MAX];
+static uint16_t attr_index_last;
+static bool attr_index_complete;
+static bool attr_index_valid;
+
+/* One-byte UUID discriminator used to skip attributes during filtered
+ * scans without a full bt_uuid_cmp(). Representation independent: for
+ * UUIDs based on the Bluetooth Base UUID, val[12] of the 128-bit form
+ * equals the low byte of the 16/32-bit forms. Collisions only cost the
+ * bt_uuid_cmp() that would have run anyway.
+ */
+static uint8_t uuid_index_key(const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		return BT_UUID_16(uuid)->val & 0xff;
+	case BT_UUID_TYPE_32:
+		return BT_UUID_32(uuid)->val & 0xff;
+	case BT_UUID_TYPE_128:
+	default:
+		return BT_UUID_128(uuid)->val[12];
+	}
+}
+
+static bool attr_index_put(const struct bt_gatt_attr *attr, uint16_t handle)
+{
+	if (handle == 0U || handle > ARRAY_SIZE(attr_index)) {
+		return false;
+	}
+
+	attr_index[handle - 1] = attr;
+	attr_index_key[handle - 1] = uuid_index_key(attr->uuid);
+	attr_index_last = MAX(attr_index_last, handle);
+
+	return true;
+}
+
+static void attr_index_rebuild(void)
+{
+	uint16_t handle = 0;
+	size_t i;
+
+	k_sched_lock();
+
+	(void)memset(attr_index, 0, sizeof(attr_index));
+	attr_index_last = 0U;
+	attr_index_complete = true;
+
+	STRUCT_SECTION_FOREACH(bt_gatt_service_static, static_svc) {
+		for (i = 0; i < static_svc->attr_count; i++) {
+			handle++;
+			if (!attr_index_put(&static_svc->attrs[i], handle)) {
+				attr_index_complete = false;
+			}
+		}
+	}
+
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	struct bt_gatt_service *svc;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
+		for (i = 0; i < svc->attr_count; i++) {
+			if (!attr_index_put(&svc->attrs[i],
+					    svc->attrs[i].handle)) {
+				attr_index_complete = false;
+			}
+		}
+	}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
+	attr_index_valid = true;
+
+	k_sched_unlock();
+}
+
+static inline void attr_index_invalidate(void)
+{
+	attr_index_valid = false;
+}
+#else
+static inline void attr_index_invalidate(void)
+{
+}
+#endif /* CONFIG_BT_GATT_HANDLE_INDEX */
+
 #if defined(CONFIG_BT_GATT_DYNAMIC_DB)
 static uint8_t found_attr(const struct bt_gatt_attr *attr, uint16_t handle,
 			  void *user_data)
@@ -1764,6 +1855,8 @@ int bt_gatt_service_register(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_invalidate();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -1794,6 +1887,8 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 		return err;
 	}
 
+	attr_index_invalidate();
+
 	/* Don't submit any work until the stack is initialized */
 	if (!atomic_test_bit(gatt_flags, GATT_INITIALIZED)) {
 		k_sched_unlock();
@@ -2101,6 +2196,43 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_HANDLE_INDEX)
+	if (!attr_index_valid) {
+		attr_index_rebuild();
+	}
+
+	/* The indexed walk is equivalent to the service walks below as long
+	 * as every registered handle fits in the index.
+	 */
+	if (attr_index_complete) {
+		uint16_t last = MIN(end_handle, attr_index_last);
+		uint8_t key = uuid ? uuid_index_key(uuid) : 0U;
+
+		for (uint16_t handle = MAX(start_handle, 1U); handle <= last;
+		     handle++) {
+			const struct bt_gatt_attr *attr =
+				attr_index[handle - 1];
+
+			if (!attr) {
+				continue;
+			}
+
+			if (uuid && attr_index_key[handle - 1] != key) {
+				continue;
+			}
+
+			if (gatt_foreach_iter(attr, handle, start_handle,
+					      end_handle, uuid, attr_data,
+					      &num_matches, func,
+					      user_data) == BT_GATT_ITER_STOP) {
+				return;
+			}
+		}
+
+		return;
+	}
+#endif /* CONFIG_BT_GATT_HANDLE_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -3123,6 +3255,15 @@ int bt_gatt_notify_multiple(struct bt_conn *conn,
 	/* Send the buffer. */
 	return gatt_notify_mult_send(conn, buf);
 }
+
+int bt_gatt_notify_mult_flush(struct bt_conn *conn)
+{
+	if (conn == NULL) {
+		return -EINVAL;
+	}
+
+	return gatt_notify_flush(conn);
+}
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
 int bt_gatt_indicate(struct bt_conn *conn,
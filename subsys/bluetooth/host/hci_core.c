@@ -4126,10 +4126,8 @@ void hci_event_prio(struct net_buf *buf)
 	}
 }
 
-static void rx_queue_put(struct net_buf *buf)
+static void rx_work_submit(void)
 {
-	net_buf_slist_put(&bt_dev.rx_queue, buf);
-
 #if defined(CONFIG_BT_RECV_WORKQ_SYS)
 	const int err = k_work_submit(&rx_work);
 #elif defined(CONFIG_BT_RECV_WORKQ_BT)
@@ -4140,6 +4138,55 @@ static void rx_queue_put(struct net_buf *buf)
 	}
 }
 
+static void rx_queue_put(struct net_buf *buf)
+{
+	net_buf_slist_put(&bt_dev.rx_queue, buf);
+
+	rx_work_submit();
+}
+
+#if defined(CONFIG_BT_RECV_CONTEXT_DIRECT)
+/* Serializes direct-context RX processing against rx_work_handler(). */
+static atomic_t rx_direct_busy;
+
+static bool bt_recv_acl_direct(struct net_buf *buf)
+{
+	if (k_is_in_isr() || !sys_slist_is_empty(&bt_dev.rx_queue)) {
+		return false;
+	}
+
+	if (!atomic_cas(&rx_direct_busy, 0, 1)) {
+		return false;
+	}
+
+	if (!sys_slist_is_empty(&bt_dev.rx_queue)) {
+		/* A queuing context won the race; fall back to the queue so
+		 * HCI ordering is preserved.
+		 */
+		atomic_clear(&rx_direct_busy);
+		return false;
+	}
+
+	bt_monitor_send(bt_monitor_opcode(buf), buf->data, buf->len);
+
+	LOG_DBG("buf %p len %u (direct)", buf, buf->len);
+
+	hci_acl(buf);
+
+	atomic_clear(&rx_direct_busy);
+
+	/* Packets queued while we were processing already submitted rx_work,
+	 * but the handler may have run and bailed out while the busy flag was
+	 * held, so make sure it gets another chance.
+	 */
+	if (!sys_slist_is_empty(&bt_dev.rx_queue)) {
+		rx_work_submit();
+	}
+
+	return true;
+}
+#endif /* CONFIG_BT_RECV_CONTEXT_DIRECT */
+
 static int bt_recv_unsafe(struct net_buf *buf)
 {
 	bt_monitor_send(bt_monitor_opcode(buf), buf->data, buf->len);
@@ -4189,6 +4236,16 @@ int bt_recv(struct net_buf *buf)
 #endif
 	int err;
 
+#if defined(CONFIG_BT_RECV_CONTEXT_DIRECT)
+	/* Demux ACL data in the calling context when that cannot reorder it
+	 * against queued traffic. This must happen before the scheduler is
+	 * locked since L2CAP processing may block.
+	 */
+	if (bt_buf_get_type(buf) == BT_BUF_ACL_IN && bt_recv_acl_direct(buf)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_RECV_CONTEXT_DIRECT */
+
 	k_sched_lock();
 	err = bt_recv_unsafe(buf);
 	k_sched_unlock();
@@ -4278,13 +4335,23 @@ static void init_work(struct k_work *work)
 
 static void rx_work_handler(struct k_work *work)
 {
-	int err;
-
 	struct net_buf *buf;
 
+#if defined(CONFIG_BT_RECV_CONTEXT_DIRECT)
+	if (!atomic_cas(&rx_direct_busy, 0, 1)) {
+		/* A driver context is processing directly. It resubmits this
+		 * work item when it finishes if the queue is not empty.
+		 */
+		return;
+	}
+#endif /* CONFIG_BT_RECV_CONTEXT_DIRECT */
+
 	LOG_DBG("Getting net_buf from queue");
 	buf = net_buf_slist_get(&bt_dev.rx_queue);
 	if (!buf) {
+#if defined(CONFIG_BT_RECV_CONTEXT_DIRECT)
+		atomic_clear(&rx_direct_busy);
+#endif
 		return;
 	}
 
@@ -4310,21 +4377,17 @@ static void rx_work_handler(struct k_work *work)
 		break;
 	}
 
+#if defined(CONFIG_BT_RECV_CONTEXT_DIRECT)
+	atomic_clear(&rx_direct_busy);
+#endif
+
 	/* Schedule the work handler to be executed again if there are
 	 * additional items in the queue. This allows for other users of the
 	 * work queue to get a chance at running, which wouldn't be possible if
 	 * we used a while() loop with a k_yield() statement.
 	 */
 	if (!sys_slist_is_empty(&bt_dev.rx_queue)) {
-
-#if defined(CONFIG_BT_RECV_WORKQ_SYS)
-		err = k_work_submit(&rx_work);
-#elif defined(CONFIG_BT_RECV_WORKQ_BT)
-		err = k_work_submit_to_queue(&bt_workq, &rx_work);
-#endif
-		if (err < 0) {
-			LOG_ERR("Could not submit rx_work: %d", err);
-		}
+		rx_work_submit();
 	}
 }
 
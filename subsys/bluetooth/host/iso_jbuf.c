@@ -0,0 +1,160 @@
+/* iso_jbuf.c - ISO receive jitter buffer */
+
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/bluetooth/iso_jbuf.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net_buf.h>
+
+LOG_MODULE_REGISTER(bt_iso_jbuf, CONFIG_BT_ISO_LOG_LEVEL);
+
+/* Signed distance between sequence numbers, handling 16-bit wrap-around */
+static inline int16_t seq_diff(uint16_t a, uint16_t b)
+{
+	return (int16_t)(a - b);
+}
+
+int bt_iso_jbuf_init(struct bt_iso_jbuf *jbuf, uint8_t depth)
+{
+	if (depth == 0U || depth > ARRAY_SIZE(jbuf->slots)) {
+		return -EINVAL;
+	}
+
+	memset(jbuf, 0, sizeof(*jbuf));
+	jbuf->depth = depth;
+	k_sem_init(&jbuf->ready, 0, depth);
+
+	return 0;
+}
+
+int bt_iso_jbuf_put(struct bt_iso_jbuf *jbuf, struct net_buf *buf,
+		    const struct bt_iso_recv_info *info)
+{
+	k_spinlock_key_t key;
+	uint8_t pos;
+
+	key = k_spin_lock(&jbuf->lock);
+
+	/* Behind the read cursor: the reader has moved past this SDU */
+	if (jbuf->started && seq_diff(info->seq_num, jbuf->next_seq) < 0) {
+		jbuf->stats.dropped_late++;
+		k_spin_unlock(&jbuf->lock, key);
+		return -EALREADY;
+	}
+
+	/* Find the insertion point, rejecting duplicates */
+	for (pos = 0U; pos < jbuf->count; pos++) {
+		int16_t diff = seq_diff(info->seq_num,
+					jbuf->slots[pos].info.seq_num);
+
+		if (diff == 0) {
+			jbuf->stats.dropped_late++;
+			k_spin_unlock(&jbuf->lock, key);
+			return -EALREADY;
+		}
+
+		if (diff < 0) {
+			break;
+		}
+	}
+
+	if (jbuf->count == jbuf->depth) {
+		/* Full: evict the oldest SDU to bound staging latency */
+		struct net_buf *evict = jbuf->slots[0].buf;
+
+		memmove(&jbuf->slots[0], &jbuf->slots[1],
+			(jbuf->count - 1) * sizeof(jbuf->slots[0]));
+		jbuf->count--;
+		jbuf->stats.overruns++;
+
+		if (pos > 0U) {
+			pos--;
+		}
+
+		net_buf_unref(evict);
+	} else {
+		/* A slot was freed for the reader */
+		k_sem_give(&jbuf->ready);
+	}
+
+	memmove(&jbuf->slots[pos + 1], &jbuf->slots[pos],
+		(jbuf->count - pos) * sizeof(jbuf->slots[0]));
+	jbuf->slots[pos].buf = net_buf_ref(buf);
+	jbuf->slots[pos].info = *info;
+	jbuf->count++;
+	jbuf->stats.queued++;
+
+	k_spin_unlock(&jbuf->lock, key);
+
+	return 0;
+}
+
+struct net_buf *bt_iso_jbuf_get(struct bt_iso_jbuf *jbuf, k_timeout_t timeout,
+				struct bt_iso_recv_info *info)
+{
+	k_spinlock_key_t key;
+	struct net_buf *buf;
+
+	if (k_sem_take(&jbuf->ready, timeout) != 0) {
+		key = k_spin_lock(&jbuf->lock);
+		jbuf->stats.underruns++;
+		k_spin_unlock(&jbuf->lock, key);
+		return NULL;
+	}
+
+	key = k_spin_lock(&jbuf->lock);
+
+	__ASSERT_NO_MSG(jbuf->count > 0U);
+
+	buf = jbuf->slots[0].buf;
+	if (info) {
+		*info = jbuf->slots[0].info;
+	}
+
+	jbuf->next_seq = jbuf->slots[0].info.seq_num + 1U;
+	jbuf->started = true;
+
+	jbuf->count--;
+	memmove(&jbuf->slots[0], &jbuf->slots[1],
+		jbuf->count * sizeof(jbuf->slots[0]));
+
+	jbuf->stats.delivered++;
+
+	k_spin_unlock(&jbuf->lock, key);
+
+	return buf;
+}
+
+void bt_iso_jbuf_flush(struct bt_iso_jbuf *jbuf)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&jbuf->lock);
+
+	while (jbuf->count > 0U) {
+		jbuf->count--;
+		net_buf_unref(jbuf->slots[jbuf->count].buf);
+	}
+
+	jbuf->started = false;
+	k_sem_reset(&jbuf->ready);
+
+	k_spin_unlock(&jbuf->lock, key);
+}
+
+void bt_iso_jbuf_stats_get(struct bt_iso_jbuf *jbuf,
+			   struct bt_iso_jbuf_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&jbuf->lock);
+	*stats = jbuf->stats;
+	k_spin_unlock(&jbuf->lock, key);
+}
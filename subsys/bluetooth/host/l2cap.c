@@ -905,6 +905,10 @@ struct net_buf *l2cap_data_pull(struct bt_conn *conn,
 	 *
 	 * For SDUs we do the same, we keep it in the queue until all the
 	 * segments have been sent, adding the PDU headers just-in-time.
+	 * Segmentation never copies payload: each K-frame header is pushed
+	 * into the space freed by the previously sent segment, and conn.c
+	 * carves views (see buf_view.h) over this buffer for the ACL
+	 * fragments handed to the controller.
 	 */
 	struct net_buf *pdu = k_fifo_peek_head(&lechan->tx_queue);
 
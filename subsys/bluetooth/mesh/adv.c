@@ -221,6 +221,72 @@ struct bt_mesh_adv *bt_mesh_adv_get(k_timeout_t timeout)
 	return process_events(events, ARRAY_SIZE(events));
 }
 
+#if defined(CONFIG_BT_MESH_ADV_EXT_SCHED)
+/* Remaining latency budget of a queued PDU, in ms. Negative when the PDU has
+ * already waited past its budget.
+ */
+static int32_t adv_slack(const struct bt_mesh_adv *adv, uint32_t now)
+{
+	uint32_t budget;
+
+	if (adv->ctx.tag == BT_MESH_ADV_TAG_RELAY) {
+		budget = CONFIG_BT_MESH_ADV_EXT_SCHED_RELAY_BUDGET_MS;
+	} else {
+		budget = CONFIG_BT_MESH_ADV_EXT_SCHED_LOCAL_BUDGET_MS;
+	}
+
+	return (int32_t)(budget - (now - adv->ctx.enqueue_ts));
+}
+
+struct bt_mesh_adv *bt_mesh_adv_get_by_deadline(enum bt_mesh_adv_tag_bit tags)
+{
+	uint32_t now = k_uptime_get_32();
+	struct k_fifo *queues[3];
+	struct k_fifo *best = NULL;
+	int32_t best_slack = 0;
+	int count = 0;
+
+	if (tags & (BT_MESH_ADV_TAG_BIT_LOCAL | BT_MESH_ADV_TAG_BIT_PROV)) {
+		queues[count++] = &bt_mesh_adv_queue;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_MESH_RELAY) &&
+	    (tags & BT_MESH_ADV_TAG_BIT_RELAY)) {
+		queues[count++] = &bt_mesh_relay_queue;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) &&
+	    (tags & BT_MESH_ADV_TAG_BIT_FRIEND)) {
+		queues[count++] = &bt_mesh_friend_queue;
+	}
+
+	for (int i = 0; i < count; i++) {
+		struct bt_mesh_adv *head = k_fifo_peek_head(queues[i]);
+		int32_t slack;
+
+		if (!head) {
+			continue;
+		}
+
+		slack = adv_slack(head, now);
+		if (!best || slack < best_slack) {
+			best = queues[i];
+			best_slack = slack;
+		}
+	}
+
+	if (!best) {
+		return NULL;
+	}
+
+	/* Another advertising set may have drained the queue since the peek;
+	 * in that case the scheduler simply comes back empty-handed and is
+	 * re-triggered by the next queued PDU.
+	 */
+	return k_fifo_get(best, K_NO_WAIT);
+}
+#endif /* CONFIG_BT_MESH_ADV_EXT_SCHED */
+
 struct bt_mesh_adv *bt_mesh_adv_get_by_tag(enum bt_mesh_adv_tag_bit tags, k_timeout_t timeout)
 {
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) &&
@@ -264,6 +330,9 @@ void bt_mesh_adv_send(struct bt_mesh_adv *adv, const struct bt_mesh_send_cb *cb,
 	adv->ctx.cb = cb;
 	adv->ctx.cb_data = cb_data;
 	adv->ctx.busy = 1U;
+#if defined(CONFIG_BT_MESH_ADV_EXT_SCHED)
+	adv->ctx.enqueue_ts = k_uptime_get_32();
+#endif
 
 	if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
 		bt_mesh_stat_planned_count(&adv->ctx);
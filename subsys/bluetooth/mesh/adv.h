@@ -55,6 +55,11 @@ struct bt_mesh_adv_ctx {
 		  tag:4;
 
 	uint8_t      xmit;
+
+#if defined(CONFIG_BT_MESH_ADV_EXT_SCHED)
+	/* Uptime at which the PDU was queued, for deadline scheduling */
+	uint32_t     enqueue_ts;
+#endif
 };
 
 struct bt_mesh_adv {
@@ -88,6 +93,8 @@ struct bt_mesh_adv *bt_mesh_adv_get(k_timeout_t timeout);
 
 struct bt_mesh_adv *bt_mesh_adv_get_by_tag(enum bt_mesh_adv_tag_bit tags, k_timeout_t timeout);
 
+struct bt_mesh_adv *bt_mesh_adv_get_by_deadline(enum bt_mesh_adv_tag_bit tags);
+
 void bt_mesh_adv_gatt_update(void);
 
 void bt_mesh_adv_get_cancel(void);
@@ -258,6 +258,35 @@ static const char * const adv_tag_to_str[] = {
 	[BT_MESH_ADV_TAG_PROV]   = "prov adv",
 };
 
+/* Tags an advertising set may pull PDUs for. With deadline scheduling
+ * enabled, any set may pick up local, provisioning and relay traffic, so an
+ * idle set can absorb a burst in another traffic class. Sets dedicated to
+ * Friend or GATT traffic keep their static role: Friend PDUs must be sent in
+ * order on the Friend set, and the separate GATT set is reserved for
+ * connectable advertising.
+ */
+static enum bt_mesh_adv_tag_bit sched_tags(const struct bt_mesh_ext_adv *ext_adv)
+{
+	if ((IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) &&
+	     ext_adv->tags == BT_MESH_ADV_TAG_BIT_FRIEND) ||
+	    (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_GATT_SEPARATE) &&
+	     ext_adv->tags == BT_MESH_ADV_TAG_BIT_PROXY)) {
+		return ext_adv->tags;
+	}
+
+	return ext_adv->tags | BT_MESH_ADV_TAG_BIT_LOCAL | BT_MESH_ADV_TAG_BIT_PROV |
+	       (IS_ENABLED(CONFIG_BT_MESH_RELAY) ? BT_MESH_ADV_TAG_BIT_RELAY : 0);
+}
+
+static struct bt_mesh_adv *adv_sched_get(struct bt_mesh_ext_adv *ext_adv)
+{
+	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_SCHED)) {
+		return bt_mesh_adv_get_by_deadline(sched_tags(ext_adv));
+	}
+
+	return bt_mesh_adv_get_by_tag(ext_adv->tags, K_NO_WAIT);
+}
+
 static bool schedule_send_with_mask(struct bt_mesh_ext_adv *ext_adv, int ignore_mask)
 {
 	if (atomic_test_and_clear_bit(ext_adv->flags, ADV_FLAG_PROXY)) {
@@ -314,7 +343,7 @@ static void send_pending_adv(struct k_work *work)
 		}
 	}
 
-	while ((adv = bt_mesh_adv_get_by_tag(ext_adv->tags, K_NO_WAIT))) {
+	while ((adv = adv_sched_get(ext_adv))) {
 		/* busy == 0 means this was canceled */
 		if (!adv->ctx.busy) {
 			bt_mesh_adv_unref(adv);
@@ -369,7 +398,18 @@ void bt_mesh_adv_gatt_update(void)
 
 void bt_mesh_adv_local_ready(void)
 {
-	(void)schedule_send(advs);
+	if (schedule_send(advs) || !IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_SCHED)) {
+		return;
+	}
+
+	/* The main set is busy, but with deadline scheduling any idle relay
+	 * set can pick the PDU up instead.
+	 */
+	for (int i = 0; i < CONFIG_BT_MESH_RELAY_ADV_SETS; i++) {
+		if (schedule_send(&relay_adv_get()[i])) {
+			return;
+		}
+	}
 }
 
 void bt_mesh_adv_relay_ready(void)
@@ -384,6 +424,7 @@ void bt_mesh_adv_relay_ready(void)
 
 	/* Use the main adv set for the sending of relay messages. */
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_RELAY_USING_MAIN_ADV_SET) ||
+	    IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_SCHED) ||
 	    CONFIG_BT_MESH_RELAY_ADV_SETS == 0) {
 		(void)schedule_send(advs);
 	}
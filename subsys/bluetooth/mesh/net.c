@@ -80,11 +80,21 @@ struct iv_val {
 	      iv_duration:7;
 } __packed;
 
+/* The message cache is organized as a set-associative hash: a received
+ * PDU maps to one set by the hash of its SRC and SEQ and only the ways
+ * of that set are probed, instead of scanning the whole cache per PDU.
+ * Within a set the oldest way is replaced (round-robin), aging entries
+ * out just like the previous FIFO did per-set. Sizes that are not a
+ * multiple of the way count leave the remainder entries unused.
+ */
+#define MSG_CACHE_WAYS MIN(4, CONFIG_BT_MESH_MSG_CACHE_SIZE)
+#define MSG_CACHE_SETS (CONFIG_BT_MESH_MSG_CACHE_SIZE / MSG_CACHE_WAYS)
+
 static struct {
 	uint32_t src : 15, /* MSb of source is always 0 */
 	      seq : 17;
-} msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
-static uint16_t msg_cache_next;
+} msg_cache[MSG_CACHE_SETS * MSG_CACHE_WAYS];
+static uint8_t msg_cache_evict[MSG_CACHE_SETS];
 
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
@@ -145,20 +155,26 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+static inline uint16_t msg_cache_set_get(uint16_t src, uint32_t seq)
+{
+	/* SRC (15 bits) and masked SEQ (17 bits) concatenate into a unique
+	 * 32-bit key, spread over the sets by a multiplicative hash.
+	 */
+	uint32_t key = ((uint32_t)src << 17) | (seq & BIT_MASK(17));
+
+	return ((key * 2654435761U) >> 16) % MSG_CACHE_SETS;
+}
+
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
+	uint16_t src = SRC(pdu->data);
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
+	uint16_t set = msg_cache_set_get(src, seq);
 	uint16_t i;
 
-	for (i = msg_cache_next; i > 0U;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
-			return true;
-		}
-	}
-
-	for (i = ARRAY_SIZE(msg_cache); i > msg_cache_next;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
+	for (i = 0U; i < MSG_CACHE_WAYS; i++) {
+		if (msg_cache[set * MSG_CACHE_WAYS + i].src == src &&
+		    msg_cache[set * MSG_CACHE_WAYS + i].seq == seq) {
 			return true;
 		}
 	}
@@ -168,10 +184,30 @@ static bool msg_cache_match(struct net_buf_simple *pdu)
 
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
-	msg_cache_next %= ARRAY_SIZE(msg_cache);
-	msg_cache[msg_cache_next].src = rx->ctx.addr;
-	msg_cache[msg_cache_next].seq = rx->seq;
-	msg_cache_next++;
+	uint16_t set = msg_cache_set_get(rx->ctx.addr, rx->seq);
+	uint16_t i = set * MSG_CACHE_WAYS + msg_cache_evict[set];
+
+	msg_cache[i].src = rx->ctx.addr;
+	msg_cache[i].seq = rx->seq;
+	msg_cache_evict[set] = (msg_cache_evict[set] + 1) % MSG_CACHE_WAYS;
+}
+
+static void msg_cache_remove(struct bt_mesh_net_rx *rx)
+{
+	uint16_t set = msg_cache_set_get(rx->ctx.addr, rx->seq);
+	uint16_t i;
+
+	for (i = 0U; i < MSG_CACHE_WAYS; i++) {
+		uint16_t idx = set * MSG_CACHE_WAYS + i;
+
+		if (msg_cache[idx].src == rx->ctx.addr &&
+		    msg_cache[idx].seq == (rx->seq & BIT_MASK(17))) {
+			msg_cache[idx].src = BT_MESH_ADDR_UNASSIGNED;
+			/* Reuse the freed way for the next addition */
+			msg_cache_evict[set] = i;
+			return;
+		}
+	}
 }
 
 static void store_iv(bool only_duration)
@@ -216,7 +252,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 	}
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
-	msg_cache_next = 0U;
+	(void)memset(msg_cache_evict, 0, sizeof(msg_cache_evict));
 
 	bt_mesh.iv_index = iv_index;
 	atomic_set_bit_to(bt_mesh.flags, BT_MESH_IVU_IN_PROGRESS,
@@ -911,8 +947,7 @@ void bt_mesh_net_recv(struct net_buf_simple *data, int8_t rssi,
 		 * it again in the future.
 		 */
 		LOG_WRN("Removing rejected message from Network Message Cache");
-		/* Rewind the next index now that we're not using this entry */
-		msg_cache[--msg_cache_next].src = BT_MESH_ADDR_UNASSIGNED;
+		msg_cache_remove(&rx);
 		dup_cache[--dup_cache_next] = 0;
 		return;
 	} else if (err == -EBADMSG) {
@@ -49,6 +49,88 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+/* Open-addressed hash index over replay_list, keyed by source address, so
+ * that the per-PDU replay check does not scan the whole list. Entries move
+ * when the list is compacted and appear or disappear during settings
+ * handling, so the index is invalidated on every structural change and
+ * lazily rebuilt on the next lookup. The table is twice the list size,
+ * which bounds probe sequences and guarantees an empty slot terminates
+ * every unsuccessful search.
+ */
+static uint16_t rpl_index[2 * CONFIG_BT_MESH_CRPL]; /* entry index + 1 */
+static uint16_t rpl_index_free;                     /* free slot index + 1 */
+static bool rpl_index_valid;
+
+static inline void rpl_index_invalidate(void)
+{
+	rpl_index_valid = false;
+}
+
+static inline uint16_t rpl_index_hash(uint16_t src)
+{
+	return ((uint32_t)src * 40503U) % ARRAY_SIZE(rpl_index);
+}
+
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+	rpl_index_free = 0U;
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		uint16_t hash;
+
+		if (!replay_list[i].src) {
+			if (!rpl_index_free) {
+				rpl_index_free = i + 1;
+			}
+
+			continue;
+		}
+
+		hash = rpl_index_hash(replay_list[i].src);
+		while (rpl_index[hash]) {
+			hash = (hash + 1) % ARRAY_SIZE(rpl_index);
+		}
+
+		rpl_index[hash] = i + 1;
+	}
+
+	rpl_index_valid = true;
+}
+
+static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
+{
+	uint16_t hash;
+
+	if (!rpl_index_valid) {
+		rpl_index_rebuild();
+	}
+
+	for (hash = rpl_index_hash(src); rpl_index[hash];
+	     hash = (hash + 1) % ARRAY_SIZE(rpl_index)) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[hash] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return NULL;
+}
+
+static struct bt_mesh_rpl *rpl_free_get(void)
+{
+	if (!rpl_index_valid) {
+		rpl_index_rebuild();
+	}
+
+	if (!rpl_index_free) {
+		return NULL;
+	}
+
+	return &replay_list[rpl_index_free - 1];
+}
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,7 +174,12 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (rpl->src != rx->ctx.addr) {
+		/* Claiming a free slot changes the set of indexed sources */
+		rpl->src = rx->ctx.addr;
+		rpl_index_invalidate();
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -110,7 +197,6 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bool bridge)
 {
 	struct bt_mesh_rpl *rpl;
-	int i;
 
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
@@ -122,42 +208,38 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx, struct bt_mesh_rpl **match, bo
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		rpl = &replay_list[i];
-
-		/* Empty slot */
-		if (!rpl->src) {
+	/* Existing slot for given address */
+	rpl = bt_mesh_rpl_find(rx->ctx.addr);
+	if (rpl) {
+		if (!rpl->old_iv &&
+		    atomic_test_bit(rpl_flags, PENDING_RESET) &&
+		    !atomic_test_bit(store, rpl_idx(rpl))) {
+			/* Until rpl reset is finished, entry with old_iv == false and
+			 * without "store" bit set will be removed, therefore it can be
+			 * reused. If such entry is reused, "store" bit will be set and
+			 * the entry won't be removed.
+			 */
 			goto match;
 		}
 
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
-				goto match;
-			}
-
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
 
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
+			goto match;
+		} else {
+			return true;
 		}
 	}
 
-	LOG_ERR("RPL is full!");
-	return true;
+	/* Empty slot */
+	rpl = rpl_free_get();
+	if (!rpl) {
+		LOG_ERR("RPL is full!");
+		return true;
+	}
 
 match:
 	if (match) {
@@ -175,6 +257,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		rpl_index_invalidate();
 		return;
 	}
 
@@ -183,19 +266,6 @@ void bt_mesh_rpl_clear(void)
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_RPL_PENDING);
 }
 
-static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
-{
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
-		}
-	}
-
-	return NULL;
-}
-
 static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 {
 	int i;
@@ -203,6 +273,7 @@ static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (!replay_list[i].src) {
 			replay_list[i].src = src;
+			rpl_index_invalidate();
 			return &replay_list[i];
 		}
 	}
@@ -261,6 +332,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_invalidate();
 	}
 }
 
@@ -284,6 +356,7 @@ static int rpl_set(const char *name, size_t len_rd,
 		LOG_DBG("val (null)");
 		if (entry) {
 			(void)memset(entry, 0, sizeof(*entry));
+			rpl_index_invalidate();
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -403,6 +476,10 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
 	}
+
+	if (clr || rst || shift > 0) {
+		rpl_index_invalidate();
+	}
 }
 
 void bt_mesh_rpl_pending_store_all_nodes(void)
@@ -220,6 +220,46 @@ static void receive_timeout_handler(struct k_timer *timer)
 	k_work_submit(&rctx->work);
 }
 
+#ifdef CONFIG_ISOTP_RX_FC_AUTOTUNE
+static void receive_fc_tune(struct isotp_recv_ctx *rctx)
+{
+	if (rctx->alloc_streak < UINT8_MAX) {
+		rctx->alloc_streak++;
+	}
+
+	/* Only speed up after two blocks in a row came out of the pool
+	 * without waiting.
+	 */
+	if (rctx->alloc_streak < 2U) {
+		return;
+	}
+
+	if (rctx->opts.stmin >= ISOTP_STMIN_US_BEGIN) {
+		uint8_t units = (rctx->opts.stmin - (ISOTP_STMIN_US_BEGIN - 1U)) / 2U;
+
+		rctx->opts.stmin = (units == 0U) ? 0U :
+				   (ISOTP_STMIN_US_BEGIN - 1U + units);
+	} else {
+		rctx->opts.stmin /= 2U;
+	}
+
+	if (rctx->opts.bs != 0U) {
+		/* Grow the block up to what the RX pool can back */
+		uint32_t bs_limit = (CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE) /
+				    (rctx->rx_addr.dl - 1);
+
+		rctx->opts.bs = MIN(rctx->opts.bs * 2U, MIN(bs_limit, UINT8_MAX));
+	}
+}
+
+static void receive_fc_backoff(struct isotp_recv_ctx *rctx)
+{
+	rctx->alloc_streak = 0U;
+	rctx->opts.bs = rctx->opts_cfg.bs;
+	rctx->opts.stmin = rctx->opts_cfg.stmin;
+}
+#endif /* CONFIG_ISOTP_RX_FC_AUTOTUNE */
+
 static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 {
 	struct net_buf *buf = NULL;
@@ -235,6 +275,9 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 	}
 
 	if (!buf) {
+#ifdef CONFIG_ISOTP_RX_FC_AUTOTUNE
+		receive_fc_backoff(rctx);
+#endif
 		k_timer_start(&rctx->timer, K_MSEC(ISOTP_ALLOC_TIMEOUT_MS), K_NO_WAIT);
 
 		if (rctx->wft == ISOTP_WFT_FIRST) {
@@ -263,6 +306,9 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 	}
 
 	rctx->act_frag = buf;
+#ifdef CONFIG_ISOTP_RX_FC_AUTOTUNE
+	receive_fc_tune(rctx);
+#endif
 	return 0;
 }
 
@@ -278,6 +324,10 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		ud_rem_len = net_buf_user_data(rctx->buf);
 		*ud_rem_len = 0;
 		LOG_DBG("SM process SF of length %d", rctx->length);
+#ifdef CONFIG_ISOTP_RX_STATS
+		rctx->stats.rx_bytes += rctx->length;
+		rctx->stats.rx_msgs++;
+#endif
 		k_fifo_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_RECYCLE;
 		receive_state_machine(rctx);
@@ -287,6 +337,9 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		rctx->length = receive_get_ff_length(rctx->buf);
 		LOG_DBG("SM process FF. Length: %d", rctx->length);
 		rctx->length -= rctx->buf->len;
+#ifdef CONFIG_ISOTP_RX_STATS
+		rctx->stats.rx_bytes += rctx->buf->len;
+#endif
 		if (rctx->opts.bs == 0 &&
 		    rctx->length > CONFIG_ISOTP_RX_BUF_COUNT * CONFIG_ISOTP_RX_BUF_SIZE) {
 			LOG_ERR("Pkt length is %d but buffer has only %d bytes", rctx->length,
@@ -319,6 +372,10 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		__fallthrough;
 	case ISOTP_RX_STATE_SEND_FC:
 		LOG_DBG("SM send CTS FC frame");
+		/* Reload the counter here so it matches the advertised BS
+		 * even if it was tuned after the last reload.
+		 */
+		rctx->bs = rctx->opts.bs;
 		receive_send_fc(rctx, ISOTP_PCI_FS_CTS);
 		k_timer_start(&rctx->timer, K_MSEC(ISOTP_CR_TIMEOUT_MS), K_NO_WAIT);
 		rctx->state = ISOTP_RX_STATE_WAIT_CF;
@@ -327,6 +384,9 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 	case ISOTP_RX_STATE_SEND_WAIT:
 		if (++rctx->wft < CONFIG_ISOTP_WFTMAX) {
 			LOG_DBG("Send wait frame number %d", rctx->wft);
+#ifdef CONFIG_ISOTP_RX_STATS
+			rctx->stats.fc_wait_frames++;
+#endif
 			receive_send_fc(rctx, ISOTP_PCI_FS_WAIT);
 			k_timer_start(&rctx->timer, K_MSEC(ISOTP_ALLOC_TIMEOUT_MS), K_NO_WAIT);
 			rctx->state = ISOTP_RX_STATE_TRY_ALLOC;
@@ -535,7 +595,14 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 	rctx->length -= data_len;
 	LOG_DBG("%d bytes remaining", rctx->length);
 
+#ifdef CONFIG_ISOTP_RX_STATS
+	rctx->stats.rx_bytes += data_len;
+#endif
+
 	if (rctx->length == 0) {
+#ifdef CONFIG_ISOTP_RX_STATS
+		rctx->stats.rx_msgs++;
+#endif
 		rctx->state = ISOTP_RX_STATE_RECYCLE;
 		*ud_rem_len = 0;
 		k_fifo_put(&rctx->fifo, rctx->buf);
@@ -636,6 +703,13 @@ int isotp_bind(struct isotp_recv_ctx *rctx, const struct device *can_dev,
 		 opts->stmin >= ISOTP_STMIN_US_BEGIN, "STmin reserved");
 
 	rctx->opts = *opts;
+#ifdef CONFIG_ISOTP_RX_FC_AUTOTUNE
+	rctx->opts_cfg = *opts;
+	rctx->alloc_streak = 0U;
+#endif
+#ifdef CONFIG_ISOTP_RX_STATS
+	memset(&rctx->stats, 0, sizeof(rctx->stats));
+#endif
 	rctx->state = ISOTP_RX_STATE_WAIT_FF_SF;
 
 	if ((rx_addr->flags & ISOTP_MSG_FDF) != 0 || (tx_addr->flags & ISOTP_MSG_FDF) != 0) {
@@ -750,6 +824,13 @@ int isotp_recv(struct isotp_recv_ctx *rctx, uint8_t *data, size_t len, k_timeout
 	return copied;
 }
 
+#ifdef CONFIG_ISOTP_RX_STATS
+void isotp_rx_stats_get(const struct isotp_recv_ctx *rctx, struct isotp_rx_stats *stats)
+{
+	*stats = rctx->stats;
+}
+#endif
+
 static inline void send_report_error(struct isotp_send_ctx *sctx, uint32_t err)
 {
 	sctx->state = ISOTP_TX_ERR;
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/debug/coredump.h>
+#include "coredump_internal.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(coredump, CONFIG_KERNEL_LOG_LEVEL);
+
+/**
+ * @file
+ * @brief Coredump backend storing data in a retained RAM region.
+ *
+ * This backend stores the raw coredump data in a retention area,
+ * chosen in devicetree as "zephyr,coredump-retention". Writing to
+ * retained RAM is a plain memory copy, so capturing a dump takes
+ * microseconds instead of the milliseconds flash or console output
+ * need, and all formatting/symbolization is deferred to the next
+ * boot or host-side tooling. The dump survives a warm reboot
+ * (including watchdog resets on SoCs that retain RAM) and can be
+ * extracted with the regular coredump query/command API or shell.
+ *
+ * A header is stored at the beginning of the retention area,
+ * followed by the raw coredump data.
+ */
+
+static const struct device *retention_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_coredump_retention));
+
+#define HDR_VER		1
+
+struct retention_hdr_t {
+	/* 'C', 'D' */
+	char		id[2];
+
+	/* Header version */
+	uint16_t	hdr_version;
+
+	/* Coredump size, excluding this header */
+	size_t		size;
+
+	/* Error encountered during dump */
+	int		error;
+} __packed;
+
+#define HDR_SIZE	sizeof(struct retention_hdr_t)
+
+static struct {
+	/* Next write offset within the retention area */
+	off_t		offset;
+
+	/* Error encountered */
+	int		error;
+} backend_ctx;
+
+/**
+ * @brief Read the stored dump header.
+ *
+ * @param hdr where to store the header
+ * @return 0 if a valid dump header is present, error code otherwise
+ */
+static int stored_dump_hdr_read(struct retention_hdr_t *hdr)
+{
+	int ret;
+
+	ret = retention_is_valid(retention_dev);
+	if ((ret != 1) && (ret != -ENOTSUP)) {
+		return (ret < 0) ? ret : -ENOENT;
+	}
+
+	ret = retention_read(retention_dev, 0, (uint8_t *)hdr, sizeof(*hdr));
+	if (ret != 0) {
+		return ret;
+	}
+
+	if ((hdr->id[0] != 'C') || (hdr->id[1] != 'D') ||
+	    (hdr->hdr_version != HDR_VER) || (hdr->error != 0)) {
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Start of coredump session.
+ *
+ * Resets the write offset; data is written behind the header which
+ * is only filled in when the dump ends.
+ */
+static void coredump_retention_backend_start(void)
+{
+	backend_ctx.error = 0;
+	backend_ctx.offset = HDR_SIZE;
+}
+
+/**
+ * @brief End of coredump session.
+ *
+ * Writes the header at the beginning of the retention area, which
+ * also marks the retained data as valid.
+ */
+static void coredump_retention_backend_end(void)
+{
+	int ret;
+
+	struct retention_hdr_t hdr = {
+		.id = {'C', 'D'},
+		.hdr_version = HDR_VER,
+		.size = backend_ctx.offset - HDR_SIZE,
+		.error = backend_ctx.error,
+	};
+
+	ret = retention_write(retention_dev, 0, (uint8_t *)&hdr, sizeof(hdr));
+	if (ret != 0) {
+		LOG_ERR("Cannot write coredump header: %d", ret);
+		backend_ctx.error = ret;
+	}
+
+	if (backend_ctx.error != 0) {
+		LOG_ERR("Error in coredump backend (%d)!", backend_ctx.error);
+	}
+}
+
+/**
+ * @brief Write a buffer to the retention area.
+ *
+ * @param buf buffer of data to write
+ * @param buflen number of bytes to write
+ */
+static void coredump_retention_backend_buffer_output(uint8_t *buf, size_t buflen)
+{
+	if (backend_ctx.error != 0) {
+		return;
+	}
+
+	backend_ctx.error = retention_write(retention_dev, backend_ctx.offset,
+					    buf, buflen);
+	if (backend_ctx.error != 0) {
+		LOG_ERR("Retention write error: %d", backend_ctx.error);
+		return;
+	}
+
+	backend_ctx.offset += buflen;
+}
+
+/**
+ * @brief Perform query on this backend.
+ *
+ * @param query_id ID of query
+ * @param arg argument of query
+ * @return depends on query
+ */
+static int coredump_retention_backend_query(enum coredump_query_id query_id,
+					    void *arg)
+{
+	struct retention_hdr_t hdr;
+	int ret;
+
+	ARG_UNUSED(arg);
+
+	switch (query_id) {
+	case COREDUMP_QUERY_GET_ERROR:
+		ret = backend_ctx.error;
+		break;
+	case COREDUMP_QUERY_HAS_STORED_DUMP:
+		ret = (stored_dump_hdr_read(&hdr) == 0) ? 1 : 0;
+		break;
+	case COREDUMP_QUERY_GET_STORED_DUMP_SIZE:
+		ret = stored_dump_hdr_read(&hdr);
+		if (ret == 0) {
+			ret = hdr.size;
+		}
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Perform command on this backend.
+ *
+ * @param cmd_id command ID
+ * @param arg argument of command
+ * @return depends on command
+ */
+static int coredump_retention_backend_cmd(enum coredump_cmd_id cmd_id,
+					  void *arg)
+{
+	struct retention_hdr_t hdr;
+	int ret;
+
+	switch (cmd_id) {
+	case COREDUMP_CMD_CLEAR_ERROR:
+		ret = 0;
+		backend_ctx.error = 0;
+		break;
+	case COREDUMP_CMD_VERIFY_STORED_DUMP:
+		/* Integrity is covered by the retention area prefix and
+		 * checksum, verified as part of the header read.
+		 */
+		ret = (stored_dump_hdr_read(&hdr) == 0) ? 1 : 0;
+		break;
+	case COREDUMP_CMD_ERASE_STORED_DUMP:
+	case COREDUMP_CMD_INVALIDATE_STORED_DUMP:
+		ret = retention_clear(retention_dev);
+		break;
+	case COREDUMP_CMD_COPY_STORED_DUMP:
+		if (arg) {
+			struct coredump_cmd_copy_arg *copy_arg
+				= (struct coredump_cmd_copy_arg *)arg;
+
+			ret = stored_dump_hdr_read(&hdr);
+			if (ret != 0) {
+				break;
+			}
+
+			if ((copy_arg->offset >= hdr.size) ||
+			    (copy_arg->buffer == NULL)) {
+				ret = -EINVAL;
+				break;
+			}
+
+			size_t len = MIN(copy_arg->length,
+					 hdr.size - copy_arg->offset);
+
+			ret = retention_read(retention_dev,
+					     HDR_SIZE + copy_arg->offset,
+					     copy_arg->buffer, len);
+			if (ret == 0) {
+				ret = len;
+			}
+		} else {
+			ret = -EINVAL;
+		}
+		break;
+	default:
+		ret = -ENOTSUP;
+		break;
+	}
+
+	return ret;
+}
+
+struct coredump_backend_api coredump_backend_retention = {
+	.start = coredump_retention_backend_start,
+	.end = coredump_retention_backend_end,
+	.buffer_output = coredump_retention_backend_buffer_output,
+	.query = coredump_retention_backend_query,
+	.cmd = coredump_retention_backend_cmd,
+};
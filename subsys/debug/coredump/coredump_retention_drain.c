@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/debug/coredump.h>
+#include "coredump_internal.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(coredump_drain, CONFIG_KERNEL_LOG_LEVEL);
+
+/**
+ * @file
+ * @brief Boot-time drain of a retained coredump to flash.
+ *
+ * The retention backend captures a dump into retained RAM in
+ * microseconds so the fatal handler stays within watchdog windows,
+ * but retained RAM is lost on a cold boot. This module runs before
+ * the application starts: if the retention area holds a valid dump,
+ * it is copied to the "coredump-partition" flash partition and the
+ * retention area is invalidated so the next crash can be captured.
+ *
+ * The on-flash layout (write-size aligned header followed by the raw
+ * dump data) matches the flash partition backend, so the same host
+ * tooling can extract the drained dump.
+ */
+#define FLASH_PARTITION		coredump_partition
+#define FLASH_PARTITION_ID	FIXED_PARTITION_ID(FLASH_PARTITION)
+
+#if !FIXED_PARTITION_EXISTS(FLASH_PARTITION)
+#error "Need a fixed partition named 'coredump-partition'!"
+
+#else
+
+/* Note that currently external memories are not supported */
+#define FLASH_CONTROLLER	\
+	DT_PARENT(DT_PARENT(DT_NODELABEL(FLASH_PARTITION)))
+
+#define FLASH_WRITE_SIZE	DT_PROP(FLASH_CONTROLLER, write_block_size)
+#define FLASH_BUF_SIZE \
+	MAX(FLASH_WRITE_SIZE, ROUND_UP(CONFIG_DEBUG_COREDUMP_FLASH_CHUNK_SIZE, FLASH_WRITE_SIZE))
+
+#define HDR_VER			1
+
+/* Must match struct flash_hdr_t in coredump_backend_flash_partition.c
+ * so host tooling parses the drained partition the same way.
+ */
+struct flash_hdr_t {
+	/* 'C', 'D' */
+	char		id[2];
+
+	/* Header version */
+	uint16_t	hdr_version;
+
+	/* Coredump size, excluding this header */
+	size_t		size;
+
+	/* Flags */
+	uint16_t	flags;
+
+	/* Checksum */
+	uint16_t	checksum;
+
+	/* Error */
+	int		error;
+} __packed;
+
+/* Buffer used in stream flash context */
+static uint8_t stream_flash_buf[FLASH_BUF_SIZE];
+
+/* Buffer for chunks read back from the retention area */
+static uint8_t drain_buf[FLASH_BUF_SIZE];
+
+/**
+ * @brief Drain a retained coredump to the flash partition.
+ *
+ * @return 0 if there is nothing to drain or drain succeeded,
+ *         error otherwise
+ */
+static int coredump_retention_drain(void)
+{
+	const struct flash_area *flash_area;
+	struct stream_flash_ctx stream_ctx;
+	const struct device *flash_dev;
+	struct coredump_cmd_copy_arg copy_arg;
+	size_t header_size, size;
+	size_t offset = 0;
+	int error = 0;
+	int ret;
+
+	struct flash_hdr_t hdr = {
+		.id = {'C', 'D'},
+		.hdr_version = HDR_VER,
+	};
+
+	ret = coredump_query(COREDUMP_QUERY_GET_STORED_DUMP_SIZE, NULL);
+	if (ret <= 0) {
+		/* Nothing retained (or the retention area is invalid):
+		 * leave any dump already in the flash partition alone.
+		 */
+		return 0;
+	}
+
+	size = (size_t)ret;
+
+	ret = flash_area_open(FLASH_PARTITION_ID, &flash_area);
+	if (ret != 0) {
+		LOG_ERR("Error opening flash partition for coredump!");
+		return ret;
+	}
+
+	/* Erase whole flash partition */
+	ret = flash_area_flatten(flash_area, 0, flash_area->fa_size);
+	if (ret != 0) {
+		goto out;
+	}
+
+	flash_dev = flash_area_get_device(flash_area);
+
+	/*
+	 * Reserve space for header from beginning of flash device.
+	 * The header size is rounded up so the beginning of coredump
+	 * is aligned to write size (for easier read and seek).
+	 */
+	header_size = ROUND_UP(sizeof(struct flash_hdr_t), FLASH_WRITE_SIZE);
+
+	ret = stream_flash_init(&stream_ctx, flash_dev,
+				stream_flash_buf, sizeof(stream_flash_buf),
+				flash_area->fa_off + header_size,
+				flash_area->fa_size - header_size, NULL);
+	if (ret != 0) {
+		goto out;
+	}
+
+	while (offset < size) {
+		copy_arg.offset = (off_t)offset;
+		copy_arg.buffer = drain_buf;
+		copy_arg.length = MIN(sizeof(drain_buf), size - offset);
+
+		ret = coredump_cmd(COREDUMP_CMD_COPY_STORED_DUMP, &copy_arg);
+		if (ret <= 0) {
+			error = (ret < 0) ? ret : -EIO;
+			break;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			hdr.checksum += drain_buf[i];
+		}
+
+		error = stream_flash_buffered_write(&stream_ctx, drain_buf,
+						    ret, false);
+		if (error != 0) {
+			break;
+		}
+
+		offset += ret;
+	}
+
+	/* Flush buffer */
+	if (error == 0) {
+		error = stream_flash_buffered_write(&stream_ctx,
+						    drain_buf, 0, true);
+	}
+
+	/* Write header; a non-zero error marks the dump as invalid */
+	hdr.size = stream_flash_bytes_written(&stream_ctx);
+	hdr.error = error;
+	hdr.flags = 0;
+
+	ret = flash_area_write(flash_area, 0, (void *)&hdr, sizeof(hdr));
+	if (ret != 0) {
+		LOG_ERR("Cannot write coredump header!");
+		goto out;
+	}
+
+	if (error != 0) {
+		LOG_ERR("Error draining coredump to flash (%d)!", error);
+		ret = error;
+		goto out;
+	}
+
+	/* Free the retention area for the next crash */
+	ret = coredump_cmd(COREDUMP_CMD_INVALIDATE_STORED_DUMP, NULL);
+
+	LOG_INF("Coredump (%zu bytes) drained to flash partition", size);
+
+out:
+	flash_area_close(flash_area);
+
+	return ret;
+}
+
+SYS_INIT(coredump_retention_drain, APPLICATION,
+	 CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* FIXED_PARTITION_EXISTS(coredump_partition) */
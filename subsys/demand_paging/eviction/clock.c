@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging.
+ *
+ * This is meant for MMUs that maintain the "accessed" page flag in
+ * hardware: the flag is harvested straight from the page tables while
+ * scanning, so no periodic software sweep over all page frames is
+ * needed.
+ *
+ * Theory of Operation:
+ *
+ * - Page frames made evictable are appended to a queue of resident
+ *   frames by k_mem_paging_eviction_add() and taken out again by
+ *   k_mem_paging_eviction_remove().
+ *
+ * - A "hand" walks the queue only when a victim is needed.  For each
+ *   frame visited, the accessed flag is read from the page tables and
+ *   cleared in one operation.  A frame found accessed is given a
+ *   second chance and skipped; the first frame found not accessed
+ *   since the hand last passed by is the victim.
+ *
+ * - The hand resumes where it stopped, so frequently used frames keep
+ *   getting their flag re-set by hardware and are never selected as
+ *   long as an idle frame exists.
+ *
+ * Selection cost is proportional to the resident set (one lap of the
+ * queue at worst), there is no timer and no work at page fault time:
+ * k_mem_paging_eviction_accessed() is a no-op because the hardware
+ * already recorded the access.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/*
+ * As in the LRU algorithm, the queue is kept as previous/next page
+ * frame indexes packed into an array rather than a pointer-based
+ * list.
+ */
+
+/*
+ * Number of bits needed to store a page frame index. Rounded up to a byte
+ * boundary for best compromize between code performance and space saving.
+ * The extra entry is used to store head and tail indexes.
+ */
+#define PF_IDX_BITS ROUND_UP(LOG2CEIL(K_MEM_NUM_PAGE_FRAMES + 1), BITS_PER_BYTE)
+
+/* For each page frame, track the previous and next page frame in the queue. */
+struct clock_pf_idx {
+	uint32_t next : PF_IDX_BITS;
+	uint32_t prev : PF_IDX_BITS;
+} __packed;
+
+static struct clock_pf_idx clock_pf_queue[K_MEM_NUM_PAGE_FRAMES + 1];
+static struct k_spinlock clock_lock;
+
+/* Queue position the hand resumes scanning from, 0 when unset */
+static uint32_t clock_hand;
+
+/* Slot 0 is for head and tail indexes (actual indexes are offset by 1) */
+#define CLOCK_PF_HEAD clock_pf_queue[0].next
+#define CLOCK_PF_TAIL clock_pf_queue[0].prev
+
+static inline uint32_t pf_to_idx(struct k_mem_page_frame *pf)
+{
+	return (pf - k_mem_page_frames) + 1;
+}
+
+static inline struct k_mem_page_frame *idx_to_pf(uint32_t idx)
+{
+	return &k_mem_page_frames[idx - 1];
+}
+
+static inline uint32_t clock_pf_next(uint32_t pf_idx)
+{
+	/* the hand wraps from the queue tail back to its head */
+	return (clock_pf_queue[pf_idx].next != 0) ?
+	       clock_pf_queue[pf_idx].next : CLOCK_PF_HEAD;
+}
+
+static inline void clock_pf_append(uint32_t pf_idx)
+{
+	clock_pf_queue[pf_idx].next = 0;
+	clock_pf_queue[pf_idx].prev = CLOCK_PF_TAIL;
+	clock_pf_queue[CLOCK_PF_TAIL].next = pf_idx;
+	CLOCK_PF_TAIL = pf_idx;
+}
+
+static inline void clock_pf_unlink(uint32_t pf_idx)
+{
+	uint32_t next = clock_pf_queue[pf_idx].next;
+	uint32_t prev = clock_pf_queue[pf_idx].prev;
+
+	clock_pf_queue[prev].next = next;
+	clock_pf_queue[next].prev = prev;
+
+	clock_pf_queue[pf_idx].next = 0;
+	clock_pf_queue[pf_idx].prev = 0;
+}
+
+static inline bool clock_pf_in_queue(uint32_t pf_idx)
+{
+	bool unqueued = (clock_pf_queue[pf_idx].next == 0) &&
+			(clock_pf_queue[pf_idx].prev == 0) &&
+			(CLOCK_PF_HEAD != pf_idx);
+
+	return !unqueued;
+}
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&clock_lock);
+
+	__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+	__ASSERT(!clock_pf_in_queue(pf_idx), "");
+	clock_pf_append(pf_idx);
+	k_spin_unlock(&clock_lock, key);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	uint32_t pf_idx = pf_to_idx(pf);
+	k_spinlock_key_t key = k_spin_lock(&clock_lock);
+
+	__ASSERT(clock_pf_in_queue(pf_idx), "");
+	if (clock_hand == pf_idx) {
+		uint32_t next = clock_pf_next(pf_idx);
+
+		clock_hand = (next != pf_idx) ? next : 0;
+	}
+	clock_pf_unlink(pf_idx);
+	k_spin_unlock(&clock_lock, key);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	/* the hardware sets the accessed flag, nothing to do here */
+	ARG_UNUSED(phys);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *victim = NULL;
+	k_spinlock_key_t key = k_spin_lock(&clock_lock);
+	uint32_t idx = (clock_hand != 0) ? clock_hand : CLOCK_PF_HEAD;
+	uint32_t steps = 0;
+
+	if (idx == 0) {
+		k_spin_unlock(&clock_lock, key);
+		return NULL;
+	}
+
+	while (true) {
+		struct k_mem_page_frame *pf = idx_to_pf(idx);
+
+		__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+
+		/* Read and clear the accessed flag in one operation */
+		uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf),
+						     NULL, true);
+
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0, "");
+
+		uint32_t next = clock_pf_next(idx);
+
+		/* The second lap is a hard stop: every queued frame had
+		 * its flag cleared on the first one, so revisiting a
+		 * frame still accessed means it was touched meanwhile
+		 * and any choice is as good as another.
+		 */
+		if (((flags & ARCH_DATA_PAGE_ACCESSED) == 0) ||
+		    (++steps > 2 * K_MEM_NUM_PAGE_FRAMES)) {
+			victim = pf;
+			*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0;
+			clock_hand = (next != idx) ? next : 0;
+			break;
+		}
+
+		idx = next;
+	}
+
+	k_spin_unlock(&clock_lock, key);
+	return victim;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
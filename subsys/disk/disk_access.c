@@ -90,6 +90,180 @@ int disk_access_status(const char *pdrv)
 	return rc;
 }
 
+#ifdef CONFIG_DISK_ACCESS_WRITE_COALESCE
+/* Write coalescing: adjacent single/few-sector writes issued close in
+ * time (FAT metadata traffic being the typical case) are collected in a
+ * buffer and sent to the disk driver as one multi-sector request, which
+ * block-oriented media such as SD turn into a single CMD25 transfer.
+ * The pending run is flushed when a non-adjacent access arrives, when
+ * the buffer fills, when the hold timer expires, and on sync/deinit.
+ */
+static K_MUTEX_DEFINE(coalesce_mutex);
+
+static struct {
+	struct disk_info *disk; /* Disk the pending run belongs to */
+	uint32_t sector_size;
+	uint32_t start_sector;
+	uint32_t num_sectors; /* 0 when no run is pending */
+	int sticky_rc; /* Error from a timer-triggered flush */
+	struct k_work_delayable flush_work;
+	uint8_t buf[CONFIG_DISK_ACCESS_WRITE_COALESCE_BUF_SIZE];
+} coalesce;
+
+/* Caller must hold coalesce_mutex */
+static int coalesce_flush_locked(void)
+{
+	int rc = 0;
+
+	if (coalesce.num_sectors > 0U) {
+		rc = coalesce.disk->ops->write(coalesce.disk, coalesce.buf,
+					       coalesce.start_sector,
+					       coalesce.num_sectors);
+		coalesce.num_sectors = 0U;
+		k_work_cancel_delayable(&coalesce.flush_work);
+	}
+	if (coalesce.sticky_rc != 0) {
+		rc = (rc == 0) ? coalesce.sticky_rc : rc;
+		coalesce.sticky_rc = 0;
+	}
+
+	return rc;
+}
+
+static void coalesce_flush_work_handler(struct k_work *work)
+{
+	int rc;
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+	rc = coalesce_flush_locked();
+	if (rc != 0) {
+		LOG_ERR("deferred disk write failed (%d)", rc);
+		/* Report on the next write or sync of any disk */
+		coalesce.sticky_rc = rc;
+	}
+	k_mutex_unlock(&coalesce_mutex);
+}
+
+/* Flush the pending run if it could interact with an access to the
+ * given sector range of the given disk.
+ */
+static int coalesce_flush_range(struct disk_info *disk, uint32_t start_sector,
+				uint32_t num_sector)
+{
+	int rc = 0;
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+	if ((coalesce.num_sectors > 0U) && (coalesce.disk == disk) &&
+	    (start_sector < coalesce.start_sector + coalesce.num_sectors) &&
+	    (start_sector + num_sector > coalesce.start_sector)) {
+		rc = coalesce_flush_locked();
+	}
+	k_mutex_unlock(&coalesce_mutex);
+
+	return rc;
+}
+
+static int coalesce_flush_disk(struct disk_info *disk)
+{
+	int rc = 0;
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+	if ((coalesce.num_sectors > 0U) && (coalesce.disk == disk)) {
+		rc = coalesce_flush_locked();
+	}
+	k_mutex_unlock(&coalesce_mutex);
+
+	return rc;
+}
+
+static int coalesce_write(struct disk_info *disk, const uint8_t *data_buf,
+			  uint32_t start_sector, uint32_t num_sector)
+{
+	uint32_t sector_size = 0;
+	size_t len;
+	int rc;
+
+	if (disk->ops->ioctl == NULL ||
+	    disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE,
+			     &sector_size) != 0 ||
+	    sector_size == 0U) {
+		/* Cannot buffer without knowing the sector size */
+		return disk->ops->write(disk, data_buf, start_sector,
+					num_sector);
+	}
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+
+	len = (size_t)num_sector * sector_size;
+
+	/* Flush a run this request cannot extend */
+	if ((coalesce.num_sectors > 0U) &&
+	    ((coalesce.disk != disk) ||
+	     (start_sector != coalesce.start_sector + coalesce.num_sectors) ||
+	     ((size_t)(coalesce.num_sectors + num_sector) * sector_size >
+	      sizeof(coalesce.buf)))) {
+		rc = coalesce_flush_locked();
+		if (rc != 0) {
+			k_mutex_unlock(&coalesce_mutex);
+			return rc;
+		}
+	}
+
+	if (len > sizeof(coalesce.buf)) {
+		/* Large requests are already efficient, pass through */
+		rc = coalesce.sticky_rc;
+		coalesce.sticky_rc = 0;
+		if (rc == 0) {
+			rc = disk->ops->write(disk, data_buf, start_sector,
+					      num_sector);
+		}
+		k_mutex_unlock(&coalesce_mutex);
+		return rc;
+	}
+
+	if (coalesce.num_sectors == 0U) {
+		rc = coalesce.sticky_rc;
+		coalesce.sticky_rc = 0;
+		if (rc != 0) {
+			k_mutex_unlock(&coalesce_mutex);
+			return rc;
+		}
+		coalesce.disk = disk;
+		coalesce.sector_size = sector_size;
+		coalesce.start_sector = start_sector;
+	}
+	memcpy(&coalesce.buf[(size_t)coalesce.num_sectors * sector_size],
+	       data_buf, len);
+	coalesce.num_sectors += num_sector;
+	k_work_reschedule(&coalesce.flush_work,
+			  K_MSEC(CONFIG_DISK_ACCESS_WRITE_COALESCE_HOLD_MS));
+
+	k_mutex_unlock(&coalesce_mutex);
+	return 0;
+}
+
+static int coalesce_init(void)
+{
+	k_work_init_delayable(&coalesce.flush_work,
+			      coalesce_flush_work_handler);
+	return 0;
+}
+
+SYS_INIT(coalesce_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline int coalesce_flush_range(struct disk_info *disk,
+				       uint32_t start_sector,
+				       uint32_t num_sector)
+{
+	return 0;
+}
+
+static inline int coalesce_flush_disk(struct disk_info *disk)
+{
+	return 0;
+}
+#endif /* CONFIG_DISK_ACCESS_WRITE_COALESCE */
+
 int disk_access_read(const char *pdrv, uint8_t *data_buf,
 		     uint32_t start_sector, uint32_t num_sector)
 {
@@ -98,7 +272,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
-		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		rc = coalesce_flush_range(disk, start_sector, num_sector);
+		if (rc == 0) {
+			rc = disk->ops->read(disk, data_buf, start_sector,
+					     num_sector);
+		}
 	}
 
 	return rc;
@@ -112,7 +290,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#ifdef CONFIG_DISK_ACCESS_WRITE_COALESCE
+		rc = coalesce_write(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -139,7 +321,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_ERR("Disk reference count at max value");
 			}
 			break;
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = coalesce_flush_disk(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
 		case DISK_IOCTL_CTRL_DEINIT:
+			(void)coalesce_flush_disk(disk);
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
 				disk->refcnt = 0U;
@@ -204,6 +393,8 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+	(void)coalesce_flush_disk(disk);
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
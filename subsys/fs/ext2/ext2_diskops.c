@@ -238,12 +238,21 @@ static inline uint32_t get_ngroups(struct ext2_data *fs)
 int ext2_fetch_block_group(struct ext2_data *fs, uint32_t group)
 {
 	struct ext2_bgroup *bg = &fs->bgroup;
+	int rc;
 
 	/* Check if block group is cached */
 	if (group == bg->num) {
 		return 0;
 	}
 
+	/* Write back pending changes of the cached group before its
+	 * descriptor and bitmaps are replaced.
+	 */
+	rc = ext2_commit_bgroup_cache(fs);
+	if (rc < 0) {
+		return rc;
+	}
+
 	uint32_t ngroups = get_ngroups(fs);
 
 	LOG_DBG("ngroups:%d", ngroups);
@@ -814,6 +823,85 @@ int ext2_commit_bg(struct ext2_data *fs)
 	return 0;
 }
 
+int ext2_commit_bgroup_cache(struct ext2_data *fs)
+{
+	struct ext2_bgroup *bg = &fs->bgroup;
+	int rc;
+
+	if (bg->block_bitmap_dirty) {
+		rc = ext2_write_block(fs, bg->block_bitmap);
+		if (rc < 0) {
+			LOG_DBG("block bitmap write returned: %d", rc);
+			return -EIO;
+		}
+		bg->block_bitmap_dirty = false;
+	}
+
+	if (bg->inode_bitmap_dirty) {
+		rc = ext2_write_block(fs, bg->inode_bitmap);
+		if (rc < 0) {
+			LOG_DBG("inode bitmap write returned: %d", rc);
+			return -EIO;
+		}
+		bg->inode_bitmap_dirty = false;
+	}
+
+	if (bg->dirty) {
+		rc = ext2_commit_bg(fs);
+		if (rc < 0) {
+			LOG_DBG("block group write returned: %d", rc);
+			return -EIO;
+		}
+		bg->dirty = false;
+	}
+
+	if (fs->flags & EXT2_DATA_FLAGS_SB_DIRTY) {
+		rc = ext2_commit_superblock(fs);
+		if (rc < 0) {
+			LOG_DBG("super block write returned: %d", rc);
+			return -EIO;
+		}
+		fs->flags &= ~EXT2_DATA_FLAGS_SB_DIRTY;
+	}
+
+	return 0;
+}
+
+/* Publish superblock, descriptor and bitmap changes made by an
+ * allocation or free. With EXT2_METADATA_WRITEBACK the structures are
+ * only marked dirty and written back in batch on a group switch or
+ * sync, otherwise they are written out immediately.
+ */
+static int commit_alloc_metadata(struct ext2_data *fs, struct ext2_block *bitmap,
+				 bool *bitmap_dirty)
+{
+	int rc;
+
+	if (IS_ENABLED(CONFIG_EXT2_METADATA_WRITEBACK)) {
+		fs->flags |= EXT2_DATA_FLAGS_SB_DIRTY;
+		fs->bgroup.dirty = true;
+		*bitmap_dirty = true;
+		return 0;
+	}
+
+	rc = ext2_commit_superblock(fs);
+	if (rc < 0) {
+		LOG_DBG("super block write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_commit_bg(fs);
+	if (rc < 0) {
+		LOG_DBG("block group write returned: %d", rc);
+		return -EIO;
+	}
+	rc = ext2_write_block(fs, bitmap);
+	if (rc < 0) {
+		LOG_DBG("bitmap write returned: %d", rc);
+		return -EIO;
+	}
+	return 0;
+}
+
 int ext2_commit_inode(struct ext2_inode *inode)
 {
 	struct ext2_data *fs = inode->i_fs;
@@ -868,27 +956,34 @@ int ext2_clear_inode(struct ext2_data *fs, uint32_t ino)
 int64_t ext2_alloc_block(struct ext2_data *fs)
 {
 	int rc, bitmap_slot;
-	uint32_t group = 0, set;
+	uint32_t ngroups = get_ngroups(fs);
+	uint32_t group, searched, set;
 	int32_t total;
 
-	rc = ext2_fetch_block_group(fs, group);
-	if (rc < 0) {
-		return rc;
-	}
+	/* Start from the group of the previous successful allocation so
+	 * that steady-state appends keep hitting the cached descriptor
+	 * and bitmap instead of re-walking the full groups from disk.
+	 */
+	group = fs->alloc_group_hint < ngroups ? fs->alloc_group_hint : 0;
 
-	LOG_DBG("Free blocks: %d", fs->bgroup.bg_free_blocks_count);
-	while ((rc >= 0) && (fs->bgroup.bg_free_blocks_count == 0)) {
-		group++;
+	for (searched = 0; searched < ngroups; searched++) {
 		rc = ext2_fetch_block_group(fs, group);
-		if (rc == -ERANGE) {
-			/* reached last group */
-			return -ENOSPC;
+		if (rc < 0) {
+			return rc;
+		}
+
+		if (fs->bgroup.bg_free_blocks_count > 0) {
+			break;
 		}
+
+		group = (group + 1) % ngroups;
 	}
-	if (rc < 0) {
-		return rc;
+	if (searched == ngroups) {
+		return -ENOSPC;
 	}
 
+	LOG_DBG("Free blocks: %d", fs->bgroup.bg_free_blocks_count);
+
 	rc = ext2_fetch_bg_bbitmap(&fs->bgroup);
 	if (rc < 0) {
 		return rc;
@@ -920,20 +1015,11 @@ int64_t ext2_alloc_block(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
+	fs->alloc_group_hint = group;
+
+	rc = commit_alloc_metadata(fs, fs->bgroup.block_bitmap, &fs->bgroup.block_bitmap_dirty);
 	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 	return total;
 }
@@ -1017,20 +1103,9 @@ int32_t ext2_alloc_inode(struct ext2_data *fs)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_alloc_metadata(fs, fs->bgroup.inode_bitmap, &fs->bgroup.inode_bitmap_dirty);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
 
 	LOG_DBG("Free inodes (bg): %d", fs->bgroup.bg_free_inodes_count);
@@ -1076,22 +1151,7 @@ int ext2_free_block(struct ext2_data *fs, uint32_t block)
 		return -EINVAL;
 	}
 
-	rc = ext2_commit_superblock(fs);
-	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.block_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
-	}
-	return 0;
+	return commit_alloc_metadata(fs, fs->bgroup.block_bitmap, &fs->bgroup.block_bitmap_dirty);
 }
 
 int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
@@ -1139,24 +1199,16 @@ int ext2_free_inode(struct ext2_data *fs, uint32_t ino, bool directory)
 
 	LOG_INF("Inode %d is free", ino);
 
-	rc = ext2_commit_superblock(fs);
+	rc = commit_alloc_metadata(fs, fs->bgroup.inode_bitmap, &fs->bgroup.inode_bitmap_dirty);
 	if (rc < 0) {
-		LOG_DBG("super block write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_commit_bg(fs);
-	if (rc < 0) {
-		LOG_DBG("block group write returned: %d", rc);
-		return -EIO;
-	}
-	rc = ext2_write_block(fs, fs->bgroup.inode_bitmap);
-	if (rc < 0) {
-		LOG_DBG("block bitmap write returned: %d", rc);
-		return -EIO;
+		return rc;
 	}
-	rc = fs->backend_ops->sync(fs);
-	if (rc < 0) {
-		return -EIO;
+
+	if (!IS_ENABLED(CONFIG_EXT2_METADATA_WRITEBACK)) {
+		rc = fs->backend_ops->sync(fs);
+		if (rc < 0) {
+			return -EIO;
+		}
 	}
 	return 0;
 }
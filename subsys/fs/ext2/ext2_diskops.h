@@ -158,6 +158,20 @@ int ext2_commit_superblock(struct ext2_data *fs);
  */
 int ext2_commit_bg(struct ext2_data *fs);
 
+/**
+ * @brief Write back pending changes of the cached block group and superblock.
+ *
+ * Writes out the structures that were only marked dirty by allocations and
+ * frees (see EXT2_METADATA_WRITEBACK). Called before the cached block group
+ * is replaced and from the sync paths. Does nothing when nothing is dirty.
+ *
+ * @param fs File system data struct
+ *
+ * @retval 0 on success
+ * @retval <0 error
+ */
+int ext2_commit_bgroup_cache(struct ext2_data *fs);
+
 /* Operations that reserve or free the block or inode in the file system. They
  * mark an inode or block as used in the bitmap and change free inode/block
  * count in superblock and block group.
@@ -372,6 +372,11 @@ int ext2_close_fs(struct ext2_data *fs)
 
 	/* To save file system as correct it must be writable and without errors */
 	if (!(fs->flags & (EXT2_DATA_FLAGS_RO | EXT2_DATA_FLAGS_ERR))) {
+		ret = ext2_commit_bgroup_cache(fs);
+		if (ret < 0) {
+			return ret;
+		}
+
 		fs->sblock.s_state = EXT2_VALID_FS;
 		ret = ext2_commit_superblock(fs);
 		if (ret < 0) {
@@ -780,6 +785,12 @@ int ext2_inode_sync(struct ext2_inode *inode)
 	int ret;
 	struct ext2_data *fs = inode->i_fs;
 
+	/* Allocation metadata may have pending write-back. */
+	ret = ext2_commit_bgroup_cache(fs);
+	if (ret < 0) {
+		return ret;
+	}
+
 	for (int i = 0; i < 4; ++i) {
 		if (inode->blocks[i] == NULL) {
 			break;
@@ -152,6 +152,10 @@ struct ext2_bgroup {
 	int32_t num;                /* number of described block group */
 	uint32_t inode_table_block; /* number of fetched block (relative) */
 
+	bool dirty;              /* descriptor modified, write-back pending */
+	bool block_bitmap_dirty; /* block bitmap modified, write-back pending */
+	bool inode_bitmap_dirty; /* inode bitmap modified, write-back pending */
+
 	uint32_t bg_block_bitmap;
 	uint32_t bg_inode_bitmap;
 	uint32_t bg_inode_table;
@@ -212,6 +216,8 @@ struct ext2_file {
 
 #define EXT2_DATA_FLAGS_RO  BIT(0)
 #define EXT2_DATA_FLAGS_ERR BIT(1)
+/* Superblock modified, write-back pending. */
+#define EXT2_DATA_FLAGS_SB_DIRTY BIT(2)
 
 struct ext2_data;
 
@@ -235,6 +241,7 @@ struct ext2_data {
 	struct ext2_inode *inode_pool[MAX_INODES];
 
 	uint32_t sblock_offset;
+	uint32_t alloc_group_hint; /* group where the last allocation succeeded */
 	uint32_t block_size; /* fs block size */
 	uint32_t write_size; /* dev minimal write size */
 	uint64_t device_size;
@@ -8,6 +8,8 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <zephyr/sys/crc.h>
+
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
 
@@ -56,10 +58,39 @@ fcb_append_to_scratch(struct fcb *fcb)
 	return 0;
 }
 
+/*
+ * Make sure the active sector has elem_sz bytes of free space, moving to
+ * the next sector when it does not. Caller must hold fcb->f_mtx.
+ */
+static int
+fcb_ensure_free(struct fcb *fcb, uint32_t elem_sz)
+{
+	struct flash_sector *sector;
+	struct fcb_entry *active;
+	int rc;
+
+	active = &fcb->f_active;
+	if (active->fe_elem_off + elem_sz <= active->fe_sector->fs_size) {
+		return 0;
+	}
+	sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
+	if (!sector || (sector->fs_size <
+		fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + elem_sz)) {
+		return -ENOSPC;
+	}
+	rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
+	if (rc) {
+		return rc;
+	}
+	active->fe_sector = sector;
+	active->fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+	fcb->f_active_id++;
+	return 0;
+}
+
 int
 fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 {
-	struct flash_sector *sector;
 	struct fcb_entry *active;
 	int cnt;
 	int rc;
@@ -82,20 +113,9 @@ fcb_append(struct fcb *fcb, uint16_t len, struct fcb_entry *append_loc)
 		return -EINVAL;
 	}
 	active = &fcb->f_active;
-	if (active->fe_elem_off + len + cnt > active->fe_sector->fs_size) {
-		sector = fcb_new_sector(fcb, fcb->f_scratch_cnt);
-		if (!sector || (sector->fs_size <
-			fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)) + len + cnt)) {
-			rc = -ENOSPC;
-			goto err;
-		}
-		rc = fcb_sector_hdr_init(fcb, sector, fcb->f_active_id + 1);
-		if (rc) {
-			goto err;
-		}
-		fcb->f_active.fe_sector = sector;
-		fcb->f_active.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
-		fcb->f_active_id++;
+	rc = fcb_ensure_free(fcb, len + cnt);
+	if (rc) {
+		goto err;
 	}
 
 	rc = fcb_flash_write(fcb, active->fe_sector, active->fe_elem_off, tmp_str, cnt);
@@ -138,3 +158,182 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	}
 	return 0;
 }
+
+/*
+ * Streaming packer used by fcb_append_bulk(). Element bytes are collected
+ * in buf and written out with as few flash operations as possible. Partial
+ * flushes only ever write an f_align multiple, so the unwritten tail can be
+ * carried over to the next write without reprogramming any byte.
+ */
+struct fcb_bulk_writer {
+	struct fcb *fw_fcb;
+	uint8_t *fw_buf;
+	uint16_t fw_buf_sz;
+	uint16_t fw_fill;
+	uint32_t fw_base_off; /* sector offset of fw_buf[0] */
+};
+
+static int
+fcb_bulk_flush(struct fcb_bulk_writer *fw, bool final)
+{
+	struct fcb *fcb = fw->fw_fcb;
+	uint16_t wr;
+	int rc;
+
+	wr = final ? fw->fw_fill :
+		(uint16_t)(fw->fw_fill & ~((uint16_t)fcb->f_align - 1U));
+	if (wr == 0U) {
+		return 0;
+	}
+	rc = fcb_flash_write(fcb, fcb->f_active.fe_sector, fw->fw_base_off,
+			     fw->fw_buf, wr);
+	if (rc) {
+		return -EIO;
+	}
+	fw->fw_base_off += wr;
+	fw->fw_fill -= wr;
+	memmove(fw->fw_buf, &fw->fw_buf[wr], fw->fw_fill);
+	memset(&fw->fw_buf[fw->fw_fill], fcb->f_erase_value,
+	       fw->fw_buf_sz - fw->fw_fill);
+	return 0;
+}
+
+static int
+fcb_bulk_put(struct fcb_bulk_writer *fw, const void *src, uint32_t len)
+{
+	const uint8_t *pos = src;
+	uint32_t chunk;
+	int rc;
+
+	while (len > 0U) {
+		chunk = MIN(len, (uint32_t)(fw->fw_buf_sz - fw->fw_fill));
+		if (chunk == 0U) {
+			rc = fcb_bulk_flush(fw, false);
+			if (rc) {
+				return rc;
+			}
+			continue;
+		}
+		if (pos) {
+			memcpy(&fw->fw_buf[fw->fw_fill], pos, chunk);
+			pos += chunk;
+		}
+		/* src == NULL appends padding; buffer already holds
+		 * erase value bytes there.
+		 */
+		fw->fw_fill += chunk;
+		len -= chunk;
+	}
+	return 0;
+}
+
+int
+fcb_append_bulk(struct fcb *fcb, const struct fcb_bulk_entry *entries, int cnt)
+{
+	uint8_t buf[CONFIG_FCB_APPEND_BULK_BUF_SIZE];
+	uint8_t lenbuf[MAX(8, fcb->f_align)];
+	uint8_t em[MAX(8, fcb->f_align)];
+	struct fcb_bulk_writer fw = {
+		.fw_fcb = fcb,
+		.fw_buf = buf,
+		.fw_buf_sz = sizeof(buf),
+	};
+	uint32_t hdr_fl;
+	uint32_t data_fl;
+	uint32_t em_fl;
+	uint8_t crc8;
+	int hdr_cnt;
+	int rc;
+	int i;
+
+	if (!entries || cnt <= 0) {
+		return -EINVAL;
+	}
+
+	__ASSERT_NO_MSG(sizeof(buf) >= fcb->f_align);
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	memset(buf, fcb->f_erase_value, sizeof(buf));
+	fw.fw_base_off = fcb->f_active.fe_elem_off;
+	em_fl = fcb_len_in_flash(fcb, FCB_CRC_SZ);
+
+	for (i = 0; i < cnt; i++) {
+		memset(lenbuf, fcb->f_erase_value, sizeof(lenbuf));
+		hdr_cnt = fcb_put_len(fcb, lenbuf, entries[i].fbe_len);
+		if (hdr_cnt < 0) {
+			rc = hdr_cnt;
+			goto err;
+		}
+		hdr_fl = fcb_len_in_flash(fcb, hdr_cnt);
+		data_fl = fcb_len_in_flash(fcb, entries[i].fbe_len);
+
+		if (fw.fw_base_off + fw.fw_fill + hdr_fl + data_fl + em_fl >
+		    fcb->f_active.fe_sector->fs_size) {
+			/* Element does not fit, write out what is pending
+			 * and continue the batch in the next sector.
+			 */
+			rc = fcb_bulk_flush(&fw, true);
+			if (rc) {
+				goto err;
+			}
+			fcb->f_active.fe_elem_off = fw.fw_base_off;
+			rc = fcb_ensure_free(fcb, hdr_fl + data_fl + em_fl);
+			if (rc) {
+				goto err;
+			}
+			fw.fw_base_off = fcb->f_active.fe_elem_off;
+		}
+
+		memset(em, 0xFF, sizeof(em));
+#if defined(CONFIG_FCB_ALLOW_FIXED_ENDMARKER)
+		if (fcb->f_flags & FCB_FLAGS_CRC_DISABLED) {
+			em[0] = FCB_FIXED_ENDMARKER;
+		} else
+#endif /* defined(CONFIG_FCB_ALLOW_FIXED_ENDMARKER) */
+		{
+			crc8 = crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, lenbuf,
+					  hdr_cnt);
+			crc8 = crc8_ccitt(crc8, entries[i].fbe_data,
+					  entries[i].fbe_len);
+			em[0] = crc8;
+		}
+
+		rc = fcb_bulk_put(&fw, lenbuf, hdr_fl);
+		if (rc) {
+			goto err;
+		}
+		rc = fcb_bulk_put(&fw, entries[i].fbe_data, entries[i].fbe_len);
+		if (rc) {
+			goto err;
+		}
+		rc = fcb_bulk_put(&fw, NULL, data_fl - entries[i].fbe_len);
+		if (rc) {
+			goto err;
+		}
+		rc = fcb_bulk_put(&fw, em, em_fl);
+		if (rc) {
+			goto err;
+		}
+	}
+
+	rc = fcb_bulk_flush(&fw, true);
+	if (rc) {
+		goto err;
+	}
+	fcb->f_active.fe_elem_off = fw.fw_base_off;
+
+	k_mutex_unlock(&fcb->f_mtx);
+	return 0;
+err:
+	/* Skip over whatever may have reached the flash so no byte gets
+	 * programmed twice; the unfinished element is skipped as invalid
+	 * by readers.
+	 */
+	fcb->f_active.fe_elem_off = fw.fw_base_off + fw.fw_fill;
+	k_mutex_unlock(&fcb->f_mtx);
+	return rc;
+}
@@ -19,6 +19,9 @@ extern "C" {
 #define FCB_CRC_SZ	sizeof(uint8_t)
 #define FCB_TMP_BUF_SZ	32
 
+/* Endmarker written instead of the CRC when FCB_FLAGS_CRC_DISABLED is set */
+#define FCB_FIXED_ENDMARKER 0xab
+
 #define FCB_ID_GT(a, b) (((int16_t)(a) - (int16_t)(b)) > 0)
 
 #define MK32(val) ((((uint32_t)(val)) << 24) |			\
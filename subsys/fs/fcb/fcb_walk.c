@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/crc.h>
+
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
 
@@ -47,3 +49,194 @@ fcb_walk(struct fcb *fcb, struct flash_sector *sector, fcb_walk_cb cb,
 	k_mutex_unlock(&fcb->f_mtx);
 	return 0;
 }
+
+/*
+ * Read window over one fcb sector, backing the buffered walk. Refills are
+ * done with one large sequential flash read, so consecutive elements are
+ * parsed and CRC-checked from RAM instead of costing several small flash
+ * reads each.
+ */
+struct fcb_walk_window {
+	struct fcb *fw_fcb;
+	struct flash_sector *fw_sector;
+	uint8_t *fw_buf;
+	size_t fw_buf_sz;
+	uint32_t fw_off; /* sector offset of fw_buf[0] */
+	size_t fw_len; /* valid bytes in fw_buf */
+};
+
+/*
+ * Return pointer to cnt bytes at sector offset off, refilling the window
+ * from flash when the range is not resident. Sets *rcp to -EFBIG when the
+ * range can never fit the window buffer.
+ */
+static const uint8_t *
+fcb_window_get(struct fcb_walk_window *fw, uint32_t off, size_t cnt, int *rcp)
+{
+	int rc;
+
+	if (off + cnt > fw->fw_sector->fs_size) {
+		*rcp = -ENOTSUP;
+		return NULL;
+	}
+	if (cnt > fw->fw_buf_sz) {
+		*rcp = -EFBIG;
+		return NULL;
+	}
+	if ((off < fw->fw_off) || (off + cnt > fw->fw_off + fw->fw_len)) {
+		fw->fw_off = off;
+		fw->fw_len = MIN(fw->fw_buf_sz, fw->fw_sector->fs_size - off);
+		rc = fcb_flash_read(fw->fw_fcb, fw->fw_sector, off, fw->fw_buf,
+				    fw->fw_len);
+		if (rc) {
+			*rcp = -EIO;
+			return NULL;
+		}
+	}
+	return &fw->fw_buf[off - fw->fw_off];
+}
+
+/*
+ * Buffered counterpart of fcb_elem_info(): parse and verify the element at
+ * loc->fe_elem_off from the window and return a pointer to its data.
+ * Returns -EFBIG when the element does not fit the window buffer; caller
+ * falls back to the flash-reading path.
+ */
+static int
+fcb_elem_info_window(struct fcb_walk_window *fw, struct fcb_entry *loc,
+		     const uint8_t **datap)
+{
+	struct fcb *fcb = fw->fw_fcb;
+	const uint8_t *elem;
+	uint32_t hdr_fl;
+	uint32_t total;
+	uint16_t len;
+	uint8_t em;
+	int cnt;
+	int rc;
+	bool match;
+
+	elem = fcb_window_get(fw, loc->fe_elem_off, 2, &rc);
+	if (!elem) {
+		return rc;
+	}
+	cnt = fcb_get_len(fcb, (uint8_t *)elem, &len);
+	if (cnt < 0) {
+		return cnt;
+	}
+	hdr_fl = fcb_len_in_flash(fcb, cnt);
+	loc->fe_data_off = loc->fe_elem_off + hdr_fl;
+	loc->fe_data_len = len;
+
+	total = hdr_fl + fcb_len_in_flash(fcb, len) +
+		fcb_len_in_flash(fcb, FCB_CRC_SZ);
+	/* May refill the window, invalidating the earlier pointer */
+	elem = fcb_window_get(fw, loc->fe_elem_off, total, &rc);
+	if (!elem) {
+		return rc;
+	}
+
+	em = elem[total - fcb_len_in_flash(fcb, FCB_CRC_SZ)];
+#if defined(CONFIG_FCB_ALLOW_FIXED_ENDMARKER)
+	match = (fcb->f_flags & FCB_FLAGS_CRC_DISABLED) &&
+		(em == FCB_FIXED_ENDMARKER);
+#else
+	match = false;
+#endif /* defined(CONFIG_FCB_ALLOW_FIXED_ENDMARKER) */
+	if (!match) {
+		uint8_t crc8;
+
+		crc8 = crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, elem, cnt);
+		crc8 = crc8_ccitt(crc8, &elem[hdr_fl], len);
+		match = (em == crc8);
+	}
+	if (!match) {
+		return -EBADMSG;
+	}
+	*datap = &elem[hdr_fl];
+	return 0;
+}
+
+int
+fcb_walk_buffered(struct fcb *fcb, struct flash_sector *sector, void *buf,
+		  size_t buf_size, fcb_buffered_walk_cb cb, void *cb_arg)
+{
+	struct fcb_walk_window fw;
+	struct fcb_entry_ctx entry_ctx;
+	struct flash_sector *cur;
+	const uint8_t *data;
+	int rc;
+
+	if (!buf || (buf_size < FCB_TMP_BUF_SZ)) {
+		return -EINVAL;
+	}
+
+	fw.fw_fcb = fcb;
+	fw.fw_buf = buf;
+	fw.fw_buf_sz = buf_size;
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc < 0) {
+		return -EINVAL;
+	}
+
+	cur = sector ? sector : fcb->f_oldest;
+	while (1) {
+		fw.fw_sector = cur;
+		fw.fw_off = 0U;
+		fw.fw_len = 0U;
+		entry_ctx.loc.fe_sector = cur;
+		entry_ctx.loc.fe_elem_off =
+			fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+
+		while (1) {
+			data = NULL;
+			rc = fcb_elem_info_window(&fw, &entry_ctx.loc, &data);
+			if (rc == -EFBIG) {
+				/* Element exceeds the window buffer, verify
+				 * it from flash; cb gets a NULL data pointer
+				 * and reads via entry_ctx instead.
+				 */
+				rc = fcb_elem_info(fcb, &entry_ctx.loc);
+			}
+			if (rc == -EBADMSG) {
+				/* Skip corrupt element, cf.
+				 * fcb_getnext_in_sector().
+				 */
+				entry_ctx.loc.fe_elem_off =
+					entry_ctx.loc.fe_data_off +
+					fcb_len_in_flash(fcb, entry_ctx.loc.fe_data_len) +
+					fcb_len_in_flash(fcb, FCB_CRC_SZ);
+				continue;
+			}
+			if (rc != 0) {
+				/* End of valid elements in this sector */
+				break;
+			}
+
+			entry_ctx.fap = fcb->fap;
+			k_mutex_unlock(&fcb->f_mtx);
+			rc = cb(&entry_ctx, data, cb_arg);
+			if (rc) {
+				return rc;
+			}
+			rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+			if (rc < 0) {
+				return -EINVAL;
+			}
+
+			entry_ctx.loc.fe_elem_off =
+				entry_ctx.loc.fe_data_off +
+				fcb_len_in_flash(fcb, entry_ctx.loc.fe_data_len) +
+				fcb_len_in_flash(fcb, FCB_CRC_SZ);
+		}
+
+		if (sector || (cur == fcb->f_active.fe_sector)) {
+			break;
+		}
+		cur = fcb_getnext_sector(fcb, cur);
+	}
+
+	k_mutex_unlock(&fcb->f_mtx);
+	return 0;
+}
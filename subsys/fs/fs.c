@@ -79,6 +79,99 @@ static const struct fs_file_system_t *fs_type_get(int type)
 	return (ep != NULL) ? ep->fstp : NULL;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_PATH_CACHE
+/* Small LRU cache of recently resolved path to mount point mappings,
+ * so that repeatedly accessed paths skip the longest-prefix scan over
+ * the mount list. Protected by the mount list mutex. Entries are dropped
+ * on unlink/rename of the cached path and the cache is flushed whenever
+ * the mount list changes.
+ */
+struct path_cache_entry {
+	char path[CONFIG_FILE_SYSTEM_PATH_CACHE_PATH_LEN];
+	struct fs_mount_t *mp;
+	uint32_t last_used;
+};
+static struct path_cache_entry path_cache[CONFIG_FILE_SYSTEM_PATH_CACHE_SIZE];
+static uint32_t path_cache_clock;
+
+/* Caller must hold the mutex */
+static struct fs_mount_t *path_cache_get(const char *name)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(path_cache); ++i) {
+		struct path_cache_entry *ep = &path_cache[i];
+
+		if ((ep->mp != NULL) && (strcmp(ep->path, name) == 0)) {
+			ep->last_used = ++path_cache_clock;
+			return ep->mp;
+		}
+	}
+	return NULL;
+}
+
+/* Caller must hold the mutex */
+static void path_cache_put(const char *name, struct fs_mount_t *mp)
+{
+	struct path_cache_entry *victim = &path_cache[0];
+
+	if (strlen(name) >= sizeof(victim->path)) {
+		return;
+	}
+	for (size_t i = 0; i < ARRAY_SIZE(path_cache); ++i) {
+		struct path_cache_entry *ep = &path_cache[i];
+
+		if (ep->mp == NULL) {
+			victim = ep;
+			break;
+		}
+		if (ep->last_used < victim->last_used) {
+			victim = ep;
+		}
+	}
+	strcpy(victim->path, name);
+	victim->mp = mp;
+	victim->last_used = ++path_cache_clock;
+}
+
+static void path_cache_drop(const char *name)
+{
+	k_mutex_lock(&mutex, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(path_cache); ++i) {
+		struct path_cache_entry *ep = &path_cache[i];
+
+		if ((ep->mp != NULL) && (strcmp(ep->path, name) == 0)) {
+			ep->mp = NULL;
+			break;
+		}
+	}
+	k_mutex_unlock(&mutex);
+}
+
+/* Caller must hold the mutex */
+static void path_cache_flush(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(path_cache); ++i) {
+		path_cache[i].mp = NULL;
+	}
+}
+#else
+static inline struct fs_mount_t *path_cache_get(const char *name)
+{
+	return NULL;
+}
+
+static inline void path_cache_put(const char *name, struct fs_mount_t *mp)
+{
+}
+
+static inline void path_cache_drop(const char *name)
+{
+}
+
+static inline void path_cache_flush(void)
+{
+}
+#endif /* CONFIG_FILE_SYSTEM_PATH_CACHE */
+
 static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			    const char *name, size_t *match_len)
 {
@@ -88,6 +181,15 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 	sys_dnode_t *node;
 
 	k_mutex_lock(&mutex, K_FOREVER);
+	mnt_p = path_cache_get(name);
+	if (mnt_p != NULL) {
+		k_mutex_unlock(&mutex);
+		*mnt_pntp = mnt_p;
+		if (match_len) {
+			*match_len = mnt_p->mountp_len;
+		}
+		return 0;
+	}
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		itr = CONTAINER_OF(node, struct fs_mount_t, node);
 		len = itr->mountp_len;
@@ -115,6 +217,9 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			longest_match = len;
 		}
 	}
+	if (mnt_p != NULL) {
+		path_cache_put(name, mnt_p);
+	}
 	k_mutex_unlock(&mutex);
 
 	if (mnt_p == NULL) {
@@ -559,6 +664,8 @@ int fs_unlink(const char *abs_path)
 	rc = mp->fs->unlink(mp, abs_path);
 	if (rc < 0) {
 		LOG_ERR("failed to unlink path (%d)", rc);
+	} else {
+		path_cache_drop(abs_path);
 	}
 
 	return rc;
@@ -599,6 +706,9 @@ int fs_rename(const char *from, const char *to)
 	rc = mp->fs->rename(mp, from, to);
 	if (rc < 0) {
 		LOG_ERR("failed to rename file or dir (%d)", rc);
+	} else {
+		path_cache_drop(from);
+		path_cache_drop(to);
 	}
 
 	return rc;
@@ -744,6 +854,7 @@ int fs_mount(struct fs_mount_t *mp)
 	mp->fs = fs;
 
 	sys_dlist_append(&fs_mnt_list, &mp->node);
+	path_cache_flush();
 	LOG_DBG("fs mounted at %s", mp->mnt_point);
 
 mount_err:
@@ -817,6 +928,7 @@ int fs_unmount(struct fs_mount_t *mp)
 
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
+	path_cache_flush();
 	LOG_DBG("fs unmounted from %s", mp->mnt_point);
 
 unmount_err:
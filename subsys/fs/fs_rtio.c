@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/rtio/work.h>
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(fs_rtio);
+
+/* Runs on the RTIO work-queue, where blocking on the storage stack is
+ * allowed; the submitter continues as soon as the SQE is queued.
+ */
+static void fs_rtio_execute(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	struct fs_rtio_iodev *fs_iodev =
+		CONTAINER_OF(sqe->iodev, struct fs_rtio_iodev, iodev);
+	uint32_t buf_len;
+	uint8_t *buf;
+	ssize_t rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+		return;
+	case RTIO_OP_RX:
+		rc = rtio_sqe_rx_buf(iodev_sqe, 1, sqe->rx.buf_len, &buf,
+				     &buf_len);
+		if (rc != 0) {
+			break;
+		}
+		rc = fs_read(fs_iodev->zfp, buf, buf_len);
+		break;
+	case RTIO_OP_TX:
+		rc = fs_write(fs_iodev->zfp, sqe->tx.buf, sqe->tx.buf_len);
+		break;
+	case RTIO_OP_TINY_TX:
+		rc = fs_write(fs_iodev->zfp, sqe->tiny_tx.buf,
+			      sqe->tiny_tx.buf_len);
+		break;
+	default:
+		LOG_ERR("unsupported op %d", sqe->op);
+		rc = -EINVAL;
+		break;
+	}
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, rc);
+	}
+}
+
+static void fs_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		LOG_ERR("RTIO work item allocation failed");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	rtio_work_req_submit(req, iodev_sqe, fs_rtio_execute);
+}
+
+static const struct rtio_iodev_api fs_rtio_iodev_api = {
+	.submit = fs_rtio_submit,
+};
+
+void fs_rtio_iodev_init(struct fs_rtio_iodev *fs_iodev, struct fs_file_t *zfp)
+{
+	fs_iodev->iodev.api = &fs_rtio_iodev_api;
+	fs_iodev->iodev.data = NULL;
+	fs_iodev->zfp = zfp;
+}
@@ -171,13 +171,221 @@ static int errno_to_lfs(int error)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+
+/* Cache of flash contents between littlefs and the flash_map API, shared
+ * by all flash-backed mounts.  A read that misses the cache fetches a whole
+ * line, so the many small sequential reads issued by littlefs metadata
+ * walks are collapsed into one flash transfer per line.  Program operations
+ * accumulate in the line they target and are written back in one transfer
+ * when littlefs syncs the device, a gap in the programmed range would form,
+ * or the line is evicted.
+ */
+struct block_cache_line {
+	const struct flash_area *fa; /* NULL when the line holds nothing */
+	size_t offset;               /* Line-aligned offset within the area */
+	size_t len;                  /* Cached bytes; short at end of area */
+	size_t dirty_start;          /* Write-back range; clean when the */
+	size_t dirty_end;            /* two bounds are equal */
+	uint8_t data[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE];
+};
+
+static struct block_cache_line block_cache[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINES];
+static uint32_t block_cache_victim;
+static K_MUTEX_DEFINE(block_cache_mutex);
+
+static int block_cache_line_flush(struct block_cache_line *line)
+{
+	int rc = 0;
+
+	if (line->dirty_end > line->dirty_start) {
+		rc = flash_area_write(line->fa,
+				      line->offset + line->dirty_start,
+				      &line->data[line->dirty_start],
+				      line->dirty_end - line->dirty_start);
+		line->dirty_start = 0;
+		line->dirty_end = 0;
+	}
+
+	return rc;
+}
+
+/* Return the line holding @p offset, loading it from flash (and evicting
+ * the round-robin victim) on a miss.  Requires block_cache_mutex.
+ */
+static int block_cache_line_get(const struct flash_area *fa, size_t offset,
+				struct block_cache_line **linep)
+{
+	struct block_cache_line *line;
+	size_t aligned = ROUND_DOWN(offset, sizeof(line->data));
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(block_cache); i++) {
+		line = &block_cache[i];
+		if ((line->fa == fa) && (line->offset == aligned)) {
+			*linep = line;
+			return 0;
+		}
+	}
+
+	line = &block_cache[block_cache_victim % ARRAY_SIZE(block_cache)];
+	block_cache_victim++;
+
+	if (line->fa != NULL) {
+		rc = block_cache_line_flush(line);
+		if (rc < 0) {
+			return rc;
+		}
+		line->fa = NULL;
+	}
+
+	line->len = MIN(sizeof(line->data), fa->fa_size - aligned);
+	rc = flash_area_read(fa, aligned, line->data, line->len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	line->fa = fa;
+	line->offset = aligned;
+	*linep = line;
+
+	return 0;
+}
+
+static int block_cache_read(const struct flash_area *fa, size_t offset,
+			    void *buffer, size_t size)
+{
+	struct block_cache_line *line;
+	uint8_t *dst = buffer;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	while (size > 0) {
+		rc = block_cache_line_get(fa, offset, &line);
+		if (rc < 0) {
+			break;
+		}
+
+		size_t pos = offset - line->offset;
+		size_t chunk = MIN(size, line->len - pos);
+
+		memcpy(dst, &line->data[pos], chunk);
+		dst += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+
+	return rc;
+}
+
+static int block_cache_prog(const struct flash_area *fa, size_t offset,
+			    const void *buffer, size_t size)
+{
+	struct block_cache_line *line;
+	const uint8_t *src = buffer;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	while (size > 0) {
+		rc = block_cache_line_get(fa, offset, &line);
+		if (rc < 0) {
+			break;
+		}
+
+		size_t pos = offset - line->offset;
+		size_t chunk = MIN(size, line->len - pos);
+
+		/* Flush rather than merge when the program operation is not
+		 * contiguous with the pending range: a merged write-back
+		 * would reprogram the bytes in between.
+		 */
+		if ((line->dirty_end > line->dirty_start) &&
+		    ((pos > line->dirty_end) ||
+		     ((pos + chunk) < line->dirty_start))) {
+			rc = block_cache_line_flush(line);
+			if (rc < 0) {
+				break;
+			}
+		}
+
+		memcpy(&line->data[pos], src, chunk);
+		if (line->dirty_end > line->dirty_start) {
+			line->dirty_start = MIN(line->dirty_start, pos);
+			line->dirty_end = MAX(line->dirty_end, pos + chunk);
+		} else {
+			line->dirty_start = pos;
+			line->dirty_end = pos + chunk;
+		}
+
+		src += chunk;
+		offset += chunk;
+		size -= chunk;
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+
+	return rc;
+}
+
+static int block_cache_sync(const struct flash_area *fa)
+{
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; (i < ARRAY_SIZE(block_cache)) && (rc == 0); i++) {
+		if (block_cache[i].fa == fa) {
+			rc = block_cache_line_flush(&block_cache[i]);
+		}
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+
+	return rc;
+}
+
+/* Flush and drop every line overlapping [offset, offset + size), invoked
+ * before the range is erased or the backing area is closed.
+ */
+static int block_cache_invalidate(const struct flash_area *fa, size_t offset,
+				  size_t size)
+{
+	struct block_cache_line *line;
+	int rc = 0;
+
+	k_mutex_lock(&block_cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; (i < ARRAY_SIZE(block_cache)) && (rc == 0); i++) {
+		line = &block_cache[i];
+		if ((line->fa == fa) && (line->offset < (offset + size)) &&
+		    ((line->offset + line->len) > offset)) {
+			rc = block_cache_line_flush(line);
+			line->fa = NULL;
+		}
+	}
+
+	k_mutex_unlock(&block_cache_mutex);
+
+	return rc;
+}
+
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	int rc = block_cache_read(fa, offset, buffer, size);
+#else
 	int rc = flash_area_read(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -188,7 +396,11 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	int rc = block_cache_prog(fa, offset, buffer, size);
+#else
 	int rc = flash_area_write(fa, offset, buffer, size);
+#endif
 
 	return errno_to_lfs(rc);
 }
@@ -197,8 +409,16 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
+	int rc;
 
-	int rc = flash_area_flatten(fa, offset, c->block_size);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	rc = block_cache_invalidate(fa, offset, c->block_size);
+	if (rc < 0) {
+		return errno_to_lfs(rc);
+	}
+#endif
+
+	rc = flash_area_flatten(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
 }
@@ -256,7 +476,11 @@ static int lfs_api_erase_blk(const struct lfs_config *c, lfs_block_t block)
 
 static int lfs_api_sync(const struct lfs_config *c)
 {
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	return errno_to_lfs(block_cache_sync(c->context));
+#else
 	return LFS_ERR_OK;
+#endif
 }
 
 static void release_file_data(struct fs_file_t *fp)
@@ -1015,6 +1239,10 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 	if (!littlefs_on_blkdev(mountp->flags)) {
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+		block_cache_invalidate(fs->backend, 0,
+				       ((struct flash_area *)fs->backend)->fa_size);
+#endif
 		flash_area_close(fs->backend);
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
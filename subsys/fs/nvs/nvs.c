@@ -36,6 +36,78 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+
+/* Locate the cache entry owned by the given id using linear probing.
+ * Returns NULL when the id is not indexed.
+ */
+static uint32_t *nvs_lookup_cache_find(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache_id[pos] == id) {
+			return &fs->lookup_cache[pos];
+		}
+		if (fs->lookup_cache_id[pos] == NVS_LOOKUP_CACHE_FREE_ID) {
+			return NULL;
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return NULL;
+}
+
+/* As nvs_lookup_cache_find(), but claim a free cache entry for the id when
+ * it is not yet indexed. Ids are never removed from the index, so probe
+ * chains stay intact without tombstones. Once the index overflows, ids
+ * that did not fit are served by the uncached linear scan.
+ */
+static uint32_t *nvs_lookup_cache_insert(struct nvs_fs *fs, uint16_t id)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache_id[pos] == id) {
+			return &fs->lookup_cache[pos];
+		}
+		if (fs->lookup_cache_id[pos] == NVS_LOOKUP_CACHE_FREE_ID) {
+			fs->lookup_cache_id[pos] = id;
+			return &fs->lookup_cache[pos];
+		}
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	fs->lookup_cache_degraded = true;
+
+	return NULL;
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE_EXACT */
+
+/* Starting address for a lookup of the given id: the cached address when
+ * known, NVS_LOOKUP_CACHE_NO_ADDR when the id has no entry, or fs->ate_wra
+ * when a full scan is required.
+ */
+static uint32_t nvs_lookup_cache_addr(struct nvs_fs *fs, uint16_t id)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+	uint32_t *cache_entry = nvs_lookup_cache_find(fs, id);
+
+	if (cache_entry == NULL) {
+		/* An unindexed id is definitively absent unless entries
+		 * were dropped because the index overflowed.
+		 */
+		return fs->lookup_cache_degraded ? fs->ate_wra :
+		       NVS_LOOKUP_CACHE_NO_ADDR;
+	}
+
+	return *cache_entry;
+#else
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+#endif
+}
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
@@ -44,6 +116,10 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 	struct nvs_ate ate;
 
 	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+	memset(fs->lookup_cache_id, 0xff, sizeof(fs->lookup_cache_id));
+	fs->lookup_cache_degraded = false;
+#endif
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +131,16 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
-		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+		if (ate.id != 0xFFFF && nvs_ate_valid(fs, &ate)) {
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+			cache_entry = nvs_lookup_cache_insert(fs, ate.id);
+#else
+			cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
+#endif
+			if ((cache_entry != NULL) &&
+			    (*cache_entry == NVS_LOOKUP_CACHE_NO_ADDR)) {
+				*cache_entry = ate_addr;
+			}
 		}
 
 		if (addr == fs->ate_wra) {
@@ -166,7 +247,15 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+		uint32_t *cache_entry = nvs_lookup_cache_insert(fs, entry->id);
+
+		if (cache_entry != NULL) {
+			*cache_entry = fs->ate_wra;
+		}
+#else
 		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+#endif
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -674,7 +763,7 @@ static int nvs_gc(struct nvs_fs *fs)
 		}
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = nvs_lookup_cache_addr(fs, gc_ate.id);
 
 		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -913,6 +1002,13 @@ static int nvs_startup(struct nvs_fs *fs)
 		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#ifdef CONFIG_NVS_LOOKUP_CACHE_EXACT
+		/* Present the index as empty so that lookups during the gc
+		 * fall back to scanning from the end of the fs.
+		 */
+		memset(fs->lookup_cache_id, 0xff, sizeof(fs->lookup_cache_id));
+		fs->lookup_cache_degraded = true;
+#endif
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -1078,7 +1174,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_addr(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1211,7 +1307,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_addr(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -30,6 +30,9 @@ extern "C" {
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
 
+/* 0xFFFF is reserved as a special-purpose id and never cached */
+#define NVS_LOOKUP_CACHE_FREE_ID 0xFFFF
+
 /*
  * Allow to use the NVS_DATA_CRC_SIZE macro in computations whether data CRC is enabled or not
  */
@@ -40,17 +40,94 @@ static inline size_t zms_lookup_cache_pos(uint32_t id)
 	return hash % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
 }
 
+/* Number of consecutive slots probed before giving up on a lookup or
+ * evicting the home slot on an insertion. Bounds the cost of a cache miss.
+ */
+#define ZMS_LOOKUP_CACHE_PROBE_MAX MIN(8, CONFIG_ZMS_LOOKUP_CACHE_SIZE)
+
+static void zms_lookup_cache_reset(struct zms_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	memset(fs->lookup_cache_id, 0xff, sizeof(fs->lookup_cache_id));
+}
+
+/* Find the slot holding the latest ATE address of the given ID.
+ * Returns NULL when the ID is not cached. The stored ID tag makes a match
+ * definitive, colliding IDs occupy neighboring slots instead of silently
+ * overwriting each other.
+ */
+static uint64_t *zms_lookup_cache_find(struct zms_fs *fs, uint32_t id)
+{
+	size_t pos = zms_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < ZMS_LOOKUP_CACHE_PROBE_MAX; i++) {
+		size_t slot = (pos + i) % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+
+		if (fs->lookup_cache[slot] != ZMS_LOOKUP_CACHE_NO_ADDR &&
+		    fs->lookup_cache_id[slot] == id) {
+			return &fs->lookup_cache[slot];
+		}
+	}
+
+	return NULL;
+}
+
+static uint64_t zms_lookup_cache_get(struct zms_fs *fs, uint32_t id)
+{
+	uint64_t *slot = zms_lookup_cache_find(fs, id);
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_STATS
+	if (slot != NULL) {
+		fs->lookup_cache_hits++;
+	} else {
+		fs->lookup_cache_misses++;
+	}
+#endif
+
+	return (slot != NULL) ? *slot : ZMS_LOOKUP_CACHE_NO_ADDR;
+}
+
+static void zms_lookup_cache_insert(struct zms_fs *fs, uint32_t id, uint64_t addr)
+{
+	size_t pos = zms_lookup_cache_pos(id);
+	size_t slot = pos;
+	bool free_found = false;
+
+	/* Prefer the slot already owning the ID, then the first free slot in
+	 * the probe window. When the window is full of other IDs, evict the
+	 * home slot.
+	 */
+	for (size_t i = 0; i < ZMS_LOOKUP_CACHE_PROBE_MAX; i++) {
+		size_t probe = (pos + i) % CONFIG_ZMS_LOOKUP_CACHE_SIZE;
+
+		if (fs->lookup_cache[probe] != ZMS_LOOKUP_CACHE_NO_ADDR &&
+		    fs->lookup_cache_id[probe] == id) {
+			slot = probe;
+			break;
+		}
+		if (!free_found && fs->lookup_cache[probe] == ZMS_LOOKUP_CACHE_NO_ADDR) {
+			/* Remember the first free slot but keep searching for
+			 * a slot already owning the ID.
+			 */
+			slot = probe;
+			free_found = true;
+		}
+	}
+
+	fs->lookup_cache[slot] = addr;
+	fs->lookup_cache_id[slot] = id;
+}
+
 static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 {
 	int rc;
 	int previous_sector_num = ZMS_INVALID_SECTOR_NUM;
 	uint64_t addr;
 	uint64_t ate_addr;
-	uint64_t *cache_entry;
 	uint8_t current_cycle;
 	struct zms_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	zms_lookup_cache_reset(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -62,9 +139,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[zms_lookup_cache_pos(ate.id)];
-
-		if (ate.id != ZMS_HEAD_ID && *cache_entry == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		if (ate.id != ZMS_HEAD_ID && zms_lookup_cache_find(fs, ate.id) == NULL) {
 			/* read the ate cycle only when we change the sector
 			 * or if it is the first read
 			 */
@@ -79,7 +154,7 @@ static int zms_lookup_cache_rebuild(struct zms_fs *fs)
 				}
 			}
 			if (zms_ate_valid_different_sector(fs, &ate, current_cycle)) {
-				*cache_entry = ate_addr;
+				zms_lookup_cache_insert(fs, ate.id, ate_addr);
 			}
 			previous_sector_num = SECTOR_NUM(ate_addr);
 		}
@@ -211,7 +286,7 @@ static int zms_flash_ate_wrt(struct zms_fs *fs, const struct zms_ate *entry)
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	/* 0xFFFFFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != ZMS_HEAD_ID) {
-		fs->lookup_cache[zms_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		zms_lookup_cache_insert(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= zms_al_size(fs, sizeof(struct zms_ate));
@@ -951,7 +1026,7 @@ static int zms_gc(struct zms_fs *fs)
 		}
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+		wlk_addr = zms_lookup_cache_get(fs, gc_ate.id);
 
 		if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 			wlk_addr = fs->ate_wra;
@@ -1028,6 +1103,41 @@ gc_done:
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+/* A proactive sector close + gc pass is due when the writable gap of the
+ * active sector falls below the watermark.
+ */
+static bool zms_gc_due(struct zms_fs *fs)
+{
+	return (fs->ate_wra - fs->data_wra) < CONFIG_ZMS_BACKGROUND_GC_WATERMARK;
+}
+
+static void zms_gc_work_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc;
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+
+	/* Re-evaluate under the lock; a write racing with the work item may
+	 * already have advanced to a fresh sector.
+	 */
+	if (fs->ready && zms_gc_due(fs)) {
+		rc = zms_sector_close(fs);
+		if (rc) {
+			LOG_ERR("Failed to close the sector, returned = %d", rc);
+			goto end;
+		}
+		rc = zms_gc(fs);
+		if (rc) {
+			LOG_ERR("Garbage collection failed, returned = %d", rc);
+		}
+	}
+end:
+	k_mutex_unlock(&fs->zms_lock);
+}
+#endif /* CONFIG_ZMS_BACKGROUND_GC */
+
 int zms_clear(struct zms_fs *fs)
 {
 	int rc;
@@ -1291,13 +1401,11 @@ static int zms_init(struct zms_fs *fs)
 		fs->data_wra = (fs->ate_wra & ADDR_SECT_MASK);
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 		/**
-		 * At this point, the lookup cache wasn't built but the gc function need to use it.
-		 * So, temporarily, we set the lookup cache to the end of the fs.
-		 * The cache will be rebuilt afterwards
+		 * At this point, the lookup cache wasn't built but the gc function needs to
+		 * use it. Reset it so every lookup misses and gc falls back to searching
+		 * from fs->ate_wra. The cache will be rebuilt afterwards.
 		 **/
-		for (i = 0; i < CONFIG_ZMS_LOOKUP_CACHE_SIZE; i++) {
-			fs->lookup_cache[i] = fs->ate_wra;
-		}
+		zms_lookup_cache_reset(fs);
 #endif
 		rc = zms_gc(fs);
 		goto end;
@@ -1327,6 +1435,9 @@ int zms_mount(struct zms_fs *fs)
 	size_t write_block_size;
 
 	k_mutex_init(&fs->zms_lock);
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	k_work_init(&fs->gc_work, zms_gc_work_handler);
+#endif
 
 	fs->flash_parameters = flash_get_parameters(fs->flash_device);
 	if (fs->flash_parameters == NULL) {
@@ -1418,7 +1529,7 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1525,6 +1636,15 @@ no_cached_entry:
 	}
 	rc = len;
 end:
+#ifdef CONFIG_ZMS_BACKGROUND_GC
+	/* Hand the next sector close + gc pass to the work item so that it
+	 * runs before the active sector is actually full and later writes
+	 * do not absorb the gc latency.
+	 */
+	if (zms_gc_due(fs)) {
+		k_work_submit(&fs->gc_work);
+	}
+#endif
 	k_mutex_unlock(&fs->zms_lock);
 	return rc;
 }
@@ -1555,7 +1675,7 @@ ssize_t zms_read_hist(struct zms_fs *fs, uint32_t id, void *data, size_t len, ui
 	cnt_his = 0U;
 
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
+	wlk_addr = zms_lookup_cache_get(fs, id);
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -1778,6 +1898,25 @@ size_t zms_active_sector_free_space(struct zms_fs *fs)
 	return fs->ate_wra - fs->data_wra - fs->ate_size;
 }
 
+#ifdef CONFIG_ZMS_LOOKUP_CACHE_STATS
+int zms_lookup_cache_stats_get(struct zms_fs *fs, uint32_t *hits, uint32_t *misses)
+{
+	if (!fs->ready) {
+		LOG_ERR("ZMS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	*hits = fs->lookup_cache_hits;
+	*misses = fs->lookup_cache_misses;
+	fs->lookup_cache_hits = 0;
+	fs->lookup_cache_misses = 0;
+	k_mutex_unlock(&fs->zms_lock);
+
+	return 0;
+}
+#endif
+
 int zms_sector_use_next(struct zms_fs *fs)
 {
 	int ret;
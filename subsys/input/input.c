@@ -13,9 +13,110 @@ LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 
 #ifdef CONFIG_INPUT_MODE_THREAD
 
+#ifdef CONFIG_INPUT_QUEUE_COALESCE
+
+static struct input_event input_queue[CONFIG_INPUT_QUEUE_MAX_MSGS];
+static uint32_t input_queue_head;
+static uint32_t input_queue_count;
+static struct k_spinlock input_queue_lock;
+static K_SEM_DEFINE(input_queue_free, CONFIG_INPUT_QUEUE_MAX_MSGS,
+		    CONFIG_INPUT_QUEUE_MAX_MSGS);
+static K_SEM_DEFINE(input_queue_used, 0, CONFIG_INPUT_QUEUE_MAX_MSGS);
+
+static bool input_event_coalesce(const struct input_event *evt)
+{
+	/* Motion events only: for absolute axes the newest sample wins, for
+	 * relative axes the pending movement is accumulated. Key events must
+	 * all be delivered.
+	 */
+	if (evt->type != INPUT_EV_ABS && evt->type != INPUT_EV_REL) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < input_queue_count; i++) {
+		struct input_event *pend = &input_queue[
+			(input_queue_head + i) % CONFIG_INPUT_QUEUE_MAX_MSGS];
+
+		if (pend->dev == evt->dev && pend->type == evt->type &&
+		    pend->code == evt->code && pend->sync == evt->sync) {
+			if (evt->type == INPUT_EV_REL) {
+				pend->value += evt->value;
+			} else {
+				pend->value = evt->value;
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static int input_event_put(const struct input_event *evt, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&input_queue_lock);
+	if (input_event_coalesce(evt)) {
+		k_spin_unlock(&input_queue_lock, key);
+		return 0;
+	}
+	k_spin_unlock(&input_queue_lock, key);
+
+	ret = k_sem_take(&input_queue_free, timeout);
+	if (ret != 0) {
+		return -ENOMSG;
+	}
+
+	key = k_spin_lock(&input_queue_lock);
+	input_queue[(input_queue_head + input_queue_count) %
+		    CONFIG_INPUT_QUEUE_MAX_MSGS] = *evt;
+	input_queue_count++;
+	k_spin_unlock(&input_queue_lock, key);
+
+	k_sem_give(&input_queue_used);
+
+	return 0;
+}
+
+static int input_event_get(struct input_event *evt, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	int ret;
+
+	ret = k_sem_take(&input_queue_used, timeout);
+	if (ret != 0) {
+		return ret;
+	}
+
+	key = k_spin_lock(&input_queue_lock);
+	*evt = input_queue[input_queue_head];
+	input_queue_head = (input_queue_head + 1) % CONFIG_INPUT_QUEUE_MAX_MSGS;
+	input_queue_count--;
+	k_spin_unlock(&input_queue_lock, key);
+
+	k_sem_give(&input_queue_free);
+
+	return 0;
+}
+
+#else /* CONFIG_INPUT_QUEUE_COALESCE */
+
 K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
 
+static int input_event_put(const struct input_event *evt, k_timeout_t timeout)
+{
+	return k_msgq_put(&input_msgq, evt, timeout);
+}
+
+static int input_event_get(struct input_event *evt, k_timeout_t timeout)
+{
+	return k_msgq_get(&input_msgq, evt, timeout);
+}
+
+#endif /* CONFIG_INPUT_QUEUE_COALESCE */
+
 #endif
 
 static void input_process(struct input_event *evt)
@@ -29,7 +130,11 @@ static void input_process(struct input_event *evt)
 
 bool input_queue_empty(void)
 {
-#ifdef CONFIG_INPUT_MODE_THREAD
+#if defined(CONFIG_INPUT_QUEUE_COALESCE)
+	if (k_sem_count_get(&input_queue_used) > 0) {
+		return false;
+	}
+#elif defined(CONFIG_INPUT_MODE_THREAD)
 	if (k_msgq_num_used_get(&input_msgq) > 0) {
 		return false;
 	}
@@ -50,7 +155,7 @@ int input_report(const struct device *dev,
 	};
 
 #ifdef CONFIG_INPUT_MODE_THREAD
-	return k_msgq_put(&input_msgq, &evt, timeout);
+	return input_event_put(&evt, timeout);
 #else
 	input_process(&evt);
 	return 0;
@@ -65,9 +170,9 @@ static void input_thread(void)
 	int ret;
 
 	while (true) {
-		ret = k_msgq_get(&input_msgq, &evt, K_FOREVER);
+		ret = input_event_get(&evt, K_FOREVER);
 		if (ret) {
-			LOG_ERR("k_msgq_get error: %d", ret);
+			LOG_ERR("input_event_get error: %d", ret);
 			continue;
 		}
 
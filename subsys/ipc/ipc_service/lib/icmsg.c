@@ -353,6 +353,10 @@ int icmsg_send(const struct icmsg_config_t *conf,
 	}
 #endif
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	uint32_t wr_idx = pbuf_wr_idx_get(dev_data->tx_pb);
+#endif
+
 	write_ret = pbuf_write(dev_data->tx_pb, msg, len);
 
 #ifdef CONFIG_IPC_SERVICE_ICMSG_SHMEM_ACCESS_SYNC
@@ -369,6 +373,18 @@ int icmsg_send(const struct icmsg_config_t *conf,
 
 	__ASSERT_NO_MSG(conf->mbox_tx.dev != NULL);
 
+#ifdef CONFIG_IPC_SERVICE_ICMSG_NOTIFY_COALESCE
+	if (pbuf_is_rd_pending(dev_data->tx_pb, wr_idx)) {
+		/* The remote side has not yet consumed the data written before
+		 * this message. Its processing loop re-checks for available
+		 * data after every message it reads, and this message was
+		 * already visible when the read index was sampled, so it is
+		 * guaranteed to be picked up without an additional signal.
+		 */
+		return sent_bytes;
+	}
+#endif
+
 	ret = mbox_send_dt(&conf->mbox_tx, NULL);
 	if (ret) {
 		return ret;
@@ -176,6 +176,20 @@ int pbuf_write(struct pbuf *pb, const char *data, uint16_t len)
 	return len;
 }
 
+uint32_t pbuf_wr_idx_get(const struct pbuf *pb)
+{
+	return pb->data.wr_idx;
+}
+
+bool pbuf_is_rd_pending(struct pbuf *pb, uint32_t wr_idx)
+{
+	/* Invalidate rd_idx only, it is the only value updated by the reader. */
+	sys_cache_data_invd_range((void *)(pb->cfg->rd_idx_loc), sizeof(*(pb->cfg->rd_idx_loc)));
+	__sync_synchronize();
+
+	return *(pb->cfg->rd_idx_loc) != wr_idx;
+}
+
 int pbuf_read(struct pbuf *pb, char *buf, uint16_t len)
 {
 	if (pb == NULL) {
@@ -280,6 +280,21 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 	const char *name;
 	int i, ret;
 
+#ifdef CONFIG_LLEXT_RELOC_CACHE
+	bool reloc_recording;
+
+	ret = llext_reloc_cache_apply(ldr, ext);
+	if (ret != -ENOENT) {
+		if (ret != 0) {
+			return ret;
+		}
+		/* Warm load: all relocations replayed from the cache */
+		goto skip_reloc;
+	}
+
+	reloc_recording = llext_reloc_cache_begin(ldr, ext);
+#endif
+
 	for (i = 0; i < ext->sect_cnt; ++i) {
 		elf_shdr_t *shdr = ext->sect_hdrs + i;
 
@@ -393,6 +408,7 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 				ELF_ST_BIND(sym.st_info), sym.st_shndx);
 
 			uintptr_t link_addr, op_loc;
+			__maybe_unused bool ext_sym = false;
 
 			op_loc = sect_base + rel.r_offset;
 
@@ -411,6 +427,7 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 					link_addr = (uintptr_t)llext_find_extension_sym(name, &dep);
 					if (link_addr) {
 						llext_dependency_add(ext, dep);
+						ext_sym = true;
 					}
 				}
 
@@ -467,9 +484,24 @@ int llext_link(struct llext_loader *ldr, struct llext *ext, const struct llext_l
 			if (ret != 0) {
 				return ret;
 			}
+
+#ifdef CONFIG_LLEXT_RELOC_CACHE
+			if (reloc_recording) {
+				llext_reloc_cache_record(&rel, shdr->sh_info, &sym,
+							 link_addr, ext_sym);
+			}
+#endif
 		}
 	}
 
+#ifdef CONFIG_LLEXT_RELOC_CACHE
+	if (reloc_recording) {
+		llext_reloc_cache_commit();
+	}
+
+skip_reloc:
+#endif
+
 #ifdef CONFIG_CACHE_MANAGEMENT
 	/* Make sure changes to memory regions are flushed to RAM */
 	for (i = 0; i < LLEXT_MEM_COUNT; ++i) {
@@ -67,4 +67,17 @@ int llext_link(struct llext_loader *ldr, struct llext *ext,
 	       const struct llext_load_param *ldr_parm);
 void llext_dependency_remove_all(struct llext *ext);
 
+/*
+ * Relocation cache (llext_reloc_cache.c)
+ */
+
+#ifdef CONFIG_LLEXT_RELOC_CACHE
+int llext_reloc_cache_apply(struct llext_loader *ldr, struct llext *ext);
+bool llext_reloc_cache_begin(struct llext_loader *ldr, struct llext *ext);
+void llext_reloc_cache_record(const elf_rela_t *rel, uint32_t op_sect,
+			      const elf_sym_t *sym, uintptr_t link_addr,
+			      bool ext_sym);
+void llext_reloc_cache_commit(void);
+#endif
+
 #endif /* ZEPHYR_SUBSYS_LLEXT_PRIV_H_ */
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/util.h>
+#include <zephyr/llext/elf.h>
+#include <zephyr/llext/loader.h>
+#include <zephyr/llext/llext.h>
+#include <zephyr/llext/llext_internal.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(llext, CONFIG_LLEXT_LOG_LEVEL);
+
+#include <string.h>
+
+#include "llext_priv.h"
+
+/**
+ * @file
+ * @brief Cache of resolved relocations for fast extension reload.
+ *
+ * A cold llext_load() spends most of its time in llext_link(): every
+ * relocation entry costs two loader seek/read round trips (the entry
+ * and its symbol) plus, for undefined symbols, a linear search of the
+ * built-in export table. This module records the outcome of a cold
+ * link - the relocation entry, the section it acts on and the resolved
+ * symbol location - keyed by the ELF and section headers of the
+ * extension. When the same extension is loaded again the recorded
+ * patches are replayed as a tight loop of arch_elf_relocate() calls,
+ * with no loader I/O and no symbol lookups.
+ *
+ * Resolved addresses of built-in symbols are stable for the lifetime
+ * of the running kernel image, and symbols defined by the extension
+ * itself are stored section-relative, so replayed patches stay correct
+ * wherever the reloaded extension lands in memory. Symbols imported
+ * from other extensions do not survive those extensions' reloads, so a
+ * link that binds to another extension is not cached.
+ */
+
+/* How a cached patch's target symbol is located at replay time */
+enum reloc_sym_loc {
+	/* No symbol (e.g. R_ARM_V4BX, R_ARM_RELATIVE): link address 0 */
+	RELOC_SYM_NONE,
+	/* Absolute address, stable for this kernel image */
+	RELOC_SYM_ABS,
+	/* Offset inside one of the extension's own sections */
+	RELOC_SYM_SECT,
+};
+
+struct reloc_patch {
+	elf_rela_t rel;
+
+	/* Section index the relocation acts on */
+	uint32_t op_sect;
+
+	enum reloc_sym_loc loc;
+
+	/* Section index of the target symbol (RELOC_SYM_SECT only) */
+	uint32_t sym_sect;
+
+	/* Absolute address or offset within sym_sect */
+	uintptr_t sym_value;
+
+	/* Symbol name offset in the string table, for diagnostics */
+	uint32_t st_name;
+};
+
+struct reloc_cache_entry {
+	sys_snode_t node;
+
+	/* Key: ELF header and section headers of the cached extension */
+	elf_ehdr_t hdr;
+	uint32_t sect_cnt;
+	elf_shdr_t *sect_hdrs;
+
+	/* Recorded patches */
+	size_t patch_cnt;
+	size_t patch_max;
+	struct reloc_patch *patches;
+};
+
+static sys_slist_t reloc_cache_list = SYS_SLIST_STATIC_INIT(&reloc_cache_list);
+static struct k_mutex reloc_cache_lock = Z_MUTEX_INITIALIZER(reloc_cache_lock);
+static unsigned int reloc_cache_cnt;
+
+/*
+ * Entry being recorded by the current cold link. Loads are serialized
+ * by the llext_load() mutex, so a single pending slot is sufficient.
+ */
+static struct reloc_cache_entry *pending;
+
+static void entry_free(struct reloc_cache_entry *entry)
+{
+	if (entry) {
+		llext_free(entry->sect_hdrs);
+		llext_free(entry->patches);
+		llext_free(entry);
+	}
+}
+
+static bool entry_matches(const struct reloc_cache_entry *entry,
+			  const struct llext_loader *ldr, const struct llext *ext)
+{
+	return entry->sect_cnt == ext->sect_cnt &&
+	       memcmp(&entry->hdr, &ldr->hdr, sizeof(entry->hdr)) == 0 &&
+	       memcmp(entry->sect_hdrs, ext->sect_hdrs,
+		      ext->sect_cnt * sizeof(elf_shdr_t)) == 0;
+}
+
+/* Must be called with reloc_cache_lock held */
+static struct reloc_cache_entry *cache_find(const struct llext_loader *ldr,
+					    const struct llext *ext)
+{
+	struct reloc_cache_entry *entry;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&reloc_cache_list, entry, node) {
+		if (entry_matches(entry, ldr, ext)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+int llext_reloc_cache_apply(struct llext_loader *ldr, struct llext *ext)
+{
+	struct reloc_cache_entry *entry;
+	size_t cnt = 0;
+	int ret = 0;
+
+	k_mutex_lock(&reloc_cache_lock, K_FOREVER);
+
+	entry = cache_find(ldr, ext);
+	if (!entry) {
+		k_mutex_unlock(&reloc_cache_lock);
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < entry->patch_cnt; i++) {
+		struct reloc_patch *patch = entry->patches + i;
+		uintptr_t op_loc, link_addr;
+
+		op_loc = (uintptr_t)llext_loaded_sect_ptr(ldr, ext, patch->op_sect) +
+			 patch->rel.r_offset;
+
+		switch (patch->loc) {
+		case RELOC_SYM_ABS:
+			link_addr = patch->sym_value;
+			break;
+		case RELOC_SYM_SECT:
+			link_addr = (uintptr_t)llext_loaded_sect_ptr(ldr, ext,
+								     patch->sym_sect) +
+				    patch->sym_value;
+			break;
+		case RELOC_SYM_NONE:
+		default:
+			link_addr = 0;
+			break;
+		}
+
+		ret = arch_elf_relocate(&patch->rel, op_loc, link_addr,
+					llext_string(ldr, ext, LLEXT_MEM_STRTAB,
+						     patch->st_name),
+					(uintptr_t)ext->mem[LLEXT_MEM_TEXT]);
+		if (ret != 0) {
+			break;
+		}
+	}
+
+	cnt = entry->patch_cnt;
+
+	k_mutex_unlock(&reloc_cache_lock);
+
+	if (ret == 0) {
+		LOG_DBG("replayed %zu cached relocations", cnt);
+	}
+
+	return ret;
+}
+
+bool llext_reloc_cache_begin(struct llext_loader *ldr, struct llext *ext)
+{
+	struct reloc_cache_entry *entry;
+	size_t patch_max = 0;
+	unsigned int i;
+
+	/* Drop a recording left over from a failed load, and any stale
+	 * cached link of this same extension.
+	 */
+	entry_free(pending);
+	pending = NULL;
+
+	k_mutex_lock(&reloc_cache_lock, K_FOREVER);
+	entry = cache_find(ldr, ext);
+	if (entry) {
+		sys_slist_find_and_remove(&reloc_cache_list, &entry->node);
+		reloc_cache_cnt--;
+	}
+	k_mutex_unlock(&reloc_cache_lock);
+	entry_free(entry);
+
+	for (i = 0; i < ext->sect_cnt; i++) {
+		elf_shdr_t *shdr = ext->sect_hdrs + i;
+
+		if ((shdr->sh_type == SHT_REL || shdr->sh_type == SHT_RELA) &&
+		    shdr->sh_entsize > 0) {
+			patch_max += shdr->sh_size / shdr->sh_entsize;
+		}
+	}
+
+	if (patch_max == 0) {
+		return false;
+	}
+
+	entry = llext_alloc(sizeof(*entry));
+	if (!entry) {
+		goto no_mem;
+	}
+	memset(entry, 0, sizeof(*entry));
+
+	entry->sect_hdrs = llext_alloc(ext->sect_cnt * sizeof(elf_shdr_t));
+	entry->patches = llext_alloc(patch_max * sizeof(struct reloc_patch));
+	if (!entry->sect_hdrs || !entry->patches) {
+		goto no_mem;
+	}
+
+	entry->hdr = ldr->hdr;
+	entry->sect_cnt = ext->sect_cnt;
+	memcpy(entry->sect_hdrs, ext->sect_hdrs, ext->sect_cnt * sizeof(elf_shdr_t));
+	entry->patch_max = patch_max;
+
+	pending = entry;
+
+	return true;
+
+no_mem:
+	entry_free(entry);
+	LOG_DBG("not enough llext heap to record relocations");
+
+	return false;
+}
+
+void llext_reloc_cache_record(const elf_rela_t *rel, uint32_t op_sect,
+			      const elf_sym_t *sym, uintptr_t link_addr, bool ext_sym)
+{
+	struct reloc_patch *patch;
+
+	if (!pending) {
+		return;
+	}
+
+	if (ext_sym || pending->patch_cnt == pending->patch_max) {
+		/* Bound to a symbol in another extension, whose address
+		 * does not survive that extension's reload: this link
+		 * cannot be cached.
+		 */
+		entry_free(pending);
+		pending = NULL;
+		return;
+	}
+
+	patch = pending->patches + pending->patch_cnt++;
+
+	patch->rel = *rel;
+	patch->op_sect = op_sect;
+	patch->st_name = sym->st_name;
+	patch->sym_sect = 0;
+	patch->sym_value = 0;
+
+	if (ELF_R_SYM(rel->r_info) == 0) {
+		patch->loc = RELOC_SYM_NONE;
+	} else if (sym->st_shndx == SHN_UNDEF || sym->st_shndx == SHN_ABS) {
+		patch->loc = RELOC_SYM_ABS;
+		patch->sym_value = link_addr;
+	} else {
+		patch->loc = RELOC_SYM_SECT;
+		patch->sym_sect = sym->st_shndx;
+		patch->sym_value = sym->st_value;
+	}
+}
+
+void llext_reloc_cache_commit(void)
+{
+	size_t cnt;
+
+	if (!pending) {
+		return;
+	}
+
+	cnt = pending->patch_cnt;
+
+	k_mutex_lock(&reloc_cache_lock, K_FOREVER);
+
+	if (reloc_cache_cnt >= CONFIG_LLEXT_RELOC_CACHE_MAX) {
+		/* Evict the oldest cached link */
+		sys_snode_t *node = sys_slist_get(&reloc_cache_list);
+
+		reloc_cache_cnt--;
+		entry_free(CONTAINER_OF(node, struct reloc_cache_entry, node));
+	}
+
+	sys_slist_append(&reloc_cache_list, &pending->node);
+	reloc_cache_cnt++;
+	pending = NULL;
+
+	k_mutex_unlock(&reloc_cache_lock);
+
+	LOG_DBG("cached %zu relocations", cnt);
+}
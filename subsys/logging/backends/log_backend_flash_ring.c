@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/logging/log_backend_flash_ring.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/util.h>
+
+#define FLASH_PARTITION		log_partition
+#define FLASH_PARTITION_ID	FIXED_PARTITION_ID(FLASH_PARTITION)
+
+#if !FIXED_PARTITION_EXISTS(FLASH_PARTITION)
+#error "Need a fixed partition named 'log-partition'!"
+
+#else
+
+#define FLASH_CONTROLLER	\
+	DT_PARENT(DT_PARENT(DT_NODELABEL(FLASH_PARTITION)))
+
+#define FLASH_WRITE_SIZE	DT_PROP(FLASH_CONTROLLER, write_block_size)
+#define FLASH_BUF_SIZE \
+	MAX(FLASH_WRITE_SIZE, \
+	    ROUND_UP(CONFIG_LOG_BACKEND_FLASH_RING_BUF_SIZE, FLASH_WRITE_SIZE))
+#if DT_NODE_HAS_PROP(FLASH_CONTROLLER, erase_block_size)
+#define ERASE_BLOCK_SIZE	DT_PROP(FLASH_CONTROLLER, erase_block_size)
+#else
+#define ERASE_BLOCK_SIZE	FLASH_BUF_SIZE
+#endif
+
+/* Number of leading bytes of an erase page checked to decide whether
+ * the page holds retained data.
+ */
+#define PAGE_PROBE_LEN		16
+
+BUILD_ASSERT(!IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE),
+	     "Immediate logging is not supported by the flash ring backend.");
+
+static const struct flash_area *flash_ring_area;
+static struct stream_flash_ctx stream_ctx;
+static uint8_t __aligned(4) stream_buf[FLASH_BUF_SIZE];
+/* Offset within the partition where the current stream segment starts */
+static size_t ring_off;
+static int64_t last_flush_time;
+static bool ring_ok;
+static struct k_mutex ring_lock;
+
+static uint32_t log_format_current = CONFIG_LOG_BACKEND_FLASH_RING_OUTPUT_DEFAULT;
+
+static uint8_t erase_value(void)
+{
+	const struct flash_parameters *fparams =
+		flash_get_parameters(flash_area_get_device(flash_ring_area));
+
+	return fparams->erase_value;
+}
+
+/* (Re)initialize the stream at given partition offset. */
+static int stream_restart(size_t offset)
+{
+	int rc;
+
+	rc = stream_flash_init(&stream_ctx,
+			       flash_area_get_device(flash_ring_area),
+			       stream_buf, sizeof(stream_buf),
+			       flash_ring_area->fa_off + offset,
+			       flash_ring_area->fa_size - offset, NULL);
+	if (rc == 0) {
+		ring_off = offset;
+	}
+
+	return rc;
+}
+
+/* Find where to resume after reboot: the erase page following the last
+ * page holding data, so that retained messages are preserved until the
+ * ring wraps over them.
+ */
+static size_t resume_offset_find(void)
+{
+	uint8_t probe[PAGE_PROBE_LEN];
+	size_t page_cnt = flash_ring_area->fa_size / ERASE_BLOCK_SIZE;
+	size_t last_used = 0;
+	bool any_used = false;
+	uint8_t erased = erase_value();
+
+	for (size_t page = 0; page < page_cnt; page++) {
+		bool used = false;
+
+		if (flash_area_read(flash_ring_area, page * ERASE_BLOCK_SIZE,
+				    probe, sizeof(probe)) < 0) {
+			continue;
+		}
+
+		for (size_t i = 0; i < sizeof(probe); i++) {
+			if (probe[i] != erased) {
+				used = true;
+				break;
+			}
+		}
+
+		if (used) {
+			last_used = page;
+			any_used = true;
+		}
+	}
+
+	if (!any_used) {
+		return 0;
+	}
+
+	return ((last_used + 1) % page_cnt) * ERASE_BLOCK_SIZE;
+}
+
+/* Flush buffered data and restart the stream right after it, so that
+ * writing can continue on a fresh stream flash session.
+ */
+static int ring_flush(void)
+{
+	size_t written;
+	int rc;
+
+	rc = stream_flash_buffered_write(&stream_ctx, NULL, 0, true);
+	if (rc < 0) {
+		return rc;
+	}
+
+	written = ROUND_UP(stream_flash_bytes_written(&stream_ctx),
+			   FLASH_WRITE_SIZE);
+
+	return stream_restart(ring_off + written);
+}
+
+static int write_to_ring(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	int rc;
+
+	if (!ring_ok) {
+		return length;
+	}
+
+	k_mutex_lock(&ring_lock, K_FOREVER);
+
+	/* Wrap to the partition start when the remaining space cannot
+	 * hold this chunk.
+	 */
+	if (stream_flash_bytes_written(&stream_ctx) + length >
+	    flash_ring_area->fa_size - ring_off) {
+		rc = stream_flash_buffered_write(&stream_ctx, NULL, 0, true);
+		if (rc == 0) {
+			rc = stream_restart(0);
+		}
+		if (rc < 0) {
+			ring_ok = false;
+			goto out;
+		}
+	}
+
+	rc = stream_flash_buffered_write(&stream_ctx, data, length, false);
+	if (rc < 0) {
+		/* Stream may have run out of space before the wrap check
+		 * predicted it (buffered bytes are not counted), retry
+		 * once from the partition start.
+		 */
+		rc = stream_restart(0);
+		if (rc == 0) {
+			rc = stream_flash_buffered_write(&stream_ctx, data,
+							 length, false);
+		}
+		if (rc < 0) {
+			ring_ok = false;
+			goto out;
+		}
+	}
+
+	if (k_uptime_get() - last_flush_time >
+	    CONFIG_LOG_BACKEND_FLASH_RING_FLUSH_TIMEOUT_MS) {
+		rc = ring_flush();
+		if (rc < 0) {
+			ring_ok = false;
+		}
+		last_flush_time = k_uptime_get();
+	}
+
+out:
+	k_mutex_unlock(&ring_lock);
+
+	return length;
+}
+
+size_t log_backend_flash_ring_capacity(void)
+{
+	return (flash_ring_area != NULL) ? flash_ring_area->fa_size : 0;
+}
+
+ssize_t log_backend_flash_ring_read(size_t offset, void *buf, size_t len)
+{
+	int rc;
+
+	if (flash_ring_area == NULL) {
+		return -ENODEV;
+	}
+
+	if (offset >= flash_ring_area->fa_size) {
+		return 0;
+	}
+
+	len = MIN(len, flash_ring_area->fa_size - offset);
+
+	rc = flash_area_read(flash_ring_area, offset, buf, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return len;
+}
+
+int log_backend_flash_ring_clear(void)
+{
+	int rc;
+
+	if (flash_ring_area == NULL) {
+		return -ENODEV;
+	}
+
+	k_mutex_lock(&ring_lock, K_FOREVER);
+
+	rc = flash_area_erase(flash_ring_area, 0, flash_ring_area->fa_size);
+	if (rc == 0) {
+		rc = stream_restart(0);
+		ring_ok = (rc == 0);
+	}
+
+	k_mutex_unlock(&ring_lock);
+
+	return rc;
+}
+
+static uint8_t __aligned(4) output_buf[FLASH_BUF_SIZE];
+LOG_OUTPUT_DEFINE(log_output_ring, write_to_ring, output_buf, sizeof(output_buf));
+
+static void log_backend_flash_ring_init(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+
+	int rc;
+
+	k_mutex_init(&ring_lock);
+
+	rc = flash_area_open(FLASH_PARTITION_ID, &flash_ring_area);
+	if (rc < 0) {
+		return;
+	}
+
+	rc = stream_restart(resume_offset_find());
+
+	ring_ok = (rc == 0);
+	last_flush_time = k_uptime_get();
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	/* Push out buffered bytes so the tail of the log survives the
+	 * reset, then stop accepting messages.
+	 */
+	if (ring_ok) {
+		(void)stream_flash_buffered_write(&stream_ctx, NULL, 0, true);
+		ring_ok = false;
+	}
+
+	log_backend_deactivate(backend);
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FLASH_RING_OUTPUT_DICTIONARY)) {
+		log_dict_output_dropped_process(&log_output_ring, cnt);
+	} else {
+		log_backend_std_dropped(&log_output_ring, cnt);
+	}
+}
+
+static void process(const struct log_backend *const backend,
+		    union log_msg_generic *msg)
+{
+	ARG_UNUSED(backend);
+
+	uint32_t flags = log_backend_std_get_flags();
+	log_format_func_t log_output_func =
+		log_format_func_t_get(log_format_current);
+
+	log_output_func(&log_output_ring, &msg->log, flags);
+}
+
+static int format_set(const struct log_backend *const backend, uint32_t log_type)
+{
+	ARG_UNUSED(backend);
+
+	log_format_current = log_type;
+	return 0;
+}
+
+static const struct log_backend_api log_backend_flash_ring_api = {
+	.process = process,
+	.panic = panic,
+	.init = log_backend_flash_ring_init,
+	.dropped = dropped,
+	.format_set = format_set,
+};
+
+LOG_BACKEND_DEFINE(log_backend_flash_ring, log_backend_flash_ring_api,
+		   IS_ENABLED(CONFIG_LOG_BACKEND_FLASH_RING_AUTOSTART));
+
+#if defined(CONFIG_SHELL)
+static int cmd_log_ring_info(const struct shell *sh, size_t argc, char *argv[])
+{
+	shell_print(sh, "Partition size: %zu", log_backend_flash_ring_capacity());
+	shell_print(sh, "Write offset: %zu",
+		    ring_off + stream_flash_bytes_written(&stream_ctx));
+	shell_print(sh, "State: %s", ring_ok ? "ok" : "error");
+
+	return 0;
+}
+
+static int cmd_log_ring_read(const struct shell *sh, size_t argc, char *argv[])
+{
+	uint8_t chunk[32];
+	size_t offset = (argc > 1) ? strtoul(argv[1], NULL, 0) : 0;
+	size_t len = (argc > 2) ? strtoul(argv[2], NULL, 0) :
+		     log_backend_flash_ring_capacity();
+	ssize_t read;
+
+	while (len > 0) {
+		read = log_backend_flash_ring_read(offset, chunk,
+						   MIN(len, sizeof(chunk)));
+		if (read < 0) {
+			shell_error(sh, "Read failed (%zd)", read);
+			return read;
+		}
+
+		if (read == 0) {
+			break;
+		}
+
+		shell_hexdump_line(sh, offset, chunk, read);
+		offset += read;
+		len -= read;
+	}
+
+	return 0;
+}
+
+static int cmd_log_ring_clear(const struct shell *sh, size_t argc, char *argv[])
+{
+	int rc = log_backend_flash_ring_clear();
+
+	if (rc < 0) {
+		shell_error(sh, "Erase failed (%d)", rc);
+	}
+
+	return rc;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_ring,
+	SHELL_CMD(info, NULL, "Show flash ring state.", cmd_log_ring_info),
+	SHELL_CMD_ARG(read, NULL, "Hexdump retained data: read [<offset> [<length>]]",
+		      cmd_log_ring_read, 1, 2),
+	SHELL_CMD(clear, NULL, "Erase retained data.", cmd_log_ring_clear),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(log_ring, &sub_log_ring, "Flash ring log backend commands",
+		   NULL);
+#endif /* CONFIG_SHELL */
+
+#endif /* FIXED_PARTITION_EXISTS(log_partition) */
@@ -137,6 +137,47 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 		 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ?
 		  MPSC_PBUF_MAX_UTILIZATION : 0)
 };
+
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/* CPU 0 uses the primary log_buffer, each remaining CPU gets its own
+ * staging buffer. The buffers are registered in the log_mpsc_pbuf
+ * section so that the processing thread merges them by timestamp,
+ * like the per-link buffers in the multi-domain setup.
+ */
+#define LOG_PERCPU_BUF_DEFINE(i, _) \
+	static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT) \
+		percpu_buf32_##i[CONFIG_LOG_BUFFER_SIZE / sizeof(int)]; \
+	static STRUCT_SECTION_ITERABLE_ALTERNATE(log_mpsc_pbuf, \
+						 mpsc_pbuf_buffer, \
+						 log_percpu_buffer_##i); \
+	static STRUCT_SECTION_ITERABLE(log_msg_ptr, log_percpu_msg_ptr_##i); \
+	static const struct mpsc_pbuf_buffer_config percpu_mpsc_config_##i = { \
+		.buf = (uint32_t *)percpu_buf32_##i, \
+		.size = ARRAY_SIZE(percpu_buf32_##i), \
+		.notify_drop = z_log_notify_drop, \
+		.get_wlen = log_msg_generic_get_wlen, \
+		.flags = (IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW) ? \
+			  MPSC_PBUF_MODE_OVERWRITE : 0) | \
+			 (IS_ENABLED(CONFIG_LOG_MEM_UTILIZATION) ? \
+			  MPSC_PBUF_MAX_UTILIZATION : 0) \
+	}
+
+LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_PERCPU_BUF_DEFINE, (;), _);
+
+#define LOG_PERCPU_BUF_PTR(i, _) &log_percpu_buffer_##i
+#define LOG_PERCPU_CONFIG_PTR(i, _) &percpu_mpsc_config_##i
+
+static struct mpsc_pbuf_buffer *const percpu_buffers[CONFIG_MP_MAX_NUM_CPUS] = {
+	&log_buffer,
+	LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_PERCPU_BUF_PTR, (,), _)
+};
+
+static const struct mpsc_pbuf_buffer_config *const
+percpu_configs[CONFIG_MP_MAX_NUM_CPUS] = {
+	&mpsc_config,
+	LISTIFY(UTIL_DEC(CONFIG_MP_MAX_NUM_CPUS), LOG_PERCPU_CONFIG_PTR, (,), _)
+};
+#endif /* CONFIG_LOG_PERCPU_BUFFERS */
 #endif
 
 /* Check that default tag can fit in tag buffer. */
@@ -536,7 +577,8 @@ void z_log_notify_backend_enabled(void)
 
 static inline bool z_log_unordered_pending(void)
 {
-	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
+	return (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+		IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS)) && unordered_cnt;
 }
 
 bool z_impl_log_process(void)
@@ -638,6 +680,12 @@ void z_log_msg_init(void)
 #ifdef CONFIG_MPSC_PBUF
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
+
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	for (size_t i = 1; i < ARRAY_SIZE(percpu_buffers); i++) {
+		mpsc_pbuf_init(percpu_buffers[i], percpu_configs[i]);
+	}
+#endif
 #endif
 }
 
@@ -654,9 +702,37 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 			: K_MSEC(CONFIG_LOG_BLOCK_IN_THREAD_TIMEOUT_MS));
 }
 
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+/* A thread can be rescheduled to another CPU between allocation and
+ * commit, so the owning buffer is found by the message address.
+ */
+static struct mpsc_pbuf_buffer *msg_owner_buffer(struct log_msg *msg)
+{
+	uint32_t *ptr = (uint32_t *)msg;
+
+	for (size_t i = 1; i < ARRAY_SIZE(percpu_buffers); i++) {
+		struct mpsc_pbuf_buffer *buffer = percpu_buffers[i];
+
+		if ((ptr >= buffer->buf) && (ptr < &buffer->buf[buffer->size])) {
+			return buffer;
+		}
+	}
+
+	return &log_buffer;
+}
+#endif /* CONFIG_LOG_PERCPU_BUFFERS */
+
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	/* Preemption between reading the CPU id and the allocation only
+	 * means occasionally writing to another CPU's buffer, which is
+	 * safe as each buffer remains multi-producer.
+	 */
+	return msg_alloc(percpu_buffers[arch_curr_cpu()->id], wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -688,7 +764,11 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PERCPU_BUFFERS
+	msg_commit(msg_owner_buffer(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -775,7 +855,8 @@ union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
-	if (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && len > 1) {
+	if ((IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+	     IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS)) && len > 1) {
 		return z_log_msg_claim_oldest(backoff);
 	}
 
@@ -810,7 +891,8 @@ bool z_log_msg_pending(void)
 
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
-	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
+	if ((!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) &&
+	     !IS_ENABLED(CONFIG_LOG_PERCPU_BUFFERS)) || (len == 1)) {
 		return msg_pending(&log_buffer);
 	}
 
@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  */
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log_internal.h>
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/internal/syscall_handler.h>
@@ -360,8 +361,86 @@ void z_log_runtime_filters_init(void)
 		LOG_FILTER_SLOT_SET(filters,
 				    LOG_FILTER_AGGR_SLOT_IDX,
 				    level);
+
+#ifdef CONFIG_LOG_RATE_LIMIT
+		struct log_source_dynamic_data *dynamic =
+			&TYPE_SECTION_START(log_dynamic)[i];
+
+		dynamic->rl_rate = CONFIG_LOG_RATE_LIMIT_DEFAULT_RATE;
+		dynamic->rl_burst = CONFIG_LOG_RATE_LIMIT_BURST;
+		dynamic->rl_tokens = dynamic->rl_burst;
+#endif
+	}
+}
+
+#ifdef CONFIG_LOG_RATE_LIMIT
+bool z_log_rate_limit_passed(const void *source)
+{
+	struct log_source_dynamic_data *dynamic =
+		(struct log_source_dynamic_data *)source;
+	uint32_t now;
+	uint32_t refill;
+
+	if ((dynamic == NULL) || (dynamic->rl_rate == 0U)) {
+		return true;
+	}
+
+	/* Unsynchronized bucket update: concurrent logging from the same
+	 * source may occasionally miscount a token, which is acceptable
+	 * for a rate limiter and keeps the hot path lock-free.
+	 */
+	now = k_uptime_get_32();
+	refill = (uint32_t)(((uint64_t)(now - dynamic->rl_last_ms) *
+			     dynamic->rl_rate) / MSEC_PER_SEC);
+
+	if (refill > 0U) {
+		dynamic->rl_tokens = MIN((uint32_t)dynamic->rl_tokens + refill,
+					 (uint32_t)dynamic->rl_burst);
+		dynamic->rl_last_ms = now;
+	}
+
+	if (dynamic->rl_tokens == 0U) {
+		dynamic->rl_dropped++;
+		return false;
+	}
+
+	dynamic->rl_tokens--;
+
+	return true;
+}
+
+int log_rate_limit_set(int16_t source_id, uint16_t msgs_per_sec, uint16_t burst)
+{
+	if ((burst == 0U) || (source_id >= (int16_t)z_log_sources_count())) {
+		return -EINVAL;
 	}
+
+	for (int i = 0; i < z_log_sources_count(); i++) {
+		struct log_source_dynamic_data *dynamic;
+
+		if ((source_id >= 0) && (i != source_id)) {
+			continue;
+		}
+
+		dynamic = &TYPE_SECTION_START(log_dynamic)[i];
+		dynamic->rl_rate = msgs_per_sec;
+		dynamic->rl_burst = burst;
+		dynamic->rl_tokens = MIN(dynamic->rl_tokens, burst);
+		dynamic->rl_last_ms = k_uptime_get_32();
+	}
+
+	return 0;
+}
+
+uint32_t log_rate_limit_dropped_get(int16_t source_id)
+{
+	if ((source_id < 0) || (source_id >= (int16_t)z_log_sources_count())) {
+		return 0;
+	}
+
+	return TYPE_SECTION_START(log_dynamic)[source_id].rl_dropped;
 }
+#endif /* CONFIG_LOG_RATE_LIMIT */
 
 int log_source_id_get(const char *name)
 {
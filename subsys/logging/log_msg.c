@@ -92,6 +92,10 @@ static bool frontend_runtime_filtering(const void *source, uint32_t level)
  */
 static void z_log_msg_simple_create(const void *source, uint32_t level, uint32_t *data, size_t len)
 {
+	if (!z_log_rate_limit_passed(source)) {
+		return;
+	}
+
 	/* Package length (in words) is increased by the header. */
 	size_t plen32 = len + CBPRINTF_DESC_SIZE32;
 	/* Package length in bytes. */
@@ -289,6 +293,10 @@ void z_impl_z_log_msg_static_create(const void *source,
 		return;
 	}
 
+	if (!z_log_rate_limit_passed(source)) {
+		return;
+	}
+
 	struct log_msg_desc out_desc = desc;
 	int inlen = desc.package_len;
 	struct log_msg *msg;
@@ -372,8 +380,11 @@ void z_log_msg_runtime_vcreate(uint8_t domain_id, const void *source,
 	struct log_msg_desc desc =
 		Z_LOG_MSG_DESC_INITIALIZER(domain_id, level, plen, dlen);
 
+	bool rate_ok = true;
+
 	if (IS_ENABLED(CONFIG_LOG_MODE_DEFERRED) && BACKENDS_IN_USE()) {
-		msg = z_log_msg_alloc(msg_wlen);
+		rate_ok = z_log_rate_limit_passed(source);
+		msg = rate_ok ? z_log_msg_alloc(msg_wlen) : NULL;
 		if (IS_ENABLED(CONFIG_LOG_FRONTEND) && msg == NULL) {
 			pkg = alloca(plen);
 		} else {
@@ -393,7 +404,7 @@ void z_log_msg_runtime_vcreate(uint8_t domain_id, const void *source,
 		log_frontend_msg(source, desc, pkg, data);
 	}
 
-	if (BACKENDS_IN_USE()) {
+	if (BACKENDS_IN_USE() && rate_ok) {
 		z_log_msg_finalize(msg, source, desc, data);
 	}
 }
@@ -11,12 +11,44 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef CONFIG_LOG_DICT_FMT_OFFSET
+TYPE_SECTION_START_EXTERN(const char, log_strings);
+
+/* Get the 16-bit offset of the package format string into the log
+ * strings section. Returns false when the offset does not fit and
+ * the regular format must be used.
+ */
+static bool package_fmt_offset_get(const uint8_t *package, size_t len,
+				   uint16_t *offset16)
+{
+	const struct cbprintf_package_hdr_ext *ext =
+		(const struct cbprintf_package_hdr_ext *)package;
+	ptrdiff_t fmt_offset;
+
+	if (len < sizeof(*ext)) {
+		return false;
+	}
+
+	fmt_offset = (const char *)ext->fmt - TYPE_SECTION_START(log_strings);
+	if ((fmt_offset < 0) || (fmt_offset > UINT16_MAX)) {
+		return false;
+	}
+
+	*offset16 = (uint16_t)fmt_offset;
+
+	return true;
+}
+#endif /* CONFIG_LOG_DICT_FMT_OFFSET */
 
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
 	void *source = (void *)log_msg_get_source(msg);
+	size_t len;
+	uint8_t *data = log_msg_get_package(msg, &len);
 
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
@@ -28,12 +60,34 @@ void log_dict_output_msg_process(const struct log_output *output,
 
 	output_hdr.source = (source != NULL) ? log_source_id(source) : 0U;
 
+#ifdef CONFIG_LOG_DICT_FMT_OFFSET
+	uint16_t fmt_offset16 = 0U;
+	bool compact = package_fmt_offset_get(data, len, &fmt_offset16);
+
+	if (compact) {
+		output_hdr.type = MSG_FMT_OFFSET;
+		output_hdr.package_len = len - sizeof(char *) + sizeof(uint16_t);
+	}
+#endif /* CONFIG_LOG_DICT_FMT_OFFSET */
+
 	log_output_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
 			 (void *)output->control_block->ctx);
 
-	size_t len;
-	uint8_t *data = log_msg_get_package(msg, &len);
+#ifdef CONFIG_LOG_DICT_FMT_OFFSET
+	if (compact) {
+		size_t args_off = offsetof(struct cbprintf_package_hdr_ext, fmt) +
+				  sizeof(char *);
 
+		log_output_write(output->func, data,
+				 offsetof(struct cbprintf_package_hdr_ext, fmt),
+				 (void *)output->control_block->ctx);
+		log_output_write(output->func, (uint8_t *)&fmt_offset16,
+				 sizeof(fmt_offset16),
+				 (void *)output->control_block->ctx);
+		log_output_write(output->func, &data[args_off], len - args_off,
+				 (void *)output->control_block->ctx);
+	} else
+#endif /* CONFIG_LOG_DICT_FMT_OFFSET */
 	if (len > 0U) {
 		log_output_write(output->func, data, len, (void *)output->control_block->ctx);
 	}
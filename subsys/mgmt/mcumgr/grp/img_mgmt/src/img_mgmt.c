@@ -985,6 +985,19 @@ end:
 	} else {
 		rc = img_mgmt_upload_good_rsp(ctxt);
 
+#ifdef CONFIG_MCUMGR_GRP_IMG_UPLOAD_WINDOW
+		/* With a pipelining client, further chunks are already queued on
+		 * the transport; drop this intermediate response and let the
+		 * response to the last queued chunk acknowledge them cumulatively.
+		 * The first chunk is always acknowledged as it confirms that the
+		 * upload has been accepted.
+		 */
+		if (rc == MGMT_ERR_EOK && !last && req.off != 0 &&
+		    smp_transport_rx_pending(ctxt->smpt)) {
+			smp_rsp_suppress(ctxt);
+		}
+#endif
+
 #ifdef CONFIG_IMG_ENABLE_IMAGE_CHECK
 		if (last && rc == MGMT_ERR_EOK) {
 			/* Append status to last packet */
@@ -426,6 +426,10 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 			cbor_nb_reader_init(streamer->reader, req);
 			cbor_nb_writer_init(streamer->writer, rsp);
 
+#ifdef CONFIG_MCUMGR_SMP_RESPONSE_SUPPRESSION
+			streamer->rsp_suppressed = false;
+#endif
+
 			/* Process the request payload and build the response. */
 			rc = smp_handle_single_req(streamer, &req_hdr, &rsn);
 			handler_found = (rc != MGMT_ERR_ENOTSUP);
@@ -433,9 +437,19 @@ int smp_process_request_packet(struct smp_streamer *streamer, void *vreq)
 				break;
 			}
 
+#ifdef CONFIG_MCUMGR_SMP_RESPONSE_SUPPRESSION
+			if (streamer->rsp_suppressed) {
+				/* The handler asked for the response to be dropped. */
+				smp_free_buf(rsp, streamer->smpt);
+				rsp = NULL;
+			}
+#endif
+
 			/* Send the response. */
-			rc = streamer->smpt->functions.output(rsp);
-			rsp = NULL;
+			if (rsp != NULL) {
+				rc = streamer->smpt->functions.output(rsp);
+				rsp = NULL;
+			}
 		} else if (IS_ENABLED(CONFIG_SMP_CLIENT) && (req_hdr.nh_op == MGMT_OP_READ_RSP ||
 			   req_hdr.nh_op == MGMT_OP_WRITE_RSP)) {
 			rc = smp_client_single_response(req, &req_hdr);
@@ -249,6 +249,11 @@ void smp_rx_remove_invalid(struct smp_transport *zst, void *arg)
 	}
 }
 
+bool smp_transport_rx_pending(struct smp_transport *smpt)
+{
+	return !k_fifo_is_empty(&smpt->fifo);
+}
+
 void smp_rx_clear(struct smp_transport *zst)
 {
 	struct net_buf *nb;
@@ -291,6 +291,26 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
 	return true;
 }
 
+/* Maximum number of 16-bit registers in a single read/write request */
+#define MBS_REGS_LIMIT 125
+
+/*
+ * Check whether a ranged register callback can serve the whole request,
+ * i.e. it is implemented and no address falls into the floating-point
+ * extensions range.
+ */
+static bool mbs_ranged_cb_usable(const void *range_cb,
+				 const uint16_t reg_addr,
+				 const uint16_t reg_qty)
+{
+	if (range_cb == NULL) {
+		return false;
+	}
+
+	return !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS) ||
+	       ((uint32_t)reg_addr + reg_qty) <= MODBUS_FP_EXTENSIONS_ADDR;
+}
+
 /*
  * 03 (0x03) Read Holding Registers
  *
@@ -306,7 +326,7 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
  */
 static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 4;
 	uint8_t *presp;
 	uint16_t err;
@@ -335,7 +355,8 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->holding_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_rd == NULL &&
+		    ctx->mbs_user_cb->holding_reg_rd_range == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -360,13 +381,38 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if (mbs_ranged_cb_usable(ctx->mbs_user_cb->holding_reg_rd_range,
+				 reg_addr, reg_qty)) {
+		uint16_t reg_buf[MBS_REGS_LIMIT];
+
+		/* Read all registers with a single callback invocation */
+		err = ctx->mbs_user_cb->holding_reg_rd_range(reg_addr, reg_buf, reg_qty);
+		if (err != 0) {
+			LOG_INF("Holding register address not supported");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+			return true;
+		}
+
+		for (uint16_t i = 0; i < reg_qty; i++) {
+			sys_put_be16(reg_buf[i], presp);
+			presp += sizeof(uint16_t);
+		}
+
+		return true;
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
 			uint16_t reg;
 
 			/* Read integer register */
-			err = ctx->mbs_user_cb->holding_reg_rd(reg_addr, &reg);
+			if (ctx->mbs_user_cb->holding_reg_rd != NULL) {
+				err = ctx->mbs_user_cb->holding_reg_rd(reg_addr, &reg);
+			} else {
+				err = ctx->mbs_user_cb->holding_reg_rd_range(reg_addr, &reg, 1);
+			}
 			if (err == 0) {
 				sys_put_be16(reg, presp);
 				presp += sizeof(uint16_t);
@@ -418,7 +464,7 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
  */
 static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 4;
 	uint8_t *presp;
 	int err;
@@ -447,7 +493,8 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->input_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->input_reg_rd == NULL &&
+		    ctx->mbs_user_cb->input_reg_rd_range == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -472,13 +519,38 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if (mbs_ranged_cb_usable(ctx->mbs_user_cb->input_reg_rd_range,
+				 reg_addr, reg_qty)) {
+		uint16_t reg_buf[MBS_REGS_LIMIT];
+
+		/* Read all registers with a single callback invocation */
+		err = ctx->mbs_user_cb->input_reg_rd_range(reg_addr, reg_buf, reg_qty);
+		if (err != 0) {
+			LOG_INF("Input register address not supported");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+			return true;
+		}
+
+		for (uint16_t i = 0; i < reg_qty; i++) {
+			sys_put_be16(reg_buf[i], presp);
+			presp += sizeof(uint16_t);
+		}
+
+		return true;
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
 			uint16_t reg;
 
 			/* Read integer register */
-			err = ctx->mbs_user_cb->input_reg_rd(reg_addr, &reg);
+			if (ctx->mbs_user_cb->input_reg_rd != NULL) {
+				err = ctx->mbs_user_cb->input_reg_rd(reg_addr, &reg);
+			} else {
+				err = ctx->mbs_user_cb->input_reg_rd_range(reg_addr, &reg, 1);
+			}
 			if (err == 0) {
 				sys_put_be16(reg, presp);
 				presp += sizeof(uint16_t);
@@ -599,7 +671,8 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 		return false;
 	}
 
-	if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
+	if (ctx->mbs_user_cb->holding_reg_wr == NULL &&
+	    ctx->mbs_user_cb->holding_reg_wr_range == NULL) {
 		mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 		return true;
 	}
@@ -607,7 +680,11 @@ static bool mbs_fc06_hreg_write(struct modbus_context *ctx)
 	reg_addr = sys_get_be16(&ctx->rx_adu.data[0]);
 	reg_val = sys_get_be16(&ctx->rx_adu.data[2]);
 
-	err = ctx->mbs_user_cb->holding_reg_wr(reg_addr, reg_val);
+	if (ctx->mbs_user_cb->holding_reg_wr != NULL) {
+		err = ctx->mbs_user_cb->holding_reg_wr(reg_addr, reg_val);
+	} else {
+		err = ctx->mbs_user_cb->holding_reg_wr_range(reg_addr, &reg_val, 1);
+	}
 
 	if (err != 0) {
 		LOG_INF("Register address not supported");
@@ -828,7 +905,7 @@ static bool mbs_fc15_coils_write(struct modbus_context *ctx)
  */
 static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 6;
 	const uint8_t response_len = 4;
 	uint8_t *prx_data;
@@ -856,7 +933,8 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Write integer register */
-		if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_wr == NULL &&
+		    ctx->mbs_user_cb->holding_reg_wr_range == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -889,6 +967,31 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	/* The 1st registers data byte is 6th element in payload */
 	prx_data = &ctx->rx_adu.data[5];
 
+	if (mbs_ranged_cb_usable(ctx->mbs_user_cb->holding_reg_wr_range,
+				 reg_addr, reg_qty)) {
+		uint16_t reg_buf[MBS_REGS_LIMIT];
+
+		for (uint16_t i = 0; i < reg_qty; i++) {
+			reg_buf[i] = sys_get_be16(prx_data);
+			prx_data += sizeof(uint16_t);
+		}
+
+		/* Write all registers with a single callback invocation */
+		err = ctx->mbs_user_cb->holding_reg_wr_range(reg_addr, reg_buf, reg_qty);
+		if (err != 0) {
+			LOG_INF("Register address not supported");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+			return true;
+		}
+
+		/* Assemble response payload */
+		ctx->tx_adu.length = response_len;
+		sys_put_be16(reg_addr, &ctx->tx_adu.data[0]);
+		sys_put_be16(reg_qty, &ctx->tx_adu.data[2]);
+
+		return true;
+	}
+
 	for (uint16_t reg_cntr = 0; reg_cntr < reg_qty;) {
 		uint16_t addr = reg_addr + reg_cntr;
 
@@ -897,7 +1000,11 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 			uint16_t reg_val = sys_get_be16(prx_data);
 
 			prx_data += sizeof(uint16_t);
-			err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
+			if (ctx->mbs_user_cb->holding_reg_wr != NULL) {
+				err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
+			} else {
+				err = ctx->mbs_user_cb->holding_reg_wr_range(addr, &reg_val, 1);
+			}
 			reg_cntr++;
 		} else {
 			uint32_t reg_val = sys_get_be32(prx_data);
@@ -210,18 +210,43 @@ void net_6lo_set_context(struct net_if *iface,
 	NET_DBG("Either no free slots in the table or exceeds limit");
 }
 
+/* Most recently used table indices, two per lookup kind since every
+ * packet looks up both its source and its destination. Steady traffic
+ * to one neighbor then matches without scanning the table. The hints
+ * are re-validated against the table before use, so stale values after
+ * a context update are harmless and no invalidation is needed.
+ */
+static uint8_t ctx_mru_cid[2];
+static uint8_t ctx_mru_addr[2];
+
+static inline void ctx_mru_update(uint8_t *mru, uint8_t index)
+{
+	mru[1] = mru[0];
+	mru[0] = index;
+}
+
 /* Get the context by matching cid */
 static inline struct net_6lo_context *
 get_6lo_context_by_cid(struct net_if *iface, uint8_t cid)
 {
 	uint8_t i;
 
+	for (i = 0U; i < 2U; i++) {
+		uint8_t hint = ctx_mru_cid[i];
+
+		if (ctx_6co[hint].is_used && ctx_6co[hint].iface == iface &&
+		    ctx_6co[hint].cid == cid) {
+			return &ctx_6co[hint];
+		}
+	}
+
 	for (i = 0U; i < CONFIG_NET_MAX_6LO_CONTEXTS; i++) {
 		if (!ctx_6co[i].is_used) {
 			continue;
 		}
 
 		if (ctx_6co[i].iface == iface && ctx_6co[i].cid == cid) {
+			ctx_mru_update(ctx_mru_cid, i);
 			return &ctx_6co[i];
 		}
 	}
@@ -235,6 +260,15 @@ get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 {
 	uint8_t i;
 
+	for (i = 0U; i < 2U; i++) {
+		uint8_t hint = ctx_mru_addr[i];
+
+		if (ctx_6co[hint].is_used && ctx_6co[hint].iface == iface &&
+		    !memcmp(ctx_6co[hint].prefix.s6_addr, addr->s6_addr, 8)) {
+			return &ctx_6co[hint];
+		}
+	}
+
 	for (i = 0U; i < CONFIG_NET_MAX_6LO_CONTEXTS; i++) {
 		if (!ctx_6co[i].is_used) {
 			continue;
@@ -242,6 +276,7 @@ get_6lo_context_by_addr(struct net_if *iface, struct in6_addr *addr)
 
 		if (ctx_6co[i].iface == iface &&
 		    !memcmp(ctx_6co[i].prefix.s6_addr, addr->s6_addr, 8)) {
+			ctx_mru_update(ctx_mru_addr, i);
 			return &ctx_6co[i];
 		}
 	}
@@ -25,6 +25,11 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/socketcan.h>
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+#include <zephyr/sys/hash_function.h>
+#include <zephyr/sys/hash_map_oa_lp.h>
+#endif
+
 #include "net_private.h"
 #include "icmpv6.h"
 #include "icmpv4.h"
@@ -116,6 +121,140 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+/* Fully qualified TCP/UDP connections (both addresses and both ports
+ * specified) are additionally stored in a hash map keyed by the packet
+ * 4-tuple, so that the common established-connection case is resolved
+ * without scanning the whole conn_used list. The map and the one-entry
+ * last-hit cache are protected by conn_lock.
+ */
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(conn_tuple_map);
+
+static struct {
+	uint64_t key;
+	struct net_conn *conn;
+} conn_last_hit;
+
+#define NET_CONN_TUPLE_SPEC	(NET_CONN_REMOTE_PORT_SPEC | \
+				 NET_CONN_LOCAL_PORT_SPEC |  \
+				 NET_CONN_REMOTE_ADDR_SPEC | \
+				 NET_CONN_LOCAL_ADDR_SPEC)
+
+static uint64_t conn_tuple_key(uint8_t family, uint16_t proto,
+			       const uint8_t *remote_addr,
+			       const uint8_t *local_addr,
+			       size_t addr_len,
+			       uint16_t remote_port, uint16_t local_port)
+{
+	uint8_t tuple[2 * sizeof(struct in6_addr) + 2];
+	size_t len = 0U;
+
+	memcpy(&tuple[len], remote_addr, addr_len);
+	len += addr_len;
+	memcpy(&tuple[len], local_addr, addr_len);
+	len += addr_len;
+	tuple[len++] = family;
+	tuple[len++] = (uint8_t)proto;
+
+	/* The ports (in network byte order) are kept verbatim in the upper
+	 * bits so that the common port mismatch case differs already in the
+	 * key itself.
+	 */
+	return ((uint64_t)remote_port << 48) | ((uint64_t)local_port << 32) |
+		sys_hash32(tuple, len);
+}
+
+static uint64_t conn_tuple_key_from_conn(struct net_conn *conn)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6) {
+		return conn_tuple_key(conn->family, conn->proto,
+				      (const uint8_t *)&net_sin6(&conn->remote_addr)->sin6_addr,
+				      (const uint8_t *)&net_sin6(&conn->local_addr)->sin6_addr,
+				      sizeof(struct in6_addr),
+				      net_sin6(&conn->remote_addr)->sin6_port,
+				      net_sin6(&conn->local_addr)->sin6_port);
+	}
+
+	return conn_tuple_key(conn->family, conn->proto,
+			      (const uint8_t *)&net_sin(&conn->remote_addr)->sin_addr,
+			      (const uint8_t *)&net_sin(&conn->local_addr)->sin_addr,
+			      sizeof(struct in_addr),
+			      net_sin(&conn->remote_addr)->sin_port,
+			      net_sin(&conn->local_addr)->sin_port);
+}
+
+static void conn_tuple_insert(struct net_conn *conn)
+{
+	uint64_t key;
+	int ret;
+
+	if (conn->proto != IPPROTO_UDP && conn->proto != IPPROTO_TCP) {
+		return;
+	}
+
+	if (conn->family != AF_INET && conn->family != AF_INET6) {
+		return;
+	}
+
+	/* Only fully qualified connections go into the map: anything less
+	 * specific can be outranked by another handler and must take the
+	 * normal scan. Port reuse (SO_REUSEPORT) can produce several
+	 * identical tuples, so those are left to the scan as well.
+	 */
+	if (NET_CONN_RANK(conn->flags) != NET_CONN_TUPLE_SPEC) {
+		return;
+	}
+
+	if (conn->context != NULL &&
+	    net_context_is_reuseport_set(conn->context)) {
+		return;
+	}
+
+	key = conn_tuple_key_from_conn(conn);
+
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	if (sys_hashmap_contains_key(&conn_tuple_map, key)) {
+		/* Key collision with another live connection, leave this
+		 * one to the scan path.
+		 */
+		k_mutex_unlock(&conn_lock);
+		return;
+	}
+
+	ret = sys_hashmap_insert(&conn_tuple_map, key,
+				 (uint64_t)POINTER_TO_UINT(conn), NULL);
+	if (ret == 1) {
+		conn->tuple_key = key;
+		conn->in_tuple_map = 1U;
+	}
+
+	k_mutex_unlock(&conn_lock);
+}
+
+static void conn_tuple_remove(struct net_conn *conn)
+{
+	if (!conn->in_tuple_map) {
+		return;
+	}
+
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	(void)sys_hashmap_remove(&conn_tuple_map, conn->tuple_key, NULL);
+
+	if (conn_last_hit.conn == conn) {
+		conn_last_hit.conn = NULL;
+	}
+
+	k_mutex_unlock(&conn_lock);
+
+	conn->in_tuple_map = 0U;
+}
+#else
+#define conn_tuple_insert(...)
+#define conn_tuple_remove(...)
+#endif /* CONFIG_NET_CONN_HASH_LOOKUP */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -430,6 +569,8 @@ int net_conn_register(uint16_t proto, uint8_t family,
 
 	conn_register_debug(conn, remote_port, local_port);
 
+	conn_tuple_insert(conn);
+
 	return 0;
 error:
 	conn_set_unused(conn);
@@ -450,6 +591,8 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	NET_DBG("Connection handler %p removed", conn);
 
+	conn_tuple_remove(conn);
+
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
 	k_mutex_unlock(&conn_lock);
@@ -476,9 +619,14 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	conn_tuple_remove(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	if (ret == 0) {
+		conn_tuple_insert(conn);
+	}
 
 	return ret;
 }
@@ -534,6 +682,71 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+/* Must be called with conn_lock held. The candidate is verified against
+ * the packet before use, so a hash collision merely falls back to the
+ * list scan.
+ */
+static struct net_conn *conn_tuple_lookup(struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  uint8_t proto, uint8_t pkt_family,
+					  uint16_t src_port, uint16_t dst_port)
+{
+	struct net_conn *conn = NULL;
+	uint64_t value;
+	uint64_t key;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && pkt_family == AF_INET6) {
+		key = conn_tuple_key(pkt_family, proto, ip_hdr->ipv6->src,
+				     ip_hdr->ipv6->dst,
+				     sizeof(struct in6_addr),
+				     src_port, dst_port);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && pkt_family == AF_INET) {
+		key = conn_tuple_key(pkt_family, proto, ip_hdr->ipv4->src,
+				     ip_hdr->ipv4->dst,
+				     sizeof(struct in_addr),
+				     src_port, dst_port);
+	} else {
+		return NULL;
+	}
+
+	if (conn_last_hit.conn != NULL && conn_last_hit.key == key) {
+		conn = conn_last_hit.conn;
+	} else if (sys_hashmap_get(&conn_tuple_map, key, &value)) {
+		conn = UINT_TO_POINTER((uintptr_t)value);
+	}
+
+	if (conn == NULL || conn->cb == NULL) {
+		return NULL;
+	}
+
+	if (conn->proto != proto || conn->family != pkt_family) {
+		return NULL;
+	}
+
+	if (net_sin(&conn->remote_addr)->sin_port != src_port ||
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return NULL;
+	}
+
+	if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) ||
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+		return NULL;
+	}
+
+	if (conn->context != NULL &&
+	    net_context_is_bound_to_iface(conn->context) &&
+	    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		return NULL;
+	}
+
+	conn_last_hit.key = key;
+	conn_last_hit.conn = conn;
+
+	return conn;
+}
+#endif /* CONFIG_NET_CONN_HASH_LOOKUP */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -620,6 +833,7 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	raw_pkt = net_pkt_clone(pkt, CLONE_TIMEOUT);
 	if (!raw_pkt) {
 		net_stats_update_per_proto_drop(pkt_iface, proto);
+		net_stats_update_drop_alloc_fail(pkt_iface);
 		NET_WARN("pkt cloning failed, pkt %p dropped", pkt);
 		return NET_DROP;
 	}
@@ -710,6 +924,27 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+	/* Unicast TCP/UDP packets for an established connection are the
+	 * common case and can be resolved directly from the 4-tuple map.
+	 * Anything the map cannot answer authoritatively (wildcards,
+	 * listeners, multicast/broadcast fan-out) takes the scan below.
+	 */
+	if (!is_mcast_pkt && !is_bcast_pkt &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    src_port != 0U && dst_port != 0U) {
+		best_match = conn_tuple_lookup(pkt, ip_hdr, proto, pkt_family,
+					       src_port, dst_port);
+		if (best_match != NULL) {
+			cb = best_match->cb;
+			user_data = best_match->user_data;
+
+			k_mutex_unlock(&conn_lock);
+			goto deliver;
+		}
+	}
+#endif /* CONFIG_NET_CONN_HASH_LOOKUP */
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -912,6 +1147,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		return NET_OK;
 	}
 
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+deliver:
+#endif
 	if (cb) {
 		NET_DBG("[%p] match found cb %p ud %p rank 0x%02x", best_match, cb,
 			user_data, NET_CONN_RANK(best_match->flags));
@@ -928,6 +1166,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	NET_DBG("No match found.");
 
+	net_stats_update_drop_no_conn(pkt_iface);
+
 	if (IS_ENABLED(CONFIG_NET_IP) && (pkt_family == AF_INET || pkt_family == AF_INET6) &&
 	    !(is_mcast_pkt || is_bcast_pkt)) {
 		if (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP &&
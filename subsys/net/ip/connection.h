@@ -82,6 +82,14 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH_LOOKUP)
+	/** Key under which this connection is stored in the 4-tuple map */
+	uint64_t tuple_key;
+
+	/** Is this connection stored in the 4-tuple map */
+	uint8_t in_tuple_map : 1;
+#endif
 };
 
 /**
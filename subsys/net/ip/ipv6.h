@@ -441,6 +441,11 @@ struct net_ipv6_reassembly {
 
 	/** IPv6 fragment identification */
 	uint32_t id;
+
+	/** Precomputed hash of id/src/dst, used to pick the probe start
+	 * slot and to reject non-matching slots without address compares.
+	 */
+	uint32_t hash;
 };
 #else
 struct net_ipv6_reassembly;
@@ -120,26 +120,57 @@ fail:
 	return -EINVAL;
 }
 
+/* Hash of the fragment identification tuple. Never zero, so a zero
+ * hash always means "slot not in use" and fails the comparison without
+ * further checks.
+ */
+static uint32_t reassembly_hash(uint32_t id, struct in6_addr *src,
+				struct in6_addr *dst)
+{
+	uint32_t hash = id;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		hash ^= UNALIGNED_GET(&src->s6_addr32[i]);
+		hash ^= UNALIGNED_GET(&dst->s6_addr32[i]);
+	}
+
+	hash *= 2654435761U;
+
+	return (hash != 0U) ? hash : 1U;
+}
+
 static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 						  struct in6_addr *src,
 						  struct in6_addr *dst)
 {
-	int i, avail = -1;
-
+	uint32_t hash = reassembly_hash(id, src, dst);
+	int start = hash % CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT;
+	int i, idx, avail = -1;
+
+	/* The slots form one open addressed hash table: probing starts
+	 * at a slot derived from the tuple hash, and a new reassembly
+	 * claims the first free slot in the same probe order, so
+	 * follow-up fragments usually match on the first probe instead
+	 * of comparing addresses against every active slot.
+	 */
 	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv6_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
-			return &reassembly[i];
+		idx = (start + i) % CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT;
+
+		if (reassembly[idx].hash == hash &&
+		    k_work_delayable_remaining_get(&reassembly[idx].timer) &&
+		    reassembly[idx].id == id &&
+		    net_ipv6_addr_cmp(src, &reassembly[idx].src) &&
+		    net_ipv6_addr_cmp(dst, &reassembly[idx].dst)) {
+			return &reassembly[idx];
 		}
 
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
+		if (k_work_delayable_remaining_get(&reassembly[idx].timer)) {
 			continue;
 		}
 
 		if (avail < 0) {
-			avail = i;
+			avail = idx;
 		}
 	}
 
@@ -153,6 +184,7 @@ static struct net_ipv6_reassembly *reassembly_get(uint32_t id,
 	net_ipaddr_copy(&reassembly[avail].dst, dst);
 
 	reassembly[avail].id = id;
+	reassembly[avail].hash = hash;
 
 	return &reassembly[avail];
 }
@@ -161,6 +193,7 @@ static bool reassembly_cancel(uint32_t id,
 			      struct in6_addr *src,
 			      struct in6_addr *dst)
 {
+	uint32_t hash = reassembly_hash(id, src, dst);
 	int i, j;
 
 	NET_DBG("Cancel 0x%x", id);
@@ -168,7 +201,8 @@ static bool reassembly_cancel(uint32_t id,
 	for (i = 0; i < CONFIG_NET_IPV6_FRAGMENT_MAX_COUNT; i++) {
 		int32_t remaining;
 
-		if (reassembly[i].id != id ||
+		if (reassembly[i].hash != hash ||
+		    reassembly[i].id != id ||
 		    !net_ipv6_addr_cmp(src, &reassembly[i].src) ||
 		    !net_ipv6_addr_cmp(dst, &reassembly[i].dst)) {
 			continue;
@@ -182,6 +216,7 @@ static bool reassembly_cancel(uint32_t id,
 			reassembly[i].id, remaining);
 
 		reassembly[i].id = 0U;
+		reassembly[i].hash = 0U;
 
 		for (j = 0; j < CONFIG_NET_IPV6_FRAGMENT_MAX_PKT; j++) {
 			if (!reassembly[i].pkt[j]) {
@@ -133,6 +133,75 @@ static inline struct net_nbr *get_nbr(int idx)
 	return &net_neighbor_pool[idx].nbr;
 }
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+/* Hash index over the neighbor pool so that address lookups do not need
+ * to scan every slot. Each bucket chains pool slot indexes, stored as
+ * index + 1 so that zero can mark the end of a chain. The index is
+ * protected by the neighbor lock like the pool itself.
+ */
+#define NBR_HASH_BUCKETS (2 * CONFIG_NET_IPV6_MAX_NEIGHBORS)
+
+BUILD_ASSERT(CONFIG_NET_IPV6_MAX_NEIGHBORS < 255,
+	     "Neighbor slot indexes must fit into uint8_t");
+
+static uint8_t nbr_hash_head[NBR_HASH_BUCKETS];
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static uint8_t nbr_hash_slot(const struct net_nbr *nbr)
+{
+	return ((const uint8_t *)nbr - (const uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static uint16_t nbr_hash_bucket(const struct in6_addr *addr)
+{
+	uint32_t hash;
+
+	hash = UNALIGNED_GET(&addr->s6_addr32[0]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[1]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[2]) ^
+	       UNALIGNED_GET(&addr->s6_addr32[3]);
+
+	/* Mix the halves so that addresses differing only in the top
+	 * bits still spread over the buckets.
+	 */
+	hash ^= hash >> 16;
+
+	return hash % NBR_HASH_BUCKETS;
+}
+
+static void nbr_hash_insert(struct net_nbr *nbr)
+{
+	uint16_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t slot = nbr_hash_slot(nbr);
+
+	nbr_hash_next[slot] = nbr_hash_head[bucket];
+	nbr_hash_head[bucket] = slot + 1U;
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	uint16_t bucket = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t slot = nbr_hash_slot(nbr);
+	uint8_t *link = &nbr_hash_head[bucket];
+
+	while (*link != 0U) {
+		if (*link == slot + 1U) {
+			*link = nbr_hash_next[slot];
+			return;
+		}
+
+		link = &nbr_hash_next[*link - 1U];
+	}
+}
+
+static void nbr_hash_clear(void)
+{
+	memset(nbr_hash_head, 0, sizeof(nbr_hash_head));
+	memset(nbr_hash_next, 0, sizeof(nbr_hash_next));
+}
+#endif /* CONFIG_NET_IPV6_NBR_HASH */
+
 static inline struct net_nbr *get_nbr_from_data(struct net_ipv6_nbr_data *data)
 {
 	int i;
@@ -269,6 +338,21 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	uint8_t idx = nbr_hash_head[nbr_hash_bucket(addr)];
+
+	while (idx != 0U) {
+		struct net_nbr *nbr = get_nbr(idx - 1U);
+
+		if (nbr->ref &&
+		    (!iface || nbr->iface == iface) &&
+		    net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+			return nbr;
+		}
+
+		idx = nbr_hash_next[idx - 1U];
+	}
+#else
 	int i;
 
 	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
@@ -286,6 +370,7 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 			return nbr;
 		}
 	}
+#endif
 
 	return NULL;
 }
@@ -448,6 +533,10 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 
 	nbr_init(nbr, iface, addr, is_router, state);
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	nbr_hash_insert(nbr);
+#endif
+
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
 		net_sprint_ipv6_addr(addr));
@@ -668,12 +757,20 @@ void net_neighbor_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	nbr_hash_remove(nbr);
+#endif
+
 	return;
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
 {
 	NET_DBG("Neighbor table %p cleared", table);
+
+#if defined(CONFIG_NET_IPV6_NBR_HASH)
+	nbr_hash_clear();
+#endif
 }
 
 struct in6_addr *net_ipv6_nbr_lookup_by_index(struct net_if *iface,
@@ -1883,12 +1883,66 @@ static void context_finalize_packet(struct net_context *context,
 	}
 }
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+void net_context_buf_credit(struct net_context *context, uint32_t bytes)
+{
+	atomic_val_t old_value, new_value;
+
+	do {
+		old_value = atomic_get(&context->bufs_in_use);
+		new_value = (old_value > bytes) ? old_value - bytes : 0;
+	} while (!atomic_cas(&context->bufs_in_use, old_value, new_value));
+}
+
+/* Charge the buffer bytes held by the packet to the owning context.
+ * The charge is given back when the packet is released.
+ */
+static void context_buf_charge(struct net_context *context,
+			       struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint32_t bytes = 0U;
+
+	while (buf != NULL) {
+		bytes += buf->size;
+		buf = buf->frags;
+	}
+
+	if (bytes == 0U || net_pkt_accounted_bytes(pkt) > 0U) {
+		return;
+	}
+
+	atomic_add(&context->bufs_in_use, bytes);
+	net_pkt_set_accounted_bytes(pkt, bytes);
+}
+
+static bool context_buf_over_budget(struct net_context *context,
+				    uint16_t budget, size_t extra)
+{
+	return budget > 0U &&
+	       (uint32_t)atomic_get(&context->bufs_in_use) + extra > budget;
+}
+#else
+#define context_buf_charge(context, pkt)
+#endif /* CONFIG_NET_CONTEXT_BUF_ACCOUNTING */
+
 static struct net_pkt *context_alloc_pkt(struct net_context *context,
 					 sa_family_t family,
 					 size_t len, k_timeout_t timeout)
 {
 	struct net_pkt *pkt;
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING) && \
+	defined(CONFIG_NET_CONTEXT_SNDBUF)
+	/* Refuse the allocation up front if this context already holds
+	 * its share of the buffer pools, so one stalled sender cannot
+	 * starve unrelated traffic.
+	 */
+	if (context_buf_over_budget(context, context->options.sndbuf, len)) {
+		return NULL;
+	}
+#endif
+
 #if defined(CONFIG_NET_CONTEXT_NET_PKT_POOL)
 	if (context->tx_slab) {
 		pkt = net_pkt_alloc_from_slab(context->tx_slab(), timeout);
@@ -1908,6 +1962,8 @@ static struct net_pkt *context_alloc_pkt(struct net_context *context,
 			return NULL;
 		}
 
+		context_buf_charge(context, pkt);
+
 		return pkt;
 	}
 #endif
@@ -1917,6 +1973,7 @@ static struct net_pkt *context_alloc_pkt(struct net_context *context,
 					timeout);
 	if (pkt) {
 		net_pkt_set_context(pkt, context);
+		context_buf_charge(context, pkt);
 	}
 
 	return pkt;
@@ -2369,6 +2426,47 @@ unlock:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+int net_context_send_nocopy(struct net_context *context,
+			    const void *buf,
+			    size_t len)
+{
+	int ret;
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+	    !net_sin(&context->remote)->sin_port) {
+		ret = -EDESTADDRREQ;
+		goto unlock;
+	}
+
+	if (net_context_get_proto(context) != IPPROTO_TCP ||
+	    (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	     net_if_is_ip_offloaded(net_context_get_iface(context)))) {
+		ret = -EOPNOTSUPP;
+		goto unlock;
+	}
+
+	ret = net_tcp_queue_nocopy(context, buf, len);
+	if (ret < 0) {
+		goto unlock;
+	}
+
+	len = ret;
+
+	ret = net_tcp_send_data(context, NULL, NULL);
+	if (ret == 0) {
+		ret = len;
+	}
+
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 int net_context_sendmsg(struct net_context *context,
 			const struct msghdr *msghdr,
 			int flags,
@@ -2433,6 +2531,24 @@ enum net_verdict net_context_packet_received(struct net_conn *conn,
 		goto unlock;
 	}
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING) && \
+	defined(CONFIG_NET_CONTEXT_RCVBUF)
+	/* TCP is excluded from the receive budget, its receive window
+	 * already bounds the amount of buffered data.
+	 */
+	if (net_context_get_proto(context) != IPPROTO_TCP) {
+		if (context_buf_over_budget(context, context->options.rcvbuf,
+					    net_pkt_get_len(pkt))) {
+			NET_DBG("Context %p holds too much buffer space, "
+				"dropping pkt %p", context, pkt);
+			net_stats_update_drop_queue_full(net_pkt_iface(pkt));
+			goto unlock;
+		}
+
+		context_buf_charge(context, pkt);
+	}
+#endif
+
 	if (net_context_get_proto(context) == IPPROTO_TCP) {
 		net_stats_update_tcp_recv(net_pkt_iface(pkt),
 					  net_pkt_remaining_data(pkt));
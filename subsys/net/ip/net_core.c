@@ -429,6 +429,96 @@ err:
 	return ret;
 }
 
+#if defined(CONFIG_NET_PKTGEN)
+
+/* UDP discard port, a receiver may be bound to it to act as a sink */
+#define PKTGEN_UDP_PORT 9
+
+#define PKTGEN_ALLOC_TIMEOUT K_MSEC(100)
+
+int net_pktgen_run(struct net_if *iface, uint32_t pkt_count,
+		   uint16_t payload_len, struct net_pktgen_result *result)
+{
+	const struct in_addr *addr;
+	uint32_t alloc_failures = 0U;
+	uint32_t sent = 0U;
+	int64_t elapsed;
+	int64_t start;
+	int ret;
+
+	if (iface == NULL || pkt_count == 0U) {
+		return -EINVAL;
+	}
+
+	addr = net_if_ipv4_get_global_addr(iface, NET_ADDR_PREFERRED);
+	if (addr == NULL) {
+		addr = net_if_ipv4_get_ll(iface, NET_ADDR_PREFERRED);
+	}
+
+	if (addr == NULL) {
+		return -EADDRNOTAVAIL;
+	}
+
+	start = k_uptime_get();
+
+	for (uint32_t i = 0U; i < pkt_count; i++) {
+		struct net_pkt *pkt;
+
+		pkt = net_pkt_alloc_with_buffer(iface, payload_len, AF_INET,
+						IPPROTO_UDP,
+						PKTGEN_ALLOC_TIMEOUT);
+		if (pkt == NULL) {
+			alloc_failures++;
+			net_stats_update_drop_alloc_fail(iface);
+			continue;
+		}
+
+		/* Sending to our own address loops the packet back to the
+		 * RX pipeline in check_ip().
+		 */
+		ret = net_ipv4_create(pkt, addr, addr);
+		if (ret == 0) {
+			ret = net_udp_create(pkt, htons(PKTGEN_UDP_PORT),
+					     htons(PKTGEN_UDP_PORT));
+		}
+
+		if (ret == 0 && payload_len > 0U) {
+			ret = net_pkt_memset(pkt, 0xa5, payload_len);
+		}
+
+		if (ret == 0) {
+			net_pkt_cursor_init(pkt);
+			ret = net_ipv4_finalize(pkt, IPPROTO_UDP);
+		}
+
+		if (ret == 0) {
+			ret = net_send_data(pkt);
+		}
+
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		sent++;
+	}
+
+	elapsed = k_uptime_get() - start;
+
+	if (result != NULL) {
+		result->pkts = sent;
+		result->alloc_failures = alloc_failures;
+		result->time_ms = (uint32_t)elapsed;
+		result->pkts_per_sec = (uint32_t)((uint64_t)sent *
+						  MSEC_PER_SEC /
+						  MAX(elapsed, 1));
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_NET_PKTGEN */
+
 static void net_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	bool is_loopback = false;
@@ -463,16 +553,26 @@ void net_process_rx_packet(struct net_pkt *pkt)
 	net_rx(net_pkt_iface(pkt), pkt);
 }
 
-static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
+static void net_queue_rx_stats(struct net_if *iface, struct net_pkt *pkt,
+			       uint8_t tc)
 {
-	uint8_t prio = net_pkt_priority(pkt);
-	uint8_t tc = net_rx_priority2tc(prio);
-
 #if defined(CONFIG_NET_STATISTICS)
 	net_stats_update_tc_recv_pkt(iface, tc);
 	net_stats_update_tc_recv_bytes(iface, tc, net_pkt_get_len(pkt));
-	net_stats_update_tc_recv_priority(iface, tc, prio);
+	net_stats_update_tc_recv_priority(iface, tc, net_pkt_priority(pkt));
+#else
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(tc);
 #endif
+}
+
+static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint8_t prio = net_pkt_priority(pkt);
+	uint8_t tc = net_rx_priority2tc(prio);
+
+	net_queue_rx_stats(iface, pkt, tc);
 
 #if NET_TC_RX_COUNT > 1
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
@@ -485,26 +585,21 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 	}
 }
 
-/* Called by driver when a packet has been received */
-int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+/* Validate a received packet and attach it to the receiving interface.
+ * Common to the single packet and packet vector receive paths.
+ */
+static int net_rx_prepare(struct net_if *iface, struct net_pkt *pkt)
 {
-	int ret;
-
-	SYS_PORT_TRACING_FUNC_ENTER(net, recv_data, iface, pkt);
-
 	if (!pkt || !iface) {
-		ret = -EINVAL;
-		goto err;
+		return -EINVAL;
 	}
 
 	if (net_pkt_is_empty(pkt)) {
-		ret = -ENODATA;
-		goto err;
+		return -ENODATA;
 	}
 
 	if (!net_if_flag_is_set(iface, NET_IF_UP)) {
-		ret = -ENETDOWN;
-		goto err;
+		return -ENETDOWN;
 	}
 
 	net_pkt_set_overwrite(pkt, true);
@@ -519,6 +614,21 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	net_pkt_set_iface(pkt, iface);
 
+	return 0;
+}
+
+/* Called by driver when a packet has been received */
+int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
+{
+	int ret;
+
+	SYS_PORT_TRACING_FUNC_ENTER(net, recv_data, iface, pkt);
+
+	ret = net_rx_prepare(iface, pkt);
+	if (ret < 0) {
+		goto err;
+	}
+
 	if (!net_pkt_filter_recv_ok(pkt)) {
 		/* silently drop the packet */
 		net_pkt_unref(pkt);
@@ -534,6 +644,62 @@ err:
 	return ret;
 }
 
+int net_recv_data_vec(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	int accepted = 0;
+	size_t i;
+#if NET_TC_RX_COUNT > 0
+	sys_slist_t tc_list[NET_TC_RX_COUNT];
+	int tc;
+
+	for (tc = 0; tc < NET_TC_RX_COUNT; tc++) {
+		sys_slist_init(&tc_list[tc]);
+	}
+#endif
+
+	for (i = 0; i < count; i++) {
+		struct net_pkt *pkt = pkts[i];
+
+		if (net_rx_prepare(iface, pkt) < 0) {
+			if (pkt) {
+				net_pkt_unref(pkt);
+			}
+
+			continue;
+		}
+
+		if (!net_pkt_filter_recv_ok(pkt)) {
+			/* silently drop the packet */
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+#if NET_TC_RX_COUNT > 0
+		tc = net_rx_priority2tc(net_pkt_priority(pkt));
+
+		net_queue_rx_stats(iface, pkt, tc);
+
+		sys_slist_append(&tc_list[tc], (sys_snode_t *)pkt);
+#else
+		net_queue_rx(iface, pkt);
+#endif
+		accepted++;
+	}
+
+#if NET_TC_RX_COUNT > 0
+	/* One queue operation and one handler wakeup per traffic class
+	 * for the whole burst.
+	 */
+	for (tc = 0; tc < NET_TC_RX_COUNT; tc++) {
+		if (!sys_slist_is_empty(&tc_list[tc])) {
+			net_tc_submit_list_to_rx_queue(tc, &tc_list[tc]);
+		}
+	}
+#endif
+
+	return accepted;
+}
+
 static inline void l3_init(void)
 {
 	net_icmpv4_init();
@@ -572,6 +738,14 @@ int net_recv_data(struct net_if *iface, struct net_pkt *pkt)
 
 	return -ENOTSUP;
 }
+int net_recv_data_vec(struct net_if *iface, struct net_pkt **pkts, size_t count)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkts);
+	ARG_UNUSED(count);
+
+	return -ENOTSUP;
+}
 #endif /* CONFIG_NET_NATIVE */
 
 static void init_rx_queues(void)
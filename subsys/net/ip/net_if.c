@@ -335,6 +335,13 @@ void net_process_tx_packet(struct net_pkt *pkt)
 
 	iface = net_pkt_iface(pkt);
 
+#if CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT > 0
+	/* Release the byte budget before net_if_tx() as the packet is
+	 * freed once the driver has sent it.
+	 */
+	atomic_sub(&iface->tx_bytes_queued, net_pkt_get_len(pkt));
+#endif
+
 	net_if_tx(iface, pkt);
 
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
@@ -369,15 +376,55 @@ void net_if_queue_tx(struct net_if *iface, struct net_pkt *pkt)
 		return;
 	}
 
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+	/* If the traffic class queue is idle (nothing queued and nothing
+	 * still in flight in the TC thread), transmit on this context and
+	 * save the context switch. Anything submitted while we are sending
+	 * goes through the queue, so packet order within the traffic class
+	 * is preserved.
+	 */
+	if (net_tc_tx_is_idle(tc)) {
+		net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
+
+		net_if_tx(iface, pkt);
+		return;
+	}
+#endif
+
 #if NET_TC_TX_COUNT > 1
 	NET_DBG("TC %d with prio %d pkt %p", tc, prio, pkt);
 #endif
 
+#if CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT > 0
+	size_t pkt_len = net_pkt_get_len(pkt);
+
+	/* Limit the amount of data sitting in the traffic class queues so
+	 * that a bulk sender cannot build up a deep backlog which every
+	 * later packet has to queue behind. High priority packets are
+	 * never dropped here but still consume budget, pushing back on
+	 * lower priority traffic instead. The check and the add are not
+	 * atomic together; an occasional overshoot by one packet is
+	 * acceptable.
+	 */
+	if (prio < NET_PRIORITY_CA &&
+	    atomic_get(&iface->tx_bytes_queued) + pkt_len >
+	    CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT) {
+		net_stats_update_processing_error(iface);
+		net_pkt_unref(pkt);
+		return;
+	}
+
+	atomic_add(&iface->tx_bytes_queued, pkt_len);
+#endif
+
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
 	iface->tx_pending++;
 #endif
 
 	if (!net_tc_submit_to_tx_queue(tc, pkt)) {
+#if CONFIG_NET_TC_TX_QUEUE_BYTE_LIMIT > 0
+		atomic_sub(&iface->tx_bytes_queued, pkt_len);
+#endif
 #if defined(CONFIG_NET_POWER_MANAGEMENT)
 		iface->tx_pending--
 #endif
@@ -5206,8 +5253,13 @@ void net_if_call_link_cb(struct net_if *iface, struct net_linkaddr *lladdr,
 	k_mutex_unlock(&lock);
 }
 
-static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
-			      enum net_if_checksum_type chksum_type)
+/* Figure out the bitmap of checksum types the driver cannot offload for
+ * the given direction. A set bit means the stack has to compute that
+ * checksum in software. When the answer cannot be cached (the VLAN main
+ * interface is not resolvable yet), cacheable is set to false.
+ */
+static uint32_t chksum_need_mask(struct net_if *iface, enum ethernet_hw_caps caps,
+				 bool *cacheable)
 {
 #if defined(CONFIG_NET_L2_ETHERNET)
 	struct ethernet_config config;
@@ -5220,17 +5272,18 @@ static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
 		if (IS_ENABLED(CONFIG_NET_VLAN) && net_eth_is_vlan_interface(iface)) {
 			iface = net_eth_get_vlan_main(iface);
 			if (iface == NULL) {
-				return true;
+				*cacheable = false;
+				return UINT32_MAX;
 			}
 
 			NET_ASSERT(net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET));
 		} else {
-			return true;
+			return UINT32_MAX;
 		}
 	}
 
 	if (!(net_eth_get_hw_capabilities(iface) & caps)) {
-		return true; /* No checksum offload*/
+		return UINT32_MAX; /* No checksum offload*/
 	}
 
 	if (caps == ETHERNET_HW_RX_CHKSUM_OFFLOAD) {
@@ -5240,17 +5293,58 @@ static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
 	}
 
 	if (net_eth_get_hw_config(iface, config_type, &config) != 0) {
-		return false; /* No extra info, assume all offloaded. */
+		return 0U; /* No extra info, assume all offloaded. */
 	}
 
 	/* bitmaps are encoded such that this works */
-	return !((config.chksum_support & chksum_type) == chksum_type);
+	return ~config.chksum_support;
 #else
 	ARG_UNUSED(iface);
 	ARG_UNUSED(caps);
+	ARG_UNUSED(cacheable);
 
-	return true;
+	return UINT32_MAX;
+#endif
+}
+
+static bool need_calc_checksum(struct net_if *iface, enum ethernet_hw_caps caps,
+			      enum net_if_checksum_type chksum_type)
+{
+	bool cacheable = true;
+	uint32_t need;
+
+#if defined(CONFIG_NET_IF_CHECKSUM_OFFLOAD_CACHE)
+	/* The driver offloading capabilities are static, so the per-packet
+	 * queries can be answered from the cached bitmaps.
+	 */
+	if (caps == ETHERNET_HW_RX_CHKSUM_OFFLOAD) {
+		if (iface->chksum_need_rx_valid) {
+			return (iface->chksum_need_rx & chksum_type) != 0U;
+		}
+	} else {
+		if (iface->chksum_need_tx_valid) {
+			return (iface->chksum_need_tx & chksum_type) != 0U;
+		}
+	}
 #endif
+
+	need = chksum_need_mask(iface, caps, &cacheable);
+
+#if defined(CONFIG_NET_IF_CHECKSUM_OFFLOAD_CACHE)
+	if (cacheable) {
+		if (caps == ETHERNET_HW_RX_CHKSUM_OFFLOAD) {
+			iface->chksum_need_rx = need;
+			iface->chksum_need_rx_valid = 1U;
+		} else {
+			iface->chksum_need_tx = need;
+			iface->chksum_need_tx_valid = 1U;
+		}
+	}
+#else
+	ARG_UNUSED(cacheable);
+#endif
+
+	return (need & chksum_type) != 0U;
 }
 
 bool net_if_need_calc_tx_checksum(struct net_if *iface, enum net_if_checksum_type chksum_type)
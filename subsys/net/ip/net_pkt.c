@@ -604,6 +604,13 @@ done:
 		return;
 	}
 
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+	if (pkt->context != NULL && pkt->accounted_bytes > 0U) {
+		net_context_buf_credit(pkt->context, pkt->accounted_bytes);
+		pkt->accounted_bytes = 0U;
+	}
+#endif
+
 	if (pkt->frags) {
 		net_pkt_frag_unref(pkt->frags);
 	}
@@ -1649,6 +1656,41 @@ struct net_pkt *net_pkt_rx_alloc_with_buffer(struct net_if *iface,
 #endif
 }
 
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+struct net_pkt *net_pkt_rx_alloc_from_frags_debug(struct net_if *iface,
+						  struct net_buf *frags,
+						  k_timeout_t timeout,
+						  const char *caller,
+						  int line)
+#else
+struct net_pkt *net_pkt_rx_alloc_from_frags(struct net_if *iface,
+					    struct net_buf *frags,
+					    k_timeout_t timeout)
+#endif
+{
+	struct net_pkt *pkt;
+
+	if (frags == NULL) {
+		return NULL;
+	}
+
+#if NET_LOG_LEVEL >= LOG_LEVEL_DBG
+	pkt = pkt_alloc_on_iface(&rx_pkts, iface, timeout, caller, line);
+#else
+	pkt = pkt_alloc_on_iface(&rx_pkts, iface, timeout);
+#endif
+	if (pkt == NULL) {
+		return NULL;
+	}
+
+	/* The fragments already hold the received data, adopt them
+	 * as-is instead of allocating a buffer and copying.
+	 */
+	net_pkt_append_buffer(pkt, frags);
+
+	return pkt;
+}
+
 void net_pkt_append_buffer(struct net_pkt *pkt, struct net_buf *buffer)
 {
 	if (!pkt->buffer) {
@@ -169,8 +169,19 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 static inline void net_tc_tx_init(void) { }
 static inline void net_tc_rx_init(void) { }
 #endif
+#if defined(CONFIG_NET_CONTEXT_BUF_ACCOUNTING)
+/* Give back buffer bytes previously charged to the context owning
+ * the packet. Called when the packet is released.
+ */
+void net_context_buf_credit(struct net_context *context, uint32_t bytes);
+#endif
+
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern void net_tc_submit_list_to_rx_queue(uint8_t tc, sys_slist_t *list);
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+extern bool net_tc_tx_is_idle(uint8_t tc);
+#endif
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
 char *net_sprint_addr(sa_family_t af, const void *addr);
@@ -297,6 +297,12 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 		src = GET_STAT_ADDR(iface, tcp);
 		break;
 #endif
+#if defined(CONFIG_NET_STATISTICS_DROP_REASON)
+	case NET_REQUEST_STATS_CMD_GET_DROP_REASON:
+		len_chk = sizeof(struct net_stats_drop);
+		src = GET_STAT_ADDR(iface, drop);
+		break;
+#endif
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
 	case NET_REQUEST_STATS_GET_PM:
 		len_chk = sizeof(struct net_stats_pm);
@@ -356,6 +362,11 @@ NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_TCP,
 				  net_stats_get);
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_DROP_REASON)
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_DROP_REASON,
+				  net_stats_get);
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_PM,
 				  net_stats_get);
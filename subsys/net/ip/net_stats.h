@@ -136,6 +136,35 @@ static inline void net_stats_update_ipv4_recv(struct net_if *iface)
 #define net_stats_update_ipv4_recv(iface)
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
+#if defined(CONFIG_NET_STATISTICS_DROP_REASON) && defined(CONFIG_NET_NATIVE)
+/* Packet drop stats by drop reason */
+
+static inline void net_stats_update_drop_alloc_fail(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.drop.alloc_fail++);
+}
+
+static inline void net_stats_update_drop_queue_full(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.drop.queue_full++);
+}
+
+static inline void net_stats_update_drop_chkerr(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.drop.chkerr++);
+}
+
+static inline void net_stats_update_drop_no_conn(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.drop.no_conn++);
+}
+#else
+#define net_stats_update_drop_alloc_fail(iface)
+#define net_stats_update_drop_queue_full(iface)
+#define net_stats_update_drop_chkerr(iface)
+#define net_stats_update_drop_no_conn(iface)
+#endif /* CONFIG_NET_STATISTICS_DROP_REASON */
+
 #if defined(CONFIG_NET_STATISTICS_ICMP) && defined(CONFIG_NET_NATIVE_IPV4)
 /* Common ICMPv4/ICMPv6 stats */
 static inline void net_stats_update_icmp_sent(struct net_if *iface)
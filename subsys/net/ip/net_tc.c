@@ -52,6 +52,10 @@ bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 #if NET_TC_TX_COUNT > 0
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+	atomic_inc(&tx_classes[tc].pkts_pending);
+#endif
+
 	submit_to_queue(&tx_classes[tc].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
@@ -72,6 +76,34 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+void net_tc_submit_list_to_rx_queue(uint8_t tc, sys_slist_t *list)
+{
+#if NET_TC_RX_COUNT > 0
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(list, node) {
+		/* The fifo word is the first member of net_pkt so the
+		 * list nodes are the packets themselves.
+		 */
+		net_pkt_set_rx_stats_tick((struct net_pkt *)node,
+					  k_cycle_get_32());
+	}
+
+	/* Appends the whole burst atomically and wakes the handler once */
+	k_fifo_put_slist(&rx_classes[tc].fifo, list);
+#else
+	ARG_UNUSED(tc);
+	ARG_UNUSED(list);
+#endif
+}
+
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+bool net_tc_tx_is_idle(uint8_t tc)
+{
+	return atomic_get(&tx_classes[tc].pkts_pending) == 0;
+}
+#endif
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -275,6 +307,15 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 		}
 
 		net_process_tx_packet(pkt);
+
+#if defined(CONFIG_NET_TC_TX_DIRECT)
+		/* Decrement only after the send has finished so that the
+		 * direct transmit path cannot overtake a packet that is
+		 * still in flight here.
+		 */
+		atomic_dec(&CONTAINER_OF(fifo, struct net_traffic_class,
+					 fifo)->pkts_pending);
+#endif
 	}
 }
 #endif
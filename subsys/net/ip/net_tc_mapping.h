@@ -145,6 +145,34 @@ static const uint8_t *tx_prio2tc_map = PRIORITY2TC_GEN(sr_b, NET_TC_TX_COUNT);
 static const uint8_t *rx_prio2tc_map = PRIORITY2TC_GEN(sr_b, NET_TC_RX_COUNT);
 #endif
 
+#elif defined(CONFIG_NET_TC_MAPPING_WIFI_WMM) && (NET_TC_COUNT > 0)
+
+/* This is the priority to access category mapping used by Wi-Fi Multimedia
+ * (WMM). Note that unlike 802.1Q, the default priority 0 maps above the
+ * background priorities 1 and 2.
+ * Ref: 802.11 - chapter 10.2.4.2 - table 10-1
+ */
+
+#if NET_TC_TX_COUNT == 1 || NET_TC_RX_COUNT == 1
+static const uint8_t priority2tc_wmm_1[] = {0, 0, 0, 0, 0, 0, 0, 0};
+#endif
+#if NET_TC_TX_COUNT == 2 || NET_TC_RX_COUNT == 2
+static const uint8_t priority2tc_wmm_2[] = {0, 0, 0, 0, 1, 1, 1, 1};
+#endif
+#if NET_TC_TX_COUNT == 3 || NET_TC_RX_COUNT == 3
+static const uint8_t priority2tc_wmm_3[] = {0, 0, 0, 0, 1, 1, 2, 2};
+#endif
+#if NET_TC_TX_COUNT == 4 || NET_TC_RX_COUNT == 4
+static const uint8_t priority2tc_wmm_4[] = {1, 0, 0, 1, 2, 2, 3, 3};
+#endif
+
+#if NET_TC_TX_COUNT > 0
+static const uint8_t *tx_prio2tc_map = PRIORITY2TC_GEN(wmm, NET_TC_TX_COUNT);
+#endif
+#if NET_TC_RX_COUNT > 0
+static const uint8_t *rx_prio2tc_map = PRIORITY2TC_GEN(wmm, NET_TC_RX_COUNT);
+#endif
+
 #endif
 
 #endif /* __TC_MAPPING_H */
@@ -40,6 +40,27 @@ static sys_slist_t active_route_lifetime_timers;
 /* Timer that manages expired route entries. */
 static struct k_work_delayable route_lifetime_timer;
 
+#if defined(CONFIG_NET_ROUTE_CACHE)
+/* Remember the last route lookup result. Forwarded traffic typically
+ * comes in bursts towards the same destination, so the cache avoids
+ * rescanning the whole route table for every packet. The cache is
+ * protected by the IPv6 neighbor lock like the route table itself and
+ * is flushed whenever the table changes.
+ */
+static struct {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+} route_cache;
+
+static void route_cache_flush(void)
+{
+	route_cache.route = NULL;
+}
+#else
+#define route_cache_flush()
+#endif /* CONFIG_NET_ROUTE_CACHE */
+
 static void net_route_nexthop_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Nexthop %p removed", nbr);
@@ -276,6 +297,18 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 
 	net_ipv6_nbr_lock();
 
+#if defined(CONFIG_NET_ROUTE_CACHE)
+	if (route_cache.route && route_cache.iface == iface &&
+	    net_ipv6_addr_cmp(&route_cache.dst, dst)) {
+		found = route_cache.route;
+
+		net_route_info("Cached", found, dst);
+
+		net_ipv6_nbr_unlock();
+		return found;
+	}
+#endif
+
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -302,6 +335,12 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		net_route_info("Found", found, dst);
 
 		update_route_access(found);
+
+#if defined(CONFIG_NET_ROUTE_CACHE)
+		net_ipaddr_copy(&route_cache.dst, dst);
+		route_cache.iface = iface;
+		route_cache.route = found;
+#endif
 	}
 
 	net_ipv6_nbr_unlock();
@@ -455,6 +494,9 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	sys_slist_init(&route->nexthop);
 	sys_slist_prepend(&route->nexthop, &nexthop_route->node);
 
+	/* The new route could be a better match for a cached destination */
+	route_cache_flush();
+
 	net_route_info("Added", route, addr);
 
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -588,6 +630,8 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+	route_cache_flush();
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		net_ipv6_nbr_unlock();
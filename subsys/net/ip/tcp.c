@@ -31,7 +31,11 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #define LAST_ACK_TIMEOUT_MS tcp_max_timeout_ms
 #define LAST_ACK_TIMEOUT K_MSEC(LAST_ACK_TIMEOUT_MS)
 #define FIN_TIMEOUT K_MSEC(tcp_max_timeout_ms)
+#if defined(CONFIG_NET_TCP_DELAYED_ACK)
+#define ACK_DELAY K_MSEC(CONFIG_NET_TCP_DELAYED_ACK_TIMEOUT)
+#else
 #define ACK_DELAY K_MSEC(100)
+#endif
 #define ZWP_MAX_DELAY_MS 120000
 #define DUPLICATE_ACK_RETRANSMIT_TRHESHOLD 3
 
@@ -769,6 +773,14 @@ static void tcp_conn_release(struct k_work *work)
 		tcp_pkt_unref(pkt);
 	}
 
+#if defined(CONFIG_NET_TCP_RX_COALESCING)
+	/* Drop any segments still waiting for the connection lock */
+	(void)k_work_cancel(&conn->rx_seg_work);
+	while ((pkt = k_fifo_get(&conn->rx_seg_queue, K_NO_WAIT)) != NULL) {
+		tcp_pkt_unref(pkt);
+	}
+#endif
+
 	k_mutex_lock(&conn->lock, K_FOREVER);
 
 	if (conn->context->conn_handler) {
@@ -802,6 +814,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->fin_timer);
 	(void)k_work_cancel_delayable(&conn->persist_timer);
 	(void)k_work_cancel_delayable(&conn->ack_timer);
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+	(void)k_work_cancel_delayable(&conn->nagle_flush_timer);
+#endif
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
 	keep_alive_timer_stop(conn);
@@ -1594,6 +1609,9 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 
 	if (flags & ACK) {
 		conn->recv_win_sent = conn->recv_win;
+#if defined(CONFIG_NET_TCP_DELAYED_ACK)
+		conn->rcv_unacked_len = 0;
+#endif
 	}
 
 	if (is_destination_local(pkt)) {
@@ -1792,6 +1810,38 @@ static int tcp_send_data(struct tcp *conn)
 
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
+/* Implement Nagle's algorithm: hold back a sub-MSS chunk while earlier data
+ * is still unacknowledged. With a non-zero flush time the chunk is held only
+ * until the flush timer expires instead of waiting for the peer ACK.
+ */
+static bool tcp_nagle_holds(struct tcp *conn)
+{
+	if (conn->tcp_nodelay || conn->unacked_len == 0) {
+		return false;
+	}
+
+	if (tcp_unsent_len(conn) >= conn_mss(conn)) {
+		return false;
+	}
+
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+	if (conn->nagle_flush) {
+		/* The flush timer expired, send the remainder as a short
+		 * segment instead of keeping it queued.
+		 */
+		return false;
+	}
+
+	if (!k_work_delayable_is_pending(&conn->nagle_flush_timer)) {
+		k_work_reschedule_for_queue(&tcp_work_q,
+					    &conn->nagle_flush_timer,
+					    K_MSEC(CONFIG_NET_TCP_NAGLE_FLUSH_TIME));
+	}
+#endif
+
+	return true;
+}
+
 static int tcp_send_queued_data(struct tcp *conn)
 {
 	int ret = 0;
@@ -1802,17 +1852,13 @@ static int tcp_send_queued_data(struct tcp *conn)
 	}
 
 	while (tcp_unsent_len(conn) > 0) {
-		/* Implement Nagle's algorithm */
-		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
-			/* If there is already pending data */
-			if (tcp_unsent_len(conn) < conn_mss(conn)) {
-				/* The number of bytes to be transmitted is less than an MSS,
-				 * skip transmission for now.
-				 * Wait for more data to be transmitted or all pending data
-				 * being acknowledged.
-				 */
-				break;
-			}
+		if (tcp_nagle_holds(conn)) {
+			/* The number of bytes to be transmitted is less than an MSS,
+			 * skip transmission for now.
+			 * Wait for more data to be transmitted or all pending data
+			 * being acknowledged.
+			 */
+			break;
 		}
 
 		ret = tcp_send_data(conn);
@@ -1838,6 +1884,32 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+static void tcp_nagle_flush_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, nagle_flush_timer);
+	int ret;
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->state == TCP_ESTABLISHED && tcp_unsent_len(conn) > 0) {
+		NET_DBG("conn: %p flush %d queued bytes", conn,
+			tcp_unsent_len(conn));
+
+		conn->nagle_flush = true;
+		ret = tcp_send_queued_data(conn);
+		conn->nagle_flush = false;
+
+		if (ret < 0 && ret != -ENOBUFS) {
+			tcp_conn_close(conn, ret);
+		}
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif /* CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0 */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1886,6 +1958,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
+	conn->total_retrans++;
 	if (ret == 0) {
 		if (conn->in_close && conn->send_data_total == 0) {
 			NET_DBG("TCP connection in %s close, "
@@ -2081,6 +2154,51 @@ static void tcp_send_ack(struct k_work *work)
 	k_mutex_unlock(&conn->lock);
 }
 
+#if defined(CONFIG_NET_TCP_RX_COALESCING)
+static void tcp_rx_seg_drain(struct tcp *conn)
+{
+	struct net_pkt *pkt;
+
+	while ((pkt = k_fifo_get(&conn->rx_seg_queue, K_NO_WAIT)) != NULL) {
+		if (tcp_in(conn, pkt) != NET_OK) {
+			tcp_pkt_unref(pkt);
+		}
+	}
+}
+
+static void tcp_rx_seg_process(struct k_work *work)
+{
+	struct tcp *conn = CONTAINER_OF(work, struct tcp, rx_seg_work);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	tcp_rx_seg_drain(conn);
+
+	k_mutex_unlock(&conn->lock);
+}
+
+static enum net_verdict tcp_in_coalesced(struct tcp *conn, struct net_pkt *pkt)
+{
+	k_fifo_put(&conn->rx_seg_queue, pkt);
+
+	/* Do not block the RX thread when the connection is busy in
+	 * another thread: segments queued meanwhile are drained in a
+	 * single lock acquisition, by whichever comes first of the next
+	 * incoming segment and the work item.
+	 */
+	if (k_mutex_lock(&conn->lock, K_NO_WAIT) != 0) {
+		k_work_submit_to_queue(&tcp_work_q, &conn->rx_seg_work);
+		return NET_OK;
+	}
+
+	tcp_rx_seg_drain(conn);
+
+	k_mutex_unlock(&conn->lock);
+
+	return NET_OK;
+}
+#endif /* CONFIG_NET_TCP_RX_COALESCING */
+
 static void tcp_conn_ref(struct tcp *conn)
 {
 	int ref_count = atomic_inc(&conn->ref_count) + 1;
@@ -2118,6 +2236,10 @@ static struct tcp *tcp_conn_alloc(void)
 
 	k_mutex_init(&conn->lock);
 	k_fifo_init(&conn->recv_data);
+#if defined(CONFIG_NET_TCP_RX_COALESCING)
+	k_fifo_init(&conn->rx_seg_queue);
+	k_work_init(&conn->rx_seg_work, tcp_rx_seg_process);
+#endif
 	k_sem_init(&conn->connect_sem, 0, K_SEM_MAX_LIMIT);
 	k_sem_init(&conn->tx_sem, 1, 1);
 
@@ -2130,6 +2252,7 @@ static struct tcp *tcp_conn_alloc(void)
 	conn->send_win = conn->send_win_max;
 	conn->tcp_nodelay = false;
 	conn->addr_ref_done = false;
+	conn->total_retrans = 0U;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
@@ -2154,6 +2277,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+	k_work_init_delayable(&conn->nagle_flush_timer, tcp_nagle_flush_timeout);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2268,7 +2394,11 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	}
 in:
 	if (conn) {
+#if defined(CONFIG_NET_TCP_RX_COALESCING)
+		verdict = tcp_in_coalesced(conn, pkt);
+#else
 		verdict = tcp_in(conn, pkt);
+#endif
 	} else {
 		net_tcp_reply_rst(pkt);
 	}
@@ -2722,6 +2852,26 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 	net_stats_update_tcp_seg_recv(conn->iface);
 	conn_ack(conn, *len);
 
+#if defined(CONFIG_NET_TCP_DELAYED_ACK)
+	/* Delayed acknowledgment: a segment no longer produces an ack of
+	 * its own.  Ack immediately once enough new data has accumulated
+	 * since the last ack went out, otherwise arm the ack timer,
+	 * keeping the deadline set by the oldest unacknowledged segment.
+	 * Acks advertising a small window are delayed as well, as
+	 * described in RFC 813.
+	 */
+	ARG_UNUSED(psh);
+
+	conn->rcv_unacked_len += *len;
+	if ((conn->rcv_unacked_len >= CONFIG_NET_TCP_DELAYED_ACK_THRESHOLD) &&
+	    !tcp_short_window(conn)) {
+		k_work_cancel_delayable(&conn->ack_timer);
+		tcp_out(conn, ACK);
+	} else {
+		k_work_schedule_for_queue(&tcp_work_q, &conn->ack_timer,
+					  ACK_DELAY);
+	}
+#else
 	/* Delay ACK response in case of small window or missing PSH,
 	 * as described in RFC 813.
 	 */
@@ -2732,6 +2882,7 @@ static enum net_verdict tcp_data_received(struct tcp *conn, struct net_pkt *pkt,
 		k_work_cancel_delayable(&conn->ack_timer);
 		tcp_out(conn, ACK);
 	}
+#endif /* CONFIG_NET_TCP_DELAYED_ACK */
 
 	return ret;
 }
@@ -3800,6 +3951,72 @@ out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+/* Pool of data-less buffers used to reference caller owned data in the
+ * send queue. The referenced data is not copied anywhere, so it must stay
+ * valid and unmodified until the peer has acknowledged it.
+ */
+NET_BUF_POOL_FIXED_DEFINE(tcp_nocopy_pool, CONFIG_NET_TCP_NOCOPY_SEND_COUNT,
+			  0, 0, NULL);
+
+int net_tcp_queue_nocopy(struct net_context *context, const void *data,
+			 size_t len)
+{
+	struct tcp *conn = context->tcp;
+	struct net_buf *buf;
+	int ret = 0;
+
+	if (!conn || conn->state != TCP_ESTABLISHED) {
+		return -ENOTCONN;
+	}
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	/* If there is no space to transmit, try at a later time.
+	 * The ZWP will make sure the window becomes available at
+	 * some point in time.
+	 */
+	if (tcp_window_full(conn)) {
+		ret = -EAGAIN;
+		goto out;
+	}
+
+	/* Queue no more than TX window permits, see net_tcp_queue() */
+	len = MIN(conn->send_win - conn->send_data_total, len);
+
+	buf = net_buf_alloc_with_data(&tcp_nocopy_pool, (void *)data, len,
+				      TCP_PKT_ALLOC_TIMEOUT);
+	if (buf == NULL) {
+		ret = -ENOBUFS;
+		goto out;
+	}
+
+	net_pkt_append_buffer(conn->send_data, buf);
+
+	conn->send_data_total += len;
+
+	/* Successfully queued data for transmission. Even if there's a transmit
+	 * failure now (out-of-buf case), it can be ignored for now, retransmit
+	 * timer will take care of queued data retransmission.
+	 */
+	ret = tcp_send_queued_data(conn);
+	if (ret < 0 && ret != -ENOBUFS) {
+		tcp_conn_close(conn, ret);
+		goto out;
+	}
+
+	if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	ret = len;
+out:
+	k_mutex_unlock(&conn->lock);
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 /* net context is about to send out queued data - inform caller only */
 int net_tcp_send_data(struct net_context *context, net_context_send_cb_t cb,
 		      void *user_data)
@@ -4121,6 +4338,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 
 drop:
 	net_stats_update_tcp_seg_chkerr(net_pkt_iface(pkt));
+	net_stats_update_drop_chkerr(net_pkt_iface(pkt));
 	return NULL;
 }
 
@@ -4392,6 +4610,37 @@ void net_tcp_foreach(net_tcp_cb_t cb, void *user_data)
 	k_mutex_unlock(&tcp_lock);
 }
 
+int net_tcp_conn_info(struct tcp *conn, struct net_tcp_conn_info *info)
+{
+	if (conn == NULL || info == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	info->state = conn->state;
+	info->send_queue_len = conn->send_data_total;
+	info->unacked_len = conn->unacked_len;
+	info->rto = TCP_RTO_MS;
+	info->total_retrans = conn->total_retrans;
+	info->send_win = conn->send_win;
+	info->send_win_max = conn->send_win_max;
+	info->recv_win = conn->recv_win;
+	info->recv_win_max = conn->recv_win_max;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	info->cwnd = conn->ca.cwnd;
+	info->ssthresh = conn->ca.ssthresh;
+#else
+	info->cwnd = 0U;
+	info->ssthresh = 0U;
+#endif
+	info->in_retransmission = conn->in_retransmission;
+
+	k_mutex_unlock(&conn->lock);
+
+	return 0;
+}
+
 uint16_t net_tcp_get_supported_mss(const struct tcp *conn)
 {
 	sa_family_t family = net_context_get_family(conn->context);
@@ -92,6 +92,57 @@ static inline void net_tcp_foreach(net_tcp_cb_t cb, void *user_data)
 }
 #endif
 
+/**
+ * @brief Snapshot of the state of a TCP connection for diagnostics.
+ */
+struct net_tcp_conn_info {
+	/** Connection state */
+	enum tcp_state state;
+	/** Bytes queued for transmission */
+	size_t send_queue_len;
+	/** Bytes transmitted but not yet acknowledged */
+	int unacked_len;
+	/** Current retransmission timeout in milliseconds */
+	uint32_t rto;
+	/** Number of retransmissions over the connection lifetime */
+	uint32_t total_retrans;
+	/** Peer receive window */
+	uint16_t send_win;
+	/** Largest peer receive window seen */
+	uint16_t send_win_max;
+	/** Our receive window */
+	uint16_t recv_win;
+	/** Maximum receive window */
+	uint16_t recv_win_max;
+	/** Congestion window, 0 if congestion avoidance is disabled */
+	uint16_t cwnd;
+	/** Slow start threshold, 0 if congestion avoidance is disabled */
+	uint16_t ssthresh;
+	/** Is the connection currently retransmitting */
+	bool in_retransmission;
+};
+
+/**
+ * @brief Get a consistent snapshot of the connection state.
+ *
+ * @param conn TCP connection
+ * @param info Snapshot to fill
+ *
+ * @return 0 if successful, < 0 on error
+ */
+#if defined(CONFIG_NET_NATIVE_TCP)
+int net_tcp_conn_info(struct tcp *conn, struct net_tcp_conn_info *info);
+#else
+static inline int net_tcp_conn_info(struct tcp *conn,
+				    struct net_tcp_conn_info *info)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(info);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Initialize TCP parts of a context
  *
@@ -312,6 +363,32 @@ static inline int net_tcp_queue(struct net_context *context, const void *data,
 }
 #endif
 
+/**
+ * @brief Queue data for transmission by reference, without copying it
+ *        into network buffers. The data must stay valid and unmodified
+ *        until the peer has acknowledged it.
+ *
+ * @param context Network context
+ * @param data Pointer to the data to be queued
+ * @param len Number of bytes to be queued
+ *
+ * @return number of bytes queued if ok, < 0 if error
+ */
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+int net_tcp_queue_nocopy(struct net_context *context, const void *data,
+			 size_t len);
+#else
+static inline int net_tcp_queue_nocopy(struct net_context *context,
+				       const void *data, size_t len)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(data);
+	ARG_UNUSED(len);
+
+	return -EPROTONOSUPPORT;
+}
+#endif
+
 /**
  * @brief Update TCP receive window
  *
@@ -274,6 +274,10 @@ struct tcp { /* TCP connection */
 	struct k_sem connect_sem; /* semaphore for blocking connect */
 	struct k_sem tx_sem; /* Semaphore indicating if transfers are blocked . */
 	struct k_fifo recv_data;  /* temp queue before passing data to app */
+#if defined(CONFIG_NET_TCP_RX_COALESCING)
+	struct k_fifo rx_seg_queue; /* segments waiting for conn->lock */
+	struct k_work rx_seg_work;
+#endif
 	struct tcp_options recv_options;
 	struct tcp_options send_options;
 	struct k_work_delayable send_timer;
@@ -282,6 +286,9 @@ struct tcp { /* TCP connection */
 	struct k_work_delayable timewait_timer;
 	struct k_work_delayable persist_timer;
 	struct k_work_delayable ack_timer;
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+	struct k_work_delayable nagle_flush_timer;
+#endif
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
@@ -303,11 +310,15 @@ struct tcp { /* TCP connection */
 	size_t send_data_total;
 	size_t send_retries;
 	int unacked_len;
+#if defined(CONFIG_NET_TCP_DELAYED_ACK)
+	int rcv_unacked_len; /* bytes received since the last ack we sent */
+#endif
 	atomic_t ref_count;
 	enum tcp_state state;
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
 	uint32_t ack;
+	uint32_t total_retrans;
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	uint32_t keep_idle;
 	uint32_t keep_intvl;
@@ -337,6 +348,9 @@ struct tcp { /* TCP connection */
 	bool keep_alive : 1;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
 	bool tcp_nodelay : 1;
+#if CONFIG_NET_TCP_NAGLE_FLUSH_TIME > 0
+	bool nagle_flush : 1;
+#endif
 	bool addr_ref_done : 1;
 };
 
@@ -188,5 +188,6 @@ out:
 	return udp_hdr;
 drop:
 	net_stats_update_udp_chkerr(net_pkt_iface(pkt));
+	net_stats_update_drop_chkerr(net_pkt_iface(pkt));
 	return NULL;
 }
@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_coap, CONFIG_COAP_LOG_LEVEL);
 
 #include <zephyr/types.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_function.h>
 #include <zephyr/sys/math_extras.h>
 
 #include <zephyr/net/net_ip.h>
@@ -1911,6 +1912,30 @@ bool coap_request_is_observe(const struct coap_packet *request)
 	return coap_get_option_int(request, COAP_OPTION_OBSERVE) == 0;
 }
 
+/* Identity hash of an observer, covering the end point and the token.
+ * Hash the address family specific fields only, the rest of the
+ * sockaddr is padding with undefined content.
+ */
+static uint32_t coap_observer_hash(const struct sockaddr *addr,
+				   const uint8_t *token, uint8_t tkl)
+{
+	uint32_t hash = 0;
+
+	if (addr->sa_family == AF_INET) {
+		const struct sockaddr_in *a4 = net_sin(addr);
+
+		hash = sys_hash32(&a4->sin_port, sizeof(a4->sin_port));
+		hash ^= sys_hash32(&a4->sin_addr, sizeof(a4->sin_addr));
+	} else if (addr->sa_family == AF_INET6) {
+		const struct sockaddr_in6 *a6 = net_sin6(addr);
+
+		hash = sys_hash32(&a6->sin6_port, sizeof(a6->sin6_port));
+		hash ^= sys_hash32(&a6->sin6_addr, sizeof(a6->sin6_addr));
+	}
+
+	return hash ^ sys_hash32(token, tkl);
+}
+
 void coap_observer_init(struct coap_observer *observer,
 			const struct coap_packet *request,
 			const struct sockaddr *addr)
@@ -1918,6 +1943,9 @@ void coap_observer_init(struct coap_observer *observer,
 	observer->tkl = coap_header_get_token(request, observer->token);
 
 	net_ipaddr_copy(&observer->addr, addr);
+
+	observer->hash = coap_observer_hash(&observer->addr, observer->token,
+					    observer->tkl);
 }
 
 static inline void coap_observer_raise_event(struct coap_resource *resource,
@@ -2009,14 +2037,23 @@ struct coap_observer *coap_find_observer(
 	const struct sockaddr *addr,
 	const uint8_t *token, uint8_t token_len)
 {
+	uint32_t hash;
+
 	if (token_len == 0U || token_len > COAP_TOKEN_MAX_LEN) {
 		return NULL;
 	}
 
+	/* Reject mismatching entries on the precomputed identity hash
+	 * so the full address and token comparison only runs for the
+	 * matching observer (or the rare collision).
+	 */
+	hash = coap_observer_hash(addr, token, token_len);
+
 	for (size_t i = 0; i < len; i++) {
 		struct coap_observer *o = &observers[i];
 
-		if (o->tkl == token_len &&
+		if (o->hash == hash &&
+		    o->tkl == token_len &&
 		    memcmp(o->token, token, token_len) == 0 &&
 		    sockaddr_equal(&o->addr, addr)) {
 			return o;
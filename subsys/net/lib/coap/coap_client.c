@@ -20,6 +20,10 @@ LOG_MODULE_DECLARE(net_coap, CONFIG_COAP_LOG_LEVEL);
 #define BLOCK1_OPTION_SIZE 4
 #define PAYLOAD_MARKER_SIZE 1
 
+#if defined(CONFIG_COAP_CLIENT_BLOCK_PIPELINE) && (CONFIG_COAP_CLIENT_BLOCK_PIPELINE > 1)
+#define COAP_CLIENT_BLK_PIPELINE
+#endif
+
 static K_MUTEX_DEFINE(coap_client_mutex);
 static struct coap_client *clients[CONFIG_COAP_CLIENT_MAX_INSTANCES];
 static int num_clients;
@@ -82,6 +86,14 @@ static void release_internal_request(struct coap_client_internal_request *reques
 {
 	request->request_ongoing = false;
 	request->pending.timeout = 0;
+
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+	for (int i = 0; i < ARRAY_SIZE(request->blk_slots); i++) {
+		request->blk_slots[i].pending.timeout = 0;
+		request->blk_slots[i].busy = false;
+	}
+	request->blk_pipeline_on = false;
+#endif
 }
 
 static int coap_client_schedule_poll(struct coap_client *client, int sock,
@@ -460,14 +472,194 @@ static void report_callback_error(struct coap_client_internal_request *internal_
 
 static bool timeout_expired(struct coap_client_internal_request *internal_req)
 {
-	if (internal_req->pending.timeout == 0) {
+	if (!internal_req->request_ongoing) {
 		return false;
 	}
 
-	return (internal_req->request_ongoing &&
-		internal_req->pending.timeout <= (k_uptime_get() - internal_req->pending.t0));
+	if (internal_req->pending.timeout != 0 &&
+	    internal_req->pending.timeout <= (k_uptime_get() - internal_req->pending.t0)) {
+		return true;
+	}
+
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+	for (int i = 0; i < ARRAY_SIZE(internal_req->blk_slots); i++) {
+		struct coap_client_blk_slot *slot = &internal_req->blk_slots[i];
+
+		if (slot->busy && slot->pending.timeout != 0 &&
+		    slot->pending.timeout <= (k_uptime_get() - slot->pending.t0)) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
 }
 
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+static struct coap_client_blk_slot *blk_slot_find(
+	struct coap_client_internal_request *internal_req, uint32_t block_num)
+{
+	for (int i = 0; i < ARRAY_SIZE(internal_req->blk_slots); i++) {
+		if (internal_req->blk_slots[i].busy &&
+		    internal_req->blk_slots[i].block_num == block_num) {
+			return &internal_req->blk_slots[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Mark a block of a pipelined receive as received and slide the window
+ * over the contiguously received prefix. Returns -EALREADY for blocks
+ * outside the window or already seen, i.e. stale retransmissions.
+ */
+static int blk_pipeline_mark(struct coap_client_internal_request *internal_req,
+			     uint32_t block_num, bool final)
+{
+	uint32_t bit;
+
+	if (block_num < internal_req->blk_window_base ||
+	    block_num >= internal_req->blk_window_base +
+			 CONFIG_COAP_CLIENT_BLOCK_PIPELINE) {
+		return -EALREADY;
+	}
+
+	bit = block_num - internal_req->blk_window_base;
+	if (internal_req->blk_recv_mask & BIT(bit)) {
+		return -EALREADY;
+	}
+
+	internal_req->blk_recv_mask |= BIT(bit);
+
+	if (final) {
+		internal_req->blk_total = block_num + 1;
+	}
+
+	while (internal_req->blk_recv_mask & BIT(0)) {
+		internal_req->blk_recv_mask >>= 1;
+		internal_req->blk_window_base++;
+	}
+
+	return 0;
+}
+
+/* (Re)build and send the block2 request of one pipeline slot. The
+ * request is reconstructed in the shared send buffer with the slot's
+ * message ID and block number; the token stays that of the original
+ * request so responses keep matching it.
+ */
+static int blk_slot_send(struct coap_client *client,
+			 struct coap_client_internal_request *internal_req,
+			 struct coap_client_blk_slot *slot, bool resend)
+{
+	struct coap_block_context blk_ctx = internal_req->recv_blk_ctx;
+	int ret;
+
+	if (!resend) {
+		slot->mid = coap_next_id();
+	}
+
+	internal_req->last_id = slot->mid;
+	internal_req->recv_blk_ctx.current =
+		slot->block_num * coap_block_size_to_bytes(blk_ctx.block_size);
+
+	ret = coap_client_init_request(client, &internal_req->coap_request,
+				       internal_req, true);
+	internal_req->recv_blk_ctx = blk_ctx;
+	if (ret < 0) {
+		LOG_ERR("Error creating a CoAP request");
+		return ret;
+	}
+
+	if (!resend) {
+		struct coap_transmission_parameters params =
+			internal_req->pending.params;
+
+		ret = coap_pending_init(&slot->pending, &internal_req->request,
+					&client->address, &params);
+		if (ret < 0) {
+			LOG_ERR("Error creating pending");
+			return ret;
+		}
+		coap_pending_cycle(&slot->pending);
+	}
+
+	return send_request(client->fd, internal_req->request.data,
+			    internal_req->request.offset, 0, &client->address,
+			    client->socklen);
+}
+
+/* Keep the block request pipe full: request every not yet requested
+ * block which fits in the window, as long as there are free slots.
+ */
+static int blk_pipeline_fill(struct coap_client *client,
+			     struct coap_client_internal_request *internal_req)
+{
+	int ret;
+
+	while ((internal_req->blk_total == 0 ||
+		internal_req->blk_next_num < internal_req->blk_total) &&
+	       internal_req->blk_next_num < internal_req->blk_window_base +
+					    CONFIG_COAP_CLIENT_BLOCK_PIPELINE) {
+		struct coap_client_blk_slot *slot = NULL;
+
+		for (int i = 0; i < ARRAY_SIZE(internal_req->blk_slots); i++) {
+			if (!internal_req->blk_slots[i].busy) {
+				slot = &internal_req->blk_slots[i];
+				break;
+			}
+		}
+
+		if (slot == NULL) {
+			break;
+		}
+
+		slot->block_num = internal_req->blk_next_num;
+
+		ret = blk_slot_send(client, internal_req, slot, false);
+		if (ret < 0) {
+			coap_pending_clear(&slot->pending);
+			return ret;
+		}
+
+		slot->busy = true;
+		internal_req->blk_next_num++;
+	}
+
+	return 0;
+}
+
+static int blk_pipeline_resend(struct coap_client *client,
+			       struct coap_client_internal_request *internal_req)
+{
+	int ret;
+
+	for (int i = 0; i < ARRAY_SIZE(internal_req->blk_slots); i++) {
+		struct coap_client_blk_slot *slot = &internal_req->blk_slots[i];
+
+		if (!slot->busy || slot->pending.timeout == 0 ||
+		    slot->pending.timeout > (k_uptime_get() - slot->pending.t0)) {
+			continue;
+		}
+
+		if (!coap_pending_cycle(&slot->pending)) {
+			LOG_ERR("Timeout, no more retries left");
+			return -ETIMEDOUT;
+		}
+
+		LOG_ERR("Timeout, retrying send");
+
+		ret = blk_slot_send(client, internal_req, slot, true);
+		if (ret < 0 && ret != -EAGAIN) {
+			LOG_ERR("Failed to resend request, %d", ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* COAP_CLIENT_BLK_PIPELINE */
+
 static int resend_request(struct coap_client *client,
 			  struct coap_client_internal_request *internal_req)
 {
@@ -476,6 +668,17 @@ static int resend_request(struct coap_client *client,
 	/* Copy the pending structure if we need to restore it */
 	struct coap_pending tmp = internal_req->pending;
 
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+	/* During a pipelined block-wise receive the retransmissions are
+	 * driven by the per-slot pendings, the main pending is idle.
+	 */
+	if (internal_req->request_ongoing &&
+	    internal_req->pending.timeout == 0 &&
+	    internal_req->blk_pipeline_on) {
+		return blk_pipeline_resend(client, internal_req);
+	}
+#endif
+
 	if (internal_req->request_ongoing &&
 	    internal_req->pending.timeout != 0 &&
 	    coap_pending_cycle(&internal_req->pending)) {
@@ -896,13 +1099,75 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 						 coap_client_default_block_size(),
 						 0);
 			internal_req->offset = 0;
+
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+			internal_req->blk_pipeline_on =
+				(block_option > 0 && !response_truncated &&
+				 internal_req->send_blk_ctx.total_size == 0);
+			internal_req->blk_window_base = 0;
+			internal_req->blk_recv_mask = 0;
+			internal_req->blk_next_num = 1;
+			internal_req->blk_total = 0;
+
+			/* Drop slots of a previous transfer, e.g. an earlier
+			 * observe notification received block-wise.
+			 */
+			for (int i = 0; i < ARRAY_SIZE(internal_req->blk_slots); i++) {
+				internal_req->blk_slots[i].pending.timeout = 0;
+				internal_req->blk_slots[i].busy = false;
+			}
+#endif
 		}
 
-		ret = coap_update_from_block(response, &internal_req->recv_blk_ctx);
-		if (ret < 0) {
-			LOG_ERR("Error updating block context");
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+		if (internal_req->blk_pipeline_on) {
+			struct coap_client_blk_slot *slot;
+
+			if (blk_pipeline_mark(internal_req, block_num,
+					      last_block) < 0) {
+				LOG_DBG("Stale or duplicate block %d, dropping",
+					block_num);
+				return 0;
+			}
+
+			slot = blk_slot_find(internal_req, block_num);
+			if (slot != NULL) {
+				coap_pending_clear(&slot->pending);
+				slot->busy = false;
+			}
+
+			if (block_num == 0) {
+				/* Learn the negotiated block size from the
+				 * first block before pipelining the rest.
+				 */
+				ret = coap_update_from_block(
+					response, &internal_req->recv_blk_ctx);
+				if (ret < 0) {
+					LOG_ERR("Error updating block context");
+				}
+				coap_next_block(response,
+						&internal_req->recv_blk_ctx);
+			}
+
+			/* Blocks may arrive out of order, place the payload
+			 * by block number and report last_block only once
+			 * the transfer is complete.
+			 */
+			internal_req->offset = block_num *
+				coap_block_size_to_bytes(
+					internal_req->recv_blk_ctx.block_size);
+			last_block = (internal_req->blk_total > 0 &&
+				      internal_req->blk_window_base >=
+					      internal_req->blk_total);
+		} else
+#endif
+		{
+			ret = coap_update_from_block(response, &internal_req->recv_blk_ctx);
+			if (ret < 0) {
+				LOG_ERR("Error updating block context");
+			}
+			coap_next_block(response, &internal_req->recv_blk_ctx);
 		}
-		coap_next_block(response, &internal_req->recv_blk_ctx);
 	} else {
 		internal_req->offset = 0;
 		last_block = true;
@@ -946,6 +1211,15 @@ static int handle_response(struct coap_client *client, const struct coap_packet
 
 	/* If this wasn't last block, send the next request */
 	if (blockwise_transfer && !last_block) {
+#if defined(COAP_CLIENT_BLK_PIPELINE)
+		if (internal_req->blk_pipeline_on) {
+			ret = blk_pipeline_fill(client, internal_req);
+			if (ret < 0) {
+				goto fail;
+			}
+			return 1;
+		}
+#endif
 		ret = coap_client_init_request(client, &internal_req->coap_request, internal_req,
 					       false);
 
@@ -28,6 +28,10 @@ LOG_MODULE_REGISTER(net_dhcpv4, CONFIG_NET_DHCPV4_LOG_LEVEL);
 #include <zephyr/net/dhcpv4.h>
 #include <zephyr/net/dns_resolve.h>
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+#include <zephyr/settings/settings.h>
+#endif
+
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_backend_net.h>
 #include <zephyr/logging/log_ctrl.h>
@@ -564,6 +568,15 @@ static uint32_t dhcpv4_send_request(struct net_if *iface)
 		       sizeof(struct in_addr));
 		timeout = dhcpv4_update_message_timeout(&iface->config.dhcpv4);
 		break;
+	case NET_DHCPV4_REBOOTING:
+		/* RFC2131 4.3.2: a REQUEST generated in INIT-REBOOT is
+		 * broadcast with the cached address in the requested IP
+		 * address option, without a server identifier and with
+		 * ciaddr zero.
+		 */
+		with_requested_ip = true;
+		timeout = dhcpv4_update_message_timeout(&iface->config.dhcpv4);
+		break;
 	case NET_DHCPV4_RENEWING:
 		/* Since we have an address populate the ciaddr field.
 		 */
@@ -686,6 +699,187 @@ fail:
 	}
 }
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+
+#define DHCPV4_LEASE_BASE_KEY "net/dhcpv4/lease"
+/* Room for the base key, the separator and an interface index */
+#define DHCPV4_LEASE_KEY_LEN (sizeof(DHCPV4_LEASE_BASE_KEY) + 12)
+
+/* On-storage layout of a cached lease.  The timers are the durations
+ * received from the server, not absolute times, so the record stays
+ * valid across reboots.
+ */
+struct dhcpv4_lease_record {
+	struct in_addr requested_ip;
+	struct in_addr netmask;
+	struct in_addr server_id;
+	struct in_addr router;
+	uint32_t lease_time;
+	uint32_t renewal_time;
+	uint32_t rebinding_time;
+#if defined(CONFIG_DNS_RESOLVER)
+	struct in_addr dns[CONFIG_DNS_RESOLVER_MAX_SERVERS];
+	uint8_t dns_count;
+#endif
+};
+
+static void dhcpv4_lease_key(struct net_if *iface, char *key, size_t len)
+{
+	(void)snprintk(key, len, DHCPV4_LEASE_BASE_KEY "/%d",
+		       net_if_get_by_iface(iface));
+}
+
+static int dhcpv4_lease_load_cb(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	struct dhcpv4_lease_record *record = param;
+
+	ARG_UNUSED(key);
+
+	if (len != sizeof(*record)) {
+		NET_DBG("Cached lease has unexpected size, ignoring");
+		return -EINVAL;
+	}
+
+	if (read_cb(cb_arg, record, sizeof(*record)) != sizeof(*record)) {
+		return -ENODATA;
+	}
+
+	return 0;
+}
+
+/* Load a cached lease for the interface into the client state.
+ * Returns false if no (valid) lease was stored.
+ */
+static bool dhcpv4_lease_load(struct net_if *iface)
+{
+	struct net_if_dhcpv4 *dhcpv4 = &iface->config.dhcpv4;
+	struct dhcpv4_lease_record record = { 0 };
+	char key[DHCPV4_LEASE_KEY_LEN];
+
+	if (settings_subsys_init() < 0) {
+		return false;
+	}
+
+	dhcpv4_lease_key(iface, key, sizeof(key));
+
+	if (settings_load_subtree_direct(key, dhcpv4_lease_load_cb,
+					 &record) < 0) {
+		return false;
+	}
+
+	/* The callback is not invoked when no entry exists, leaving the
+	 * record zeroed.
+	 */
+	if (record.requested_ip.s_addr == INADDR_ANY ||
+	    record.lease_time == 0U) {
+		return false;
+	}
+
+	dhcpv4->requested_ip = record.requested_ip;
+	dhcpv4->netmask = record.netmask;
+	dhcpv4->server_id = record.server_id;
+	dhcpv4->lease_router = record.router;
+	dhcpv4->lease_time = record.lease_time;
+	dhcpv4->renewal_time = record.renewal_time;
+	dhcpv4->rebinding_time = record.rebinding_time;
+#if defined(CONFIG_DNS_RESOLVER)
+	dhcpv4->lease_dns_count = MIN(record.dns_count,
+				      ARRAY_SIZE(dhcpv4->lease_dns));
+	memcpy(dhcpv4->lease_dns, record.dns, sizeof(dhcpv4->lease_dns));
+#endif
+
+	NET_DBG("loaded cached lease %s for iface %d",
+		net_sprint_ipv4_addr(&record.requested_ip),
+		net_if_get_by_iface(iface));
+
+	return true;
+}
+
+static void dhcpv4_lease_save(struct net_if *iface)
+{
+	struct net_if_dhcpv4 *dhcpv4 = &iface->config.dhcpv4;
+	struct dhcpv4_lease_record record = {
+		.requested_ip = dhcpv4->requested_ip,
+		.netmask = dhcpv4->netmask,
+		.server_id = dhcpv4->server_id,
+		.router = dhcpv4->lease_router,
+		.lease_time = dhcpv4->lease_time,
+		.renewal_time = dhcpv4->renewal_time,
+		.rebinding_time = dhcpv4->rebinding_time,
+	};
+	char key[DHCPV4_LEASE_KEY_LEN];
+	int ret;
+
+#if defined(CONFIG_DNS_RESOLVER)
+	record.dns_count = dhcpv4->lease_dns_count;
+	memcpy(record.dns, dhcpv4->lease_dns, sizeof(record.dns));
+#endif
+
+	dhcpv4_lease_key(iface, key, sizeof(key));
+
+	ret = settings_save_one(key, &record, sizeof(record));
+	if (ret < 0) {
+		NET_DBG("Failed to save lease for iface %d (%d)",
+			net_if_get_by_iface(iface), ret);
+	}
+}
+
+static void dhcpv4_lease_clear(struct net_if *iface)
+{
+	char key[DHCPV4_LEASE_KEY_LEN];
+
+	dhcpv4_lease_key(iface, key, sizeof(key));
+
+	(void)settings_delete(key);
+}
+
+/* Apply the cached configuration provisionally so that traffic can flow
+ * while the lease is being revalidated; a NAK tears it back down.
+ */
+static void dhcpv4_enter_rebooting(struct net_if *iface)
+{
+	struct net_if_dhcpv4 *dhcpv4 = &iface->config.dhcpv4;
+
+	if (!net_if_ipv4_addr_add(iface, &dhcpv4->requested_ip,
+				  NET_ADDR_DHCP, dhcpv4->lease_time)) {
+		NET_DBG("Failed to add IPv4 addr to iface %p", iface);
+	}
+
+	net_if_ipv4_set_netmask_by_addr(iface, &dhcpv4->requested_ip,
+					&dhcpv4->netmask);
+
+	if (dhcpv4->lease_router.s_addr != INADDR_ANY) {
+		net_if_ipv4_set_gw(iface, &dhcpv4->lease_router);
+	}
+
+#if defined(CONFIG_DNS_RESOLVER)
+	if (dhcpv4->lease_dns_count > 0U) {
+		struct sockaddr_in dnses[CONFIG_DNS_RESOLVER_MAX_SERVERS] = { 0 };
+		const struct sockaddr *dns_servers[CONFIG_DNS_RESOLVER_MAX_SERVERS + 1] = { 0 };
+
+		for (uint8_t i = 0; i < dhcpv4->lease_dns_count; i++) {
+			dnses[i].sin_family = AF_INET;
+			dnses[i].sin_addr = dhcpv4->lease_dns[i];
+			dns_servers[i] = (struct sockaddr *)&dnses[i];
+		}
+
+		if (dns_resolve_reconfigure(dns_resolve_get_default(), NULL,
+					    dns_servers) < 0) {
+			NET_DBG("Failed to apply cached DNS servers");
+		}
+	}
+#endif
+
+	dhcpv4->attempts = 0U;
+	dhcpv4->state = NET_DHCPV4_REBOOTING;
+	NET_DBG("enter state=%s",
+		net_dhcpv4_state_name(dhcpv4->state));
+}
+
+#endif /* CONFIG_NET_DHCPV4_LEASE_CACHE */
+
 static void dhcpv4_enter_selecting(struct net_if *iface)
 {
 	iface->config.dhcpv4.attempts = 0U;
@@ -744,6 +938,17 @@ static void dhcpv4_enter_bound(struct net_if *iface)
 		dhcpv4->rebinding_time = dhcpv4->lease_time * 875U / 1000U;
 	}
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+	/* Persist only newly acquired or revalidated leases; a renewal
+	 * carries the same parameters and saving it again would only
+	 * wear the storage.
+	 */
+	if (dhcpv4->state == NET_DHCPV4_REQUESTING ||
+	    dhcpv4->state == NET_DHCPV4_REBOOTING) {
+		dhcpv4_lease_save(iface);
+	}
+#endif
+
 	dhcpv4->state = NET_DHCPV4_BOUND;
 	NET_DBG("enter state=%s renewal=%us rebinding=%us",
 		net_dhcpv4_state_name(dhcpv4->state),
@@ -796,13 +1001,49 @@ static uint32_t dhcpv4_manage_timers(struct net_if *iface, int64_t now)
 		break;
 	case NET_DHCPV4_DECLINE:
 		dhcpv4_send_decline(iface);
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		/* The declined address must not be requested again. */
+		dhcpv4_lease_clear(iface);
+		iface->config.dhcpv4.requested_ip.s_addr = INADDR_ANY;
+#endif
 		__fallthrough;
 	case NET_DHCPV4_INIT:
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		if (iface->config.dhcpv4.requested_ip.s_addr != INADDR_ANY &&
+		    iface->config.dhcpv4.lease_time != 0U) {
+			/* A previous lease is known, either loaded from
+			 * the cache at startup or retained over a link
+			 * flap: revalidate it with an INIT-REBOOT
+			 * request instead of restarting from DISCOVER.
+			 */
+			dhcpv4_enter_rebooting(iface);
+			return dhcpv4_send_request(iface);
+		}
+#endif
 		dhcpv4_enter_selecting(iface);
 		__fallthrough;
 	case NET_DHCPV4_SELECTING:
 		/* Failed to get OFFER message, send DISCOVER again */
 		return dhcpv4_send_discover(iface);
+	case NET_DHCPV4_REBOOTING:
+		/* The server does not confirm the cached lease, fall
+		 * back to the full configuration sequence.
+		 */
+		if (iface->config.dhcpv4.attempts >=
+					DHCPV4_MAX_NUMBER_OF_ATTEMPTS) {
+			NET_DBG("too many attempts, restart");
+
+			if (!net_if_ipv4_addr_rm(
+					iface,
+					&iface->config.dhcpv4.requested_ip)) {
+				NET_DBG("Failed to remove addr from iface");
+			}
+
+			dhcpv4_enter_selecting(iface);
+			return dhcpv4_send_discover(iface);
+		}
+
+		return dhcpv4_send_request(iface);
 	case NET_DHCPV4_REQUESTING:
 		/* Maximum number of renewal attempts failed, so start
 		 * from the beginning.
@@ -1051,6 +1292,10 @@ static bool dhcpv4_parse_options(struct net_pkt *pkt,
 			net_if_ipv4_set_gw(iface, &router);
 			router_present = true;
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+			iface->config.dhcpv4.lease_router = router;
+#endif
+
 			break;
 		}
 #if defined(CONFIG_DNS_RESOLVER)
@@ -1107,6 +1352,14 @@ static bool dhcpv4_parse_options(struct net_pkt *pkt,
 			for (uint8_t i = 0; i < dns_servers_cnt; i++) {
 				dnses[i].sin_family = AF_INET;
 			}
+
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+			iface->config.dhcpv4.lease_dns_count = dns_servers_cnt;
+			for (uint8_t i = 0; i < dns_servers_cnt; i++) {
+				iface->config.dhcpv4.lease_dns[i] =
+							dnses[i].sin_addr;
+			}
+#endif
 			status = dns_resolve_reconfigure(ctx, NULL, dns_servers);
 			if (status < 0) {
 				NET_DBG("options_dns, failed to set "
@@ -1341,6 +1594,7 @@ static inline void dhcpv4_handle_msg_offer(struct net_if *iface,
 	case NET_DHCPV4_REBINDING:
 	case NET_DHCPV4_BOUND:
 	case NET_DHCPV4_DECLINE:
+	case NET_DHCPV4_REBOOTING:
 		break;
 	case NET_DHCPV4_SELECTING:
 		dhcpv4_enter_requesting(iface, msg);
@@ -1359,6 +1613,7 @@ static void dhcpv4_handle_msg_ack(struct net_if *iface)
 	case NET_DHCPV4_DECLINE:
 		break;
 	case NET_DHCPV4_REQUESTING:
+	case NET_DHCPV4_REBOOTING:
 		NET_INFO("Received: %s",
 			 net_sprint_ipv4_addr(&iface->config.dhcpv4.requested_ip));
 
@@ -1410,11 +1665,17 @@ static void dhcpv4_handle_msg_nak(struct net_if *iface)
 		break;
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_REBINDING:
+	case NET_DHCPV4_REBOOTING:
 		if (!net_if_ipv4_addr_rm(iface,
 					 &iface->config.dhcpv4.requested_ip)) {
 			NET_DBG("Failed to remove addr from iface");
 		}
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		/* The server rejected the lease, invalidate the cache. */
+		dhcpv4_lease_clear(iface);
+#endif
+
 		/* Restart the configuration process. */
 		dhcpv4_enter_selecting(iface);
 		break;
@@ -1570,7 +1831,8 @@ static void dhcpv4_iface_event_handler(struct net_mgmt_event_callback *cb,
 	if (mgmt_event == NET_EVENT_IF_DOWN) {
 		NET_DBG("Interface %p going down", iface);
 
-		if (iface->config.dhcpv4.state == NET_DHCPV4_BOUND) {
+		if (iface->config.dhcpv4.state == NET_DHCPV4_BOUND ||
+		    iface->config.dhcpv4.state == NET_DHCPV4_REBOOTING) {
 			iface->config.dhcpv4.attempts = 0U;
 			iface->config.dhcpv4.state = NET_DHCPV4_INIT;
 			NET_DBG("enter state=%s", net_dhcpv4_state_name(
@@ -1656,7 +1918,8 @@ const char *net_dhcpv4_state_name(enum net_dhcpv4_state state)
 		"renewing",
 		"rebinding",
 		"bound",
-		"decline,"
+		"decline,",
+		"rebooting"
 	};
 
 	__ASSERT_NO_MSG(state >= 0 && state < sizeof(name));
@@ -1717,6 +1980,16 @@ static void dhcpv4_start_internal(struct net_if *iface, bool first_start)
 					DHCPV4_INITIAL_DELAY_MIN) + DHCPV4_INITIAL_DELAY_MIN;
 		}
 
+#if defined(CONFIG_NET_DHCPV4_LEASE_CACHE)
+		if (dhcpv4_lease_load(iface)) {
+			/* A cached lease skips the initial delay; the
+			 * INIT state handler revalidates it with an
+			 * INIT-REBOOT request straight away.
+			 */
+			timeout = 0U;
+		}
+#endif
+
 		NET_DBG("wait timeout=%us", timeout);
 
 		if (sys_slist_is_empty(&dhcpv4_ifaces)) {
@@ -1739,6 +2012,7 @@ static void dhcpv4_start_internal(struct net_if *iface, bool first_start)
 	case NET_DHCPV4_REBINDING:
 	case NET_DHCPV4_BOUND:
 	case NET_DHCPV4_DECLINE:
+	case NET_DHCPV4_REBOOTING:
 		break;
 	}
 
@@ -1826,6 +2100,7 @@ void net_dhcpv4_stop(struct net_if *iface)
 
 	case NET_DHCPV4_RENEWING:
 	case NET_DHCPV4_BOUND:
+	case NET_DHCPV4_REBOOTING:
 		if (!net_if_ipv4_addr_rm(iface,
 					 &iface->config.dhcpv4.requested_ip)) {
 			NET_DBG("Failed to remove addr from iface");
@@ -1927,7 +2202,8 @@ bool net_dhcpv4_accept_unicast(struct net_pkt *pkt)
 	if (iface->config.dhcpv4.state != NET_DHCPV4_SELECTING &&
 	    iface->config.dhcpv4.state != NET_DHCPV4_REQUESTING &&
 	    iface->config.dhcpv4.state != NET_DHCPV4_RENEWING &&
-	    iface->config.dhcpv4.state != NET_DHCPV4_REBINDING) {
+	    iface->config.dhcpv4.state != NET_DHCPV4_REBINDING &&
+	    iface->config.dhcpv4.state != NET_DHCPV4_REBOOTING) {
 		return false;
 	}
 
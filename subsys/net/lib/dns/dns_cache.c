@@ -5,12 +5,22 @@
  */
 
 #include <zephyr/net/dns_resolve.h>
+#include <zephyr/sys/crc.h>
 #include "dns_cache.h"
 
 LOG_MODULE_REGISTER(net_dns_cache, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 
 static void dns_cache_clean(struct dns_cache const *cache);
 
+/* Same hash the resolver uses for matching queries to pending slots.
+ * It is only a cheap pre-filter, entries with a matching hash are still
+ * compared with strcmp().
+ */
+static uint16_t dns_cache_hash(char const *query)
+{
+	return crc16_ansi((const uint8_t *)query, strlen(query));
+}
+
 int dns_cache_flush(struct dns_cache *cache)
 {
 	k_mutex_lock(cache->lock, K_FOREVER);
@@ -22,14 +32,17 @@ int dns_cache_flush(struct dns_cache *cache)
 	return 0;
 }
 
-int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
-		  uint32_t ttl)
+static int dns_cache_add_entry(struct dns_cache *cache, char const *query,
+			       struct dns_addrinfo const *addrinfo, uint32_t ttl,
+			       bool is_negative)
 {
 	k_timepoint_t closest_to_expiry = sys_timepoint_calc(K_FOREVER);
 	size_t index_to_replace = 0;
 	bool found_empty = false;
+	bool found_stale = false;
+	uint16_t hash;
 
-	if (cache == NULL || query == NULL || addrinfo == NULL || ttl == 0) {
+	if (cache == NULL || query == NULL || ttl == 0) {
 		return -EINVAL;
 	}
 
@@ -40,30 +53,55 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
-	NET_DBG("Add \"%s\" with TTL %" PRIu32, query, ttl);
+	NET_DBG("Add%s \"%s\" with TTL %" PRIu32, is_negative ? " negative" : "", query, ttl);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
 		if (!cache->entries[i].in_use) {
+			if (!found_stale) {
+				index_to_replace = i;
+				found_empty = true;
+			}
+			continue;
+		}
+
+		/* An entry of the opposite polarity for the same query is
+		 * stale now, prefer replacing it over everything else.
+		 */
+		if (cache->entries[i].is_negative != is_negative &&
+		    cache->entries[i].hash == hash &&
+		    strcmp(cache->entries[i].query, query) == 0) {
 			index_to_replace = i;
-			found_empty = true;
+			found_stale = true;
 			break;
-		} else if (sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
+		}
+
+		if (!found_empty &&
+		    sys_timepoint_cmp(closest_to_expiry, cache->entries[i].expiry) > 0) {
 			index_to_replace = i;
 			closest_to_expiry = cache->entries[i].expiry;
 		}
 	}
 
-	if (!found_empty) {
+	if (!found_empty && !found_stale) {
 		NET_DBG("Overwrite \"%s\"", cache->entries[index_to_replace].query);
 	}
 
 	strncpy(cache->entries[index_to_replace].query, query,
 		CONFIG_DNS_RESOLVER_MAX_QUERY_LEN - 1);
-	cache->entries[index_to_replace].data = *addrinfo;
+	if (addrinfo != NULL) {
+		cache->entries[index_to_replace].data = *addrinfo;
+	} else {
+		memset(&cache->entries[index_to_replace].data, 0,
+		       sizeof(cache->entries[index_to_replace].data));
+	}
+	cache->entries[index_to_replace].hash = hash;
+	cache->entries[index_to_replace].is_negative = is_negative;
 	cache->entries[index_to_replace].expiry = sys_timepoint_calc(K_SECONDS(ttl));
 	cache->entries[index_to_replace].in_use = true;
 
@@ -72,6 +110,21 @@ int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinf
 	return 0;
 }
 
+int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
+		  uint32_t ttl)
+{
+	if (addrinfo == NULL) {
+		return -EINVAL;
+	}
+
+	return dns_cache_add_entry(cache, query, addrinfo, ttl, false);
+}
+
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, uint32_t ttl)
+{
+	return dns_cache_add_entry(cache, query, NULL, ttl, true);
+}
+
 int dns_cache_remove(struct dns_cache *cache, char const *query)
 {
 	NET_DBG("Remove all entries with query \"%s\"", query);
@@ -97,10 +150,14 @@ int dns_cache_remove(struct dns_cache *cache, char const *query)
 	return 0;
 }
 
-int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
-		   size_t addrinfo_array_len)
+int dns_cache_find_ttl(struct dns_cache const *cache, const char *query,
+		       struct dns_addrinfo *addrinfo, size_t addrinfo_array_len,
+		       uint32_t *ttl_left)
 {
+	bool negative_hit = false;
+	uint32_t max_ttl_left = 0;
 	size_t found = 0;
+	uint16_t hash;
 
 	NET_DBG("Find \"%s\"", query);
 	if (cache == NULL || query == NULL || addrinfo == NULL || addrinfo_array_len <= 0) {
@@ -113,17 +170,32 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 		return -EINVAL;
 	}
 
+	hash = dns_cache_hash(query);
+
 	k_mutex_lock(cache->lock, K_FOREVER);
 
 	dns_cache_clean(cache);
 
 	for (size_t i = 0; i < cache->size; i++) {
+		uint32_t entry_ttl_left;
+
 		if (!cache->entries[i].in_use) {
 			continue;
 		}
-		if (strcmp(cache->entries[i].query, query) != 0) {
+		if (cache->entries[i].hash != hash ||
+		    strcmp(cache->entries[i].query, query) != 0) {
 			continue;
 		}
+		if (cache->entries[i].is_negative) {
+			negative_hit = true;
+			continue;
+		}
+
+		entry_ttl_left = k_ticks_to_ms_floor32(
+					sys_timepoint_timeout(cache->entries[i].expiry).ticks) /
+				 MSEC_PER_SEC;
+		max_ttl_left = MAX(max_ttl_left, entry_ttl_left);
+
 		if (found >= addrinfo_array_len) {
 			NET_WARN("Found \"%s\" but not enough space in provided buffer.", query);
 			found++;
@@ -141,11 +213,27 @@ int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_
 	}
 
 	if (found == 0) {
+		if (negative_hit) {
+			NET_DBG("Negative entry for \"%s\"", query);
+			return -ENOENT;
+		}
 		NET_DBG("Could not find \"%s\"", query);
+		return 0;
 	}
+
+	if (ttl_left != NULL) {
+		*ttl_left = max_ttl_left;
+	}
+
 	return found;
 }
 
+int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
+		   size_t addrinfo_array_len)
+{
+	return dns_cache_find_ttl(cache, query, addrinfo, addrinfo_array_len, NULL);
+}
+
 /* Needs to be called when lock is already acquired */
 static void dns_cache_clean(struct dns_cache const *cache)
 {
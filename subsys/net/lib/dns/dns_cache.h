@@ -22,7 +22,9 @@ struct dns_cache_entry {
 	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
 	struct dns_addrinfo data;
 	k_timepoint_t expiry;
+	uint16_t hash;
 	bool in_use;
+	bool is_negative;
 };
 
 struct dns_cache {
@@ -71,6 +73,23 @@ int dns_cache_flush(struct dns_cache *cache);
 int dns_cache_add(struct dns_cache *cache, char const *query, struct dns_addrinfo const *addrinfo,
 		  uint32_t ttl);
 
+/**
+ * @brief Adds a negative entry to the dns cache recording that the query
+ * is known to have no result.
+ *
+ * While the entry lives @ref dns_cache_find returns -ENOENT for the query
+ * so that the failure does not have to be rediscovered over the network.
+ * A subsequent @ref dns_cache_add for the same query replaces the
+ * negative entry.
+ *
+ * @param cache Cache where the entry should be added.
+ * @param query Query which should be persisted in the cache.
+ * @param ttl Time to live for the entry in seconds.
+ * @retval 0 on success
+ * @retval On error, a negative value is returned.
+ */
+int dns_cache_add_negative(struct dns_cache *cache, char const *query, uint32_t ttl);
+
 /**
  * @brief Removes all entries with the given query
  *
@@ -97,4 +116,29 @@ int dns_cache_remove(struct dns_cache *cache, char const *query);
 int dns_cache_find(struct dns_cache const *cache, const char *query, struct dns_addrinfo *addrinfo,
 		   size_t addrinfo_array_len);
 
+/**
+ * @brief Tries to find the specified query entry within the cache and
+ * reports how long the result stays valid.
+ *
+ * Same as @ref dns_cache_find but additionally writes the largest
+ * remaining time to live in seconds of the returned entries into
+ * @p ttl_left. This can be used to refresh entries shortly before
+ * they expire.
+ *
+ * @param cache Cache where the entry should be searched.
+ * @param query Query which should be searched for.
+ * @param addrinfo dns_addrinfo array which will be written if the query was found.
+ * @param addrinfo_array_len Array size of the dns_addrinfo array
+ * @param ttl_left Remaining time to live in seconds, may be NULL.
+ * Only written on cache hit.
+ * @retval on success the amount of dns_addrinfo written into the addrinfo array.
+ * @retval 0 on a cache miss.
+ * @retval -ENOENT if a negative entry added with @ref dns_cache_add_negative
+ * matched the query.
+ * @retval On other errors a negative value is returned.
+ */
+int dns_cache_find_ttl(struct dns_cache const *cache, const char *query,
+		       struct dns_addrinfo *addrinfo, size_t addrinfo_array_len,
+		       uint32_t *ttl_left);
+
 #endif /* ZEPHYR_INCLUDE_NET_DNS_CACHE_H_ */
@@ -77,6 +77,77 @@ NET_BUF_POOL_DEFINE(dns_qname_pool, DNS_RESOLVER_BUF_CTR,
 
 #ifdef CONFIG_DNS_RESOLVER_CACHE
 DNS_CACHE_DEFINE(dns_cache, CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES);
+
+#if CONFIG_DNS_RESOLVER_CACHE_PREFETCH_THRESHOLD > 0
+/* How long a background cache refresh query may take before it is
+ * abandoned (in milliseconds).
+ */
+#define DNS_CACHE_PREFETCH_TIMEOUT 2000
+
+static void dns_cache_prefetch_work_handler(struct k_work *work);
+static K_WORK_DEFINE(dns_prefetch_work, dns_cache_prefetch_work_handler);
+
+static struct {
+	struct dns_resolve_context *ctx;
+	char query[CONFIG_DNS_RESOLVER_MAX_QUERY_LEN];
+	enum dns_query_type query_type;
+	atomic_t busy;
+} dns_prefetch;
+
+static void dns_cache_prefetch_cb(enum dns_resolve_status status,
+				  struct dns_addrinfo *info,
+				  void *user_data)
+{
+	ARG_UNUSED(info);
+	ARG_UNUSED(user_data);
+
+	/* The answers, if any, have already been added to the cache by
+	 * the normal response handling, just track query completion.
+	 */
+	if (status != DNS_EAI_INPROGRESS) {
+		atomic_clear(&dns_prefetch.busy);
+	}
+}
+
+static void dns_cache_prefetch_work_handler(struct k_work *work)
+{
+	int ret;
+
+	ARG_UNUSED(work);
+
+	/* Drop the nearly expired entries so that the query below goes
+	 * out to the network instead of being answered from the cache.
+	 */
+	dns_cache_remove(&dns_cache, dns_prefetch.query);
+
+	ret = dns_resolve_name(dns_prefetch.ctx, dns_prefetch.query,
+			       dns_prefetch.query_type,
+			       NULL, dns_cache_prefetch_cb, NULL,
+			       DNS_CACHE_PREFETCH_TIMEOUT);
+	if (ret < 0) {
+		atomic_clear(&dns_prefetch.busy);
+	}
+}
+
+static void dns_cache_schedule_prefetch(struct dns_resolve_context *ctx,
+					const char *query,
+					enum dns_query_type type)
+{
+	/* Only one refresh in flight at a time, further triggers are
+	 * retried on the next cache hit.
+	 */
+	if (!atomic_cas(&dns_prefetch.busy, 0, 1)) {
+		return;
+	}
+
+	strncpy(dns_prefetch.query, query, sizeof(dns_prefetch.query) - 1);
+	dns_prefetch.query[sizeof(dns_prefetch.query) - 1] = '\0';
+	dns_prefetch.ctx = ctx;
+	dns_prefetch.query_type = type;
+
+	k_work_submit(&dns_prefetch_work);
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_PREFETCH_THRESHOLD > 0 */
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
 
 static int init_called;
@@ -1014,6 +1085,13 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE) && (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0)
+	if (ret == DNS_EAI_NODATA) {
+		dns_cache_add_negative(&dns_cache, ctx->queries[query_idx].query,
+				       CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+	}
+#endif /* CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL > 0 */
+
 	invoke_query_callback(ret, NULL, &ctx->queries[query_idx]);
 
 	/* Marks the end of the results */
@@ -1339,6 +1417,7 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	uint8_t hop_limit;
 #ifdef CONFIG_DNS_RESOLVER_CACHE
 	struct dns_addrinfo cached_info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES] = {0};
+	uint32_t ttl_left = 0;
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
 
 	if (!ctx || !query || !cb) {
@@ -1402,7 +1481,8 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 
 try_resolve:
 #ifdef CONFIG_DNS_RESOLVER_CACHE
-	ret = dns_cache_find(&dns_cache, query, cached_info, ARRAY_SIZE(cached_info));
+	ret = dns_cache_find_ttl(&dns_cache, query, cached_info, ARRAY_SIZE(cached_info),
+				 &ttl_left);
 	if (ret > 0) {
 		/* The query was cached, no
 		 * need to continue further.
@@ -1412,6 +1492,18 @@ try_resolve:
 		}
 		cb(DNS_EAI_ALLDONE, NULL, user_data);
 
+#if CONFIG_DNS_RESOLVER_CACHE_PREFETCH_THRESHOLD > 0
+		if (ttl_left <= CONFIG_DNS_RESOLVER_CACHE_PREFETCH_THRESHOLD) {
+			dns_cache_schedule_prefetch(ctx, query, type);
+		}
+#endif
+		return 0;
+	} else if (ret == -ENOENT) {
+		/* The failure is still cached, do not query the network
+		 * again yet.
+		 */
+		cb(DNS_EAI_NODATA, NULL, user_data);
+
 		return 0;
 	}
 #endif /* CONFIG_DNS_RESOLVER_CACHE */
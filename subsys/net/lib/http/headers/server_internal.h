@@ -39,6 +39,11 @@ int enter_http_done_state(struct http_client_ctx *client);
 /* Others */
 struct http_resource_detail *get_resource_detail(const char *path, int *len, bool is_ws);
 int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t len);
+#if defined(CONFIG_HTTP_SERVER_NOCOPY_STATIC)
+int http_server_sendall_nocopy(struct http_client_ctx *client, const void *buf, size_t len);
+#else
+#define http_server_sendall_nocopy http_server_sendall
+#endif
 void http_server_get_content_type_from_extension(char *url, char *content_type,
 						 size_t content_type_size);
 int http_server_find_file(char *fname, size_t fname_size, size_t *file_size, bool *gzipped);
@@ -806,6 +806,33 @@ int http_server_sendall(struct http_client_ctx *client, const void *buf, size_t
 	return 0;
 }
 
+#if defined(CONFIG_HTTP_SERVER_NOCOPY_STATIC)
+int http_server_sendall_nocopy(struct http_client_ctx *client, const void *buf, size_t len)
+{
+	while (len) {
+		ssize_t out_len = zsock_send_nocopy(client->fd, buf, len);
+
+		if (out_len < 0) {
+			if (errno == EOPNOTSUPP) {
+				/* TLS or offloaded socket, the data cannot be
+				 * queued by reference so copy it instead.
+				 */
+				return http_server_sendall(client, buf, len);
+			}
+
+			return -errno;
+		}
+
+		buf = (const char *)buf + out_len;
+		len -= out_len;
+
+		http_client_timer_restart(client);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_HTTP_SERVER_NOCOPY_STATIC */
+
 bool http_response_is_final(struct http_response_ctx *rsp, enum http_data_status status)
 {
 	if (status != HTTP_SERVER_DATA_FINAL) {
@@ -83,7 +83,11 @@ static int handle_http1_static_resource(
 			return ret;
 		}
 
-		ret = http_server_sendall(client, data, len);
+		/* The resource table data is constant for the lifetime of
+		 * the server, so it can be streamed by reference when
+		 * CONFIG_HTTP_SERVER_NOCOPY_STATIC is enabled.
+		 */
+		ret = http_server_sendall_nocopy(client, data, len);
 		if (ret < 0) {
 			return ret;
 		}
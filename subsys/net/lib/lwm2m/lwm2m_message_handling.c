@@ -3159,8 +3159,31 @@ msg_init:
 	/* set the output writer */
 	select_writer(&msg->out, obs->format);
 	if (obs->composite) {
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+		if (obs->resource_update && !obs->changed_overflow &&
+		    obs->changed_cnt > 0) {
+			/* Resource triggered notify, report only the paths
+			 * which changed since the last notification.
+			 */
+			struct lwm2m_obj_path_list
+				delta_entries[CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA_PATHS];
+			sys_slist_t delta_list;
+
+			sys_slist_init(&delta_list);
+			for (int i = 0; i < obs->changed_cnt; i++) {
+				delta_entries[i].path = obs->changed_paths[i];
+				sys_slist_append(&delta_list,
+						 &delta_entries[i].node);
+			}
+
+			ret = do_send_op(msg, obs->format, &delta_list);
+		} else {
+			ret = do_send_op(msg, obs->format, &obs->path_list);
+		}
+#else
 		/* Use do send which actually do Composite read operation */
 		ret = do_send_op(msg, obs->format, &obs->path_list);
+#endif
 	} else {
 		ret = do_read_op(msg, obs->format);
 	}
@@ -3178,6 +3201,10 @@ msg_init:
 
 	obs->active_notify = msg;
 	obs->resource_update = false;
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+	obs->changed_cnt = 0U;
+	obs->changed_overflow = false;
+#endif
 	lwm2m_information_interface_send(msg);
 #if defined(CONFIG_LWM2M_RESOURCE_DATA_CACHE_SUPPORT)
 	msg->cache_info = NULL;
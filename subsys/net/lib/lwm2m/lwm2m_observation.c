@@ -351,6 +351,33 @@ int engine_observe_attribute_list_get(sys_slist_t *path_list, struct notificatio
 	return 0;
 }
 
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+/* Remember which paths of a composite observation changed since the last
+ * notify, so the notification can carry only those. On overflow the whole
+ * path list is notified instead.
+ */
+static void engine_observe_mark_changed(struct observe_node *obs,
+					const struct lwm2m_obj_path *path)
+{
+	if (!obs->composite || obs->changed_overflow) {
+		return;
+	}
+
+	for (int i = 0; i < obs->changed_cnt; i++) {
+		if (lwm2m_obj_path_equal(&obs->changed_paths[i], path)) {
+			return;
+		}
+	}
+
+	if (obs->changed_cnt >= ARRAY_SIZE(obs->changed_paths)) {
+		obs->changed_overflow = true;
+		return;
+	}
+
+	obs->changed_paths[obs->changed_cnt++] = *path;
+}
+#endif /* CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA */
+
 int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 {
 	struct observe_node *obs;
@@ -379,19 +406,31 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 					timestamp =
 						obs->last_timestamp + MSEC_PER_SEC * nattrs.pmin;
 				} else {
-					/* Trig immediately */
-					timestamp = k_uptime_get();
+					/* Trig once the batching window, in
+					 * which further resource changes join
+					 * this notification, has passed.
+					 * By default trig immediately.
+					 */
+					timestamp = k_uptime_get() +
+						    CONFIG_LWM2M_NOTIFY_BATCH_WINDOW_MS;
 				}
 
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+				engine_observe_mark_changed(obs, path);
+#endif
+
 				if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
 					obs->resource_update = true;
 					obs->event_timestamp = timestamp;
+					/* Only a new or earlier event needs
+					 * a service thread wakeup.
+					 */
+					lwm2m_engine_wake_up();
 				}
 
 				LOG_DBG("NOTIFY EVENT %u/%u/%u", path->obj_id, path->obj_inst_id,
 					path->res_id);
 				ret++;
-				lwm2m_engine_wake_up();
 			}
 		}
 	}
@@ -459,6 +498,10 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 	obs->active_notify = NULL;
 	obs->format = format;
 	obs->counter = OBSERVE_COUNTER_START;
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+	obs->changed_cnt = 0U;
+	obs->changed_overflow = false;
+#endif
 	sys_slist_append(&ctx->observer, &obs->node);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&obs->path_list, tmp, node) {
@@ -24,6 +24,11 @@ struct observe_node {
 	uint8_t tkl;
 	bool resource_update : 1;            /* Resource is updated */
 	bool composite : 1;                  /* Composite Observation */
+#if defined(CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA)
+	bool changed_overflow : 1;           /* Too many changed paths, notify all */
+	uint8_t changed_cnt;                 /* Changed paths since last Notify */
+	struct lwm2m_obj_path changed_paths[CONFIG_LWM2M_COMPOSITE_NOTIFY_DELTA_PATHS];
+#endif
 };
 /* Attribute handling. */
 
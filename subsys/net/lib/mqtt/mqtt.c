@@ -25,6 +25,16 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.last_activity = 0U;
 	client->internal.rx_buf_datalen = 0U;
 	client->internal.remaining_payload = 0U;
+
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+	for (int i = 0; i < ARRAY_SIZE(client->internal.qos1_inflight); i++) {
+		client->internal.qos1_inflight[i].used = false;
+	}
+#endif
+
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	client->internal.tx_coalesce_datalen = 0U;
+#endif
 }
 
 /** @brief Initialize tx buffer. */
@@ -125,6 +135,115 @@ static int client_read(struct mqtt_client *client)
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+/** @brief Reserve an in-flight window slot for a QoS 1 publish. */
+static int qos1_inflight_register(struct mqtt_client *client,
+				  uint16_t message_id)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.qos1_inflight); i++) {
+		if (!client->internal.qos1_inflight[i].used) {
+			client->internal.qos1_inflight[i].used = true;
+			client->internal.qos1_inflight[i].message_id =
+								message_id;
+			client->internal.qos1_inflight[i].timestamp =
+						mqtt_sys_tick_in_ms_get();
+			return 0;
+		}
+	}
+
+	NET_DBG("[%p]: QoS 1 in-flight window full.", client);
+
+	return -EAGAIN;
+}
+
+void mqtt_qos1_inflight_clear(struct mqtt_client *client, uint16_t message_id)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.qos1_inflight); i++) {
+		if (client->internal.qos1_inflight[i].used &&
+		    client->internal.qos1_inflight[i].message_id ==
+							message_id) {
+			client->internal.qos1_inflight[i].used = false;
+			return;
+		}
+	}
+}
+#endif /* CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0 */
+
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+/** @brief Write out any data staged in the TX coalescing buffer. */
+static int tx_coalesce_flush(struct mqtt_client *client)
+{
+	int err_code;
+
+	if (client->internal.tx_coalesce_datalen == 0U) {
+		return 0;
+	}
+
+	NET_DBG("[%p]: Transport writing %d coalesced bytes.", client,
+		client->internal.tx_coalesce_datalen);
+
+	err_code = mqtt_transport_write(client, client->internal.tx_coalesce,
+					client->internal.tx_coalesce_datalen);
+	client->internal.tx_coalesce_datalen = 0U;
+	if (err_code < 0) {
+		NET_ERR("Transport write failed, err_code = %d, "
+			 "closing connection", err_code);
+		client_disconnect(client, err_code, true);
+		return err_code;
+	}
+
+	client->internal.last_activity = mqtt_sys_tick_in_ms_get();
+
+	return 0;
+}
+
+/** @brief Stage an outgoing packet in the TX coalescing buffer if it fits,
+ *         flushing staged data first when it is in the way. Packets larger
+ *         than the buffer are left to the caller to write directly.
+ */
+static int tx_coalesce_append(struct mqtt_client *client,
+			      const struct msghdr *message, bool *coalesced)
+{
+	uint32_t total = 0U;
+	int err_code;
+
+	*coalesced = false;
+
+	for (size_t i = 0; i < message->msg_iovlen; i++) {
+		total += message->msg_iov[i].iov_len;
+	}
+
+	if (total > sizeof(client->internal.tx_coalesce)) {
+		/* Too large to stage, flush so the direct write keeps the
+		 * packet order.
+		 */
+		return tx_coalesce_flush(client);
+	}
+
+	if (total > sizeof(client->internal.tx_coalesce) -
+		    client->internal.tx_coalesce_datalen) {
+		err_code = tx_coalesce_flush(client);
+		if (err_code < 0) {
+			return err_code;
+		}
+	}
+
+	for (size_t i = 0; i < message->msg_iovlen; i++) {
+		memcpy(client->internal.tx_coalesce +
+		       client->internal.tx_coalesce_datalen,
+		       message->msg_iov[i].iov_base,
+		       message->msg_iov[i].iov_len);
+		client->internal.tx_coalesce_datalen +=
+					message->msg_iov[i].iov_len;
+	}
+
+	client->internal.last_activity = mqtt_sys_tick_in_ms_get();
+	*coalesced = true;
+
+	return 0;
+}
+#endif /* CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0 */
+
 static int client_write(struct mqtt_client *client, const uint8_t *data,
 			uint32_t datalen)
 {
@@ -132,6 +251,25 @@ static int client_write(struct mqtt_client *client, const uint8_t *data,
 
 	NET_DBG("[%p]: Transport writing %d bytes.", client, datalen);
 
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	{
+		struct iovec io_vector = {
+			.iov_base = (void *)data,
+			.iov_len = datalen,
+		};
+		struct msghdr message = {
+			.msg_iov = &io_vector,
+			.msg_iovlen = 1,
+		};
+		bool coalesced;
+
+		err_code = tx_coalesce_append(client, &message, &coalesced);
+		if (err_code < 0 || coalesced) {
+			return err_code;
+		}
+	}
+#endif
+
 	err_code = mqtt_transport_write(client, data, datalen);
 	if (err_code < 0) {
 		NET_ERR("Transport write failed, err_code = %d, "
@@ -153,6 +291,17 @@ static int client_write_msg(struct mqtt_client *client,
 
 	NET_DBG("[%p]: Transport writing message.", client);
 
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	{
+		bool coalesced;
+
+		err_code = tx_coalesce_append(client, message, &coalesced);
+		if (err_code < 0 || coalesced) {
+			return err_code;
+		}
+	}
+#endif
+
 	err_code = mqtt_transport_write_msg(client, message);
 	if (err_code < 0) {
 		NET_ERR("Transport write failed, err_code = %d, "
@@ -276,6 +425,16 @@ int mqtt_publish(struct mqtt_client *client,
 	msg.msg_iov = io_vector;
 	msg.msg_iovlen = ARRAY_SIZE(io_vector);
 
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+	if (param->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+		err_code = qos1_inflight_register(client,
+						  param->message_id);
+		if (err_code < 0) {
+			goto error;
+		}
+	}
+#endif
+
 	err_code = client_write_msg(client, &msg);
 
 error:
@@ -464,6 +623,16 @@ int mqtt_disconnect(struct mqtt_client *client)
 		goto error;
 	}
 
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	/* The disconnect packet must reach the wire before the transport
+	 * goes down.
+	 */
+	err_code = tx_coalesce_flush(client);
+	if (err_code < 0) {
+		goto error;
+	}
+#endif
+
 	client_disconnect(client, 0, true);
 
 error:
@@ -609,6 +778,42 @@ int mqtt_live(struct mqtt_client *client)
 		ping_sent = true;
 	}
 
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+	for (int i = 0; i < ARRAY_SIZE(client->internal.qos1_inflight); i++) {
+		struct mqtt_evt evt = {
+			.type = MQTT_EVT_PUBACK_TIMEOUT,
+			.result = -ETIMEDOUT,
+		};
+
+		if (!client->internal.qos1_inflight[i].used ||
+		    mqtt_elapsed_time_in_ms_get(
+			client->internal.qos1_inflight[i].timestamp) <
+		    (CONFIG_MQTT_QOS1_RETRY_TIMEOUT * MSEC_PER_SEC)) {
+			continue;
+		}
+
+		/* Rearm the entry so the event repeats if the publish stays
+		 * unacknowledged after the application retried it.
+		 */
+		client->internal.qos1_inflight[i].timestamp =
+						mqtt_sys_tick_in_ms_get();
+
+		evt.param.puback.message_id =
+				client->internal.qos1_inflight[i].message_id;
+		event_notify(client, &evt);
+	}
+#endif
+
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	if (MQTT_HAS_STATE(client, MQTT_STATE_TCP_CONNECTED)) {
+		int flush_code = tx_coalesce_flush(client);
+
+		if (flush_code < 0 && ping_sent) {
+			err_code = flush_code;
+		}
+	}
+#endif
+
 	mqtt_mutex_unlock(client);
 
 	if (ping_sent) {
@@ -647,7 +852,15 @@ int mqtt_input(struct mqtt_client *client)
 	NET_DBG("state:0x%08x", client->internal.state);
 
 	if (MQTT_HAS_STATE(client, MQTT_STATE_TCP_CONNECTED)) {
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+		/* Get staged requests out before waiting for responses. */
+		err_code = tx_coalesce_flush(client);
+		if (err_code == 0) {
+			err_code = client_read(client);
+		}
+#else
 		err_code = client_read(client);
+#endif
 	} else {
 		err_code = -ENOTCONN;
 	}
@@ -657,6 +870,25 @@ int mqtt_input(struct mqtt_client *client)
 	return err_code;
 }
 
+int mqtt_flush(struct mqtt_client *client)
+{
+	int err_code = 0;
+
+	NULL_PARAM_CHECK(client);
+
+	mqtt_mutex_lock(client);
+
+#if defined(CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE) && (CONFIG_MQTT_TX_COALESCE_BUFFER_SIZE > 0)
+	if (MQTT_HAS_STATE(client, MQTT_STATE_TCP_CONNECTED)) {
+		err_code = tx_coalesce_flush(client);
+	}
+#endif
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
 static int read_publish_payload(struct mqtt_client *client, void *buffer,
 				size_t length, bool shall_block)
 {
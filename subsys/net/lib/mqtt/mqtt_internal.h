@@ -154,6 +154,15 @@ enum mqtt_state {
  */
 void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
 
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+/**@brief Release the in-flight window slot of an acknowledged QoS 1 publish.
+ *
+ * @param[in] client Identifies the client for which the PUBACK was received.
+ * @param[in] message_id Message ID carried in the PUBACK.
+ */
+void mqtt_qos1_inflight_clear(struct mqtt_client *client, uint16_t message_id);
+#endif
+
 /**@brief Handles MQTT messages received from the peer.
  *
  * @param[in] client Identifies the client for which the data was received.
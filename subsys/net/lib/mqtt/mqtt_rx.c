@@ -77,6 +77,13 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(buf, &evt.param.puback);
 		evt.result = err_code;
+
+#if defined(CONFIG_MQTT_QOS1_INFLIGHT_WINDOW) && (CONFIG_MQTT_QOS1_INFLIGHT_WINDOW > 0)
+		if (err_code == 0) {
+			mqtt_qos1_inflight_clear(client,
+						 evt.param.puback.message_id);
+		}
+#endif
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -21,6 +21,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_collector, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+static const void *resolve_metric_entry(const struct prometheus_metric *metric);
+
 int prometheus_collector_register_metric(struct prometheus_collector *collector,
 					 struct prometheus_metric *metric)
 {
@@ -34,6 +36,11 @@ int prometheus_collector_register_metric(struct prometheus_collector *collector,
 	for (int i = 0; i < CONFIG_PROMETHEUS_MAX_METRICS; i++) {
 		if (!collector->metric[i]) {
 			collector->metric[i] = metric;
+			/* Resolve the metric value entry once here so that
+			 * scrapes do not search the metric sections by name
+			 * for every metric.
+			 */
+			collector->entry[i] = resolve_metric_entry(metric);
 			collector->size++;
 			return 0;
 		}
@@ -106,40 +113,35 @@ const struct prometheus_summary *prometheus_get_summary_metric(const char *name)
 	return NULL;
 }
 
+static const void *resolve_metric_entry(const struct prometheus_metric *metric)
+{
+	switch (metric->type) {
+	case PROMETHEUS_COUNTER:
+		return prometheus_get_counter_metric(metric->name);
+	case PROMETHEUS_GAUGE:
+		return prometheus_get_gauge_metric(metric->name);
+	case PROMETHEUS_HISTOGRAM:
+		return prometheus_get_histogram_metric(metric->name);
+	case PROMETHEUS_SUMMARY:
+		return prometheus_get_summary_metric(metric->name);
+	default:
+		LOG_ERR("Invalid metric type");
+		return NULL;
+	}
+}
+
 const void *prometheus_collector_get_metric(const struct prometheus_collector *collector,
 					    const char *name)
 {
-	bool is_found = false;
-	enum prometheus_metric_type type = 0;
-
 	for (size_t i = 0; i < collector->size; ++i) {
 		if (strncmp(collector->metric[i]->name, name, sizeof(collector->metric[i]->name)) ==
 		    0) {
-			type = collector->metric[i]->type;
-			is_found = true;
-
 			LOG_DBG("metric found: %s", collector->metric[i]->name);
+			return collector->entry[i];
 		}
 	}
 
-	if (!is_found) {
-		LOG_ERR("Metric not found");
-		return NULL;
-	}
-
-	switch (type) {
-	case PROMETHEUS_COUNTER:
-		return prometheus_get_counter_metric(name);
-	case PROMETHEUS_GAUGE:
-		return prometheus_get_gauge_metric(name);
-	case PROMETHEUS_HISTOGRAM:
-		return prometheus_get_histogram_metric(name);
-	case PROMETHEUS_SUMMARY:
-		return prometheus_get_summary_metric(name);
-	default:
-		LOG_ERR("Invalid metric type");
-		return NULL;
-	}
+	LOG_ERR("Metric not found");
 
 	return NULL;
 }
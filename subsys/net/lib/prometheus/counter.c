@@ -14,15 +14,47 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pm_counter, CONFIG_PROMETHEUS_LOG_LEVEL);
 
+static inline atomic_t *counter_shard(struct prometheus_counter *counter)
+{
+#if defined(CONFIG_SMP)
+	/* Migration between reading the CPU id and the atomic add is
+	 * harmless, the increment just lands in another CPU's shard.
+	 */
+	return &counter->shard[arch_curr_cpu()->id];
+#else
+	return &counter->shard[0];
+#endif
+}
+
 int prometheus_counter_inc(struct prometheus_counter *counter)
+{
+	return prometheus_counter_add(counter, 1U);
+}
+
+int prometheus_counter_add(struct prometheus_counter *counter, uint32_t value)
 {
 	if (!counter) {
 		return -EINVAL;
 	}
 
-	if (counter) {
-		counter->value++;
-	}
+	atomic_add(counter_shard(counter), (atomic_val_t)value);
 
 	return 0;
 }
+
+uint64_t prometheus_counter_value(struct prometheus_counter *counter)
+{
+	if (!counter) {
+		return 0U;
+	}
+
+	/* Fold the shards into the 64-bit value. Each shard is cleared
+	 * atomically, so increments racing with the fold are counted
+	 * either here or on the next read, never twice.
+	 */
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		counter->value += (uint32_t)atomic_clear(&counter->shard[i]);
+	}
+
+	return counter->value;
+}
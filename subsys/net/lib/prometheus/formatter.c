@@ -122,14 +122,19 @@ int prometheus_format_exposition(const struct prometheus_collector *collector, c
 			const struct prometheus_counter *counter =
 				(const struct prometheus_counter *)prometheus_collector_get_metric(
 					collector, metric->name);
+			/* Fold the per-CPU shards once so that every label
+			 * line of the sample reports the same value.
+			 */
+			uint64_t value =
+				prometheus_counter_value((struct prometheus_counter *)counter);
 
-			LOG_DBG("counter->value: %llu", counter->value);
+			LOG_DBG("counter->value: %llu", value);
 
 			for (int i = 0; i < metric->num_labels; ++i) {
 				ret = write_metric_to_buffer(
 					buffer + written, buffer_size - written,
 					"%s{%s=\"%s\"} %llu\n", metric->name, metric->labels[i].key,
-					metric->labels[i].value, counter->value);
+					metric->labels[i].value, value);
 				if (ret < 0) {
 					LOG_ERR("Error writing counter");
 					return ret;
@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(ptp_clock, CONFIG_PTP_LOG_LEVEL);
 #include "ddt.h"
 #include "msg.h"
 #include "port.h"
+#include "servo.h"
 #include "tlv.h"
 #include "transport.h"
 
@@ -507,8 +508,19 @@ int ptp_clock_management_msg_process(struct ptp_port *port, struct ptp_msg *msg)
 }
 
 void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
+{
+	/* Only record the sample, the servo math and the clock update
+	 * run later in the PTP thread, see ptp_clock_servo_update().
+	 * This keeps the function callable from the timestamp delivery
+	 * context, including ISRs.
+	 */
+	ptp_servo_ts_offer(ingress, egress);
+}
+
+static void clock_synchronize(uint64_t ingress, uint64_t egress)
 {
 	int64_t offset;
+	int64_t ppb;
 	uint64_t delay = ptp_clk.current_ds.mean_delay >> 16;
 
 	ptp_clk.timestamp.t1 = egress;
@@ -543,13 +555,32 @@ void ptp_clock_synchronize(uint64_t ingress, uint64_t egress)
 		current.nanosecond = (uint32_t)dest_nsec;
 
 		ptp_clock_set(ptp_clk.phc, &current);
+
+		/* The drift estimate is based on offsets measured
+		 * before the step and is no longer valid.
+		 */
+		ptp_servo_reset();
 		return;
 	}
 
 	LOG_DBG("Offset %lldns", offset);
 	ptp_clk.current_ds.offset_from_tt = clock_ns_to_timeinterval(offset);
 
-	ptp_clock_adjust(ptp_clk.phc, -offset);
+	ppb = ptp_servo_sample(offset);
+
+	/* The servo itself is fixed-point, only the conversion to the
+	 * frequency ratio of the driver API uses floating point.
+	 */
+	ptp_clock_rate_adjust(ptp_clk.phc, 1.0 - ((double)ppb / 1e9));
+}
+
+void ptp_clock_servo_update(void)
+{
+	struct ptp_servo_ts_sample sample;
+
+	while (ptp_servo_ts_fetch(&sample)) {
+		clock_synchronize(sample.ingress, sample.egress);
+	}
 }
 
 void ptp_clock_delay(uint64_t egress, uint64_t ingress)
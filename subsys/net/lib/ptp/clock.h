@@ -111,13 +111,25 @@ void ptp_clock_handle_state_decision_evt(void);
 int ptp_clock_management_msg_process(struct ptp_port *port, struct ptp_msg *msg);
 
 /**
- * @brief Function synchronizing local PTP Hardware Clock to the remote.
+ * @brief Function recording a synchronization timestamp sample.
+ *
+ * The sample is buffered and applied to the PTP Hardware Clock by the
+ * PTP thread, see ptp_clock_servo_update(). The function may be called
+ * from any context, including interrupt handlers.
  *
  * @param[in] ingress Timestamp of the message reception from the remote node in nanoseconds.
  * @param[in] egress  Timestamp of the message transmission to the local node in nanoseconds.
  */
 void ptp_clock_synchronize(uint64_t ingress, uint64_t egress);
 
+/**
+ * @brief Function synchronizing local PTP Hardware Clock to the remote.
+ *
+ * Processes all buffered synchronization timestamp samples through the
+ * clock servo. Called only from the PTP thread.
+ */
+void ptp_clock_servo_update(void);
+
 /**
  * @brief Function updating PTP Clock path delay.
  *
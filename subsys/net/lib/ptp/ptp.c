@@ -85,6 +85,8 @@ static void ptp_thread(void *p1, void *p2, void *p3)
 			}
 		}
 
+		ptp_clock_servo_update();
+
 		ptp_clock_handle_state_decision_evt();
 	}
 }
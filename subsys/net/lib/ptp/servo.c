@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(ptp_servo, CONFIG_PTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#include "servo.h"
+
+/* Fractional bits of the integral (drift) accumulator. */
+#define SERVO_FRAC_BITS 16
+
+/* Largest frequency correction the servo will request, in ppb. */
+#define SERVO_MAX_PPB 100000000LL
+
+/* Must be a power of two, see the index arithmetic below. */
+#define TS_BUF_SIZE 8
+
+struct ts_slot {
+	struct ptp_servo_ts_sample sample;
+	/* Claim index + 1, written after the sample. Zero means empty. */
+	atomic_val_t seq;
+};
+
+static struct ts_slot ts_buf[TS_BUF_SIZE];
+static atomic_t ts_head;
+static uint32_t ts_tail;
+
+/* Integral term, in ppb scaled by 2^SERVO_FRAC_BITS. */
+static int64_t servo_drift;
+
+void ptp_servo_ts_offer(uint64_t ingress, uint64_t egress)
+{
+	/* Claim a slot with an atomic increment so that producers in
+	 * any context, including ISRs, never take a lock. A producer
+	 * lapping the consumer simply overwrites the oldest sample,
+	 * which is the preferred loss policy for servo input.
+	 */
+	atomic_val_t claim = atomic_inc(&ts_head);
+	struct ts_slot *slot = &ts_buf[claim & (TS_BUF_SIZE - 1)];
+
+	slot->sample.ingress = ingress;
+	slot->sample.egress = egress;
+
+	/* Publish after the sample is fully written. */
+	atomic_set(&slot->seq, claim + 1);
+}
+
+bool ptp_servo_ts_fetch(struct ptp_servo_ts_sample *sample)
+{
+	atomic_val_t head = atomic_get(&ts_head);
+
+	if (ts_tail == (uint32_t)head) {
+		return false;
+	}
+
+	/* If producers have lapped us, skip to the oldest slot that
+	 * still holds a coherent sample.
+	 */
+	if ((uint32_t)head - ts_tail > TS_BUF_SIZE) {
+		ts_tail = (uint32_t)head - TS_BUF_SIZE;
+	}
+
+	struct ts_slot *slot = &ts_buf[ts_tail & (TS_BUF_SIZE - 1)];
+
+	if ((uint32_t)atomic_get(&slot->seq) != ts_tail + 1) {
+		/* Slot claimed but not yet published, try again later. */
+		return false;
+	}
+
+	*sample = slot->sample;
+
+	/* Re-check that a producer did not overwrite the slot while
+	 * we were copying it out.
+	 */
+	if ((uint32_t)atomic_get(&slot->seq) != ts_tail + 1) {
+		ts_tail++;
+		return false;
+	}
+
+	ts_tail++;
+	return true;
+}
+
+int64_t ptp_servo_sample(int64_t offset)
+{
+	int64_t ppb;
+
+	/* Integral term: drift += offset * ki, proportional term:
+	 * offset * kp, with the gains expressed as right shifts so
+	 * that the whole filter stays in integer arithmetic.
+	 */
+	servo_drift += (offset << SERVO_FRAC_BITS) >> CONFIG_PTP_SERVO_KI_SHIFT;
+	servo_drift = CLAMP(servo_drift,
+			    -(SERVO_MAX_PPB << SERVO_FRAC_BITS),
+			    SERVO_MAX_PPB << SERVO_FRAC_BITS);
+
+	ppb = (offset >> CONFIG_PTP_SERVO_KP_SHIFT) +
+	      (servo_drift >> SERVO_FRAC_BITS);
+
+	return CLAMP(ppb, -SERVO_MAX_PPB, SERVO_MAX_PPB);
+}
+
+void ptp_servo_reset(void)
+{
+	servo_drift = 0;
+}
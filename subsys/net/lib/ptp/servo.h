@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file servo.h
+ * @brief Fixed-point PI clock servo and timestamp sample buffer
+ *
+ * References are to version 2019 of IEEE 1588, ("PTP")
+ */
+
+#ifndef ZEPHYR_INCLUDE_PTP_SERVO_H_
+#define ZEPHYR_INCLUDE_PTP_SERVO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Synchronization timestamp sample.
+ */
+struct ptp_servo_ts_sample {
+	/** Sync message ingress timestamp in nanoseconds. */
+	uint64_t ingress;
+	/** Corrected Sync message egress timestamp in nanoseconds. */
+	uint64_t egress;
+};
+
+/**
+ * @brief Function offering a timestamp sample to the clock servo.
+ *
+ * The sample is stored in a lock-free ring buffer and consumed later
+ * by the PTP thread. The function is safe to call from any context,
+ * including interrupt handlers delivering hardware timestamps.
+ * If the buffer is full the oldest sample is overwritten.
+ *
+ * @param[in] ingress Sync message ingress timestamp in nanoseconds.
+ * @param[in] egress  Corrected Sync message egress timestamp in nanoseconds.
+ */
+void ptp_servo_ts_offer(uint64_t ingress, uint64_t egress);
+
+/**
+ * @brief Function fetching the oldest unprocessed timestamp sample.
+ *
+ * Called only from the PTP thread.
+ *
+ * @param[out] sample Destination for the fetched sample.
+ *
+ * @return True if a sample was fetched, false if the buffer was empty.
+ */
+bool ptp_servo_ts_fetch(struct ptp_servo_ts_sample *sample);
+
+/**
+ * @brief Function feeding a measured offset into the PI servo.
+ *
+ * All filtering is done in integer arithmetic, the integral term is
+ * accumulated with 16 fractional bits so that small offsets are not
+ * lost to truncation.
+ *
+ * @param[in] offset Measured offset from the time transmitter in nanoseconds.
+ *
+ * @return Frequency correction in parts per billion to be applied
+ * to the local clock.
+ */
+int64_t ptp_servo_sample(int64_t offset);
+
+/**
+ * @brief Function resetting the servo state.
+ *
+ * Called after the local clock has been stepped, since the accumulated
+ * drift estimate is based on offsets measured before the step.
+ */
+void ptp_servo_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PTP_SERVO_H_ */
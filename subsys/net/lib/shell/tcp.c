@@ -12,6 +12,10 @@ LOG_MODULE_DECLARE(net_shell);
 
 #include "net_shell_private.h"
 
+#if defined(CONFIG_NET_TCP)
+#include "tcp_internal.h"
+#endif
+
 #if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP)
 static struct net_context *tcp_ctx;
 static const struct shell *tcp_shell;
@@ -389,6 +393,56 @@ static int cmd_net_tcp_close(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP)
+static void tcp_info_cb(struct tcp *conn, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *sh = data->sh;
+	int *count = data->user_data;
+	struct net_tcp_conn_info info;
+
+	if (net_tcp_conn_info(conn, &info) < 0) {
+		return;
+	}
+
+	PR("%p %-12s %5u %7u %8u %8u %5u %6u %7zu %7d %s\n",
+	   conn, net_tcp_state_str(info.state), info.rto, info.total_retrans,
+	   info.send_win, info.recv_win, info.cwnd, info.ssthresh,
+	   info.send_queue_len, info.unacked_len,
+	   info.in_retransmission ? "yes" : "no");
+
+	(*count)++;
+}
+#endif
+
+static int cmd_net_tcp_info(const struct shell *sh, size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_TCP) && defined(CONFIG_NET_NATIVE_TCP)
+	struct net_shell_user_data user_data;
+	int count = 0;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR("TCP        State          RTO Retrans Send-win Recv-win  Cwnd "
+	   "Ssthr  Queued Unacked Resending\n");
+
+	user_data.sh = sh;
+	user_data.user_data = &count;
+
+	net_tcp_foreach(tcp_info_cb, &user_data);
+
+	if (count == 0) {
+		PR("No TCP connections\n");
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_TCP and CONFIG_NET_NATIVE", "TCP");
+#endif /* CONFIG_NET_NATIVE_TCP */
+
+	return 0;
+}
+
 static int cmd_net_tcp(const struct shell *sh, size_t argc, char *argv[])
 {
 	ARG_UNUSED(argc);
@@ -409,6 +463,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_tcp,
 		  cmd_net_tcp_recv),
 	SHELL_CMD(close, NULL,
 		  "'net tcp close' closes TCP connection.", cmd_net_tcp_close),
+	SHELL_CMD(info, NULL,
+		  "'net tcp info' prints RTO, retransmit and window state of "
+		  "TCP connections.",
+		  cmd_net_tcp_info),
 	SHELL_SUBCMD_SET_END
 );
 
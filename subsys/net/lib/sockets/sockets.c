@@ -710,6 +710,271 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	unsigned int i;
+	int ret = 0;
+
+	if (msgvec == NULL && vlen > 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len = vtable->sendmsg(obj, &msgvec[i].msg_hdr, flags);
+
+		if (len < 0) {
+			/* Report the error only if nothing was sent yet */
+			if (i == 0) {
+				ret = -1;
+			}
+
+			break;
+		}
+
+		msgvec[i].msg_len = len;
+		ret = i + 1;
+
+		sock_obj_core_update_send_stats(sock, len);
+	}
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+	int ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen,
+					    sizeof(struct mmsghdr)));
+
+	/* The per-message verification and deep copy is done by the
+	 * single message handler, so the socket is resolved per message
+	 * here. Kernel mode callers get the batched path.
+	 */
+	for (i = 0; i < vlen; i++) {
+		unsigned int msg_len;
+		ssize_t len;
+
+		len = z_vrfy_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (len < 0) {
+			if (i == 0) {
+				ret = -1;
+			}
+
+			break;
+		}
+
+		msg_len = len;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msg_len,
+					  sizeof(msg_len)));
+		ret = i + 1;
+	}
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	unsigned int i;
+	int ret = 0;
+
+	if (msgvec == NULL && vlen > 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		ssize_t len;
+
+		/* Only the first message may block, the rest of the batch
+		 * just drains what is already queued.
+		 */
+		len = vtable->recvmsg(obj, &msgvec[i].msg_hdr,
+				      i == 0 ? flags :
+					       flags | ZSOCK_MSG_DONTWAIT);
+		if (len < 0) {
+			/* Report the error only if nothing was received yet */
+			if (i == 0) {
+				ret = -1;
+			}
+
+			break;
+		}
+
+		msgvec[i].msg_len = len;
+		ret = i + 1;
+
+		sock_obj_core_update_recv_stats(sock, len);
+	}
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+	int ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen,
+					    sizeof(struct mmsghdr)));
+
+	/* The per-message verification and deep copy is done by the
+	 * single message handler, so the socket is resolved per message
+	 * here. Kernel mode callers get the batched path.
+	 */
+	for (i = 0; i < vlen; i++) {
+		unsigned int msg_len;
+		ssize_t len;
+
+		len = z_vrfy_zsock_recvmsg(sock, &msgvec[i].msg_hdr,
+					   i == 0 ? flags :
+						    flags | ZSOCK_MSG_DONTWAIT);
+		if (len < 0) {
+			if (i == 0) {
+				ret = -1;
+			}
+
+			break;
+		}
+
+		msg_len = len;
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &msg_len,
+					  sizeof(msg_len)));
+		ret = i + 1;
+	}
+
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_BUF_LOAN)
+ssize_t zsock_recv_buf_loan(int sock, struct net_buf **buf, int flags,
+			    struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	ssize_t ret;
+
+	if (buf == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	/* Only plain native sockets can hand out their buffers, anything
+	 * stacked on top (TLS, offloaded sockets) owns the data
+	 * representation itself.
+	 */
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_recv_buf_loan_ctx(obj, buf, flags, src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_BUF_LOAN */
+
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+ssize_t zsock_send_nocopy(int sock, const void *buf, size_t len)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	ssize_t ret;
+
+	if (buf == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	/* Only plain native sockets can queue caller owned data as is,
+	 * anything stacked on top (TLS, offloaded sockets) transforms or
+	 * owns the data representation itself.
+	 */
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_send_nocopy_ctx(obj, buf, len);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_send_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -650,6 +650,56 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	return status;
 }
 
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+ssize_t zsock_send_nocopy_ctx(struct net_context *ctx, const void *buf,
+			      size_t len)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if (sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	while (1) {
+		status = net_context_send_nocopy(ctx, buf, len);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_TCP_NOCOPY_SEND */
+
 ssize_t zsock_sendmsg_ctx(struct net_context *ctx, const struct msghdr *msg,
 			  int flags)
 {
@@ -1239,6 +1289,115 @@ fail:
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_BUF_LOAN)
+ssize_t zsock_recv_buf_loan_ctx(struct net_context *ctx, struct net_buf **buf,
+				int flags, struct sockaddr *src_addr,
+				socklen_t *addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t headroom;
+	size_t recv_len;
+
+	if (net_context_get_type(ctx) != SOCK_DGRAM ||
+	    (flags & ZSOCK_MSG_PEEK)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		int ret;
+
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (src_addr && addrlen) {
+		int ret;
+
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			errno = -ret;
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			net_pkt_unref(pkt);
+			return -1;
+		}
+
+		if (src_addr->sa_family == AF_INET) {
+			*addrlen = sizeof(struct sockaddr_in);
+		} else if (src_addr->sa_family == AF_INET6) {
+			*addrlen = sizeof(struct sockaddr_in6);
+		} else {
+			errno = ENOTSUP;
+			net_pkt_unref(pkt);
+			return -1;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	/* Strip the already parsed protocol headers so that the loaned
+	 * chain starts at the application data the cursor points to.
+	 */
+	headroom = net_pkt_get_len(pkt) - net_pkt_remaining_data(pkt);
+
+	while (pkt->buffer != NULL && headroom >= pkt->buffer->len) {
+		struct net_buf *frag = pkt->buffer;
+
+		headroom -= frag->len;
+		pkt->buffer = frag->frags;
+		frag->frags = NULL;
+		net_buf_unref(frag);
+	}
+
+	if (pkt->buffer != NULL && headroom > 0) {
+		net_buf_pull(pkt->buffer, headroom);
+	}
+
+	/* Hand the fragment chain over to the caller and release the
+	 * packet meta data, the chain is returned via net_buf_unref()
+	 * in zsock_recv_buf_return().
+	 */
+	*buf = pkt->buffer;
+	recv_len = (*buf != NULL) ? net_buf_frags_len(*buf) : 0;
+
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	return recv_len;
+}
+
+void zsock_recv_buf_return(struct net_buf *buf)
+{
+	if (buf != NULL) {
+		net_buf_unref(buf);
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_BUF_LOAN */
+
 static size_t zsock_recv_stream_immediate(struct net_context *ctx, uint8_t **buf, size_t *max_len,
 					  int flags)
 {
@@ -79,6 +79,19 @@ struct socket_op_vtable {
 
 size_t msghdr_non_empty_iov_count(const struct msghdr *msg);
 
+extern const struct socket_op_vtable sock_fd_op_vtable;
+
+#if defined(CONFIG_NET_SOCKETS_BUF_LOAN)
+ssize_t zsock_recv_buf_loan_ctx(struct net_context *ctx, struct net_buf **buf,
+				int flags, struct sockaddr *src_addr,
+				socklen_t *addrlen);
+#endif
+
+#if defined(CONFIG_NET_TCP_NOCOPY_SEND)
+ssize_t zsock_send_nocopy_ctx(struct net_context *ctx, const void *buf,
+			      size_t len);
+#endif
+
 #if defined(CONFIG_NET_SOCKETS_OBJ_CORE)
 int sock_obj_core_alloc(int sock, struct net_socket_register *reg,
 			int family, int type, int proto);
@@ -98,81 +98,71 @@ out:
 	return ret;
 }
 
-static struct net_socket_service_desc *find_svc_and_event(
-	struct zsock_pollfd *pev,
-	struct net_socket_service_event **event)
-{
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int i = 0; i < svc->pev_len; i++) {
-			if (svc->pev[i].event.fd == pev->fd) {
-				*event = &svc->pev[i];
-				return svc;
-			}
-		}
-	}
-
-	return NULL;
-}
-
-/* We do not set the user callback to our work struct because we need to
- * hook into the flow and restore the global poll array so that the next poll
- * round will not notice it and call the callback again while we are
- * servicing the callback.
+/* Dispatch all ready events of one service in a single pass. The service
+ * descriptors and the global poll array share the same contiguous layout,
+ * so the ready entries are found with simple indexing instead of searching
+ * the whole registry for each triggered fd.
+ *
+ * All triggered events of the service are snapshot and marked non pollable
+ * in the global array before any user callback runs, so that the next poll
+ * round will not notice them and call the callbacks again while we are
+ * servicing them. The global entries are restored from the service once
+ * the callbacks have returned.
  */
-void net_socket_service_callback(struct net_socket_service_event *pev)
+static void dispatch_svc(struct net_socket_service_desc *svc, int *remaining)
 {
-	struct net_socket_service_desc *svc = pev->svc;
-	struct net_socket_service_event ev = *pev;
-
-	ev.callback(&ev);
+	struct net_socket_service_event *ready[CONFIG_ZVFS_POLL_MAX];
+	int nready = 0;
 
-	/* Copy back the socket fd to the global array because we marked
-	 * it as -1 when triggering the work.
-	 */
-	for (int i = 0; i < svc->pev_len; i++) {
-		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
-	}
-}
+	for (int i = 0; i < svc->pev_len && *remaining > 0; i++) {
+		struct zsock_pollfd *pfd = &ctx.events[get_idx(svc) + i];
 
-static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *event)
-{
-	int ret = 0;
+		if (pfd->fd < 0 || pfd->revents == 0) {
+			continue;
+		}
 
-	/* Mark the global fd non pollable so that we do not
-	 * call the callback second time.
-	 */
-	pev->fd = -1;
+		(*remaining)--;
 
-	/* Synchronous call */
-	net_socket_service_callback(event);
+		svc->pev[i].svc = svc;
 
-	return ret;
+		/* Copy the triggered event to our event so that we know
+		 * what was actually causing the event.
+		 */
+		svc->pev[i].event = *pfd;
 
-}
+		/* Mark the global fd non pollable so that we do not
+		 * call the callback second time.
+		 */
+		pfd->fd = -1;
 
-static int trigger_work(struct zsock_pollfd *pev)
-{
-	struct net_socket_service_event *event;
-	struct net_socket_service_desc *svc;
+		ready[nready++] = &svc->pev[i];
+	}
 
-	svc = find_svc_and_event(pev, &event);
-	if (svc == NULL) {
-		return -ENOENT;
+	if (nready == 0) {
+		return;
 	}
 
-	event->svc = svc;
+	if (svc->batch != NULL) {
+		svc->batch(ready, nready);
+	} else {
+		for (int i = 0; i < nready; i++) {
+			struct net_socket_service_event ev = *ready[i];
 
-	/* Copy the triggered event to our event so that we know what
-	 * was actually causing the event.
-	 */
-	event->event = *pev;
+			ev.callback(&ev);
+		}
+	}
 
-	return call_work(pev, event);
+	/* Copy back the socket fds to the global array because we marked
+	 * them as -1 when triggering the callbacks.
+	 */
+	for (int i = 0; i < svc->pev_len; i++) {
+		ctx.events[get_idx(svc) + i] = svc->pev[i].event;
+	}
 }
 
 static void socket_service_thread(void)
 {
-	int ret, i, fd, count = 0;
+	int ret, fd, count = 0;
 	zvfs_eventfd_t value;
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
@@ -219,8 +209,6 @@ static void socket_service_thread(void)
 	ctx.events[0].events = ZSOCK_POLLIN;
 
 restart:
-	i = 1;
-
 	k_mutex_lock(&lock, K_FOREVER);
 
 	/* Copy individual events to the big array */
@@ -251,17 +239,12 @@ restart:
 			goto restart;
 		}
 
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
+		STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
+			if (ret <= 0) {
+				break;
 			}
 
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
-				}
-			}
+			dispatch_svc(svc, &ret);
 		}
 	}
 
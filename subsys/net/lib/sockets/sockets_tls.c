@@ -47,6 +47,10 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_TICKETS) && \
+	defined(MBEDTLS_SSL_SESSION_TICKETS)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -143,6 +147,11 @@ __net_socket struct tls_context {
 	/** Session ended at the TLS/DTLS level. */
 	bool session_closed : 1;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_DTLS_RX_LOAN)
+	/** Transport socket refused buffer loan, use the copy RX path. */
+	bool rx_loan_unsupported : 1;
+#endif
+
 	/** Socket type. */
 	enum net_sock_type type;
 
@@ -254,6 +263,12 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_TICKETS) && \
+	defined(MBEDTLS_SSL_SESSION_TICKETS)
+static mbedtls_ssl_ticket_context ticket_ctx;
+static bool ticket_ctx_ready;
+#endif
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -371,6 +386,25 @@ static int tls_init(void)
 
 #if defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_init(&server_cache);
+	mbedtls_ssl_cache_set_max_entries(
+		&server_cache, CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_COUNT);
+	mbedtls_ssl_cache_set_timeout(
+		&server_cache, CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TIMEOUT);
+#endif
+
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_TICKETS) && \
+	defined(MBEDTLS_SSL_SESSION_TICKETS)
+	mbedtls_ssl_ticket_init(&ticket_ctx);
+
+	if (mbedtls_ssl_ticket_setup(
+		    &ticket_ctx, tls_ctr_drbg_random, NULL,
+		    MBEDTLS_CIPHER_AES_256_GCM,
+		    CONFIG_NET_SOCKETS_TLS_SERVER_SESSION_TIMEOUT) == 0) {
+		ticket_ctx_ready = true;
+	} else {
+		NET_ERR("Failed to set up session ticket keys, "
+			"tickets will not be issued.");
+	}
 #endif
 
 	return 0;
@@ -869,6 +903,41 @@ static int dtls_tx(void *ctx, const unsigned char *buf, size_t len)
 	return sent;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_DTLS_RX_LOAN)
+static ssize_t dtls_rx_loan(struct tls_context *tls_ctx, unsigned char *buf,
+			    size_t len, struct sockaddr *addr,
+			    socklen_t *addrlen)
+{
+	struct net_buf *chain, *frag;
+	ssize_t received;
+	size_t limit, copied = 0;
+
+	received = zsock_recv_buf_loan(tls_ctx->sock, &chain,
+				       ZSOCK_MSG_DONTWAIT, addr, addrlen);
+	if (received < 0) {
+		return received;
+	}
+
+	/* Linearize the loaned chain straight into the mbedTLS record
+	 * buffer; this is the only copy on the RX path, mbedTLS decrypts
+	 * the record in place there. Oversized datagrams are truncated,
+	 * just like on the zsock_recvfrom() path.
+	 */
+	limit = MIN((size_t)received, len);
+	for (frag = chain; frag != NULL && copied < limit;
+	     frag = frag->frags) {
+		size_t chunk = MIN(frag->len, limit - copied);
+
+		memcpy(buf + copied, frag->data, chunk);
+		copied += chunk;
+	}
+
+	zsock_recv_buf_return(chain);
+
+	return copied;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_DTLS_RX_LOAN */
+
 static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 {
 	struct tls_context *tls_ctx = ctx;
@@ -877,8 +946,25 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len)
 	int err;
 	ssize_t received;
 
-	received = zsock_recvfrom(tls_ctx->sock, buf, len,
-				  ZSOCK_MSG_DONTWAIT, &addr, &addrlen);
+#if defined(CONFIG_NET_SOCKETS_TLS_DTLS_RX_LOAN)
+	if (!tls_ctx->rx_loan_unsupported) {
+		received = dtls_rx_loan(tls_ctx, buf, len, &addr, &addrlen);
+		if (received < 0 && errno == EOPNOTSUPP) {
+			/* Transport cannot loan buffers (offloaded or
+			 * non-native socket), use the copy path from now on.
+			 */
+			tls_ctx->rx_loan_unsupported = true;
+			received = zsock_recvfrom(tls_ctx->sock, buf, len,
+						  ZSOCK_MSG_DONTWAIT,
+						  &addr, &addrlen);
+		}
+	} else
+#endif /* CONFIG_NET_SOCKETS_TLS_DTLS_RX_LOAN */
+	{
+		received = zsock_recvfrom(tls_ctx->sock, buf, len,
+					  ZSOCK_MSG_DONTWAIT, &addr, &addrlen);
+	}
+
 	if (received < 0) {
 		if (errno == EAGAIN) {
 			return MBEDTLS_ERR_SSL_WANT_READ;
@@ -1421,6 +1507,16 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(CONFIG_NET_SOCKETS_TLS_SESSION_TICKETS) && \
+	defined(MBEDTLS_SSL_SESSION_TICKETS)
+	if (is_server && context->options.cache_enabled && ticket_ctx_ready) {
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &ticket_ctx);
+	}
+#endif
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 	mbedtls_ssl_conf_early_data(&context->config, MBEDTLS_SSL_EARLY_DATA_ENABLED);
 #endif
@@ -44,9 +44,13 @@ struct sockaddr_in *zperf_get_sin(void)
 #define ZPERF_WORK_Q_THREAD_PRIORITY                                                               \
 	CLAMP(CONFIG_ZPERF_WORK_Q_THREAD_PRIORITY, K_HIGHEST_APPLICATION_THREAD_PRIO,              \
 	      K_LOWEST_APPLICATION_THREAD_PRIO)
-K_THREAD_STACK_DEFINE(zperf_work_q_stack, CONFIG_ZPERF_WORK_Q_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(zperf_work_q_stack, CONFIG_NET_ZPERF_ASYNC_STREAMS,
+			    CONFIG_ZPERF_WORK_Q_STACK_SIZE);
 
-static struct k_work_q zperf_work_q;
+/* One work queue per asynchronous upload stream, as the upload work
+ * items block for the whole test duration.
+ */
+static struct k_work_q zperf_work_q[CONFIG_NET_ZPERF_ASYNC_STREAMS];
 
 int zperf_get_ipv6_addr(char *host, char *prefix_str, struct in6_addr *addr)
 {
@@ -220,19 +224,21 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
-void zperf_async_work_submit(struct k_work *work)
+void zperf_async_work_submit(uint8_t stream, struct k_work *work)
 {
-	k_work_submit_to_queue(&zperf_work_q, work);
+	k_work_submit_to_queue(&zperf_work_q[stream % CONFIG_NET_ZPERF_ASYNC_STREAMS],
+			       work);
 }
 
 static int zperf_init(void)
 {
-
-	k_work_queue_init(&zperf_work_q);
-	k_work_queue_start(&zperf_work_q, zperf_work_q_stack,
-			   K_THREAD_STACK_SIZEOF(zperf_work_q_stack), ZPERF_WORK_Q_THREAD_PRIORITY,
-			   NULL);
-	k_thread_name_set(&zperf_work_q.thread, "zperf_work_q");
+	for (int i = 0; i < CONFIG_NET_ZPERF_ASYNC_STREAMS; i++) {
+		k_work_queue_init(&zperf_work_q[i]);
+		k_work_queue_start(&zperf_work_q[i], zperf_work_q_stack[i],
+				   K_THREAD_STACK_SIZEOF(zperf_work_q_stack[i]),
+				   ZPERF_WORK_Q_THREAD_PRIORITY, NULL);
+		k_thread_name_set(&zperf_work_q[i].thread, "zperf_work_q");
+	}
 
 	zperf_udp_uploader_init();
 	zperf_tcp_uploader_init();
@@ -86,6 +86,78 @@ struct session *get_session(const struct sockaddr *addr,
 	return active;
 }
 
+struct session *get_session_by_index(enum session_proto proto, int index)
+{
+	if (proto >= SESSION_PROTO_END || index < 0 || index >= SESSION_MAX) {
+		return NULL;
+	}
+
+	return &sessions[proto][index];
+}
+
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+void zperf_session_latency_record(struct session *session, uint32_t latency_us)
+{
+	uint32_t group, sub;
+
+	if (latency_us < LATENCY_HIST_SUBS) {
+		group = 0U;
+		sub = latency_us;
+	} else {
+		uint32_t msb = find_msb_set(latency_us) - 1;
+
+		group = msb - LATENCY_HIST_SUBS_SHIFT + 1;
+		if (group >= LATENCY_HIST_GROUPS) {
+			/* Clamp outliers into the last bucket */
+			group = LATENCY_HIST_GROUPS - 1;
+			sub = LATENCY_HIST_SUBS - 1;
+		} else {
+			sub = (latency_us >> (msb - LATENCY_HIST_SUBS_SHIFT)) &
+			      (LATENCY_HIST_SUBS - 1);
+		}
+	}
+
+	session->latency_hist[group][sub]++;
+	session->latency_count++;
+	session->latency_sum += latency_us;
+	session->latency_min = MIN(session->latency_min, latency_us);
+	session->latency_max = MAX(session->latency_max, latency_us);
+}
+
+uint32_t zperf_session_latency_percentile(const struct session *session,
+					  uint32_t percentile_x10)
+{
+	uint64_t rank;
+	uint64_t cumulative = 0U;
+
+	if (session->latency_count == 0U) {
+		return 0U;
+	}
+
+	rank = DIV_ROUND_UP((uint64_t)session->latency_count * percentile_x10,
+			    1000U);
+
+	for (uint32_t group = 0U; group < LATENCY_HIST_GROUPS; group++) {
+		for (uint32_t sub = 0U; sub < LATENCY_HIST_SUBS; sub++) {
+			cumulative += session->latency_hist[group][sub];
+			if (cumulative < rank) {
+				continue;
+			}
+
+			/* Upper bound of the bucket */
+			if (group == 0U) {
+				return sub;
+			}
+
+			return ((LATENCY_HIST_SUBS + sub + 1) <<
+				(group - 1)) - 1;
+		}
+	}
+
+	return session->latency_max;
+}
+#endif /* CONFIG_NET_ZPERF_LATENCY_HISTOGRAM */
+
 void zperf_reset_session_stats(struct session *session)
 {
 	if (!session) {
@@ -100,6 +172,13 @@ void zperf_reset_session_stats(struct session *session)
 	session->error = 0U;
 	session->jitter = 0;
 	session->last_transit_time = 0;
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	memset(session->latency_hist, 0, sizeof(session->latency_hist));
+	session->latency_count = 0U;
+	session->latency_min = UINT32_MAX;
+	session->latency_max = 0U;
+	session->latency_sum = 0U;
+#endif
 }
 
 void zperf_session_reset(enum session_proto proto)
@@ -32,6 +32,18 @@ enum session_proto {
 	SESSION_PROTO_END
 };
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+/* Log-linear histogram: each power-of-two group of transit times is
+ * split into LATENCY_HIST_SUBS linear sub-buckets, giving a constant
+ * ~12.5 % relative resolution. The last group covers everything from
+ * LATENCY_HIST_SUBS << (LATENCY_HIST_GROUPS - 2) microseconds upwards
+ * (~4.2 s with the defaults).
+ */
+#define LATENCY_HIST_SUBS_SHIFT	3
+#define LATENCY_HIST_SUBS	(1 << LATENCY_HIST_SUBS_SHIFT)
+#define LATENCY_HIST_GROUPS	20
+#endif /* CONFIG_NET_ZPERF_LATENCY_HISTOGRAM */
+
 struct session {
 	/* Tuple for UDP */
 	uint16_t port;
@@ -50,15 +62,36 @@ struct session {
 	int32_t jitter;
 	int32_t last_transit_time;
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+	/* Per-packet transit time distribution (microseconds) */
+	uint32_t latency_hist[LATENCY_HIST_GROUPS][LATENCY_HIST_SUBS];
+	uint32_t latency_count;
+	uint32_t latency_min;
+	uint32_t latency_max;
+	uint64_t latency_sum;
+#endif
+
 	/* Stats packet*/
 	struct zperf_server_hdr stat;
 };
 
 struct session *get_session(const struct sockaddr *addr,
 			    enum session_proto proto);
+/* Get a session by slot index, NULL when index is out of range. */
+struct session *get_session_by_index(enum session_proto proto, int index);
 void zperf_session_init(void);
 void zperf_reset_session_stats(struct session *session);
 /* Reset all sessions for a given protocol. */
 void zperf_session_reset(enum session_proto proto);
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+/* Account a single packet transit time into the session histogram. */
+void zperf_session_latency_record(struct session *session, uint32_t latency_us);
+/* Percentile (in tenths of a percent, e.g. 999 for p99.9) of the
+ * recorded transit times, 0 when no packets have been recorded.
+ */
+uint32_t zperf_session_latency_percentile(const struct session *session,
+					  uint32_t percentile_x10);
+#endif
+
 #endif /* __ZPERF_SESSION_H */
@@ -1393,6 +1393,116 @@ static int cmd_tcp_download(const struct shell *sh, size_t argc,
 	}
 }
 
+static const char *session_state_str(enum state state)
+{
+	switch (state) {
+	case STATE_ONGOING:
+		return "ongoing";
+	case STATE_LAST_PACKET_RECEIVED:
+	case STATE_COMPLETED:
+		return "completed";
+	default:
+		return "unknown";
+	}
+}
+
+static void session_stats_print(const struct shell *sh,
+				enum session_proto proto, bool csv)
+{
+	const char *proto_str = (proto == SESSION_UDP) ? "udp" : "tcp";
+	struct session *session;
+	int i = 0;
+
+	while ((session = get_session_by_index(proto, i++)) != NULL) {
+		if (session->state == STATE_NULL || session->counter == 0U) {
+			continue;
+		}
+
+		if (csv) {
+			shell_fprintf(sh, SHELL_NORMAL, "%s,%s:%u,%s,%u,%llu,"
+				      "%u,%u,%d",
+				      proto_str,
+				      net_sprint_addr(session->ip.family,
+						      &session->ip.in_addr),
+				      ntohs(session->port),
+				      session_state_str(session->state),
+				      session->counter, session->length,
+				      session->outorder, session->error,
+				      session->jitter);
+		} else {
+			shell_fprintf(sh, SHELL_NORMAL,
+				      "%s [%s]:%u (%s)\n"
+				      " packets:\t%u\n bytes:\t\t%llu\n"
+				      " outorder:\t%u\n lost:\t\t%u\n"
+				      " jitter:\t%d us\n",
+				      proto_str,
+				      net_sprint_addr(session->ip.family,
+						      &session->ip.in_addr),
+				      ntohs(session->port),
+				      session_state_str(session->state),
+				      session->counter, session->length,
+				      session->outorder, session->error,
+				      session->jitter);
+		}
+
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+		if (session->latency_count > 0U) {
+			uint32_t avg = (uint32_t)(session->latency_sum /
+						  session->latency_count);
+
+			if (csv) {
+				shell_fprintf(sh, SHELL_NORMAL,
+					      ",%u,%u,%u,%u,%u,%u,%u",
+					      session->latency_min, avg,
+					      session->latency_max,
+					      zperf_session_latency_percentile(session, 500),
+					      zperf_session_latency_percentile(session, 900),
+					      zperf_session_latency_percentile(session, 990),
+					      zperf_session_latency_percentile(session, 999));
+			} else {
+				shell_fprintf(sh, SHELL_NORMAL,
+					      " latency min/avg/max:\t%u/%u/%u us\n"
+					      " latency p50/p90/p99/p99.9:\t"
+					      "%u/%u/%u/%u us\n",
+					      session->latency_min, avg,
+					      session->latency_max,
+					      zperf_session_latency_percentile(session, 500),
+					      zperf_session_latency_percentile(session, 900),
+					      zperf_session_latency_percentile(session, 990),
+					      zperf_session_latency_percentile(session, 999));
+			}
+		} else if (csv) {
+			shell_fprintf(sh, SHELL_NORMAL, ",,,,,,,");
+		}
+#endif /* CONFIG_NET_ZPERF_LATENCY_HISTOGRAM */
+
+		if (csv) {
+			shell_fprintf(sh, SHELL_NORMAL, "\n");
+		}
+	}
+}
+
+static int cmd_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	bool csv = (argc > 1) && (strcmp(argv[1], "csv") == 0);
+
+	if (csv) {
+		shell_fprintf(sh, SHELL_NORMAL,
+			      "proto,peer,state,packets,bytes,outorder,lost,"
+			      "jitter_us"
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+			      ",lat_min_us,lat_avg_us,lat_max_us,lat_p50_us,"
+			      "lat_p90_us,lat_p99_us,lat_p999_us"
+#endif
+			      "\n");
+	}
+
+	session_stats_print(sh, SESSION_UDP, csv);
+	session_stats_print(sh, SESSION_TCP, csv);
+
+	return 0;
+}
+
 static int cmd_version(const struct shell *sh, size_t argc, char *argv[])
 {
 	shell_fprintf(sh, SHELL_NORMAL, "Version: %s\nConfig: %s\n",
@@ -1602,6 +1712,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_commands,
 	SHELL_CMD(udp, &zperf_cmd_udp,
 		  "Upload/Download UDP data",
 		  cmd_udp),
+	SHELL_CMD(stats, NULL,
+		  "[csv]\n"
+		  "Print receiver session statistics, optionally as CSV\n"
+		  "Example: zperf stats csv\n",
+		  cmd_stats),
 	SHELL_CMD(version, NULL,
 		  "Zperf version",
 		  cmd_version),
@@ -18,7 +18,10 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 
 static char sample_packet[PACKET_SIZE_MAX];
 
-static struct zperf_async_upload_context tcp_async_upload_ctx;
+/* The sample packet is shared between streams: every upload fills it
+ * with the same constant pattern, so concurrent writers are harmless.
+ */
+static struct zperf_async_upload_context tcp_async_upload_ctx[CONFIG_NET_ZPERF_ASYNC_STREAMS];
 
 static ssize_t sendall(int sock, const void *buf, size_t len)
 {
@@ -222,24 +225,37 @@ cleanup:
 int zperf_tcp_upload_async(const struct zperf_upload_params *param,
 			   zperf_callback callback, void *user_data)
 {
+	struct zperf_async_upload_context *upload_ctx = NULL;
+	uint8_t stream;
+
 	if (param == NULL || callback == NULL) {
 		return -EINVAL;
 	}
 
-	if (k_work_is_pending(&tcp_async_upload_ctx.work)) {
+	for (stream = 0; stream < CONFIG_NET_ZPERF_ASYNC_STREAMS; stream++) {
+		if (!k_work_is_pending(&tcp_async_upload_ctx[stream].work)) {
+			upload_ctx = &tcp_async_upload_ctx[stream];
+			break;
+		}
+	}
+
+	if (upload_ctx == NULL) {
 		return -EBUSY;
 	}
 
-	memcpy(&tcp_async_upload_ctx.param, param, sizeof(*param));
-	tcp_async_upload_ctx.callback = callback;
-	tcp_async_upload_ctx.user_data = user_data;
+	memcpy(&upload_ctx->param, param, sizeof(*param));
+	upload_ctx->callback = callback;
+	upload_ctx->user_data = user_data;
 
-	zperf_async_work_submit(&tcp_async_upload_ctx.work);
+	zperf_async_work_submit(stream, &upload_ctx->work);
 
 	return 0;
 }
 
 void zperf_tcp_uploader_init(void)
 {
-	k_work_init(&tcp_async_upload_ctx.work, tcp_upload_async_work);
+	for (int i = 0; i < CONFIG_NET_ZPERF_ASYNC_STREAMS; i++) {
+		k_work_init(&tcp_async_upload_ctx[i].work,
+			    tcp_upload_async_work);
+	}
 }
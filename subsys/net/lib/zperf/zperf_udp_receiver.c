@@ -213,6 +213,17 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 
 			session->last_transit_time = transit_time;
 
+#if defined(CONFIG_NET_ZPERF_LATENCY_HISTOGRAM)
+			/* Unsynchronized clocks can yield a negative
+			 * transit time; clamp so the histogram keeps
+			 * tracking the relative distribution.
+			 */
+			zperf_session_latency_record(
+				session,
+				(transit_time < 0) ? 0U :
+				(uint32_t)transit_time);
+#endif
+
 			/* Check header id */
 			if (id != session->next_id) {
 				if (id < session->next_id) {
@@ -14,11 +14,16 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 
 #include "zperf_internal.h"
 
-static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
-			     sizeof(struct zperf_client_hdr_v1) +
-			     PACKET_SIZE_MAX];
+#define UDP_UPLOAD_BUF_SIZE (sizeof(struct zperf_udp_datagram) + \
+			     sizeof(struct zperf_client_hdr_v1) + \
+			     PACKET_SIZE_MAX)
 
-static struct zperf_async_upload_context udp_async_upload_ctx;
+/* Each upload stream needs its own packet buffer as uploads run
+ * concurrently on separate work queues.
+ */
+static uint8_t sample_packet[CONFIG_NET_ZPERF_ASYNC_STREAMS][UDP_UPLOAD_BUF_SIZE];
+
+static struct zperf_async_upload_context udp_async_upload_ctx[CONFIG_NET_ZPERF_ASYNC_STREAMS];
 
 static inline void zperf_upload_decode_stat(const uint8_t *data,
 					    size_t datalen,
@@ -51,7 +56,8 @@ static inline int zperf_upload_fin(int sock,
 				   uint64_t end_time,
 				   uint32_t packet_size,
 				   struct zperf_results *results,
-				   bool is_mcast_pkt)
+				   bool is_mcast_pkt,
+				   uint8_t *buf)
 {
 	uint8_t stats[sizeof(struct zperf_udp_datagram) +
 		      sizeof(struct zperf_server_hdr)] = { 0 };
@@ -67,14 +73,14 @@ static inline int zperf_upload_fin(int sock,
 	};
 
 	while (ret <= 0 && loop-- > 0) {
-		datagram = (struct zperf_udp_datagram *)sample_packet;
+		datagram = (struct zperf_udp_datagram *)buf;
 
 		/* Fill the packet header */
 		datagram->id = htonl(-nb_packets);
 		datagram->tv_sec = htonl(secs);
 		datagram->tv_usec = htonl(usecs);
 
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
+		hdr = (struct zperf_client_hdr_v1 *)(buf +
 						     sizeof(*datagram));
 
 		/* According to iperf documentation (in include/Settings.hpp),
@@ -85,13 +91,13 @@ static inline int zperf_upload_fin(int sock,
 		hdr->flags = 0;
 		hdr->num_of_threads = htonl(1);
 		hdr->port = 0;
-		hdr->buffer_len = sizeof(sample_packet) -
+		hdr->buffer_len = UDP_UPLOAD_BUF_SIZE -
 			sizeof(*datagram) - sizeof(*hdr);
 		hdr->bandwidth = 0;
 		hdr->num_of_bytes = htonl(packet_size);
 
 		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		ret = zsock_send(sock, buf, packet_size, 0);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			continue;
@@ -140,7 +146,8 @@ static inline int zperf_upload_fin(int sock,
 
 static int udp_upload(int sock, int port,
 		      const struct zperf_upload_params *param,
-		      struct zperf_results *results)
+		      struct zperf_results *results,
+		      uint8_t *buf)
 {
 	uint32_t duration_in_ms = param->duration_ms;
 	uint32_t packet_size = param->packet_size;
@@ -174,7 +181,7 @@ static int udp_upload(int sock, int port,
 	print_period = k_ms_to_ticks_ceil32(MSEC_PER_SEC);
 	print_time = start_time + print_period;
 
-	(void)memset(sample_packet, 'z', sizeof(sample_packet));
+	(void)memset(buf, 'z', UDP_UPLOAD_BUF_SIZE);
 
 	do {
 		struct zperf_udp_datagram *datagram;
@@ -210,24 +217,24 @@ static int udp_upload(int sock, int port,
 		usecs = usecs64 - (uint64_t)secs * USEC_PER_SEC;
 
 		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
+		datagram = (struct zperf_udp_datagram *)buf;
 
 		datagram->id = htonl(nb_packets);
 		datagram->tv_sec = htonl(secs);
 		datagram->tv_usec = htonl(usecs);
 
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
+		hdr = (struct zperf_client_hdr_v1 *)(buf +
 						     sizeof(*datagram));
 		hdr->flags = 0;
 		hdr->num_of_threads = htonl(1);
 		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
+		hdr->buffer_len = UDP_UPLOAD_BUF_SIZE -
 			sizeof(*datagram) - sizeof(*hdr);
 		hdr->bandwidth = htonl(rate_in_kbps);
 		hdr->num_of_bytes = htonl(packet_size);
 
 		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		ret = zsock_send(sock, buf, packet_size, 0);
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			return -errno;
@@ -268,7 +275,7 @@ static int udp_upload(int sock, int port,
 		return -EINVAL;
 	}
 	ret = zperf_upload_fin(sock, nb_packets, end_time, packet_size,
-			       results, is_mcast_pkt);
+			       results, is_mcast_pkt, buf);
 	if (ret < 0) {
 		return ret;
 	}
@@ -282,8 +289,9 @@ static int udp_upload(int sock, int port,
 	return 0;
 }
 
-int zperf_udp_upload(const struct zperf_upload_params *param,
-		     struct zperf_results *result)
+static int zperf_udp_upload_buf(const struct zperf_upload_params *param,
+				struct zperf_results *result,
+				uint8_t *buf)
 {
 	int port = 0;
 	int sock;
@@ -321,24 +329,31 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 		}
 	}
 
-	ret = udp_upload(sock, port, param, result);
+	ret = udp_upload(sock, port, param, result, buf);
 
 	zsock_close(sock);
 
 	return ret;
 }
 
+int zperf_udp_upload(const struct zperf_upload_params *param,
+		     struct zperf_results *result)
+{
+	return zperf_udp_upload_buf(param, result, sample_packet[0]);
+}
+
 static void udp_upload_async_work(struct k_work *work)
 {
 	struct zperf_async_upload_context *upload_ctx =
-		&udp_async_upload_ctx;
+		CONTAINER_OF(work, struct zperf_async_upload_context, work);
 	struct zperf_results result;
 	int ret;
 
 	upload_ctx->callback(ZPERF_SESSION_STARTED, NULL,
 			     upload_ctx->user_data);
 
-	ret = zperf_udp_upload(&upload_ctx->param, &result);
+	ret = zperf_udp_upload_buf(&upload_ctx->param, &result,
+				   sample_packet[upload_ctx - udp_async_upload_ctx]);
 	if (ret < 0) {
 		upload_ctx->callback(ZPERF_SESSION_ERROR, NULL,
 				     upload_ctx->user_data);
@@ -351,24 +366,37 @@ static void udp_upload_async_work(struct k_work *work)
 int zperf_udp_upload_async(const struct zperf_upload_params *param,
 			   zperf_callback callback, void *user_data)
 {
+	struct zperf_async_upload_context *upload_ctx = NULL;
+	uint8_t stream;
+
 	if (param == NULL || callback == NULL) {
 		return -EINVAL;
 	}
 
-	if (k_work_is_pending(&udp_async_upload_ctx.work)) {
+	for (stream = 0; stream < CONFIG_NET_ZPERF_ASYNC_STREAMS; stream++) {
+		if (!k_work_is_pending(&udp_async_upload_ctx[stream].work)) {
+			upload_ctx = &udp_async_upload_ctx[stream];
+			break;
+		}
+	}
+
+	if (upload_ctx == NULL) {
 		return -EBUSY;
 	}
 
-	memcpy(&udp_async_upload_ctx.param, param, sizeof(*param));
-	udp_async_upload_ctx.callback = callback;
-	udp_async_upload_ctx.user_data = user_data;
+	memcpy(&upload_ctx->param, param, sizeof(*param));
+	upload_ctx->callback = callback;
+	upload_ctx->user_data = user_data;
 
-	zperf_async_work_submit(&udp_async_upload_ctx.work);
+	zperf_async_work_submit(stream, &upload_ctx->work);
 
 	return 0;
 }
 
 void zperf_udp_uploader_init(void)
 {
-	k_work_init(&udp_async_upload_ctx.work, udp_upload_async_work);
+	for (int i = 0; i < CONFIG_NET_ZPERF_ASYNC_STREAMS; i++) {
+		k_work_init(&udp_async_upload_ctx[i].work,
+			    udp_upload_async_work);
+	}
 }
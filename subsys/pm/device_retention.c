@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/init.h>
+#include <zephyr/pm/device.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(pm_device, CONFIG_PM_DEVICE_LOG_LEVEL);
+
+/*
+ * Retained record layout: a device count used as a layout check, followed
+ * by one bit per static device, set when the device was suspended when the
+ * record was saved. Validity across the power cycle is provided by the
+ * retention driver (prefix/checksum as configured on the chosen area).
+ */
+struct retention_record_hdr {
+	uint16_t dev_count;
+} __packed;
+
+static const struct device *record_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_pm_device_retention));
+
+/** Record load state, only touched during sequential device init. */
+static enum {
+	RECORD_UNKNOWN,
+	RECORD_VALID,
+	RECORD_INVALID,
+} record_state = RECORD_UNKNOWN;
+
+static uint16_t static_device_count(const struct device **devs)
+{
+	size_t count = z_device_get_all_static(devs);
+
+	return (uint16_t)count;
+}
+
+int pm_device_retention_save(void)
+{
+	const struct device *devs;
+	uint16_t count = static_device_count(&devs);
+	struct retention_record_hdr hdr = { .dev_count = count };
+	uint8_t bits = 0U;
+	off_t offset = sizeof(hdr);
+	int rc;
+
+	rc = retention_write(record_dev, 0, (uint8_t *)&hdr, sizeof(hdr));
+	if (rc != 0) {
+		return rc;
+	}
+
+	for (uint16_t i = 0; i < count; i++) {
+		enum pm_device_state state;
+
+		if ((pm_device_state_get(&devs[i], &state) == 0) &&
+		    (state == PM_DEVICE_STATE_SUSPENDED)) {
+			bits |= BIT(i % 8);
+		}
+
+		if (((i % 8) == 7U) || (i == (count - 1U))) {
+			rc = retention_write(record_dev, offset, &bits, sizeof(bits));
+			if (rc != 0) {
+				return rc;
+			}
+			offset += sizeof(bits);
+			bits = 0U;
+		}
+	}
+
+	return 0;
+}
+
+static bool record_load(void)
+{
+	struct retention_record_hdr hdr;
+	const struct device *devs;
+
+	if (record_state != RECORD_UNKNOWN) {
+		return record_state == RECORD_VALID;
+	}
+
+	/* The retention device itself initializes through the normal
+	 * path; devices preceding it are never skipped.
+	 */
+	if (!record_dev->state->initialized ||
+	    (record_dev->state->init_res != 0U)) {
+		return false;
+	}
+
+	record_state = RECORD_INVALID;
+
+	if (retention_is_valid(record_dev) != 1) {
+		return false;
+	}
+
+	if ((retention_read(record_dev, 0, (uint8_t *)&hdr, sizeof(hdr)) != 0) ||
+	    (hdr.dev_count != static_device_count(&devs))) {
+		LOG_WRN("Stale device retention record ignored");
+		return false;
+	}
+
+	record_state = RECORD_VALID;
+
+	return true;
+}
+
+bool pm_device_retention_resume(const struct device *dev)
+{
+	const struct device *devs;
+	uint16_t count = static_device_count(&devs);
+	ptrdiff_t idx = dev - devs;
+	uint8_t bits;
+
+	if (!record_load() || (idx < 0) || (idx >= count)) {
+		return false;
+	}
+
+	if (retention_read(record_dev, sizeof(struct retention_record_hdr) + (idx / 8),
+			   &bits, sizeof(bits)) != 0) {
+		return false;
+	}
+
+	if ((bits & BIT(idx % 8)) == 0U) {
+		return false;
+	}
+
+	pm_device_init_suspended(dev);
+
+	return true;
+}
+
+/** Consume the record so it only ever applies to the boot after save. */
+static int pm_device_retention_invalidate(void)
+{
+	if (device_is_ready(record_dev)) {
+		(void)retention_clear(record_dev);
+	}
+
+	return 0;
+}
+
+SYS_INIT(pm_device_retention_invalidate, APPLICATION, 99);
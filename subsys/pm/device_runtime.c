@@ -330,6 +330,15 @@ int pm_device_runtime_put(const struct device *dev)
 		ret = put_sync_locked(dev);
 
 		k_spin_unlock(&pm_sync->lock, k);
+	} else if (!k_is_pre_kernel() &&
+		   !K_TIMEOUT_EQ(dev->pm->autosuspend_delay, K_NO_WAIT)) {
+		/*
+		 * Defer the suspension by the configured idle window. A
+		 * pm_device_runtime_get() within the window cancels it, so
+		 * bursts of get/put cycles do not power-cycle the device or
+		 * release its power domain in between.
+		 */
+		ret = runtime_suspend(dev, true, dev->pm->autosuspend_delay);
 	} else {
 		ret = runtime_suspend(dev, false, K_NO_WAIT);
 
@@ -370,6 +379,33 @@ int pm_device_runtime_put_async(const struct device *dev, k_timeout_t delay)
 	return ret;
 }
 
+int pm_device_runtime_autosuspend_set(const struct device *dev,
+				      k_timeout_t delay)
+{
+	struct pm_device *pm = dev->pm;
+
+	if (pm == NULL) {
+		return -ENOTSUP;
+	}
+
+	/* ISR safe devices suspend in place, there is no work item to defer */
+	if (atomic_test_bit(&dev->pm_base->flags, PM_DEVICE_FLAG_ISR_SAFE)) {
+		return -ENOTSUP;
+	}
+
+	if (!k_is_pre_kernel()) {
+		(void)k_sem_take(&pm->lock, K_FOREVER);
+	}
+
+	pm->autosuspend_delay = delay;
+
+	if (!k_is_pre_kernel()) {
+		k_sem_give(&pm->lock);
+	}
+
+	return 0;
+}
+
 __boot_func
 int pm_device_runtime_auto_enable(const struct device *dev)
 {
@@ -18,6 +18,7 @@
 #include <zephyr/tracing/tracing.h>
 
 #include "pm_stats.h"
+#include "policy/policy_learn.h"
 #include "device_system_managed.h"
 
 #include <zephyr/logging/log.h>
@@ -217,6 +218,9 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	 */
 	k_sched_lock();
 	pm_stats_start();
+#ifdef CONFIG_PM_POLICY_RESIDENCY_LEARNING
+	uint32_t state_entry_cyc = k_cycle_get_32();
+#endif
 	/* Enter power state */
 	pm_state_notify(true);
 	atomic_set_bit(z_post_ops_required, id);
@@ -224,6 +228,11 @@ bool pm_system_suspend(int32_t kernel_ticks)
 	pm_stats_stop();
 
 	/* Wake up sequence starts here */
+#ifdef CONFIG_PM_POLICY_RESIDENCY_LEARNING
+	pm_policy_residency_record(id, z_cpus_pm_state[id].state,
+				   z_cpus_pm_state[id].substate_id,
+				   k_cycle_get_32() - state_entry_cyc);
+#endif
 	pm_stats_update(z_cpus_pm_state[id].state);
 	pm_system_resume();
 	k_sched_unlock();
@@ -9,6 +9,8 @@
 #include <zephyr/sys_clock.h>
 #include <zephyr/pm/device.h>
 
+#include "policy_learn.h"
+
 extern int32_t max_latency_cyc;
 
 const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
@@ -47,6 +49,14 @@ const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
 			continue;
 		}
 
+		/* skip state if past entries into it kept waking early,
+		 * e.g. an interrupt source firing shortly after entry
+		 */
+		if (!pm_policy_residency_fits(cpu, (uint8_t)i,
+					      min_residency_cyc + exit_latency_cyc)) {
+			continue;
+		}
+
 		if ((cyc < 0) ||
 		    (cyc >= (min_residency_cyc + exit_latency_cyc))) {
 			return state;
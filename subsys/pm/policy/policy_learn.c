@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/pm/state.h>
+#include <zephyr/sys/util.h>
+
+#include "policy_learn.h"
+
+/*
+ * Per-state residency learning for the default policy.
+ *
+ * All data is per CPU and only touched from pm_system_suspend() /
+ * pm_policy_next_state(), which run on that CPU with interrupts
+ * locked, so no locking is needed.
+ */
+
+/** Upper bound on tracked states per CPU; extra states are not tracked. */
+#define LEARN_MAX_STATES 8U
+
+/** EWMA weight: a new sample contributes 1/8. */
+#define LEARN_EWMA_SHIFT 3
+
+/** Let a vetoed state through every this many decisions to refresh data. */
+#define LEARN_RETRY_PERIOD 16U
+
+struct learn_state {
+	/** Exponential moving average of achieved residency, in cycles. */
+	uint32_t residency_ewma_cyc;
+	/** Whether residency_ewma_cyc holds at least one sample. */
+	bool seeded;
+	/** Consecutive decisions in which this state was vetoed. */
+	uint8_t vetoed;
+};
+
+static struct learn_state learn_states[CONFIG_MP_MAX_NUM_CPUS][LEARN_MAX_STATES];
+
+static struct learn_state *learn_state_get(uint8_t cpu, enum pm_state state,
+					   uint8_t substate_id)
+{
+	const struct pm_state_info *cpu_states;
+	uint8_t num_cpu_states;
+
+	num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+
+	for (uint8_t i = 0; i < MIN(num_cpu_states, LEARN_MAX_STATES); i++) {
+		if ((cpu_states[i].state == state) &&
+		    (cpu_states[i].substate_id == substate_id)) {
+			return &learn_states[cpu][i];
+		}
+	}
+
+	return NULL;
+}
+
+void pm_policy_residency_record(uint8_t cpu, enum pm_state state,
+				uint8_t substate_id, uint32_t residency_cyc)
+{
+	struct learn_state *ls = learn_state_get(cpu, state, substate_id);
+
+	if (ls == NULL) {
+		return;
+	}
+
+	if (!ls->seeded) {
+		ls->residency_ewma_cyc = residency_cyc;
+		ls->seeded = true;
+	} else {
+		ls->residency_ewma_cyc +=
+			((int32_t)(residency_cyc - ls->residency_ewma_cyc)) >>
+			LEARN_EWMA_SHIFT;
+	}
+}
+
+bool pm_policy_residency_fits(uint8_t cpu, uint8_t state_idx, uint32_t required_cyc)
+{
+	struct learn_state *ls;
+
+	if (state_idx >= LEARN_MAX_STATES) {
+		return true;
+	}
+
+	ls = &learn_states[cpu][state_idx];
+
+	if (!ls->seeded || (ls->residency_ewma_cyc >= required_cyc)) {
+		ls->vetoed = 0U;
+		return true;
+	}
+
+	/* Wakes keep arriving before this state pays off. Veto it, but
+	 * let it through periodically so the average tracks a changed
+	 * wake pattern.
+	 */
+	ls->vetoed++;
+	if (ls->vetoed >= LEARN_RETRY_PERIOD) {
+		ls->vetoed = 0U;
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SUBSYS_PM_POLICY_POLICY_LEARN_H_
+#define ZEPHYR_SUBSYS_PM_POLICY_POLICY_LEARN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/pm/state.h>
+
+#ifdef CONFIG_PM_POLICY_RESIDENCY_LEARNING
+/**
+ * @brief Record the achieved residency of a power state entry.
+ *
+ * Called on wake with the cycles actually spent between state entry and
+ * resume, including the entry/exit overhead.
+ */
+void pm_policy_residency_record(uint8_t cpu, enum pm_state state,
+				uint8_t substate_id, uint32_t residency_cyc);
+
+/**
+ * @brief Check a state's learned residency against its requirement.
+ *
+ * @param state_idx Index of the state in the pm_state_cpu_get_all() array.
+ * @param required_cyc Minimum residency plus exit latency, in cycles.
+ *
+ * @return false if recently observed residencies keep falling short of
+ *	   the requirement, true otherwise.
+ */
+bool pm_policy_residency_fits(uint8_t cpu, uint8_t state_idx, uint32_t required_cyc);
+#else
+static inline void pm_policy_residency_record(uint8_t cpu, enum pm_state state,
+					      uint8_t substate_id,
+					      uint32_t residency_cyc) {}
+static inline bool pm_policy_residency_fits(uint8_t cpu, uint8_t state_idx,
+					    uint32_t required_cyc)
+{
+	return true;
+}
+#endif /* CONFIG_PM_POLICY_RESIDENCY_LEARNING */
+
+#endif /* ZEPHYR_SUBSYS_PM_POLICY_POLICY_LEARN_H_ */
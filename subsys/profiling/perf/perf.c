@@ -12,9 +12,23 @@
 #include <zephyr/shell/shell_uart.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+/* One unique (thread, callchain) pair with its hit counter. The table of
+ * these entries is the collapsed-stack ("flamegraph") representation of
+ * the whole recording, aggregated on target as samples arrive.
+ */
+struct perf_aggr_entry {
+	struct k_thread *thread;
+	uint32_t hits;
+	size_t depth;
+	uintptr_t chain[CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH];
+};
+#endif
+
 struct perf_data_t {
 	struct k_timer timer;
 
@@ -22,9 +36,16 @@ struct perf_data_t {
 
 	struct k_work_delayable dwork;
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	size_t used;
+	struct perf_aggr_entry entries[CONFIG_PROFILING_PERF_AGGREGATE_ENTRIES];
+	/* Samples lost: callchain deeper than an entry holds, or table full */
+	uint32_t lost;
+#else
 	size_t idx;
 	uintptr_t buf[CONFIG_PROFILING_PERF_BUFFER_SIZE];
 	bool buf_full;
+#endif
 };
 
 static void perf_tracer(struct k_timer *timer);
@@ -34,6 +55,45 @@ static struct perf_data_t perf_data = {
 	.dwork = Z_WORK_DELAYABLE_INITIALIZER(perf_dwork_handler),
 };
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static void perf_tracer(struct k_timer *timer)
+{
+	struct perf_data_t *perf_data_ptr =
+		(struct perf_data_t *)k_timer_user_data_get(timer);
+	struct k_thread *thread = k_sched_current_thread_query();
+	uintptr_t chain[CONFIG_PROFILING_PERF_AGGREGATE_MAX_DEPTH];
+	struct perf_aggr_entry *entry;
+	size_t trace_length;
+
+	trace_length = arch_perf_current_stack_trace(chain, ARRAY_SIZE(chain));
+	if (trace_length == 0) {
+		perf_data_ptr->lost++;
+		return;
+	}
+
+	for (size_t i = 0; i < perf_data_ptr->used; i++) {
+		entry = &perf_data_ptr->entries[i];
+		if ((entry->thread == thread) &&
+		    (entry->depth == trace_length) &&
+		    (memcmp(entry->chain, chain,
+			    trace_length * sizeof(chain[0])) == 0)) {
+			entry->hits++;
+			return;
+		}
+	}
+
+	if (perf_data_ptr->used >= ARRAY_SIZE(perf_data_ptr->entries)) {
+		perf_data_ptr->lost++;
+		return;
+	}
+
+	entry = &perf_data_ptr->entries[perf_data_ptr->used++];
+	entry->thread = thread;
+	entry->hits = 1;
+	entry->depth = trace_length;
+	memcpy(entry->chain, chain, trace_length * sizeof(chain[0]));
+}
+#else
 static void perf_tracer(struct k_timer *timer)
 {
 	struct perf_data_t *perf_data_ptr =
@@ -56,6 +116,7 @@ static void perf_tracer(struct k_timer *timer)
 		k_work_reschedule(&perf_data_ptr->dwork, K_NO_WAIT);
 	}
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 
 static void perf_dwork_handler(struct k_work *work)
 {
@@ -63,11 +124,20 @@ static void perf_dwork_handler(struct k_work *work)
 	struct perf_data_t *perf_data_ptr = CONTAINER_OF(dwork, struct perf_data_t, dwork);
 
 	k_timer_stop(&perf_data_ptr->timer);
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	if (perf_data_ptr->lost != 0) {
+		shell_warn(perf_data_ptr->sh, "Perf done, %u samples lost!",
+			   perf_data_ptr->lost);
+	} else {
+		shell_print(perf_data_ptr->sh, "Perf done!");
+	}
+#else
 	if (perf_data_ptr->buf_full) {
 		shell_error(perf_data_ptr->sh, "Perf buf overflow!");
 	} else {
 		shell_print(perf_data_ptr->sh, "Perf done!");
 	}
+#endif
 }
 
 static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
@@ -77,10 +147,12 @@ static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
 		return -EINPROGRESS;
 	}
 
+#ifndef CONFIG_PROFILING_PERF_AGGREGATE
 	if (perf_data.buf_full) {
 		shell_warn(sh, "Perf buffer is full");
 		return -ENOBUFS;
 	}
+#endif
 
 	k_timeout_t duration = K_MSEC(strtoll(argv[1], NULL, 10));
 	k_timeout_t period = K_NSEC(1000000000 / strtoll(argv[2], NULL, 10));
@@ -107,8 +179,13 @@ static int cmd_perf_clear(const struct shell *sh, size_t argc, char **argv)
 		shell_print(sh, "Perf buffer cleared");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	perf_data.used = 0;
+	perf_data.lost = 0;
+#else
 	perf_data.idx = 0;
 	perf_data.buf_full = false;
+#endif
 
 	return 0;
 }
@@ -119,12 +196,72 @@ static int cmd_perf_info(const struct shell *sh, size_t argc, char **argv)
 		shell_print(sh, "Perf is running");
 	}
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	shell_print(sh, "Perf callchains: %zu/%d, lost samples: %u",
+		    perf_data.used, CONFIG_PROFILING_PERF_AGGREGATE_ENTRIES,
+		    perf_data.lost);
+#else
 	shell_print(sh, "Perf buf: %zu/%d %s", perf_data.idx, CONFIG_PROFILING_PERF_BUFFER_SIZE,
 		    perf_data.buf_full ? "(full)" : "");
+#endif
 
 	return 0;
 }
 
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+static const char *perf_thread_name(struct k_thread *thread)
+{
+	const char *name = k_thread_name_get(thread);
+
+	return ((name != NULL) && (name[0] != '\0')) ? name : "unknown";
+}
+
+/* Print the aggregation table in collapsed-stack format, one unique
+ * callchain per line, sorted by hit count: "thread;0xPC;0xPC... hits".
+ * Addresses are leaf-last and symbolized on the host (e.g. addr2line).
+ */
+static int cmd_perf_report(const struct shell *sh, size_t argc, char **argv)
+{
+	if (k_work_delayable_is_pending(&perf_data.dwork)) {
+		shell_warn(sh, "Perf is running");
+		return -EINPROGRESS;
+	}
+
+	shell_print(sh, "Perf callchains %zu, lost samples %u",
+		    perf_data.used, perf_data.lost);
+
+	for (uint32_t max_hits = UINT32_MAX; ; ) {
+		uint32_t next_hits = 0;
+
+		for (size_t i = 0; i < perf_data.used; i++) {
+			const struct perf_aggr_entry *entry = &perf_data.entries[i];
+
+			if (entry->hits > max_hits) {
+				continue;
+			}
+			if (entry->hits < max_hits) {
+				next_hits = MAX(next_hits, entry->hits);
+				continue;
+			}
+
+			shell_fprintf(sh, SHELL_NORMAL, "%s",
+				      perf_thread_name(entry->thread));
+			for (size_t j = entry->depth; j > 0; j--) {
+				shell_fprintf(sh, SHELL_NORMAL, ";0x%lx",
+					      entry->chain[j - 1]);
+			}
+			shell_fprintf(sh, SHELL_NORMAL, " %u\n", entry->hits);
+		}
+
+		if (next_hits == 0) {
+			break;
+		}
+		max_hits = next_hits;
+	}
+
+	return 0;
+}
+#else
 static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 {
 	if (k_work_delayable_is_pending(&perf_data.dwork)) {
@@ -141,6 +278,7 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 
 	return 0;
 }
+#endif /* CONFIG_PROFILING_PERF_AGGREGATE */
 
 #define CMD_HELP_RECORD                                                                            \
 	"Start recording for <duration> ms on <frequency> Hz\n"                                    \
@@ -148,7 +286,12 @@ static int cmd_perf_print(const struct shell *sh, size_t argc, char **argv)
 
 SHELL_STATIC_SUBCMD_SET_CREATE(m_sub_perf,
 	SHELL_CMD_ARG(record, NULL, CMD_HELP_RECORD, cmd_perf_record, 3, 0),
+#ifdef CONFIG_PROFILING_PERF_AGGREGATE
+	SHELL_CMD_ARG(report, NULL, "Print aggregated callchains in collapsed-stack format",
+		      cmd_perf_report, 0, 0),
+#else
 	SHELL_CMD_ARG(printbuf, NULL, "Print the perf buffer", cmd_perf_print, 0, 0),
+#endif
 	SHELL_CMD_ARG(clear, NULL, "Clear the perf buffer", cmd_perf_clear, 0, 0),
 	SHELL_CMD_ARG(info, NULL, "Print the perf info", cmd_perf_info, 0, 0),
 	SHELL_SUBCMD_SET_END
@@ -8,6 +8,7 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/entropy.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <string.h>
 
 #if !defined(CONFIG_MBEDTLS_CFG_FILE)
@@ -16,6 +17,7 @@
 #include CONFIG_MBEDTLS_CFG_FILE
 #endif /* CONFIG_MBEDTLS_CFG_FILE */
 #include <mbedtls/ctr_drbg.h>
+#include <mbedtls/platform_util.h>
 
 /*
  * entropy_dev is initialized at runtime to allow first time initialization
@@ -28,8 +30,76 @@ static struct k_mutex ctr_lock;
 
 static mbedtls_ctr_drbg_context ctr_ctx;
 
+#ifdef CONFIG_CS_CTR_DRBG_ENTROPY_POOL
+/*
+ * Pool of raw entropy drained from the driver by a background work item, so
+ * that DRBG (re)seeding on the hot path does not have to wait for the
+ * hardware. The pool level is protected by ctr_lock.
+ */
+static uint8_t entropy_pool[CONFIG_CS_CTR_DRBG_ENTROPY_POOL_SIZE];
+static size_t entropy_pool_level;
+static struct k_work entropy_pool_work;
+
+static void entropy_pool_refill(struct k_work *work)
+{
+	uint8_t buf[32];
+	size_t room;
+	size_t len;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		k_mutex_lock(&ctr_lock, K_FOREVER);
+		room = sizeof(entropy_pool) - entropy_pool_level;
+		k_mutex_unlock(&ctr_lock);
+
+		if (room == 0) {
+			break;
+		}
+
+		/* Read from the driver without holding the lock, so that the
+		 * DRBG stays usable while the hardware gathers entropy.
+		 */
+		len = MIN(room, sizeof(buf));
+		if (entropy_get_entropy(entropy_dev, buf, len) != 0) {
+			break;
+		}
+
+		k_mutex_lock(&ctr_lock, K_FOREVER);
+		len = MIN(len, sizeof(entropy_pool) - entropy_pool_level);
+		memcpy(&entropy_pool[entropy_pool_level], buf, len);
+		entropy_pool_level += len;
+		k_mutex_unlock(&ctr_lock);
+	}
+
+	mbedtls_platform_zeroize(buf, sizeof(buf));
+}
+#endif /* CONFIG_CS_CTR_DRBG_ENTROPY_POOL */
+
 static int ctr_drbg_entropy_func(void *ctx, unsigned char *buf, size_t len)
 {
+#ifdef CONFIG_CS_CTR_DRBG_ENTROPY_POOL
+	/* Called by mbedTLS during (re)seeding, with ctr_lock held. */
+	size_t take = MIN(len, entropy_pool_level);
+
+	if (take > 0) {
+		entropy_pool_level -= take;
+		memcpy(buf, &entropy_pool[entropy_pool_level], take);
+		mbedtls_platform_zeroize(&entropy_pool[entropy_pool_level],
+					 take);
+		buf += take;
+		len -= take;
+	}
+
+	k_work_submit(&entropy_pool_work);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	/* Pool exhausted, read the remainder from the driver directly. */
+#endif /* CONFIG_CS_CTR_DRBG_ENTROPY_POOL */
+
 	return entropy_get_entropy(entropy_dev, (void *)buf, len);
 }
 
@@ -44,6 +114,10 @@ static int ctr_drbg_initialize(void)
 		return -ENODEV;
 	}
 
+#ifdef CONFIG_CS_CTR_DRBG_ENTROPY_POOL
+	k_work_init(&entropy_pool_work, entropy_pool_refill);
+#endif
+
 	mbedtls_ctr_drbg_init(&ctr_ctx);
 
 	ret = mbedtls_ctr_drbg_seed(&ctr_ctx,
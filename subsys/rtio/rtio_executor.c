@@ -147,6 +147,7 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 	struct rtio_iodev_sqe *curr = iodev_sqe, *next;
 	void *userdata;
 	uint32_t sqe_flags, cqe_flags;
+	uint32_t cqe_count = 0;
 
 	do {
 		userdata = curr->sqe.userdata;
@@ -163,7 +164,8 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 		if (!is_canceled && FIELD_GET(RTIO_SQE_NO_RESPONSE, sqe_flags) == 0) {
 			/* Request was not canceled, generate a CQE */
-			rtio_cqe_submit(r, result, userdata, cqe_flags);
+			rtio_cqe_submit_no_signal(r, result, userdata, cqe_flags);
+			cqe_count++;
 		}
 		curr = next;
 		if (!is_ok) {
@@ -172,6 +174,11 @@ static inline void rtio_executor_done(struct rtio_iodev_sqe *iodev_sqe, int resu
 		}
 	} while (sqe_flags & RTIO_SQE_TRANSACTION);
 
+	/* Coalesce the wake-up for all CQEs generated above into one signal */
+	if (cqe_count > 0) {
+		rtio_cqe_signal(r, cqe_count);
+	}
+
 	/* curr should now be the last sqe in the transaction if that is what completed */
 	if (sqe_flags & RTIO_SQE_CHAINED) {
 		rtio_iodev_submit(curr);
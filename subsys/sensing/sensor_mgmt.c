@@ -6,6 +6,7 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/devicetree.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor_data_types.h>
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/rtio/rtio.h>
@@ -514,6 +515,65 @@ int sensing_get_sensors(int *sensor_nums, const struct sensing_sensor_info **inf
 	return 0;
 }
 
+/* The decoder output is converted to the sensing representation in place,
+ * the two layouts must stay identical.
+ */
+BUILD_ASSERT(sizeof(struct sensor_three_axis_data) ==
+	     sizeof(struct sensing_sensor_value_3d_q31),
+	     "decoder and sensing 3d data layouts must match");
+BUILD_ASSERT(offsetof(struct sensor_three_axis_data, readings) ==
+	     offsetof(struct sensing_sensor_value_3d_q31, readings),
+	     "decoder and sensing 3d data layouts must match");
+
+int sensing_decode_three_axis(sensing_sensor_handle_t handle, const void *buf,
+			      struct sensing_sensor_value_3d_q31 *values, uint16_t max_count)
+{
+	struct sensing_connection *conn = handle;
+	struct sensor_three_axis_data *raw = (struct sensor_three_axis_data *)values;
+	const struct sensor_decoder_api *decoder;
+	struct sensing_submit_config *config;
+	struct sensor_chan_spec spec;
+	uint32_t fit = 0;
+	int count;
+	int ret;
+
+	if (conn == NULL || buf == NULL || values == NULL || max_count == 0) {
+		return -EINVAL;
+	}
+
+	__ASSERT(conn->source && conn->source->dev, "decode, reporter should not be NULL");
+
+	ret = sensor_get_decoder(conn->source->dev, &decoder);
+	if (ret) {
+		LOG_ERR("%s get decoder failed:%d", conn->source->dev->name, ret);
+		return ret;
+	}
+
+	config = conn->source->iodev->data;
+	spec.chan_type = config->chan;
+	spec.chan_idx = 0;
+
+	/* decode the whole FIFO window with a single decoder call */
+	count = decoder->decode(buf, spec, &fit, max_count, raw);
+	if (count <= 0) {
+		return count;
+	}
+
+	/* fix up the header in place, the readings keep the fixed-point q31
+	 * representation of the decoder and only the timestamps are scaled
+	 * from nano to micro seconds
+	 */
+	values->header.base_timestamp = raw->header.base_timestamp_ns / NSEC_PER_USEC;
+	values->header.reading_count = count;
+	values->shift = raw->shift;
+
+	for (int i = 0; i < count; i++) {
+		values->readings[i].timestamp_delta /= NSEC_PER_USEC;
+	}
+
+	return count;
+}
+
 K_THREAD_DEFINE(sensing_runtime, CONFIG_SENSING_RUNTIME_THREAD_STACK_SIZE, sensing_runtime_thread,
 		&sensing_ctx, NULL, NULL, CONFIG_SENSING_RUNTIME_THREAD_PRIORITY, 0, 0);
 
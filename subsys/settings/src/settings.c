@@ -16,6 +16,9 @@
 #include "settings_priv.h"
 #include <zephyr/types.h>
 #include <zephyr/sys/iterable_sections.h>
+#ifdef CONFIG_SETTINGS_LOOKUP_CACHE
+#include <zephyr/sys/hash_function.h>
+#endif
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(settings, CONFIG_SETTINGS_LOG_LEVEL);
 
@@ -25,6 +28,13 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#ifdef CONFIG_SETTINGS_LOOKUP_CACHE
+/* Cleared when the handler set changes, forcing a rebuild of the
+ * handler lookup cache on the next settings_parse_and_lookup() call.
+ */
+static bool lookup_cache_valid;
+#endif
+
 
 void settings_store_init(void);
 
@@ -59,6 +69,9 @@ int settings_register_with_cprio(struct settings_handler *handler, int cprio)
 
 	handler->cprio = cprio;
 	sys_slist_append(&settings_handlers, &handler->node);
+#ifdef CONFIG_SETTINGS_LOOKUP_CACHE
+	lookup_cache_valid = false;
+#endif
 
 end:
 	k_mutex_unlock(&settings_lock);
@@ -142,12 +155,139 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
+#ifdef CONFIG_SETTINGS_LOOKUP_CACHE
+/* Index of all handlers keyed by the hash of their (possibly multi
+ * segment) name, sorted by hash value. Looking up the handler for a
+ * stored record then costs one binary search per name segment instead
+ * of a string comparison against every registered handler, which
+ * dominates settings_load() time with many persisted keys.
+ */
+struct lookup_cache_entry {
+	uint32_t hash;
+	struct settings_handler_static *ch;
+};
+static struct lookup_cache_entry lookup_cache[CONFIG_SETTINGS_LOOKUP_CACHE_ENTRIES];
+static int lookup_cache_cnt;
+static bool lookup_cache_overflow;
+
+static void lookup_cache_insert(struct settings_handler_static *ch)
+{
+	uint32_t hash = sys_hash32(ch->name, strlen(ch->name));
+	int pos;
+
+	if (lookup_cache_cnt >= (int)ARRAY_SIZE(lookup_cache)) {
+		lookup_cache_overflow = true;
+		return;
+	}
+
+	pos = lookup_cache_cnt;
+	while ((pos > 0) && (lookup_cache[pos - 1].hash > hash)) {
+		lookup_cache[pos] = lookup_cache[pos - 1];
+		pos--;
+	}
+	lookup_cache[pos].hash = hash;
+	lookup_cache[pos].ch = ch;
+	lookup_cache_cnt++;
+}
+
+/* Returns 0 when the cache is usable, -ENOSPC when there are more
+ * handlers than cache entries and lookups must fall back to the scan.
+ */
+static int lookup_cache_refresh(void)
+{
+	if (lookup_cache_valid) {
+		return lookup_cache_overflow ? -ENOSPC : 0;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	lookup_cache_cnt = 0;
+	lookup_cache_overflow = false;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		lookup_cache_insert(ch);
+	}
+#if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
+	struct settings_handler *dh;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, dh, node) {
+		lookup_cache_insert((struct settings_handler_static *)dh);
+	}
+#endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+	lookup_cache_valid = true;
+	k_mutex_unlock(&settings_lock);
+
+	return lookup_cache_overflow ? -ENOSPC : 0;
+}
+
+static struct settings_handler_static *lookup_cache_find(const char *name,
+							 const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	const char *pos = name;
+
+	if (next) {
+		*next = NULL;
+	}
+
+	/* Each separator-aligned prefix of name is a possible handler
+	 * name; the longest one registered wins, matching the bestmatch
+	 * selection of the linear scan.
+	 */
+	while (true) {
+		const char *seg_next;
+		size_t plen;
+		uint32_t hash;
+		int lo = 0;
+		int hi = lookup_cache_cnt;
+
+		plen = (pos - name) + settings_name_next(pos, &seg_next);
+		hash = sys_hash32(name, plen);
+
+		while (lo < hi) {
+			int mid = (lo + hi) / 2;
+
+			if (lookup_cache[mid].hash < hash) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		for (; (lo < lookup_cache_cnt) &&
+		       (lookup_cache[lo].hash == hash); lo++) {
+			struct settings_handler_static *ch = lookup_cache[lo].ch;
+
+			if ((strncmp(ch->name, name, plen) == 0) &&
+			    (ch->name[plen] == '\0')) {
+				bestmatch = ch;
+				if (next) {
+					*next = seg_next;
+				}
+				break;
+			}
+		}
+
+		if (!seg_next) {
+			break;
+		}
+		pos = seg_next;
+	}
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_LOOKUP_CACHE */
+
 struct settings_handler_static *settings_parse_and_lookup(const char *name,
 							const char **next)
 {
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
 
+#ifdef CONFIG_SETTINGS_LOOKUP_CACHE
+	if (lookup_cache_refresh() == 0) {
+		return lookup_cache_find(name, next);
+	}
+#endif
+
 	bestmatch = NULL;
 	if (next) {
 		*next = NULL;
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/debug/lock_prof.h>
+
+static void lock_entry_dump(const struct lock_prof_stats *stats, void *user_data)
+{
+	const struct shell *sh = user_data;
+	char site[41];
+
+	if (stats->kind == LOCK_PROF_KIND_SPINLOCK) {
+		strncpy(site, stats->site, sizeof(site) - 1);
+		site[sizeof(site) - 1] = '\0';
+	} else {
+		snprintf(site, sizeof(site), "%p", stats->site);
+	}
+
+	shell_print(sh, "%-40s %-9s %10u %14llu %12u", site,
+		    stats->kind == LOCK_PROF_KIND_SPINLOCK ? "spinlock" : "mutex",
+		    stats->count,
+		    (unsigned long long)stats->contended_cycles,
+		    stats->max_hold_cycles);
+}
+
+static int cmd_kernel_locks(const struct shell *sh, size_t argc, char **argv)
+{
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") == 0) {
+			lock_prof_reset();
+			return 0;
+		}
+
+		shell_error(sh, "Unknown subcommand \"%s\"", argv[1]);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "%-40s %-9s %10s %14s %12s", "call site", "kind",
+		    "count", "contended cyc", "max hold cyc");
+	lock_prof_foreach(lock_entry_dump, (void *)sh);
+
+	return 0;
+}
+
+KERNEL_CMD_ARG_ADD(locks, NULL, "Lock contention statistics ([reset]).",
+		   cmd_kernel_locks, 1, 1);
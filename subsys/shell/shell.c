@@ -1229,6 +1229,11 @@ static int instance_init(const struct shell *sh,
 		sh->stats->log_lost_cnt = 0;
 	}
 
+#ifdef CONFIG_SHELL_ASYNC_TX
+	ring_buf_init(&sh->ctx->tx_ringbuf, sizeof(sh->ctx->tx_ringbuf_data),
+		      sh->ctx->tx_ringbuf_data);
+#endif
+
 	z_flag_tx_rdy_set(sh, true);
 
 	sh->ctx->vt100_ctx.cons.terminal_wid =
@@ -1345,8 +1350,13 @@ void shell_thread(void *shell_handle, void *arg_log_backend,
 	}
 
 	while (true) {
-		/* waiting for all signals except SHELL_SIGNAL_TXDONE */
-		err = k_poll(sh->ctx->events, SHELL_SIGNAL_TXDONE,
+		/* Wait for all signals. SHELL_SIGNAL_TXDONE is excluded
+		 * unless asynchronous output is enabled, in which case it
+		 * wakes this thread to drain the output ring buffer.
+		 */
+		err = k_poll(sh->ctx->events,
+			     IS_ENABLED(CONFIG_SHELL_ASYNC_TX) ?
+					SHELL_SIGNALS : SHELL_SIGNAL_TXDONE,
 			     K_FOREVER);
 
 		if (err != 0) {
@@ -1365,6 +1375,9 @@ void shell_thread(void *shell_handle, void *arg_log_backend,
 			shell_signal_handle(sh, SHELL_SIGNAL_LOG_MSG,
 					    shell_log_process);
 		}
+#ifdef CONFIG_SHELL_ASYNC_TX
+		shell_signal_handle(sh, SHELL_SIGNAL_TXDONE, z_shell_tx_flush);
+#endif
 
 		if (sh->iface->api->update) {
 			sh->iface->api->update(sh->iface);
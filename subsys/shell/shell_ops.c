@@ -427,11 +427,63 @@ static void shell_pend_on_txdone(const struct shell *sh)
 	}
 }
 
+#ifdef CONFIG_SHELL_ASYNC_TX
+static void shell_write_async(const struct shell *sh, const void *data,
+			      size_t length)
+{
+	uint32_t written = ring_buf_put(&sh->ctx->tx_ringbuf, data, length);
+
+	if (written < length) {
+		atomic_add(&sh->ctx->tx_dropped, length - written);
+	}
+
+	if (written > 0) {
+		/* Wake up the shell thread to drain the ring buffer. */
+		(void)k_poll_signal_raise(
+				&sh->ctx->signals[SHELL_SIGNAL_TXDONE], 0);
+	}
+}
+
+void z_shell_tx_flush(const struct shell *sh)
+{
+	uint8_t *data;
+	uint32_t size;
+
+	while ((size = ring_buf_get_claim(&sh->ctx->tx_ringbuf, &data,
+				ring_buf_capacity_get(&sh->ctx->tx_ringbuf)))
+	       > 0) {
+		size_t cnt = 0;
+		int err = sh->iface->api->write(sh->iface, data, size, &cnt);
+
+		(void)err;
+		__ASSERT_NO_MSG(err == 0);
+		(void)ring_buf_get_finish(&sh->ctx->tx_ringbuf, cnt);
+		if (cnt < size) {
+			/* Transport full. Draining continues when the
+			 * transport signals TXDONE again.
+			 */
+			break;
+		}
+	}
+}
+#endif /* CONFIG_SHELL_ASYNC_TX */
+
 void z_shell_write(const struct shell *sh, const void *data,
 		 size_t length)
 {
 	__ASSERT_NO_MSG(sh && data);
 
+#ifdef CONFIG_SHELL_ASYNC_TX
+	/* In panic or synchronous mode output is written directly to the
+	 * transport as the shell thread may not be running anymore.
+	 */
+	if (!z_flag_sync_mode_get(sh) &&
+	    (sh->ctx->state != SHELL_STATE_PANIC_MODE_ACTIVE)) {
+		shell_write_async(sh, data, length);
+		return;
+	}
+#endif
+
 	size_t offset = 0;
 	size_t tmp_cnt;
 
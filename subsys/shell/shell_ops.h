@@ -340,6 +340,14 @@ void z_shell_print_prompt_and_cmd(const struct shell *sh);
  */
 void z_shell_write(const struct shell *sh, const void *data, size_t length);
 
+#ifdef CONFIG_SHELL_ASYNC_TX
+/* Function draining the asynchronous output ring buffer to the transport.
+ * Called from the shell thread whenever TXDONE is signaled, either by a
+ * producer queuing new data or by the transport completing a transfer.
+ */
+void z_shell_tx_flush(const struct shell *sh);
+#endif
+
 /**
  * @internal @brief This function shall not be used directly, it is required by
  *		    the fprintf module.
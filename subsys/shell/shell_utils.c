@@ -266,16 +266,31 @@ static inline uint32_t shell_root_cmd_count(void)
 	return len;
 }
 
-/* Function returning pointer to parent command matching requested syntax. */
+/* Function returning pointer to parent command matching requested syntax.
+ *
+ * Root commands are placed in a dedicated memory section which the linker
+ * sorts by entry name (see SORT_BY_NAME in the iterable section macros).
+ * Entry names embed the command syntax, so the section is ordered by
+ * strcmp() on the syntax and commands can be resolved with a binary
+ * search instead of a linear scan.
+ */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
-	const size_t cmd_count = shell_root_cmd_count();
-	const union shell_cmd_entry *cmd;
+	size_t low = 0;
+	size_t high = shell_root_cmd_count();
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
-		cmd = shell_root_cmd_get(cmd_idx);
-		if (strcmp(syntax, cmd->entry->syntax) == 0) {
-			return cmd->entry;
+	while (low < high) {
+		const size_t mid = low + (high - low) / 2;
+		const struct shell_static_entry *entry =
+						shell_root_cmd_get(mid)->entry;
+		int cmp = strcmp(syntax, entry->syntax);
+
+		if (cmp == 0) {
+			return entry;
+		} else if (cmp < 0) {
+			high = mid;
+		} else {
+			low = mid + 1;
 		}
 	}
 
@@ -343,6 +358,14 @@ const struct shell_static_entry *z_shell_find_cmd(
 	struct shell_static_entry parent_cpy;
 	size_t idx = 0;
 
+	/* Root commands are sorted by syntax and are resolved with a
+	 * binary search. Subcommand arrays have no ordering guarantee and
+	 * dynamic commands none at all, so those levels stay linear.
+	 */
+	if (parent == NULL) {
+		return root_cmd_find(cmd_str);
+	}
+
 	/* Dynamic command operates on shared memory. If we are processing two
 	 * dynamic commands at the same time (current and subcommand) they
 	 * will operate on the same memory region what can cause undefined
@@ -66,29 +66,50 @@ int flash_area_read(const struct flash_area *fa, off_t off, void *dst,
 int flash_area_write(const struct flash_area *fa, off_t off, const void *src,
 		     size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
-	return flash_write(fa->fa_dev, fa->fa_off + off, (void *)src, len);
+	rc = flash_write(fa->fa_dev, fa->fa_off + off, (void *)src, len);
+	if (rc == 0) {
+		flash_map_stats_account_write(fa, len);
+	}
+
+	return rc;
 }
 
 int flash_area_erase(const struct flash_area *fa, off_t off, size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
-	return flash_erase(fa->fa_dev, fa->fa_off + off, len);
+	rc = flash_erase(fa->fa_dev, fa->fa_off + off, len);
+	if (rc == 0) {
+		flash_map_stats_account_erase(fa, len);
+	}
+
+	return rc;
 }
 
 int flash_area_flatten(const struct flash_area *fa, off_t off, size_t len)
 {
+	int rc;
+
 	if (!is_in_flash_area_bounds(fa, off, len)) {
 		return -EINVAL;
 	}
 
-	return flash_flatten(fa->fa_dev, fa->fa_off + off, len);
+	rc = flash_flatten(fa->fa_dev, fa->fa_off + off, len);
+	if (rc == 0) {
+		flash_map_stats_account_erase(fa, len);
+	}
+
+	return rc;
 }
 
 uint32_t flash_area_align(const struct flash_area *fa)
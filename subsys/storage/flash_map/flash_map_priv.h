@@ -36,4 +36,19 @@ static inline bool is_in_flash_area_bounds(const struct flash_area *fa,
 	return (off >= 0) && ((off + len) <= fa->fa_size);
 }
 
+#ifdef CONFIG_FLASH_MAP_STATS
+void flash_map_stats_account_write(const struct flash_area *fa, size_t len);
+void flash_map_stats_account_erase(const struct flash_area *fa, size_t len);
+#else
+static inline void flash_map_stats_account_write(const struct flash_area *fa,
+						 size_t len)
+{
+}
+
+static inline void flash_map_stats_account_erase(const struct flash_area *fa,
+						 size_t len)
+{
+}
+#endif /* CONFIG_FLASH_MAP_STATS */
+
 #endif /* ZEPHYR_SUBSYS_STORAGE_FLASH_MAP_PRIV_H_ */
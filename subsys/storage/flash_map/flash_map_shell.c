@@ -56,9 +56,38 @@ static int cmd_flash_map_list(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_FLASH_MAP_STATS
+static void fa_stats_cb(const struct flash_area *fa, void *user_data)
+{
+	struct shell *sh = user_data;
+	struct flash_area_stats stats;
+
+	if (flash_area_stats_get(fa, &stats) != 0) {
+		return;
+	}
+	shell_print(sh, "%2d   %-26s  %10u  %14llu  %10u  %14llu",
+		    (int)fa->fa_id, fa->fa_dev->name, stats.write_count,
+		    (unsigned long long)stats.bytes_written, stats.erase_count,
+		    (unsigned long long)stats.bytes_erased);
+}
+
+static int cmd_flash_map_stats(const struct shell *sh, size_t argc,
+			       char **argv)
+{
+	shell_print(sh, "ID | Device Name               "
+			"| Writes     | Bytes written  | Erases     | Bytes erased");
+	shell_print(sh, "---------------------------------------------"
+			"--------------------------------------------");
+	flash_area_foreach(fa_stats_cb, (struct shell *)sh);
+	return 0;
+}
+#endif /* CONFIG_FLASH_MAP_STATS */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_flash_map,
 	/* Alphabetically sorted. */
 	SHELL_CMD(list, NULL, "List flash areas", cmd_flash_map_list),
+	SHELL_COND_CMD(CONFIG_FLASH_MAP_STATS, stats, NULL,
+		       "Show flash area access statistics", cmd_flash_map_stats),
 	SHELL_SUBCMD_SET_END /* Array terminated. */
 );
 
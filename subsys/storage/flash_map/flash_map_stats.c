@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include "flash_map_priv.h"
+
+#ifdef CONFIG_FLASH_MAP_STATS_PERSIST
+#include <zephyr/settings/settings.h>
+#include <stdio.h>
+#endif
+
+/* Counters are kept per flash map slot; areas beyond the table size are
+ * not accounted. A spinlock protects read-modify-write of the 64-bit
+ * byte counters, which may be updated from any context.
+ */
+static struct flash_area_stats stats_tbl[CONFIG_FLASH_MAP_STATS_MAX_AREAS];
+static struct k_spinlock stats_lock;
+
+static struct flash_area_stats *stats_slot(const struct flash_area *fa)
+{
+	for (int i = 0; i < flash_map_entries &&
+	     i < (int)ARRAY_SIZE(stats_tbl); i++) {
+		if (flash_map[i].fa_id == fa->fa_id) {
+			return &stats_tbl[i];
+		}
+	}
+	return NULL;
+}
+
+void flash_map_stats_account_write(const struct flash_area *fa, size_t len)
+{
+	struct flash_area_stats *stats = stats_slot(fa);
+	k_spinlock_key_t key;
+
+	if (stats == NULL) {
+		return;
+	}
+	key = k_spin_lock(&stats_lock);
+	stats->write_count++;
+	stats->bytes_written += len;
+	k_spin_unlock(&stats_lock, key);
+}
+
+void flash_map_stats_account_erase(const struct flash_area *fa, size_t len)
+{
+	struct flash_area_stats *stats = stats_slot(fa);
+	k_spinlock_key_t key;
+
+	if (stats == NULL) {
+		return;
+	}
+	key = k_spin_lock(&stats_lock);
+	stats->erase_count++;
+	stats->bytes_erased += len;
+	k_spin_unlock(&stats_lock, key);
+}
+
+int flash_area_stats_get(const struct flash_area *fa,
+			 struct flash_area_stats *stats)
+{
+	struct flash_area_stats *slot;
+	k_spinlock_key_t key;
+
+	if (fa == NULL || stats == NULL) {
+		return -EINVAL;
+	}
+	slot = stats_slot(fa);
+	if (slot == NULL) {
+		return -ENOENT;
+	}
+	key = k_spin_lock(&stats_lock);
+	*stats = *slot;
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+
+int flash_area_stats_reset(const struct flash_area *fa)
+{
+	struct flash_area_stats *slot;
+	k_spinlock_key_t key;
+
+	if (fa == NULL) {
+		return -EINVAL;
+	}
+	slot = stats_slot(fa);
+	if (slot == NULL) {
+		return -ENOENT;
+	}
+	key = k_spin_lock(&stats_lock);
+	*slot = (struct flash_area_stats){ 0 };
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_FLASH_MAP_STATS_PERSIST
+
+static int fa_stats_settings_set(const char *key, size_t len,
+				 settings_read_cb read_cb, void *cb_arg)
+{
+	struct flash_area_stats loaded;
+	const struct flash_area *fa;
+	struct flash_area_stats *slot;
+	k_spinlock_key_t lock_key;
+	char *end;
+	long id;
+
+	id = strtol(key, &end, 10);
+	if ((end == key) || (id < 0)) {
+		return -ENOENT;
+	}
+	fa = get_flash_area_from_id(id);
+	if (fa == NULL) {
+		return -ENOENT;
+	}
+	slot = stats_slot(fa);
+	if (slot == NULL) {
+		return -ENOENT;
+	}
+	if (len != sizeof(loaded)) {
+		return -EINVAL;
+	}
+	if (read_cb(cb_arg, &loaded, sizeof(loaded)) != sizeof(loaded)) {
+		return -EIO;
+	}
+	/* Persisted totals are the baseline the runtime counters grow on */
+	lock_key = k_spin_lock(&stats_lock);
+	slot->write_count += loaded.write_count;
+	slot->erase_count += loaded.erase_count;
+	slot->bytes_written += loaded.bytes_written;
+	slot->bytes_erased += loaded.bytes_erased;
+	k_spin_unlock(&stats_lock, lock_key);
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(flash_map_stats, "fa_stats", NULL,
+			       fa_stats_settings_set, NULL, NULL);
+
+int flash_area_stats_save(void)
+{
+	char name[sizeof("fa_stats/255")];
+	int rc = 0;
+
+	for (int i = 0; i < flash_map_entries &&
+	     i < (int)ARRAY_SIZE(stats_tbl); i++) {
+		struct flash_area_stats snapshot;
+		k_spinlock_key_t key;
+		int rc2;
+
+		key = k_spin_lock(&stats_lock);
+		snapshot = stats_tbl[i];
+		k_spin_unlock(&stats_lock, key);
+
+		if (snapshot.write_count == 0 && snapshot.erase_count == 0) {
+			continue;
+		}
+
+		snprintf(name, sizeof(name), "fa_stats/%u",
+			 (unsigned int)flash_map[i].fa_id);
+		rc2 = settings_save_one(name, &snapshot, sizeof(snapshot));
+		if (rc2 != 0 && rc == 0) {
+			rc = rc2;
+		}
+	}
+
+	return rc;
+}
+
+#endif /* CONFIG_FLASH_MAP_STATS_PERSIST */
@@ -122,23 +122,21 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Erase as needed, pad to write-block-size and program buf at write_addr.
+ * Does not touch the write progress accounting.
+ */
+static int flash_sync_buf(struct stream_flash_ctx *ctx, uint8_t *buf,
+			  size_t buf_bytes, size_t write_addr)
 {
 	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
 	size_t buf_bytes_aligned;
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
+					     write_addr + buf_bytes - 1);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
 				rc, write_addr);
@@ -147,17 +145,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -169,42 +167,155 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
+	return rc;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_sync_buf(ctx, ctx->buf, ctx->buf_bytes,
+			    ctx->offset + ctx->bytes_written);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
 	return rc;
 }
 
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+
+static void write_work_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, write_work);
+
+	ctx->write_rc = flash_sync_buf(ctx, ctx->write_buf,
+				       ctx->write_buf_bytes, ctx->write_addr);
+	k_sem_give(&ctx->write_done);
+}
+
+/* Wait for an outstanding background write and fold its result into the
+ * write progress. Leaves the completion semaphore taken; the caller either
+ * submits the next write or gives the semaphore back.
+ */
+static int flash_async_collect(struct stream_flash_ctx *ctx)
+{
+	k_sem_take(&ctx->write_done, K_FOREVER);
+
+	if (!ctx->write_pending) {
+		return 0;
+	}
+	ctx->write_pending = false;
+	if (ctx->write_rc != 0) {
+		return ctx->write_rc;
+	}
+	ctx->bytes_written += ctx->write_buf_bytes;
+
+	return 0;
+}
+
+/* Hand the filled buffer half over to the work item and continue filling
+ * the other half. Blocks only when the previous half is still being
+ * programmed.
+ */
+static int flash_async_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *full_buf = ctx->buf;
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	rc = flash_async_collect(ctx);
+	if (rc != 0) {
+		k_sem_give(&ctx->write_done);
+		return rc;
+	}
+
+	ctx->write_buf = full_buf;
+	ctx->write_buf_bytes = ctx->buf_bytes;
+	ctx->write_addr = ctx->offset + ctx->bytes_written;
+	ctx->write_pending = true;
+
+	ctx->buf = ctx->buf_alt;
+	ctx->buf_alt = full_buf;
+	ctx->buf_bytes = 0U;
+
+	k_work_submit(&ctx->write_work);
+
+	return 0;
+}
+
+/* Complete all outstanding background writes */
+static int flash_async_drain(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	rc = flash_async_collect(ctx);
+	k_sem_give(&ctx->write_done);
+
+	return rc;
+}
+
+#else /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
+static inline int flash_async_submit(struct stream_flash_ctx *ctx)
+{
+	return flash_sync(ctx);
+}
+
+static inline int flash_async_drain(struct stream_flash_ctx *ctx)
+{
+	return 0;
+}
+
+#endif /* CONFIG_STREAM_FLASH_DOUBLE_BUFFER */
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
 	int processed = 0;
 	int rc = 0;
 	int buf_empty_bytes;
+	size_t pending = 0;
 
 	if (!ctx) {
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	if (ctx->write_pending) {
+		pending = ctx->write_buf_bytes;
+	}
+#endif
+	if (ctx->bytes_written + pending + ctx->buf_bytes + len >
+	    ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -214,7 +325,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		       buf_empty_bytes);
 
 		ctx->buf_bytes = ctx->buf_len;
-		rc = flash_sync(ctx);
+		rc = flash_async_submit(ctx);
 
 		if (rc != 0) {
 			return rc;
@@ -230,8 +341,14 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		ctx->buf_bytes += len - processed;
 	}
 
-	if (flush && ctx->buf_bytes > 0) {
-		rc = flash_sync(ctx);
+	if (flush) {
+		rc = flash_async_drain(ctx);
+		if (rc != 0) {
+			return rc;
+		}
+		if (ctx->buf_bytes > 0) {
+			rc = flash_sync(ctx);
+		}
 	}
 
 	return rc;
@@ -312,6 +429,21 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->fdev = fdev;
 	ctx->buf = buf;
 	ctx->buf_len = buf_len;
+#ifdef CONFIG_STREAM_FLASH_DOUBLE_BUFFER
+	/* The caller's buffer is split into two halves, one being filled
+	 * while the other is programmed in the background.
+	 */
+	if (buf_len % (2 * ctx->write_block_size)) {
+		LOG_ERR("Buffer is not splittable into write-block-size aligned halves");
+		return -EFAULT;
+	}
+	ctx->buf_len = buf_len / 2;
+	ctx->buf_alt = buf + ctx->buf_len;
+	k_work_init(&ctx->write_work, write_work_handler);
+	k_sem_init(&ctx->write_done, 1, 1);
+	ctx->write_pending = false;
+	ctx->write_rc = 0;
+#endif
 	ctx->bytes_written = 0;
 	ctx->buf_bytes = 0U;
 	ctx->offset = offset;
@@ -44,6 +44,10 @@ static struct k_spinlock channels_lock;
 /* timer used for watchdog handling */
 static struct k_timer timer;
 
+/* deadline the timer is currently armed for and the channel owning it */
+static uintptr_t armed_channel_id;
+static int64_t armed_timeout_ticks = INT64_MAX;
+
 #ifdef CONFIG_TASK_WDT_HW_FALLBACK
 /* pointer to the hardware watchdog used as a fallback */
 static const struct device *hw_wdt_dev;
@@ -75,6 +79,8 @@ static void schedule_next_timeout(int64_t current_ticks)
 	}
 
 	/* update task wdt kernel timer */
+	armed_channel_id = next_channel_id;
+	armed_timeout_ticks = next_timeout;
 	k_timer_user_data_set(&timer, (void *)next_channel_id);
 	k_timer_start(&timer, K_TIMEOUT_ABS_TICKS(next_timeout), K_FOREVER);
 
@@ -217,6 +223,7 @@ int task_wdt_delete(int channel_id)
 int task_wdt_feed(int channel_id)
 {
 	int64_t current_ticks;
+	int64_t new_timeout;
 
 	if (channel_id < 0 || channel_id >= ARRAY_SIZE(channels)) {
 		return -EINVAL;
@@ -233,10 +240,22 @@ int task_wdt_feed(int channel_id)
 	current_ticks = sys_clock_tick_get();
 
 	/* feed the specified channel */
-	channels[channel_id].timeout_abs_ticks = current_ticks +
+	new_timeout = current_ticks +
 		k_ms_to_ticks_ceil64(channels[channel_id].reload_period);
-
-	schedule_next_timeout(current_ticks);
+	channels[channel_id].timeout_abs_ticks = new_timeout;
+
+	/* The timer is armed for the earliest deadline of all channels.
+	 * Feeding can only move the fed channel's deadline further out, so
+	 * unless this channel owns the armed deadline (a new minimum must be
+	 * searched) or its new deadline undercuts the armed one (a shorter
+	 * period channel fed for the first time in a while), the armed timer
+	 * stays correct and neither the channel scan nor the timer
+	 * reprogramming is needed.
+	 */
+	if ((uintptr_t)channel_id == armed_channel_id ||
+	    new_timeout < armed_timeout_ticks) {
+		schedule_next_timeout(current_ticks);
+	}
 
 	k_sched_unlock();
 
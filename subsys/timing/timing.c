@@ -12,6 +12,12 @@
 static bool has_inited;
 static atomic_val_t started_ref;
 
+/* Nanoseconds per counter cycle in Q32 fixed point format, calibrated
+ * once in timing_init() so that hot path conversions are a multiply and
+ * a shift instead of a 64-bit divide.
+ */
+static uint64_t cycles_to_ns_q32;
+
 void timing_init(void)
 {
 	if (has_inited) {
@@ -26,9 +32,39 @@ void timing_init(void)
 	arch_timing_init();
 #endif
 
+	uint64_t freq = timing_freq_get();
+
+	if (freq != 0U) {
+		cycles_to_ns_q32 = ((uint64_t)NSEC_PER_SEC << 32) / freq;
+	}
+
 	has_inited = true;
 }
 
+uint64_t timing_cycles_to_ns_fast(uint64_t cycles)
+{
+	uint64_t factor = cycles_to_ns_q32;
+
+	if (unlikely(factor == 0U)) {
+		/* Not calibrated yet, fall back to the backend divide */
+		return timing_cycles_to_ns(cycles);
+	}
+
+	/* (cycles * factor) >> 32 without overflowing the intermediate
+	 * product: split cycles into 32-bit halves.
+	 */
+	return ((cycles >> 32) * factor) +
+	       (((cycles & 0xffffffffU) * factor) >> 32);
+}
+
+void timing_cycles_to_ns_batch(const uint64_t *cycles, uint64_t *ns,
+			       size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		ns[i] = timing_cycles_to_ns_fast(cycles[i]);
+	}
+}
+
 void timing_start(void)
 {
 	if (atomic_inc(&started_ref) != 0) {
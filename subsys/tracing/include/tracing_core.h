@@ -14,9 +14,19 @@
 extern "C" {
 #endif
 
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+/* Each CPU produces into its own ring, so the put path only needs to
+ * keep the producer on its CPU and lock out local interrupts instead of
+ * taking the global IRQ lock (z_smp_global_lock() on SMP).
+ */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
@@ -5,11 +5,37 @@
  */
 
 #include <zephyr/sys/ring_buffer.h>
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+#include <zephyr/kernel_structs.h>
+#endif
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+#define TRACING_NUM_RINGS CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TRACING_NUM_RINGS 1
+#endif
+
+static struct ring_buf tracing_ring_buf[TRACING_NUM_RINGS];
+static uint8_t tracing_buffer[TRACING_NUM_RINGS][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+/* Ring the consumer (tracing thread) is currently draining. */
+static uint8_t drain_ring;
+
+static inline struct ring_buf *put_ring_get(void)
+{
+#ifdef CONFIG_TRACING_PERCPU_BUFFERS
+	/* Producers run with local interrupts locked (TRACING_LOCK), so
+	 * they cannot migrate between put claim and finish. Each ring
+	 * therefore has a single producer and a single consumer (the
+	 * tracing thread) and needs no further synchronization.
+	 */
+	return &tracing_ring_buf[arch_curr_cpu()->id];
+#else
+	return &tracing_ring_buf[0];
+#endif
+}
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +45,83 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_ring_get(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	return ring_buf_put_finish(put_ring_get(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	return ring_buf_put(put_ring_get(), data, size);
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	uint32_t claimed_size;
+
+	for (uint8_t i = 0; i < TRACING_NUM_RINGS; i++) {
+		claimed_size = ring_buf_get_claim(&tracing_ring_buf[drain_ring],
+						  data, size);
+		if (claimed_size > 0) {
+			return claimed_size;
+		}
+
+		drain_ring = (drain_ring + 1) % TRACING_NUM_RINGS;
+	}
+
+	return 0;
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	return ring_buf_get_finish(&tracing_ring_buf[drain_ring], size);
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	uint32_t read_size;
+
+	for (uint8_t i = 0; i < TRACING_NUM_RINGS; i++) {
+		read_size = ring_buf_get(&tracing_ring_buf[drain_ring],
+					 data, size);
+		if (read_size > 0) {
+			return read_size;
+		}
+
+		drain_ring = (drain_ring + 1) % TRACING_NUM_RINGS;
+	}
+
+	return 0;
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (uint8_t i = 0; i < TRACING_NUM_RINGS; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	for (uint8_t i = 0; i < TRACING_NUM_RINGS; i++) {
+		if (!ring_buf_is_empty(&tracing_ring_buf[i])) {
+			return false;
+		}
+	}
+
+	return true;
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_ring_get());
 }
@@ -35,7 +35,8 @@
 LOG_MODULE_REGISTER(usbd_cdc_acm, CONFIG_USBD_CDC_ACM_LOG_LEVEL);
 
 UDC_BUF_POOL_DEFINE(cdc_acm_ep_pool,
-		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) * 2,
+		    DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT) *
+		    (1 + CONFIG_USBD_CDC_ACM_TX_TRANSFERS),
 		    512, sizeof(struct udc_buf_info), NULL);
 
 #define CDC_ACM_DEFAULT_LINECODING	{sys_cpu_to_le32(115200), 0, 0, 8}
@@ -49,7 +50,6 @@ UDC_BUF_POOL_DEFINE(cdc_acm_ep_pool,
 #define CDC_ACM_IRQ_RX_ENABLED		2
 #define CDC_ACM_IRQ_TX_ENABLED		3
 #define CDC_ACM_RX_FIFO_BUSY		4
-#define CDC_ACM_TX_FIFO_BUSY		5
 
 static struct k_work_q cdc_acm_work_q;
 static K_KERNEL_STACK_DEFINE(cdc_acm_stack,
@@ -116,6 +116,8 @@ struct cdc_acm_uart_data {
 	/* USBD CDC ACM RX fifo work */
 	struct k_work rx_fifo_work;
 	atomic_t state;
+	/* Number of bulk IN transfers in flight */
+	atomic_t tx_in_flight;
 	struct k_sem notif_sem;
 };
 
@@ -230,7 +232,7 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 		}
 
 		if (bi->ep == cdc_acm_get_bulk_in(c_data)) {
-			atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+			atomic_dec(&data->tx_in_flight);
 		}
 
 		goto ep_request_error;
@@ -256,7 +258,7 @@ static int usbd_cdc_acm_request(struct usbd_class_data *const c_data,
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
 
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		atomic_dec(&data->tx_in_flight);
 
 		if (!ring_buf_is_empty(data->tx_fifo.rb)) {
 			/* Queue pending TX data on IN endpoint */
@@ -561,26 +563,28 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 		return;
 	}
 
-	if (atomic_test_and_set_bit(&data->state, CDC_ACM_TX_FIFO_BUSY)) {
-		LOG_DBG("TX transfer already in progress");
-		return;
-	}
-
-	buf = cdc_acm_buf_alloc(cdc_acm_get_bulk_in(c_data));
-	if (buf == NULL) {
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
-		cdc_acm_work_schedule(&data->tx_fifo_work, K_MSEC(1));
-		return;
-	}
+	/* Keep up to CONFIG_USBD_CDC_ACM_TX_TRANSFERS transfers in flight
+	 * so the controller can start the next buffer back-to-back.
+	 */
+	while (!ring_buf_is_empty(data->tx_fifo.rb) &&
+	       atomic_get(&data->tx_in_flight) < CONFIG_USBD_CDC_ACM_TX_TRANSFERS) {
+		buf = cdc_acm_buf_alloc(cdc_acm_get_bulk_in(c_data));
+		if (buf == NULL) {
+			cdc_acm_work_schedule(&data->tx_fifo_work, K_MSEC(1));
+			return;
+		}
 
-	len = ring_buf_get(data->tx_fifo.rb, buf->data, buf->size);
-	net_buf_add(buf, len);
+		len = ring_buf_get(data->tx_fifo.rb, buf->data, buf->size);
+		net_buf_add(buf, len);
 
-	ret = usbd_ep_enqueue(c_data, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue");
-		net_buf_unref(buf);
-		atomic_clear_bit(&data->state, CDC_ACM_TX_FIFO_BUSY);
+		atomic_inc(&data->tx_in_flight);
+		ret = usbd_ep_enqueue(c_data, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue");
+			net_buf_unref(buf);
+			atomic_dec(&data->tx_in_flight);
+			return;
+		}
 	}
 }
 
@@ -848,7 +852,7 @@ static void cdc_acm_irq_cb_handler(struct k_work *work)
 
 	if (data->tx_fifo.altered) {
 		LOG_DBG("tx fifo altered, submit work");
-		if (!atomic_test_bit(&data->state, CDC_ACM_TX_FIFO_BUSY)) {
+		if (atomic_get(&data->tx_in_flight) < CONFIG_USBD_CDC_ACM_TX_TRANSFERS) {
 			cdc_acm_work_schedule(&data->tx_fifo_work, K_NO_WAIT);
 		}
 	}
@@ -89,11 +89,40 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 		break;
 	}
 	case ZBUS_OBSERVER_SUBSCRIBER_TYPE: {
+		if (obs->data->keep_latest) {
+			const struct zbus_channel *dropped;
+
+			/* Never block the publisher: drop the oldest pending
+			 * notification when the queue is full. Subscribers read
+			 * the channel's current message, so the newest
+			 * publication is the one consumed.
+			 */
+			while (k_msgq_put(obs->queue, &chan, K_NO_WAIT) != 0) {
+				(void)k_msgq_get(obs->queue, &dropped, K_NO_WAIT);
+			}
+
+			return 0;
+		}
+
 		return k_msgq_put(obs->queue, &chan, sys_timepoint_timeout(end_time));
 	}
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER)
 	case ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE: {
-		struct net_buf *cloned_buf = net_buf_clone(buf, sys_timepoint_timeout(end_time));
+		k_timeout_t timeout = obs->data->keep_latest ? K_NO_WAIT
+							     : sys_timepoint_timeout(end_time);
+		struct net_buf *cloned_buf = net_buf_clone(buf, timeout);
+
+		if (cloned_buf == NULL && obs->data->keep_latest) {
+			/* Reclaim the oldest pending message of this observer
+			 * and retry, keeping the newest publications.
+			 */
+			struct net_buf *oldest = k_fifo_get(obs->message_fifo, K_NO_WAIT);
+
+			if (oldest != NULL) {
+				net_buf_unref(oldest);
+				cloned_buf = net_buf_clone(buf, K_NO_WAIT);
+			}
+		}
 
 		if (cloned_buf == NULL) {
 			return -ENOMEM;
@@ -317,6 +346,40 @@ static inline int chan_lock(const struct zbus_channel *chan, k_timeout_t timeout
 	return 0;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+
+/* Lock-free read attempts before zbus_chan_read falls back to the
+ * channel semaphore.
+ */
+#define CHAN_SEQ_READ_RETRIES 4
+
+/* Sequence counter write side. Writers already own the channel semaphore, so
+ * the increments only race with the lock-free readers in zbus_chan_read.
+ */
+static inline void chan_seq_write_begin(const struct zbus_channel *chan)
+{
+	atomic_inc(&chan->data->seq);
+}
+
+static inline void chan_seq_write_end(const struct zbus_channel *chan)
+{
+	atomic_inc(&chan->data->seq);
+}
+
+#else
+
+static inline void chan_seq_write_begin(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+}
+
+static inline void chan_seq_write_end(const struct zbus_channel *chan)
+{
+	ARG_UNUSED(chan);
+}
+
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
+
 static inline void chan_unlock(const struct zbus_channel *chan, int prio)
 {
 	k_sem_give(&chan->data->sem);
@@ -360,8 +423,12 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 	chan->data->publish_count += 1;
 #endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 
+	chan_seq_write_begin(chan);
+
 	memcpy(chan->message, msg, chan->message_size);
 
+	chan_seq_write_end(chan);
+
 	err = _zbus_vded_exec(chan, end_time);
 
 	chan_unlock(chan, context_priority);
@@ -378,6 +445,40 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 		timeout = K_NO_WAIT;
 	}
 
+#if defined(CONFIG_ZBUS_CHANNEL_SEQLOCK)
+	k_timepoint_t end_time = sys_timepoint_calc(timeout);
+	uint32_t seq;
+
+	/* Bounded lock-free fast path. A claim owner keeps the counter odd
+	 * until the matching finish call, which is an unbounded,
+	 * caller-controlled window, and spinning on it (even with
+	 * k_yield(), which never runs lower priority threads) could keep a
+	 * preempted owner off the CPU indefinitely. After a few failed
+	 * attempts, block on the semaphore like the non-seqlock path.
+	 */
+	for (int retry = 0; retry < CHAN_SEQ_READ_RETRIES; retry++) {
+		seq = (uint32_t)atomic_get(&chan->data->seq);
+
+		if ((seq & 1U) == 0U) {
+			memcpy(msg, chan->message, chan->message_size);
+
+			if ((uint32_t)atomic_get(&chan->data->seq) == seq) {
+				return 0;
+			}
+		}
+	}
+
+	int err = k_sem_take(&chan->data->sem, sys_timepoint_timeout(end_time));
+	if (err) {
+		return err;
+	}
+
+	memcpy(msg, chan->message, chan->message_size);
+
+	k_sem_give(&chan->data->sem);
+
+	return 0;
+#else
 	int err = k_sem_take(&chan->data->sem, timeout);
 	if (err) {
 		return err;
@@ -388,6 +489,7 @@ int zbus_chan_read(const struct zbus_channel *chan, void *msg, k_timeout_t timeo
 	k_sem_give(&chan->data->sem);
 
 	return 0;
+#endif /* CONFIG_ZBUS_CHANNEL_SEQLOCK */
 }
 
 int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
@@ -430,6 +532,11 @@ int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 		return err;
 	}
 
+	/* The claim owner may modify the message directly, keep the sequence
+	 * counter odd until the matching finish call.
+	 */
+	chan_seq_write_begin(chan);
+
 	return 0;
 }
 
@@ -437,6 +544,8 @@ int zbus_chan_finish(const struct zbus_channel *chan)
 {
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
 
+	chan_seq_write_end(chan);
+
 	k_sem_give(&chan->data->sem);
 
 	return 0;
@@ -554,6 +663,17 @@ int zbus_obs_is_chan_notification_masked(const struct zbus_observer *obs,
 	return err;
 }
 
+int zbus_obs_set_keep_latest(const struct zbus_observer *obs, bool enabled)
+{
+	_ZBUS_ASSERT(obs != NULL, "obs is required");
+	_ZBUS_ASSERT(obs->type != ZBUS_OBSERVER_LISTENER_TYPE,
+		     "listeners are notified synchronously and have no queue");
+
+	obs->data->keep_latest = enabled;
+
+	return 0;
+}
+
 int zbus_obs_set_enable(const struct zbus_observer *obs, bool enabled)
 {
 	_ZBUS_ASSERT(obs != NULL, "obs is required");
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief zDSP basic math benchmark
+ *
+ * Measures the cycles per sample of the zdsp basic math operations for the
+ * currently selected DSP backend. The same binary built with different
+ * DSP_BACKEND choices (or different ISA extensions enabled in the backend
+ * library) gives directly comparable numbers, so backend ports can be
+ * validated against the scalar baseline. Results are folded into a checksum
+ * that is asserted on, so the measured loops cannot be optimized away.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#define BLOCK_SIZE 1024
+#define ITERATIONS 64
+
+static q15_t in_a_q15[BLOCK_SIZE];
+static q15_t in_b_q15[BLOCK_SIZE];
+static q15_t out_q15[BLOCK_SIZE];
+
+static q31_t in_a_q31[BLOCK_SIZE];
+static q31_t in_b_q31[BLOCK_SIZE];
+static q31_t out_q31[BLOCK_SIZE];
+
+static float32_t in_a_f32[BLOCK_SIZE];
+static float32_t in_b_f32[BLOCK_SIZE];
+static float32_t out_f32[BLOCK_SIZE];
+
+static void fill_inputs(void)
+{
+	uint32_t seed = 0x12345678;
+
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		/* xorshift: cheap deterministic pseudo-random data */
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+
+		in_a_q15[i] = (q15_t)seed;
+		in_b_q15[i] = (q15_t)(seed >> 16);
+		in_a_q31[i] = (q31_t)seed;
+		in_b_q31[i] = (q31_t)(seed * 2654435761U);
+		/* Keep floats in [-1, 1) so products stay well conditioned */
+		in_a_f32[i] = (float32_t)(int32_t)seed / 2147483648.0f;
+		in_b_f32[i] = (float32_t)(int32_t)(seed * 2654435761U) / 2147483648.0f;
+	}
+}
+
+static void report(const char *name, uint64_t cycles)
+{
+	uint64_t total = (uint64_t)BLOCK_SIZE * ITERATIONS;
+
+	TC_PRINT("%-16s: %u.%02u cycles/sample\n", name,
+		 (uint32_t)(cycles / total),
+		 (uint32_t)((cycles * 100ULL / total) % 100ULL));
+}
+
+#define MEASURE(name, op)                                                                          \
+	do {                                                                                       \
+		timing_t start;                                                                    \
+		timing_t end;                                                                      \
+                                                                                                   \
+		timing_start();                                                                    \
+		start = timing_counter_get();                                                      \
+		for (int it = 0; it < ITERATIONS; it++) {                                          \
+			op;                                                                        \
+		}                                                                                  \
+		end = timing_counter_get();                                                        \
+		timing_stop();                                                                     \
+		report(name, timing_cycles_get(&start, &end));                                     \
+	} while (0)
+
+static uint32_t checksum_q15(const q15_t *data)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		sum = (sum * 31) + (uint16_t)data[i];
+	}
+
+	return sum;
+}
+
+static uint32_t checksum_q31(const q31_t *data)
+{
+	uint32_t sum = 0;
+
+	for (size_t i = 0; i < BLOCK_SIZE; i++) {
+		sum = (sum * 31) + (uint32_t)data[i];
+	}
+
+	return sum;
+}
+
+ZTEST(dsp_perf, test_mult_perf)
+{
+	fill_inputs();
+
+	MEASURE("mult_q15", zdsp_mult_q15(in_a_q15, in_b_q15, out_q15, BLOCK_SIZE));
+	zassert_not_equal(checksum_q15(out_q15), 0, "mult_q15 produced no data");
+
+	MEASURE("mult_q31", zdsp_mult_q31(in_a_q31, in_b_q31, out_q31, BLOCK_SIZE));
+	zassert_not_equal(checksum_q31(out_q31), 0, "mult_q31 produced no data");
+
+	MEASURE("mult_f32", zdsp_mult_f32(in_a_f32, in_b_f32, out_f32, BLOCK_SIZE));
+	zassert_true(out_f32[0] == in_a_f32[0] * in_b_f32[0], "mult_f32 wrong result");
+}
+
+ZTEST(dsp_perf, test_add_perf)
+{
+	fill_inputs();
+
+	MEASURE("add_q15", zdsp_add_q15(in_a_q15, in_b_q15, out_q15, BLOCK_SIZE));
+	zassert_not_equal(checksum_q15(out_q15), 0, "add_q15 produced no data");
+
+	MEASURE("add_q31", zdsp_add_q31(in_a_q31, in_b_q31, out_q31, BLOCK_SIZE));
+	zassert_not_equal(checksum_q31(out_q31), 0, "add_q31 produced no data");
+
+	MEASURE("add_f32", zdsp_add_f32(in_a_f32, in_b_f32, out_f32, BLOCK_SIZE));
+	zassert_true(out_f32[0] == in_a_f32[0] + in_b_f32[0], "add_f32 wrong result");
+}
+
+ZTEST(dsp_perf, test_dot_prod_perf)
+{
+	q63_t result_q63 = 0;
+	float32_t result_f32 = 0.0f;
+
+	fill_inputs();
+
+	MEASURE("dot_prod_q15",
+		zdsp_dot_prod_q15(in_a_q15, in_b_q15, BLOCK_SIZE, &result_q63));
+	zassert_not_equal(result_q63, 0, "dot_prod_q15 produced no data");
+
+	result_q63 = 0;
+	MEASURE("dot_prod_q31",
+		zdsp_dot_prod_q31(in_a_q31, in_b_q31, BLOCK_SIZE, &result_q63));
+	zassert_not_equal(result_q63, 0, "dot_prod_q31 produced no data");
+
+	MEASURE("dot_prod_f32",
+		zdsp_dot_prod_f32(in_a_f32, in_b_f32, BLOCK_SIZE, &result_f32));
+	zassert_true(result_f32 != 0.0f, "dot_prod_f32 produced no data");
+}
+
+ZTEST(dsp_perf, test_scale_perf)
+{
+	fill_inputs();
+
+	MEASURE("scale_q15", zdsp_scale_q15(in_a_q15, 0x4000, 1, out_q15, BLOCK_SIZE));
+	zassert_not_equal(checksum_q15(out_q15), 0, "scale_q15 produced no data");
+
+	MEASURE("scale_q31", zdsp_scale_q31(in_a_q31, 0x40000000, 1, out_q31, BLOCK_SIZE));
+	zassert_not_equal(checksum_q31(out_q31), 0, "scale_q31 produced no data");
+
+	MEASURE("scale_f32", zdsp_scale_f32(in_a_f32, 0.5f, out_f32, BLOCK_SIZE));
+	zassert_true(out_f32[0] == in_a_f32[0] * 0.5f, "scale_f32 wrong result");
+}
+
+ZTEST_SUITE(dsp_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * IPC contention benchmark.
+ *
+ * Sweeps producer/consumer CPU placement for the kernel message passing
+ * primitives (k_msgq, k_fifo, k_pipe, k_sem) and zbus, with 1 to 4
+ * producer threads feeding a single consumer. Each scenario moves
+ * CONFIG_BENCHMARK_IPC_NUM_MSGS messages and prints one machine-readable
+ * CSV row:
+ *
+ *   primitive,placement,producers,messages,total_cycles,ns_per_msg
+ *
+ * The "same" placement pins all threads to CPU 0, "cross" pins the
+ * consumer to CPU 0 and spreads the producers over the remaining CPUs,
+ * so comparing the two rows isolates the cost of cross-core wakeups and
+ * scheduler/primitive lock contention from the cost of the primitive
+ * itself.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#ifdef CONFIG_ZBUS
+#include <zephyr/zbus/zbus.h>
+#endif
+
+#define MAX_PRODUCERS 4
+#define QUEUE_DEPTH   64
+
+#define BENCH_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BENCH_PRIORITY	 5
+
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stack, MAX_PRODUCERS, BENCH_STACK_SIZE);
+static K_THREAD_STACK_DEFINE(consumer_stack, BENCH_STACK_SIZE);
+
+static struct k_thread producer_thread[MAX_PRODUCERS];
+static struct k_thread consumer_thread;
+
+static K_SEM_DEFINE(consumer_done, 0, 1);
+static timing_t bench_end;
+
+struct ipc_ops {
+	const char *name;
+	void (*produce)(uint32_t count);
+	void (*consume)(uint32_t count);
+};
+
+/* k_msgq */
+
+K_MSGQ_DEFINE(bench_msgq, sizeof(uint32_t), QUEUE_DEPTH, 4);
+
+static void msgq_produce(uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		k_msgq_put(&bench_msgq, &i, K_FOREVER);
+	}
+}
+
+static void msgq_consume(uint32_t count)
+{
+	uint32_t value;
+
+	for (uint32_t i = 0; i < count; i++) {
+		k_msgq_get(&bench_msgq, &value, K_FOREVER);
+	}
+}
+
+/* k_fifo
+ *
+ * Nodes are recycled through a second "free" FIFO so that the data path
+ * is allocation free; every message therefore costs one get and one put
+ * on each side, on both placements alike.
+ */
+
+struct fifo_node {
+	void *reserved;
+	uint32_t payload;
+};
+
+static struct fifo_node fifo_nodes[QUEUE_DEPTH];
+
+static K_FIFO_DEFINE(bench_fifo);
+static K_FIFO_DEFINE(bench_fifo_free);
+
+static void fifo_produce(uint32_t count)
+{
+	struct fifo_node *node;
+
+	for (uint32_t i = 0; i < count; i++) {
+		node = k_fifo_get(&bench_fifo_free, K_FOREVER);
+		node->payload = i;
+		k_fifo_put(&bench_fifo, node);
+	}
+}
+
+static void fifo_consume(uint32_t count)
+{
+	struct fifo_node *node;
+
+	for (uint32_t i = 0; i < count; i++) {
+		node = k_fifo_get(&bench_fifo, K_FOREVER);
+		k_fifo_put(&bench_fifo_free, node);
+	}
+}
+
+/* k_pipe */
+
+K_PIPE_DEFINE(bench_pipe, QUEUE_DEPTH * sizeof(uint32_t), 4);
+
+static void pipe_produce(uint32_t count)
+{
+	size_t written;
+
+	for (uint32_t i = 0; i < count; i++) {
+		k_pipe_put(&bench_pipe, &i, sizeof(i), &written, sizeof(i),
+			   K_FOREVER);
+	}
+}
+
+static void pipe_consume(uint32_t count)
+{
+	uint32_t value;
+	size_t bytes_read;
+
+	for (uint32_t i = 0; i < count; i++) {
+		k_pipe_get(&bench_pipe, &value, sizeof(value), &bytes_read,
+			   sizeof(value), K_FOREVER);
+	}
+}
+
+/* k_sem */
+
+static K_SEM_DEFINE(bench_sem, 0, K_SEM_MAX_LIMIT);
+
+static void sem_produce(uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_give(&bench_sem);
+	}
+}
+
+static void sem_consume(uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++) {
+		k_sem_take(&bench_sem, K_FOREVER);
+	}
+}
+
+/* zbus */
+
+#ifdef CONFIG_ZBUS
+
+struct bench_msg {
+	uint32_t seq;
+};
+
+ZBUS_CHAN_DEFINE(bench_chan, struct bench_msg, NULL, NULL,
+		 ZBUS_OBSERVERS(bench_sub), ZBUS_MSG_INIT(.seq = 0));
+
+ZBUS_SUBSCRIBER_DEFINE(bench_sub, QUEUE_DEPTH);
+
+static void zbus_produce(uint32_t count)
+{
+	struct bench_msg msg;
+
+	for (uint32_t i = 0; i < count; i++) {
+		msg.seq = i;
+		zbus_chan_pub(&bench_chan, &msg, K_FOREVER);
+	}
+}
+
+static void zbus_consume(uint32_t count)
+{
+	const struct zbus_channel *chan;
+	struct bench_msg msg;
+
+	for (uint32_t i = 0; i < count; i++) {
+		zbus_sub_wait(&bench_sub, &chan, K_FOREVER);
+		zbus_chan_read(chan, &msg, K_FOREVER);
+	}
+}
+
+#endif /* CONFIG_ZBUS */
+
+static const struct ipc_ops ipc_primitives[] = {
+	{"msgq", msgq_produce, msgq_consume},
+	{"fifo", fifo_produce, fifo_consume},
+	{"pipe", pipe_produce, pipe_consume},
+	{"sem", sem_produce, sem_consume},
+#ifdef CONFIG_ZBUS
+	{"zbus", zbus_produce, zbus_consume},
+#endif
+};
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	const struct ipc_ops *ops = p1;
+
+	ARG_UNUSED(p3);
+
+	ops->produce((uint32_t)(uintptr_t)p2);
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	const struct ipc_ops *ops = p1;
+
+	ARG_UNUSED(p3);
+
+	ops->consume((uint32_t)(uintptr_t)p2);
+
+	bench_end = timing_counter_get();
+	k_sem_give(&consumer_done);
+}
+
+static void pin_thread(k_tid_t tid, int cpu)
+{
+	ARG_UNUSED(tid);
+	ARG_UNUSED(cpu);
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	k_thread_cpu_pin(tid, cpu % arch_num_cpus());
+#endif
+}
+
+static void run_scenario(const struct ipc_ops *ops, unsigned int producers,
+			 bool cross)
+{
+	uint32_t per_producer = CONFIG_BENCHMARK_IPC_NUM_MSGS / producers;
+	uint32_t total = per_producer * producers;
+	timing_t start;
+	uint64_t cycles;
+	k_tid_t tid;
+
+	tid = k_thread_create(&consumer_thread, consumer_stack,
+			      BENCH_STACK_SIZE, consumer_entry, (void *)ops,
+			      (void *)(uintptr_t)total, NULL, BENCH_PRIORITY,
+			      0, K_FOREVER);
+	pin_thread(tid, 0);
+
+	for (unsigned int i = 0; i < producers; i++) {
+		tid = k_thread_create(&producer_thread[i], producer_stack[i],
+				      BENCH_STACK_SIZE, producer_entry,
+				      (void *)ops,
+				      (void *)(uintptr_t)per_producer, NULL,
+				      BENCH_PRIORITY, 0, K_FOREVER);
+		pin_thread(tid, cross ? (int)(1 + i) : 0);
+	}
+
+	start = timing_counter_get();
+
+	k_thread_start(&consumer_thread);
+	for (unsigned int i = 0; i < producers; i++) {
+		k_thread_start(&producer_thread[i]);
+	}
+
+	k_sem_take(&consumer_done, K_FOREVER);
+
+	for (unsigned int i = 0; i < producers; i++) {
+		k_thread_join(&producer_thread[i], K_FOREVER);
+	}
+	k_thread_join(&consumer_thread, K_FOREVER);
+
+	cycles = timing_cycles_get(&start, &bench_end);
+
+	printk("%s,%s,%u,%u,%llu,%u\n", ops->name, cross ? "cross" : "same",
+	       producers, total, cycles,
+	       (uint32_t)(timing_cycles_to_ns(cycles) / total));
+}
+
+int main(void)
+{
+	unsigned int max_producers = MIN(MAX_PRODUCERS,
+					 CONFIG_BENCHMARK_IPC_NUM_MSGS);
+	bool can_cross = IS_ENABLED(CONFIG_SCHED_CPU_MASK) &&
+			 arch_num_cpus() > 1;
+
+	for (size_t i = 0; i < ARRAY_SIZE(fifo_nodes); i++) {
+		k_fifo_put(&bench_fifo_free, &fifo_nodes[i]);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("primitive,placement,producers,messages,total_cycles,ns_per_msg\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(ipc_primitives); i++) {
+		for (unsigned int producers = 1; producers <= max_producers;
+		     producers++) {
+			run_scenario(&ipc_primitives[i], producers, false);
+			if (can_cross) {
+				run_scenario(&ipc_primitives[i], producers,
+					     true);
+			}
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Storage backend benchmark
+ *
+ * Runs the same key/value update and read-back workload against NVS, ZMS
+ * or littlefs on top of the flash simulator and reports throughput, p99
+ * operation latency and write amplification (flash bytes programmed per
+ * payload byte), so backend trade-offs can be compared with data instead
+ * of folklore. Enable CONFIG_FLASH_SIMULATOR_SIMULATE_TIMING together
+ * with CONFIG_FLASH_SIMULATOR_TIME_PER_UNIT to make the latency figures
+ * reflect the request sizes the backend issues; the flash simulator
+ * per-page erase counters (flash_sim_stats) additionally expose the wear
+ * distribution.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <zephyr/drivers/flash.h>
+#include <zephyr/stats/stats.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/timing/timing.h>
+
+#ifdef CONFIG_NVS
+#include <zephyr/fs/nvs.h>
+#endif
+#ifdef CONFIG_ZMS
+#include <zephyr/fs/zms.h>
+#endif
+#ifdef CONFIG_FILE_SYSTEM_LITTLEFS
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/littlefs.h>
+#endif
+
+#define BENCH_AREA	  storage_partition
+#define BENCH_AREA_OFFSET FIXED_PARTITION_OFFSET(BENCH_AREA)
+#define BENCH_AREA_ID	  FIXED_PARTITION_ID(BENCH_AREA)
+#define BENCH_AREA_DEV	  DEVICE_DT_GET(DT_MTD_FROM_FIXED_PARTITION(DT_NODELABEL(BENCH_AREA)))
+
+#define BENCH_SECTOR_COUNT 8U
+
+/* Number of distinct records and total update operations; several updates
+ * per record force the backends into garbage collection so steady-state
+ * cost is measured, not just the cost of filling empty flash.
+ */
+#define BENCH_KEY_COUNT	 8U
+#define BENCH_VALUE_SIZE 32U
+#define BENCH_OPS	 400U
+
+static const struct device *const flash_dev = BENCH_AREA_DEV;
+
+static uint32_t lat_ns[BENCH_OPS];
+static uint8_t value_buf[BENCH_VALUE_SIZE];
+
+struct stat_query {
+	const char *name;
+	uint32_t value;
+};
+
+static int stat_query_cb(struct stats_hdr *hdr, void *arg, const char *name, uint16_t off)
+{
+	struct stat_query *q = arg;
+
+	if (strcmp(name, q->name) == 0) {
+		q->value = *(uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+
+static uint32_t flash_sim_stat_get(const char *name)
+{
+	struct stats_hdr *hdr = stats_group_find("flash_sim_stats");
+	struct stat_query q = {
+		.name = name,
+	};
+
+	if (hdr != NULL) {
+		stats_walk(hdr, stat_query_cb, &q);
+	}
+
+	return q.value;
+}
+
+static int lat_cmp(const void *a, const void *b)
+{
+	uint32_t la = *(const uint32_t *)a;
+	uint32_t lb = *(const uint32_t *)b;
+
+	return (la > lb) - (la < lb);
+}
+
+static void bench_report(const char *backend, const char *phase, uint32_t ops,
+			 uint64_t total_ns)
+{
+	uint64_t ops_per_sec = (ops * NSEC_PER_SEC) / total_ns;
+
+	qsort(lat_ns, ops, sizeof(lat_ns[0]), lat_cmp);
+
+	TC_PRINT("%s %s: %u ops in %u us, %u ops/s, avg %u us, p99 %u us\n",
+		 backend, phase, ops, (uint32_t)(total_ns / NSEC_PER_USEC),
+		 (uint32_t)ops_per_sec,
+		 (uint32_t)(total_ns / ops / NSEC_PER_USEC),
+		 lat_ns[(ops * 99U) / 100U] / (uint32_t)NSEC_PER_USEC);
+}
+
+static void bench_report_wa(const char *backend, uint32_t flash_written,
+			    uint32_t flash_erases, uint32_t payload)
+{
+	TC_PRINT("%s write amplification: %u flash bytes / %u payload bytes "
+		 "(%u.%02ux), %u erase calls\n",
+		 backend, flash_written, payload, flash_written / payload,
+		 ((uint64_t)flash_written * 100U / payload) % 100U,
+		 flash_erases);
+}
+
+static void value_fill(uint32_t op)
+{
+	for (size_t i = 0; i < sizeof(value_buf); i++) {
+		value_buf[i] = (uint8_t)(op + i);
+	}
+}
+
+/* Runs the write and read phases through backend-specific operations */
+struct bench_backend {
+	const char *name;
+	int (*write)(void *ctx, uint32_t id, const void *data, size_t len);
+	int (*read)(void *ctx, uint32_t id, void *data, size_t len);
+};
+
+static void bench_run(const struct bench_backend *be, void *ctx)
+{
+	uint32_t written_before;
+	uint32_t erases_before;
+	uint64_t total_ns;
+	timing_t start, end;
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	written_before = flash_sim_stat_get("bytes_written");
+	erases_before = flash_sim_stat_get("flash_erase_calls");
+
+	/* Update phase: round-robin updates of a small record set */
+	total_ns = 0;
+	for (uint32_t op = 0; op < BENCH_OPS; op++) {
+		value_fill(op);
+
+		start = timing_counter_get();
+		ret = be->write(ctx, op % BENCH_KEY_COUNT, value_buf, sizeof(value_buf));
+		end = timing_counter_get();
+		zassert_true(ret >= 0, "%s write failed: %d", be->name, ret);
+
+		lat_ns[op] = (uint32_t)timing_cycles_to_ns(timing_cycles_get(&start, &end));
+		total_ns += lat_ns[op];
+	}
+	bench_report(be->name, "write", BENCH_OPS, total_ns);
+	bench_report_wa(be->name,
+			flash_sim_stat_get("bytes_written") - written_before,
+			flash_sim_stat_get("flash_erase_calls") - erases_before,
+			BENCH_OPS * BENCH_VALUE_SIZE);
+
+	/* Read phase */
+	total_ns = 0;
+	for (uint32_t op = 0; op < BENCH_OPS; op++) {
+		start = timing_counter_get();
+		ret = be->read(ctx, op % BENCH_KEY_COUNT, value_buf, sizeof(value_buf));
+		end = timing_counter_get();
+		zassert_true(ret >= 0, "%s read failed: %d", be->name, ret);
+
+		lat_ns[op] = (uint32_t)timing_cycles_to_ns(timing_cycles_get(&start, &end));
+		total_ns += lat_ns[op];
+	}
+	bench_report(be->name, "read", BENCH_OPS, total_ns);
+
+	timing_stop();
+}
+
+static void bench_area_erase(void)
+{
+	const struct flash_area *fa;
+	int ret;
+
+	ret = flash_area_open(BENCH_AREA_ID, &fa);
+	zassert_equal(ret, 0, "flash_area_open() fail: %d", ret);
+
+	ret = flash_area_flatten(fa, 0, fa->fa_size);
+	zassert_equal(ret, 0, "flash_area_flatten() fail: %d", ret);
+
+	flash_area_close(fa);
+}
+
+static size_t bench_sector_size(void)
+{
+	struct flash_pages_info info;
+	int ret;
+
+	ret = flash_get_page_info_by_offs(flash_dev, BENCH_AREA_OFFSET, &info);
+	zassert_equal(ret, 0, "Unable to get page info: %d", ret);
+
+	return info.size;
+}
+
+#ifdef CONFIG_NVS
+static int nvs_bench_write(void *ctx, uint32_t id, const void *data, size_t len)
+{
+	return nvs_write(ctx, (uint16_t)id, data, len);
+}
+
+static int nvs_bench_read(void *ctx, uint32_t id, void *data, size_t len)
+{
+	return nvs_read(ctx, (uint16_t)id, data, len);
+}
+#endif
+
+ZTEST(storage_bench, test_nvs)
+{
+#ifdef CONFIG_NVS
+	static const struct bench_backend be = {
+		.name = "nvs",
+		.write = nvs_bench_write,
+		.read = nvs_bench_read,
+	};
+	static struct nvs_fs fs;
+	int ret;
+
+	fs.flash_device = flash_dev;
+	fs.offset = BENCH_AREA_OFFSET;
+	fs.sector_size = bench_sector_size();
+	fs.sector_count = BENCH_SECTOR_COUNT;
+
+	ret = nvs_mount(&fs);
+	zassert_equal(ret, 0, "nvs_mount() fail: %d", ret);
+
+	bench_run(&be, &fs);
+#else
+	ztest_test_skip();
+#endif
+}
+
+#ifdef CONFIG_ZMS
+static int zms_bench_write(void *ctx, uint32_t id, const void *data, size_t len)
+{
+	return zms_write(ctx, id, data, len);
+}
+
+static int zms_bench_read(void *ctx, uint32_t id, void *data, size_t len)
+{
+	return zms_read(ctx, id, data, len);
+}
+#endif
+
+ZTEST(storage_bench, test_zms)
+{
+#ifdef CONFIG_ZMS
+	static const struct bench_backend be = {
+		.name = "zms",
+		.write = zms_bench_write,
+		.read = zms_bench_read,
+	};
+	static struct zms_fs fs;
+	int ret;
+
+	fs.flash_device = flash_dev;
+	fs.offset = BENCH_AREA_OFFSET;
+	fs.sector_size = bench_sector_size();
+	fs.sector_count = BENCH_SECTOR_COUNT;
+
+	ret = zms_mount(&fs);
+	zassert_equal(ret, 0, "zms_mount() fail: %d", ret);
+
+	bench_run(&be, &fs);
+#else
+	ztest_test_skip();
+#endif
+}
+
+#ifdef CONFIG_FILE_SYSTEM_LITTLEFS
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(bench_lfs);
+
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &bench_lfs,
+	.storage_dev = (void *)BENCH_AREA_ID,
+	.mnt_point = "/lfs",
+};
+
+static int lfs_bench_write(void *ctx, uint32_t id, const void *data, size_t len)
+{
+	struct fs_file_t file;
+	char path[24];
+	int ret;
+	int rc;
+
+	ARG_UNUSED(ctx);
+	snprintk(path, sizeof(path), "/lfs/rec%u", id);
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = fs_write(&file, data, len);
+	rc = fs_close(&file);
+
+	return ret < 0 ? ret : rc;
+}
+
+static int lfs_bench_read(void *ctx, uint32_t id, void *data, size_t len)
+{
+	struct fs_file_t file;
+	char path[24];
+	int ret;
+	int rc;
+
+	ARG_UNUSED(ctx);
+	snprintk(path, sizeof(path), "/lfs/rec%u", id);
+
+	fs_file_t_init(&file);
+	ret = fs_open(&file, path, FS_O_READ);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = fs_read(&file, data, len);
+	rc = fs_close(&file);
+
+	return ret < 0 ? ret : rc;
+}
+#endif
+
+ZTEST(storage_bench, test_littlefs)
+{
+#ifdef CONFIG_FILE_SYSTEM_LITTLEFS
+	static const struct bench_backend be = {
+		.name = "littlefs",
+		.write = lfs_bench_write,
+		.read = lfs_bench_read,
+	};
+	int ret;
+
+	ret = fs_mount(&lfs_mnt);
+	zassert_equal(ret, 0, "fs_mount() fail: %d", ret);
+
+	bench_run(&be, NULL);
+
+	ret = fs_unmount(&lfs_mnt);
+	zassert_equal(ret, 0, "fs_unmount() fail: %d", ret);
+#else
+	ztest_test_skip();
+#endif
+}
+
+static void *setup(void)
+{
+	__ASSERT_NO_MSG(device_is_ready(flash_dev));
+
+	/* Start every backend from clean flash */
+	bench_area_erase();
+
+	return NULL;
+}
+
+ZTEST_SUITE(storage_bench, NULL, setup, NULL, NULL, NULL);
@@ -208,6 +208,81 @@ static int spi_complete_loop(struct spi_dt_spec *spec)
 	return 0;
 }
 
+static int spi_complete_batch(struct spi_dt_spec *spec)
+{
+	const struct spi_buf tx_buf = {
+		.buf = buffer_tx,
+		.len = BUF_SIZE,
+	};
+	const struct spi_buf rx_buf = {
+		.buf = buffer_rx,
+		.len = BUF_SIZE,
+	};
+	const struct spi_buf tx2_buf = {
+		.buf = buffer2_tx,
+		.len = BUF2_SIZE,
+	};
+	const struct spi_buf rx2_buf = {
+		.buf = buffer2_rx,
+		.len = BUF2_SIZE,
+	};
+	const struct spi_buf_set tx = {
+		.buffers = &tx_buf,
+		.count = 1
+	};
+	const struct spi_buf_set rx = {
+		.buffers = &rx_buf,
+		.count = 1
+	};
+	const struct spi_buf_set tx2 = {
+		.buffers = &tx2_buf,
+		.count = 1
+	};
+	const struct spi_buf_set rx2 = {
+		.buffers = &rx2_buf,
+		.count = 1
+	};
+	const struct spi_transfer transfers[] = {
+		{ .tx_bufs = &tx, .rx_bufs = &rx },
+		{ .tx_bufs = &tx2, .rx_bufs = &rx2 },
+	};
+
+	int ret;
+
+	LOG_INF("Start complete batch");
+	memset(buffer_rx, 0, sizeof(buffer_rx));
+	memset(buffer2_rx, 0, sizeof(buffer2_rx));
+
+	ret = spi_transceive_batch_dt(spec, transfers, ARRAY_SIZE(transfers));
+	if (ret) {
+		LOG_ERR("Code %d", ret);
+		zassert_false(ret, "SPI batch transceive failed");
+		return ret;
+	}
+
+	if (memcmp(buffer_tx, buffer_rx, BUF_SIZE)) {
+		to_display_format(buffer_tx, BUF_SIZE, buffer_print_tx);
+		to_display_format(buffer_rx, BUF_SIZE, buffer_print_rx);
+		LOG_ERR("Buffer contents are different: %s", buffer_print_tx);
+		LOG_ERR("                           vs: %s", buffer_print_rx);
+		zassert_false(1, "Buffer contents are different");
+		return -1;
+	}
+
+	if (memcmp(buffer2_tx, buffer2_rx, BUF2_SIZE)) {
+		to_display_format(buffer2_tx, BUF2_SIZE, buffer_print_tx2);
+		to_display_format(buffer2_rx, BUF2_SIZE, buffer_print_rx2);
+		LOG_ERR("Buffer 2 contents are different: %s", buffer_print_tx2);
+		LOG_ERR("                             vs: %s", buffer_print_rx2);
+		zassert_false(1, "Buffer 2 contents are different");
+		return -1;
+	}
+
+	LOG_INF("Passed");
+
+	return 0;
+}
+
 static int spi_null_tx_buf(struct spi_dt_spec *spec)
 {
 	static const uint8_t EXPECTED_NOP_RETURN_BUF[BUF_SIZE] = { 0 };
@@ -746,6 +821,7 @@ ZTEST(spi_loopback, test_spi_loopback)
 
 	if (spi_complete_multiple(&spi_slow) ||
 	    spi_complete_loop(&spi_slow) ||
+	    spi_complete_batch(&spi_slow) ||
 	    spi_null_tx_buf(&spi_slow) ||
 	    spi_rx_half_start(&spi_slow) ||
 	    spi_rx_half_end(&spi_slow) ||
@@ -765,6 +841,7 @@ ZTEST(spi_loopback, test_spi_loopback)
 
 	if (spi_complete_multiple(&spi_fast) ||
 	    spi_complete_loop(&spi_fast) ||
+	    spi_complete_batch(&spi_fast) ||
 	    spi_null_tx_buf(&spi_fast) ||
 	    spi_rx_half_start(&spi_fast) ||
 	    spi_rx_half_end(&spi_fast) ||
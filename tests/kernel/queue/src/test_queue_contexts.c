@@ -527,6 +527,41 @@ ZTEST(queue_api_1cpu, test_queue_multithread_competition)
 	k_thread_priority_set(k_current_get(), old_prio);
 }
 
+#ifdef CONFIG_QUEUE_MPSC_APPEND
+static void tIsr_entry_append_mpsc(const void *p)
+{
+	k_queue_append_mpsc((struct k_queue *)p, (void *)&data[1]);
+}
+
+/**
+ * @brief Verify k_queue_append_mpsc()
+ *
+ * @details Stage items from thread and ISR context.
+ * Staged items must not be visible to k_queue_is_empty()
+ * or k_queue_peek_head() until a get folds them in, and
+ * k_queue_get() must return them in FIFO order.
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @see k_queue_append_mpsc()
+ */
+ZTEST(queue_api, test_queue_append_mpsc)
+{
+	k_queue_init(&queue);
+
+	k_queue_append_mpsc(&queue, (void *)&data[0]);
+	irq_offload(tIsr_entry_append_mpsc, (const void *)&queue);
+
+	/* Staged items are folded in by the next get, not before */
+	zassert_true(k_queue_is_empty(&queue));
+	zassert_is_null(k_queue_peek_head(&queue));
+
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), (void *)&data[0]);
+	zassert_equal(k_queue_get(&queue, K_NO_WAIT), (void *)&data[1]);
+	zassert_is_null(k_queue_get(&queue, K_NO_WAIT));
+}
+#endif /* CONFIG_QUEUE_MPSC_APPEND */
+
 /**
  * @brief Verify k_queue_unique_append()
  *
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#include "_main.h"
+
+ZTEST(hash_map, test_reserve)
+{
+	int ret;
+	size_t n_buckets;
+
+	zassert_true(sys_hashmap_is_empty(&map));
+
+	ret = sys_hashmap_reserve(&map, MANY);
+	if (ret == -ENOSYS) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(ret, "failed to reserve %zu entries: %d", (size_t)MANY, ret);
+	zassert_true(sys_hashmap_is_empty(&map));
+
+	n_buckets = sys_hashmap_num_buckets(&map);
+	zassert_true(n_buckets > 0);
+
+	for (size_t i = 0; i < MANY; ++i) {
+		zassert_equal(1, sys_hashmap_insert(&map, i, i, NULL));
+	}
+
+	/* the reservation should have made rehashing unnecessary */
+	zassert_equal(n_buckets, sys_hashmap_num_buckets(&map));
+
+	for (size_t i = 0; i < MANY; ++i) {
+		zassert_true(sys_hashmap_contains_key(&map, i));
+	}
+}
@@ -1294,5 +1294,91 @@ ZTEST(log_buffer, test_utilization)
 	zassert_true(packet == NULL);
 }
 
+ZTEST(log_buffer, test_claim_batch)
+{
+	struct mpsc_pbuf_buffer buffer;
+	const union mpsc_pbuf_generic *packets[4];
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	size_t cnt;
+
+	init(&buffer, 32, false);
+
+	zassert_equal(mpsc_pbuf_claim_batch(&buffer, packets,
+					    ARRAY_SIZE(packets)), 0);
+
+	for (int i = 0; i < 6; i++) {
+		test_1word.data.data = i;
+		mpsc_pbuf_put_word(&buffer, test_1word.item);
+	}
+
+	cnt = mpsc_pbuf_claim_batch(&buffer, packets, ARRAY_SIZE(packets));
+	zassert_equal(cnt, ARRAY_SIZE(packets));
+
+	for (size_t i = 0; i < cnt; i++) {
+		union test_item *t = (union test_item *)packets[i];
+
+		zassert_equal(t->data.data, i);
+		mpsc_pbuf_free(&buffer, packets[i]);
+	}
+
+	cnt = mpsc_pbuf_claim_batch(&buffer, packets, ARRAY_SIZE(packets));
+	zassert_equal(cnt, 2);
+
+	for (size_t i = 0; i < cnt; i++) {
+		union test_item *t = (union test_item *)packets[i];
+
+		zassert_equal(t->data.data, 4 + i);
+		mpsc_pbuf_free(&buffer, packets[i]);
+	}
+
+	zassert_is_null(mpsc_pbuf_claim(&buffer));
+}
+
+static uint32_t watermark_cnt;
+
+static void watermark(const struct mpsc_pbuf_buffer *buffer)
+{
+	ARG_UNUSED(buffer);
+
+	watermark_cnt++;
+}
+
+ZTEST(log_buffer, test_watermark_notification)
+{
+	struct mpsc_pbuf_buffer buffer;
+	union test_item test_1word = {.data = {.valid = 1, .len = 1 }};
+	union test_item *t;
+	struct mpsc_pbuf_buffer_config config = {
+		.buf = buf32,
+		.size = 32,
+		.notify_drop = drop,
+		.notify_watermark = watermark,
+		.watermark = 4,
+		.get_wlen = get_wlen,
+	};
+
+	watermark_cnt = 0;
+	mpsc_pbuf_init(&buffer, &config);
+
+	/* Notified once when the watermark is crossed, not per packet. */
+	for (int i = 0; i < 6; i++) {
+		mpsc_pbuf_put_word(&buffer, test_1word.item);
+	}
+	zassert_equal(watermark_cnt, 1);
+
+	/* Draining below the watermark re-arms the notification. */
+	for (int i = 0; i < 6; i++) {
+		t = (union test_item *)mpsc_pbuf_claim(&buffer);
+		zassert_true(t);
+		mpsc_pbuf_free(&buffer, &t->item);
+	}
+	zassert_equal(watermark_cnt, 1);
+
+	for (int i = 0; i < 4; i++) {
+		mpsc_pbuf_put_word(&buffer, test_1word.item);
+	}
+	zassert_equal(watermark_cnt, 2);
+}
+
 /*test case main entry*/
 ZTEST_SUITE(log_buffer, NULL, NULL, NULL, NULL, NULL);
@@ -604,6 +604,69 @@ ZTEST(ringbuffer_api, test_ringbuffer_alloc_put)
 	}
 }
 
+ZTEST(ringbuffer_api, test_ringbuffer_claim2)
+{
+	uint8_t outputbuf[RINGBUFFER_SIZE];
+	uint32_t size1, size2;
+	uint8_t *data1, *data2;
+	uint32_t claimed;
+	int err;
+
+	ring_buf_init(&ringbuf_raw, RINGBUFFER_SIZE, ringbuf_raw.buffer);
+
+	/* Empty buffer: the whole capacity comes back as one segment */
+	claimed = ring_buf_put_claim2(&ringbuf_raw, &data1, &size1,
+				      &data2, &size2, RINGBUFFER_SIZE);
+	zassert_equal(claimed, RINGBUFFER_SIZE);
+	zassert_equal(size1, RINGBUFFER_SIZE);
+	zassert_equal(size2, 0U);
+	zassert_is_null(data2);
+
+	err = ring_buf_put_finish(&ringbuf_raw, 0);
+	zassert_equal(err, 0);
+
+	/* Move the indexes near the end so the next claim wraps */
+	claimed = ring_buf_put(&ringbuf_raw, outputbuf, RINGBUFFER_SIZE - 2);
+	zassert_equal(claimed, RINGBUFFER_SIZE - 2);
+	claimed = ring_buf_get(&ringbuf_raw, NULL, RINGBUFFER_SIZE - 2);
+	zassert_equal(claimed, RINGBUFFER_SIZE - 2);
+
+	claimed = ring_buf_put_claim2(&ringbuf_raw, &data1, &size1,
+				      &data2, &size2, RINGBUFFER_SIZE);
+	zassert_equal(claimed, RINGBUFFER_SIZE);
+	zassert_equal(size1, 2U);
+	zassert_equal(size2, RINGBUFFER_SIZE - 2);
+	zassert_not_null(data2);
+
+	for (uint32_t i = 0; i < size1; i++) {
+		data1[i] = (uint8_t)i;
+	}
+	for (uint32_t i = 0; i < size2; i++) {
+		data2[i] = (uint8_t)(size1 + i);
+	}
+
+	err = ring_buf_put_finish(&ringbuf_raw, claimed);
+	zassert_equal(err, 0);
+
+	/* Read back across the wrap as two segments as well */
+	claimed = ring_buf_get_claim2(&ringbuf_raw, &data1, &size1,
+				      &data2, &size2, RINGBUFFER_SIZE);
+	zassert_equal(claimed, RINGBUFFER_SIZE);
+	zassert_equal(size1, 2U);
+	zassert_equal(size2, RINGBUFFER_SIZE - 2);
+
+	for (uint32_t i = 0; i < size1; i++) {
+		zassert_equal(data1[i], (uint8_t)i);
+	}
+	for (uint32_t i = 0; i < size2; i++) {
+		zassert_equal(data2[i], (uint8_t)(size1 + i));
+	}
+
+	err = ring_buf_get_finish(&ringbuf_raw, claimed);
+	zassert_equal(err, 0);
+	zassert_true(ring_buf_is_empty(&ringbuf_raw));
+}
+
 ZTEST(ringbuffer_api, test_byte_put_free)
 {
 	uint8_t indata[] = {1, 2, 3, 4, 5};
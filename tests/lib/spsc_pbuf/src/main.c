@@ -20,7 +20,8 @@
 static bool use_cache(uint32_t flags)
 {
 	return IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_ALWAYS) ||
-		(IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) && (flags & SPSC_PBUF_CACHE));
+		(IS_ENABLED(CONFIG_SPSC_PBUF_CACHE_FLAG) &&
+		 (flags & (SPSC_PBUF_CACHE | SPSC_PBUF_PADDED)));
 }
 
 static void test_spsc_pbuf_flags(uint32_t flags)
@@ -113,6 +114,11 @@ ZTEST(test_spsc_pbuf, test_spsc_pbuf_ut_cache)
 	test_spsc_pbuf_flags(SPSC_PBUF_CACHE);
 }
 
+ZTEST(test_spsc_pbuf, test_spsc_pbuf_ut_padded)
+{
+	test_spsc_pbuf_flags(SPSC_PBUF_PADDED);
+}
+
 static int check_buffer(char *buf, uint16_t len, char exp)
 {
 	for (uint16_t i = 0; i < len; i++) {
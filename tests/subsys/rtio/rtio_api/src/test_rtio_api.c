@@ -163,6 +163,54 @@ ZTEST(rtio_api, test_rtio_chain)
 	}
 }
 
+/**
+ * @brief Test consuming a batch of completions in a single pass
+ */
+void test_rtio_cqe_consume_batch_(struct rtio *r)
+{
+	int res;
+	uint32_t userdata[4] = {0, 1, 2, 3};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqes[4];
+	size_t consumed;
+
+	for (int i = 0; i < 4; i++) {
+		sqe = rtio_sqe_acquire(r);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, iodev_test_chain[i % 2], &userdata[i]);
+		sqe->flags |= RTIO_SQE_CHAINED;
+	}
+
+	/* Clear the last one */
+	sqe->flags = 0;
+
+	res = rtio_submit(r, 4);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	consumed = rtio_cqe_consume_batch(r, cqes, ARRAY_SIZE(cqes));
+	zassert_equal(consumed, 4, "Expected all completions in one batch");
+
+	for (int i = 0; i < 4; i++) {
+		zassert_ok(cqes[i]->result, "Result should be ok");
+		zassert_equal_ptr(cqes[i]->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(r, cqes[i]);
+	}
+
+	consumed = rtio_cqe_consume_batch(r, cqes, ARRAY_SIZE(cqes));
+	zassert_equal(consumed, 0, "Expected an empty completion queue");
+}
+
+ZTEST(rtio_api, test_rtio_cqe_consume_batch)
+{
+	for (int i = 0; i < 2; i++) {
+		rtio_iodev_test_init(iodev_test_chain[i]);
+	}
+
+	for (int i = 0; i < TEST_REPEATS; i++) {
+		test_rtio_cqe_consume_batch_(&r_chain);
+	}
+}
+
 RTIO_DEFINE(r_multi_chain, SQE_POOL_SIZE, CQE_POOL_SIZE);
 
 RTIO_IODEV_TEST_DEFINE(iodev_test_multi0);
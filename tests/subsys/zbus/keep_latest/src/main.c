@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct msg {
+	int x;
+};
+
+ZBUS_CHAN_DEFINE(chan, struct msg, NULL, NULL, ZBUS_OBSERVERS(sub), ZBUS_MSG_INIT(0));
+
+ZBUS_SUBSCRIBER_DEFINE(sub, 2);
+
+ZTEST(keep_latest, test_queue_full_behavior)
+{
+	const struct zbus_channel *recv_chan;
+	struct msg val = {0};
+	struct msg rd = {0};
+
+	/* Default behavior: publications beyond the queue capacity fail */
+	for (int i = 1; i <= 2; i++) {
+		val.x = i;
+		zassert_equal(0, zbus_chan_pub(&chan, &val, K_NO_WAIT));
+	}
+	val.x = 3;
+	zassert_equal(-ENOMSG, zbus_chan_pub(&chan, &val, K_NO_WAIT));
+
+	/* Drain the queue */
+	while (zbus_sub_wait(&sub, &recv_chan, K_NO_WAIT) == 0) {
+	}
+
+	/* Keep-latest: publishers never stall, oldest notifications drop */
+	zassert_equal(0, zbus_obs_set_keep_latest(&sub, true));
+
+	for (int i = 1; i <= 4; i++) {
+		val.x = i;
+		zassert_equal(0, zbus_chan_pub(&chan, &val, K_NO_WAIT));
+	}
+
+	/* Only the two newest notifications remain and the channel holds
+	 * the latest sample.
+	 */
+	zassert_equal(0, zbus_sub_wait(&sub, &recv_chan, K_NO_WAIT));
+	zassert_equal_ptr(&chan, recv_chan);
+	zassert_equal(0, zbus_chan_read(&chan, &rd, K_NO_WAIT));
+	zassert_equal(4, rd.x);
+
+	zassert_equal(0, zbus_sub_wait(&sub, &recv_chan, K_NO_WAIT));
+	zassert_equal(-ENOMSG, zbus_sub_wait(&sub, &recv_chan, K_NO_WAIT));
+
+	zassert_equal(0, zbus_obs_set_keep_latest(&sub, false));
+}
+
+ZTEST_SUITE(keep_latest, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/zbus/zbus.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ztest_assert.h>
+
+struct msg {
+	int x;
+	int y;
+};
+
+ZBUS_CHAN_DEFINE(chan, struct msg, NULL, NULL, ZBUS_OBSERVERS_EMPTY, ZBUS_MSG_INIT(0));
+
+ZTEST(seqlock, test_pub_read_roundtrip)
+{
+	struct msg val = {.x = 13, .y = 31};
+	struct msg rd = {0};
+
+	zassert_equal(0, zbus_chan_pub(&chan, &val, K_NO_WAIT));
+
+	/* Reads do not take the channel semaphore, but must still observe
+	 * a consistent message.
+	 */
+	zassert_equal(0, zbus_chan_read(&chan, &rd, K_NO_WAIT));
+	zassert_equal(val.x, rd.x);
+	zassert_equal(val.y, rd.y);
+}
+
+ZTEST(seqlock, test_read_blocked_by_claim)
+{
+	struct msg *cval;
+	struct msg rd = {0};
+
+	/* While the channel is claimed the message may be mutating, reads
+	 * must fail instead of returning torn data.
+	 */
+	zassert_equal(0, zbus_chan_claim(&chan, K_NO_WAIT));
+	cval = zbus_chan_msg(&chan);
+	cval->x = 1000;
+	cval->y = 2000;
+
+	zassert_equal(-EBUSY, zbus_chan_read(&chan, &rd, K_NO_WAIT));
+	zassert_equal(-EAGAIN, zbus_chan_read(&chan, &rd, K_MSEC(10)));
+
+	zassert_equal(0, zbus_chan_finish(&chan));
+
+	zassert_equal(0, zbus_chan_read(&chan, &rd, K_NO_WAIT));
+	zassert_equal(1000, rd.x);
+	zassert_equal(2000, rd.y);
+}
+
+ZTEST_SUITE(seqlock, NULL, NULL, NULL, NULL, NULL);